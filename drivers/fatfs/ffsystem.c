@@ -13,11 +13,25 @@
 /* Allocate a memory block                                                */
 /*------------------------------------------------------------------------*/
 
+/* Bytes allocated now and at most, for the heap statistics of the
+/  emulator. FatFs allocates from both cores but with the volume locked,
+/  so the counts need no lock of their own. The size of each block is
+/  kept in the 8 bytes before it, which keeps the block aligned.
+*/
+UINT ff_mem_live = 0;
+UINT ff_mem_peak = 0;
+
 void* ff_memalloc (	/* Returns pointer to the allocated memory block (null if not enough core) */
 	UINT msize		/* Number of bytes to allocate */
 )
 {
-	return malloc(msize);	/* Allocate a new memory block with POSIX API */
+	UINT* blk = malloc(msize + 8);	/* Allocate a new memory block with POSIX API */
+
+	if (!blk) return 0;
+	blk[0] = msize;
+	ff_mem_live += msize;
+	if (ff_mem_live > ff_mem_peak) ff_mem_peak = ff_mem_live;
+	return (BYTE*)blk + 8;
 }
 
 
@@ -29,7 +43,12 @@ void ff_memfree (
 	void* mblock	/* Pointer to the memory block to free (nothing to do if null) */
 )
 {
-	free(mblock);	/* Free the memory block with POSIX API */
+	UINT* blk;
+
+	if (!mblock) return;
+	blk = (UINT*)((BYTE*)mblock - 8);
+	ff_mem_live -= blk[0];
+	free(blk);	/* Free the memory block with POSIX API */
 }
 
 #endif
@@ -47,6 +66,7 @@ void ff_memfree (
 */
 
 //const osMutexDef_t Mutex[FF_VOLUMES];	/* Table of CMSIS-RTOS mutex */
+static mutex_t Mutex[FF_VOLUMES];	/* Table of Pico SDK mutex, usable from both cores */
 
 
 int ff_cre_syncobj (	/* 1:Function succeeded, 0:Could not create the sync object */
@@ -54,9 +74,14 @@ int ff_cre_syncobj (	/* 1:Function succeeded, 0:Could not create the sync object
 	FF_SYNC_t* sobj		/* Pointer to return the created sync object */
 )
 {
+	/* Pico SDK */
+	mutex_init(&Mutex[vol]);
+	*sobj = &Mutex[vol];
+	return 1;
+
 	/* Win32 */
-	*sobj = CreateMutex(NULL, FALSE, NULL);
-	return (int)(*sobj != INVALID_HANDLE_VALUE);
+//	*sobj = CreateMutex(NULL, FALSE, NULL);
+//	return (int)(*sobj != INVALID_HANDLE_VALUE);
 
 	/* uITRON */
 //	T_CSEM csem = {TA_TPRI,1,1};
@@ -90,8 +115,11 @@ int ff_del_syncobj (	/* 1:Function succeeded, 0:Could not delete due to an error
 	FF_SYNC_t sobj		/* Sync object tied to the logical drive to be deleted */
 )
 {
+	/* Pico SDK */
+	return 1;
+
 	/* Win32 */
-	return (int)CloseHandle(sobj);
+//	return (int)CloseHandle(sobj);
 
 	/* uITRON */
 //	return (int)(del_sem(sobj) == E_OK);
@@ -121,8 +149,11 @@ int ff_req_grant (	/* 1:Got a grant to access the volume, 0:Could not get a gran
 	FF_SYNC_t sobj	/* Sync object to wait */
 )
 {
+	/* Pico SDK */
+	return (int)mutex_enter_timeout_ms(sobj, FF_FS_TIMEOUT);
+
 	/* Win32 */
-	return (int)(WaitForSingleObject(sobj, FF_FS_TIMEOUT) == WAIT_OBJECT_0);
+//	return (int)(WaitForSingleObject(sobj, FF_FS_TIMEOUT) == WAIT_OBJECT_0);
 
 	/* uITRON */
 //	return (int)(wai_sem(sobj) == E_OK);
@@ -150,8 +181,11 @@ void ff_rel_grant (
 	FF_SYNC_t sobj	/* Sync object to be signaled */
 )
 {
+	/* Pico SDK */
+	mutex_exit(sobj);
+
 	/* Win32 */
-	ReleaseMutex(sobj);
+//	ReleaseMutex(sobj);
 
 	/* uITRON */
 //	sig_sem(sobj);
@@ -1,6 +1,9 @@
 #include "graphics.h"
 #include <string.h>
 
+volatile uint32_t graphics_vsync_count = 0;
+volatile uint32_t graphics_vsync_time = 0;
+
 void draw_text(const char string[TEXTMODE_COLS + 1], uint32_t x, uint32_t y, uint8_t color, uint8_t bgcolor) {
     uint8_t* t_buf = text_buffer + TEXTMODE_COLS * 2 * y + 2 * x;
     for (int xi = TEXTMODE_COLS * 2; xi--;) {
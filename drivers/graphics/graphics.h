@@ -4,6 +4,7 @@ extern "C" {
 
 #include "stdbool.h"
 #include "stdint.h"
+#include "hardware/structs/timer.h"
 
 #ifdef TFT
 #include "st7789.h"
@@ -44,6 +45,16 @@ enum graphics_mode_t {
 // Буффер текстового режима
 extern uint8_t* text_buffer;
 
+// Счётчик кадров видеовыхода и время (мкс) последнего VSYNC
+extern volatile uint32_t graphics_vsync_count;
+extern volatile uint32_t graphics_vsync_time;
+
+// Вызывается драйвером на каждом VSYNC (из прерывания)
+static inline void graphics_vsync_tick(void) {
+    graphics_vsync_time = timer_hw->timerawl;
+    graphics_vsync_count++;
+}
+
 void graphics_init();
 
 void graphics_set_mode(enum graphics_mode_t mode);
@@ -172,6 +172,7 @@ static void __scratch_y("hdmi_driver") dma_handler_HDMI() {
     dma_channel_set_read_addr(dma_chan_ctrl, &DMA_BUF_ADDR[inx_buf_dma & 1], false);
 
     line = line >= 524 ? 0 : line + 1;
+    if (line == 0) graphics_vsync_tick();
 
     if ((line & 1) == 0) return;
 
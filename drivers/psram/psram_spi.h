@@ -95,6 +95,25 @@ typedef struct psram_spi_inst {
 extern psram_spi_inst_t* async_spi_inst;
 #endif
 
+/**
+ * @brief Start a transaction on the PSRAM SPI PIO: CS is asserted, @c out_bits
+ * bits are written, then @c in_bits bits are read and CS is deasserted.
+ *
+ * The PIO program takes both counts as 16-bit values, each from the top of a
+ * FIFO word of its own, so one transaction can move up to 8 KB. The bytes to
+ * write are then to be fed to the FIFO, and the bytes read taken from it.
+ *
+ * @param spi The PSRAM configuration instance returned from psram_spi_init().
+ * @param out_bits Number of bits to write, command and address included.
+ * @param in_bits Number of bits to read after them.
+ */
+__force_inline static void __time_critical_func(pio_spi_begin)(
+        psram_spi_inst_t* spi, const size_t out_bits, const size_t in_bits
+) {
+    pio_sm_put_blocking(spi->pio, spi->sm, (uint32_t) out_bits << 16);
+    pio_sm_put_blocking(spi->pio, spi->sm, (uint32_t) in_bits << 16);
+}
+
 /**
  * @brief Write and read raw data to the PSRAM SPI PIO, driven by the CPU
  * without DMA. This can be used if DMA has not yet been initialized.
@@ -122,6 +141,7 @@ __force_inline static void __time_critical_func(pio_spi_write_read_blocking)(
 #elif defined(PSRAM_SPINLOCK)
     spi->spin_irq_state = spin_lock_blocking(spi->spinlock);
 #endif
+    pio_spi_begin(spi, src_len * 8, dst_len * 8);
     io_rw_8 *txfifo = (io_rw_8 *) &spi->pio->txf[spi->sm];
     while (tx_remain) {
         if (!pio_sm_is_tx_fifo_full(spi->pio, spi->sm)) {
@@ -154,11 +174,15 @@ __force_inline static void __time_critical_func(pio_spi_write_read_blocking)(
  * pio_spi_write_read_dma_blocking() if no data is to be read.
  *
  * @param spi The PSRAM configuration instance returned from psram_spi_init().
- * @param src Pointer to the source data to write.
- * @param src_len Length of the source data in bytes.
+ * @param cmd Pointer to the command and address to write.
+ * @param cmd_len Length of the command and address in bytes.
+ * @param src Pointer to the data to write after them, if any. Set to 0 or NULL
+ * if there is none.
+ * @param src_len Length of the data in bytes. Set to 0 if there is none.
  */
 __force_inline static void __time_critical_func(pio_spi_write_dma_blocking)(
         psram_spi_inst_t* spi,
+        const uint8_t* cmd, const size_t cmd_len,
         const uint8_t* src, const size_t src_len
 ) {
 #ifdef PSRAM_MUTEX
@@ -173,8 +197,13 @@ __force_inline static void __time_critical_func(pio_spi_write_dma_blocking)(
     dma_channel_wait_for_finish_blocking(spi->write_dma_chan);
     dma_channel_wait_for_finish_blocking(spi->read_dma_chan);
 #endif // PSRAM_WAITDMA
-    dma_channel_transfer_from_buffer_now(spi->write_dma_chan, src, src_len);
+    pio_spi_begin(spi, (cmd_len + src_len) * 8, 0);
+    dma_channel_transfer_from_buffer_now(spi->write_dma_chan, cmd, cmd_len);
     dma_channel_wait_for_finish_blocking(spi->write_dma_chan);
+    if (src_len) {
+        dma_channel_transfer_from_buffer_now(spi->write_dma_chan, src, src_len);
+        dma_channel_wait_for_finish_blocking(spi->write_dma_chan);
+    }
 #ifdef PSRAM_MUTEX
     mutex_exit(&spi->mtx);
 #elif defined(PSRAM_SPINLOCK)
@@ -215,6 +244,7 @@ __force_inline static void __time_critical_func(pio_spi_write_read_dma_blocking)
     dma_channel_wait_for_finish_blocking(spi->write_dma_chan);
     dma_channel_wait_for_finish_blocking(spi->read_dma_chan);
 #endif // PSRAM_WAITDMA
+    pio_spi_begin(spi, src_len * 8, dst_len * 8);
     dma_channel_transfer_from_buffer_now(spi->write_dma_chan, src, src_len);
     dma_channel_transfer_to_buffer_now(spi->read_dma_chan, dst, dst_len);
     dma_channel_wait_for_finish_blocking(spi->write_dma_chan);
@@ -255,6 +285,7 @@ __force_inline static void __time_critical_func(pio_spi_write_async)(
     dma_channel_wait_for_finish_blocking(spi->async_dma_chan);
     async_spi_inst = spi;
 
+    pio_spi_begin(spi, src_len * 8, 0);
     dma_channel_transfer_from_buffer_now(spi->async_dma_chan, src, src_len);
 }
 #endif
@@ -300,8 +331,6 @@ int test_psram(psram_spi_inst_t* psram_spi, int increment);
 void psram_spi_uninit(psram_spi_inst_t spi, bool fudge);
 
 static uint8_t write8_command[] = {
-    40,         // 40 bits write
-    0,          // 0 bits read
     0x02u,      // Write command
     0, 0, 0,    // Address
     0           // 8 bits data
@@ -319,10 +348,10 @@ static uint8_t write8_command[] = {
  */
 #if defined(PSRAM_ASYNC)
 __force_inline static void psram_write8_async(psram_spi_inst_t* spi, uint32_t addr, uint8_t val) {
-    write8_command[3] = addr >> 16;
-    write8_command[4] = addr >> 8;
-    write8_command[5] = addr;
-    write8_command[6] = val;
+    write8_command[1] = addr >> 16;
+    write8_command[2] = addr >> 8;
+    write8_command[3] = addr;
+    write8_command[4] = val;
 
     pio_spi_write_async(spi, write8_command, sizeof(write8_command));
 };
@@ -342,18 +371,16 @@ __force_inline static void psram_write8_async(psram_spi_inst_t* spi, uint32_t ad
  * @param val Value to write.
  */
 __force_inline static void psram_write8(psram_spi_inst_t* spi, uint32_t addr, uint8_t val) {
-    write8_command[3] = addr >> 16;
-    write8_command[4] = addr >> 8;
-    write8_command[5] = addr;
-    write8_command[6] = val;
+    write8_command[1] = addr >> 16;
+    write8_command[2] = addr >> 8;
+    write8_command[3] = addr;
+    write8_command[4] = val;
 
-    pio_spi_write_dma_blocking(spi, write8_command, sizeof(write8_command));
+    pio_spi_write_dma_blocking(spi, write8_command, sizeof(write8_command), NULL, 0);
 };
 
 
 static uint8_t read8_command[] = {
-    40,         // 40 bits write
-    8,          // 8 bits read
     0x0bu,      // Fast read command
     0, 0, 0,    // Address
     0           // 8 delay cycles
@@ -371,9 +398,9 @@ static uint8_t read8_command[] = {
  * @return The data at the specified address.
  */
 __force_inline static uint8_t psram_read8(psram_spi_inst_t* spi, uint32_t addr) {
-    read8_command[3] = addr >> 16;
-    read8_command[4] = addr >> 8;
-    read8_command[5] = addr;
+    read8_command[1] = addr >> 16;
+    read8_command[2] = addr >> 8;
+    read8_command[3] = addr;
 
     uint8_t val; 
     pio_spi_write_read_dma_blocking(spi, read8_command, sizeof(read8_command), &val, 1);
@@ -382,8 +409,6 @@ __force_inline static uint8_t psram_read8(psram_spi_inst_t* spi, uint32_t addr)
 
 
 static uint8_t write16_command[] = {
-    48,         // 48 bits write
-    0,          // 0 bits read
     0x02u,      // Write command
     0, 0, 0,    // Address
     0, 0        // 16 bits data
@@ -401,19 +426,17 @@ static uint8_t write16_command[] = {
  * @param val Value to write.
  */
 __force_inline static void psram_write16(psram_spi_inst_t* spi, uint32_t addr, uint16_t val) {
-    write16_command[3] = addr >> 16;
-    write16_command[4] = addr >> 8;
-    write16_command[5] = addr;
-    write16_command[6] = val;
-    write16_command[7] = val >> 8;
+    write16_command[1] = addr >> 16;
+    write16_command[2] = addr >> 8;
+    write16_command[3] = addr;
+    write16_command[4] = val;
+    write16_command[5] = val >> 8;
 
-    pio_spi_write_dma_blocking(spi, write16_command, sizeof(write16_command));
+    pio_spi_write_dma_blocking(spi, write16_command, sizeof(write16_command), NULL, 0);
 };
 
 
 static uint8_t read16_command[] = {
-    40,         // 40 bits write
-    16,         // 16 bits read
     0x0bu,      // Fast read command
     0, 0, 0,    // Address
     0           // 8 delay cycles
@@ -431,9 +454,9 @@ static uint8_t read16_command[] = {
  * @return The data at the specified address.
  */
 __force_inline static uint16_t psram_read16(psram_spi_inst_t* spi, uint32_t addr) {
-    read16_command[3] = addr >> 16;
-    read16_command[4] = addr >> 8;
-    read16_command[5] = addr;
+    read16_command[1] = addr >> 16;
+    read16_command[2] = addr >> 8;
+    read16_command[3] = addr;
 
     uint16_t val; 
     pio_spi_write_read_dma_blocking(spi, read16_command, sizeof(read16_command), (unsigned char*)&val, 2);
@@ -442,8 +465,6 @@ __force_inline static uint16_t psram_read16(psram_spi_inst_t* spi, uint32_t addr
 
 
 static uint8_t write32_command[] = {
-    64,         // 64 bits write
-    0,          // 0 bits read
     0x02u,      // Write command
     0, 0, 0,    // Address
     0, 0, 0, 0  // 32 bits data
@@ -462,15 +483,15 @@ static uint8_t write32_command[] = {
  */
 __force_inline static void psram_write32(psram_spi_inst_t* spi, uint32_t addr, uint32_t val) {
     // Break the address into three bytes and send read command
-    write32_command[3] = addr >> 16;
-    write32_command[4] = addr >> 8;
-    write32_command[5] = addr;
-    write32_command[6] = val;
-    write32_command[7] = val >> 8;
-    write32_command[8] = val >> 16;
-    write32_command[9] = val >> 24;
-
-    pio_spi_write_dma_blocking(spi, write32_command, sizeof(write32_command));
+    write32_command[1] = addr >> 16;
+    write32_command[2] = addr >> 8;
+    write32_command[3] = addr;
+    write32_command[4] = val;
+    write32_command[5] = val >> 8;
+    write32_command[6] = val >> 16;
+    write32_command[7] = val >> 24;
+
+    pio_spi_write_dma_blocking(spi, write32_command, sizeof(write32_command), NULL, 0);
 };
 
 
@@ -487,21 +508,19 @@ __force_inline static void psram_write32(psram_spi_inst_t* spi, uint32_t addr, u
  */
 __force_inline static void psram_write32_async(psram_spi_inst_t* spi, uint32_t addr, uint32_t val) {
     // Break the address into three bytes and send read command
-    write32_command[3] = addr >> 16;
-    write32_command[4] = addr >> 8;
-    write32_command[5] = addr;
-    write32_command[6] = val;
-    write32_command[7] = val >> 8;
-    write32_command[8] = val >> 16;
-    write32_command[9] = val >> 24;
+    write32_command[1] = addr >> 16;
+    write32_command[2] = addr >> 8;
+    write32_command[3] = addr;
+    write32_command[4] = val;
+    write32_command[5] = val >> 8;
+    write32_command[6] = val >> 16;
+    write32_command[7] = val >> 24;
 
     pio_spi_write_async(spi, write32_command, sizeof(write32_command));
 };
 
 
 static uint8_t read32_command[] = {
-    40,         // 40 bits write
-    32,         // 32 bits read
     0x0bu,      // Fast read command
     0, 0, 0,    // Address
     0           // 8 delay cycles
@@ -519,9 +538,9 @@ static uint8_t read32_command[] = {
  * @return The data at the specified address.
  */
 __force_inline static uint32_t psram_read32(psram_spi_inst_t* spi, uint32_t addr) {
-    read32_command[3] = addr >> 16;
-    read32_command[4] = addr >> 8;
-    read32_command[5] = addr;
+    read32_command[1] = addr >> 16;
+    read32_command[2] = addr >> 8;
+    read32_command[3] = addr;
 
     uint32_t val;
     pio_spi_write_read_dma_blocking(spi, read32_command, sizeof(read32_command), (unsigned char*)&val, 4);
@@ -530,8 +549,6 @@ __force_inline static uint32_t psram_read32(psram_spi_inst_t* spi, uint32_t addr
 
 
 static uint8_t write_command[] = {
-    0,          // n bits write
-    0,          // 0 bits read
     0x02u,      // Fast write command
     0, 0, 0     // Address
 };
@@ -547,19 +564,15 @@ static uint8_t write_command[] = {
  */
 __force_inline static void psram_write(psram_spi_inst_t* spi, const uint32_t addr, const uint8_t* src, const size_t count) {
     // Break the address into three bytes and send read command
-    write_command[0] = (4 + count) * 8;
-    write_command[3] = addr >> 16;
-    write_command[4] = addr >> 8;
-    write_command[5] = addr;
+    write_command[1] = addr >> 16;
+    write_command[2] = addr >> 8;
+    write_command[3] = addr;
 
-    pio_spi_write_dma_blocking(spi, write_command, sizeof(write_command));
-    pio_spi_write_dma_blocking(spi, src, count);
+    pio_spi_write_dma_blocking(spi, write_command, sizeof(write_command), src, count);
 };
 
 
 static uint8_t read_command[] = {
-    40,         // 40 bits write
-    0,          // n bits read
     0x0bu,      // Fast read command
     0, 0, 0,    // Address
     0           // 8 delay cycles
@@ -575,18 +588,15 @@ static uint8_t read_command[] = {
  * @param count Number of bytes to read.
  */
 __force_inline static void psram_read(psram_spi_inst_t* spi, const uint32_t addr, uint8_t* dst, const size_t count) {
-    read_command[1] = count * 8;
-    read_command[3] = addr >> 16;
-    read_command[4] = addr >> 8;
-    read_command[5] = addr;
+    read_command[1] = addr >> 16;
+    read_command[2] = addr >> 8;
+    read_command[3] = addr;
 
     pio_spi_write_read_dma_blocking(spi, read_command, sizeof(read_command), dst, count);
 };
 
 
-static uint8_t write_async_fast_command[134] = {
-    0,          // n bits write
-    0,          // 0 bits read
+static uint8_t write_async_fast_command[132] = {
     0x02u      // Fast write command
 };
 /**
@@ -599,22 +609,28 @@ static uint8_t write_async_fast_command[134] = {
  * @param count Number of bytes to write.
  */
 __force_inline static void psram_write_async_fast(psram_spi_inst_t* spi, uint32_t addr, uint8_t* val, const size_t count) {
-    write_async_fast_command[0] = (4 + count) * 8;
-    write_async_fast_command[3] = addr >> 16;
-    write_async_fast_command[4] = addr >> 8;
-    write_async_fast_command[5] = addr;
+    write_async_fast_command[1] = addr >> 16;
+    write_async_fast_command[2] = addr >> 8;
+    write_async_fast_command[3] = addr;
 
-    memcpy(write_async_fast_command + 6, val, count);
+    memcpy(write_async_fast_command + 4, val, count);
 
-    pio_spi_write_async(spi, write_async_fast_command, 6 + count);
+    pio_spi_write_async(spi, write_async_fast_command, 4 + count);
 };
 
+extern bool PSRAM_AVAILABLE;
+// Size of the chip in bytes, found by init_psram(); the emulator lays out
+// its use of PSRAM from the top down (see src/blkcache.h) and needs 2 MB.
+extern uint32_t PSRAM_SIZE;
+
 void init_psram();
 void psram_cleanup();
 void write8psram(uint32_t addr32, uint8_t v);
 void write16psram(uint32_t addr32, uint16_t v);
 uint8_t read8psram(uint32_t addr32);
 uint16_t read16psram(uint32_t addr32);
+void writepsram(uint32_t addr32, const uint8_t* src, size_t len);
+void readpsram(uint32_t addr32, uint8_t* dst, size_t len);
 
 #ifdef __cplusplus
 }
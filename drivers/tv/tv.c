@@ -178,6 +178,7 @@ static void __scratch_x("tv_main_loop") main_video_loopTV() {
         if (line_active == v_mode.N_lines) {
             line_active = 0;
             frame_i++;
+            graphics_vsync_tick();
             input_buffer = graphics_buffer.data;
         }
 
@@ -80,6 +80,7 @@ void __time_critical_func() dma_handler_VGA() {
     if (screen_line == N_lines_total) {
         screen_line = 0;
         frame_number++;
+        graphics_vsync_tick();
         input_buffer = graphics_buffer;
     }
 
@@ -79,25 +79,25 @@ int AF80_palette[16];
 static void update_d6(void)
 {
 	if (!not_enable_2k_character_ram) {
-		memcpy(MEMORY_mem + 0xd600, af80_screen + (video_bank_select<<7), 0x80);
-		memcpy(MEMORY_mem + 0xd680, af80_screen + (video_bank_select<<7), 0x80);
+		MEMORY_dCopyToMem(af80_screen + (video_bank_select<<7), 0xd600, 0x80);
+		MEMORY_dCopyToMem(af80_screen + (video_bank_select<<7), 0xd680, 0x80);
 	}
 	else if (!not_enable_2k_attribute_ram) {
-		memcpy(MEMORY_mem + 0xd600, af80_attrib + (video_bank_select<<7), 0x80);
-		memcpy(MEMORY_mem + 0xd680, af80_attrib + (video_bank_select<<7), 0x80);
+		MEMORY_dCopyToMem(af80_attrib + (video_bank_select<<7), 0xd600, 0x80);
+		MEMORY_dCopyToMem(af80_attrib + (video_bank_select<<7), 0xd680, 0x80);
 	}
 	else if (not_enable_crtc_registers) {
-		memset(MEMORY_mem + 0xd600, 0xff, 0x100);
+		MEMORY_dFillMem(0xd600, 0xff, 0x100);
 	}
 }
 
 static void update_d5(void)
 {
 	if (not_rom_output_enable) {
-		memset(MEMORY_mem + 0xd500, 0xff, 0x100);
+		MEMORY_dFillMem(0xd500, 0xff, 0x100);
 	}
 	else {
-		memcpy(MEMORY_mem + 0xd500, af80_rom + (rom_bank_select<<8), 0x100);
+		MEMORY_dCopyToMem(af80_rom + (rom_bank_select<<8), 0xd500, 0x100);
 	}
 }
 
@@ -105,12 +105,12 @@ static void update_8000_9fff(void)
 {
 	if (not_right_cartridge_rd4_control) return;
 	if (not_rom_output_enable) {
-		memset(MEMORY_mem + 0x8000, 0xff, 0x2000);
+		MEMORY_dFillMem(0x8000, 0xff, 0x2000);
 	}
 	else {
 		int i;
 		for (i=0; i<32; i++) {
-		memcpy(MEMORY_mem + 0x8000 + (i<<8), af80_rom + (rom_bank_select<<8), 0x100);
+		MEMORY_dCopyToMem(af80_rom + (rom_bank_select<<8), 0x8000 + (i<<8), 0x100);
 		}
 	}
 }
@@ -140,7 +140,7 @@ int AF80_Initialise(int *argc, char *argv[])
 		Log_print("Austin Franklin 80 enabled");
 		af80_rom = (UBYTE *)Util_malloc(0x1000, "AF80_Initialise af80_rom");
 		if (!Atari800_LoadImage(af80_rom_filename, af80_rom, 0x1000)) {
-			free(af80_rom);
+			Util_free(af80_rom);
 			af80_rom = NULL;
 			AF80_enabled = FALSE;
 			Log_print("Couldn't load Austin Franklin ROM image");
@@ -151,8 +151,8 @@ int AF80_Initialise(int *argc, char *argv[])
 		}
 		af80_charset = (UBYTE *)Util_malloc(0x1000, "AF80_Initialise af80_charset");
 		if (!Atari800_LoadImage(af80_charset_filename, af80_charset, 0x1000)) {
-			free(af80_charset);
-			free(af80_rom);
+			Util_free(af80_charset);
+			Util_free(af80_rom);
 			af80_charset = af80_rom = NULL;
 			AF80_enabled = FALSE;
 			Log_print("Couldn't load Austin Franklin charset image");
@@ -178,10 +178,10 @@ int AF80_Initialise(int *argc, char *argv[])
 
 void AF80_Exit(void)
 {
-	free(af80_screen);
-	free(af80_attrib);
-	free(af80_charset);
-	free(af80_rom);
+	Util_free(af80_screen);
+	Util_free(af80_attrib);
+	Util_free(af80_charset);
+	Util_free(af80_rom);
 	af80_screen = af80_attrib = af80_charset = af80_rom = NULL;
 }
 
@@ -36,6 +36,7 @@
 #include "memory.h"
 #include "platform.h"
 #include "pokey.h"
+#include "telemetry.h"
 #include "util.h"
 #if !defined(BASIC) && !defined(CURSES_BASIC)
 #include "input.h"
@@ -48,6 +49,21 @@
 #include "cycle_map.h"
 #endif
 
+#ifdef TELEMETRY
+/* ANTIC_Frame interleaves the CPU and GTIA with drawing; charge their time
+   to their own phases. */
+#define CPU_GO(limit) do { \
+		int telemetry_prev = TELEMETRY_Switch(TELEMETRY_CPU); \
+		(CPU_GO)(limit); \
+		TELEMETRY_Switch(telemetry_prev); \
+	} while (0)
+#define GTIA_NewPmScanline() do { \
+		int telemetry_prev = TELEMETRY_Switch(TELEMETRY_GTIA); \
+		(GTIA_NewPmScanline)(); \
+		TELEMETRY_Switch(telemetry_prev); \
+	} while (0)
+#endif /* TELEMETRY */
+
 #define LCHOP 3			/* do not build leftmost 0..3 characters in wide mode */
 #define RCHOP 3			/* do not build rightmost 0..3 characters in wide mode */
 
@@ -2598,6 +2614,131 @@ static void draw_antic_f_gtia_bug(int nchars, const UBYTE *antic_memptr, UWORD *
 	do_border();
 }
 
+/* PMG-free kernels ---------------------------------------------------------
+
+   Most mode lines have no players or missiles on them (GTIA_pm_dirty is
+   FALSE after GTIA_NewPmScanline). For such lines ANTIC_Frame calls the
+   variants below instead of the draw_antic_table[0] ones. They are the same
+   loops without the per-character GTIA_pm_scanline test, the PMG merge and
+   the collision updates. t_pm_scanline_ptr is ignored. */
+
+static void do_border_nopm(void)
+{
+	int kk;
+	ULONG *l_ptr = (ULONG *) &scrn_ptr[LBORDER_START];
+	ULONG background = ANTIC_lookup_gtia9[0];
+	/* left border */
+	for (kk = left_border_chars; kk; kk--) {
+		WRITE_VIDEO_LONG(l_ptr++, background);
+		WRITE_VIDEO_LONG(l_ptr++, background);
+	}
+	/* right border */
+	l_ptr = (ULONG *) &scrn_ptr[right_border_start];
+	while (l_ptr < (ULONG *) &scrn_ptr[RBORDER_END]) {
+		WRITE_VIDEO_LONG(l_ptr++, background);
+		WRITE_VIDEO_LONG(l_ptr++, background);
+	}
+}
+
+#define DRAW_HIRES_NOPM(data) \
+	if (data) {\
+		WRITE_VIDEO(ptr++, hires_norm(data & 0xc0));\
+		WRITE_VIDEO(ptr++, hires_norm(data & 0x30));\
+		WRITE_VIDEO(ptr++, hires_norm(data & 0x0c));\
+		WRITE_VIDEO(ptr++, hires_norm((data & 0x03) << 2));\
+	}\
+	else\
+		DRAW_BACKGROUND(C_PF2)
+
+#define DRAW_LORES_NOPM(lookup, data) \
+	if (data) {\
+		WRITE_VIDEO(ptr++, lookup[data & 0xc0]);\
+		WRITE_VIDEO(ptr++, lookup[data & 0x30]);\
+		WRITE_VIDEO(ptr++, lookup[data & 0x0c]);\
+		WRITE_VIDEO(ptr++, lookup[data & 0x03]);\
+	}\
+	else\
+		DRAW_BACKGROUND(C_BAK)
+
+static void draw_antic_2_nopm(int nchars, const UBYTE *antic_memptr, UWORD *ptr, const ULONG *t_pm_scanline_ptr)
+{
+	INIT_BACKGROUND_6
+	INIT_ANTIC_2
+	INIT_HIRES
+
+	CHAR_LOOP_BEGIN
+		UBYTE screendata = *antic_memptr++;
+		int chdata;
+
+		GET_CHDATA_ANTIC_2
+		DRAW_HIRES_NOPM(chdata)
+	CHAR_LOOP_END
+	do_border_nopm();
+}
+
+static void draw_antic_4_nopm(int nchars, const UBYTE *antic_memptr, UWORD *ptr, const ULONG *t_pm_scanline_ptr)
+{
+	INIT_BACKGROUND_8
+#ifdef PAGED_MEM
+	UWORD t_chbase = ((anticmode == 4 ? dctr : dctr >> 1) ^ chbase_20) & 0xfc07;
+#else
+	const UBYTE *chptr;
+	if (ANTIC_xe_ptr != NULL && chbase_20 < 0x8000 && chbase_20 >= 0x4000)
+		chptr = ANTIC_xe_ptr + (((anticmode == 4 ? dctr : dctr >> 1) ^ chbase_20) & 0x3c07);
+	else
+		chptr = MEMORY_mem + (((anticmode == 4 ? dctr : dctr >> 1) ^ chbase_20) & 0xfc07);
+#endif
+
+	ADD_FONT_CYCLES;
+	lookup2[0x0f] = lookup2[0x00] = ANTIC_cl[C_BAK];
+	lookup2[0x4f] = lookup2[0x1f] = lookup2[0x13] =
+	lookup2[0x40] = lookup2[0x10] = lookup2[0x04] = lookup2[0x01] = ANTIC_cl[C_PF0];
+	lookup2[0x8f] = lookup2[0x2f] = lookup2[0x17] = lookup2[0x11] =
+	lookup2[0x80] = lookup2[0x20] = lookup2[0x08] = lookup2[0x02] = ANTIC_cl[C_PF1];
+	lookup2[0xc0] = lookup2[0x30] = lookup2[0x0c] = lookup2[0x03] = ANTIC_cl[C_PF2];
+	lookup2[0xcf] = lookup2[0x3f] = lookup2[0x1b] = lookup2[0x12] = ANTIC_cl[C_PF3];
+
+	CHAR_LOOP_BEGIN
+		UBYTE screendata = *antic_memptr++;
+		const UWORD *lookup = screendata & 0x80 ? lookup2 + 0xf : lookup2;
+		UBYTE chdata;
+#ifdef PAGED_MEM
+		chdata = MEMORY_dGetByte(t_chbase + ((UWORD) (screendata & 0x7f) << 3));
+#else
+		chdata = chptr[(screendata & 0x7f) << 3];
+#endif
+		DRAW_LORES_NOPM(lookup, chdata)
+	CHAR_LOOP_END
+	do_border_nopm();
+}
+
+static void draw_antic_e_nopm(int nchars, const UBYTE *antic_memptr, UWORD *ptr, const ULONG *t_pm_scanline_ptr)
+{
+	INIT_BACKGROUND_8
+	lookup2[0x00] = ANTIC_cl[C_BAK];
+	lookup2[0x40] = lookup2[0x10] = lookup2[0x04] = lookup2[0x01] = ANTIC_cl[C_PF0];
+	lookup2[0x80] = lookup2[0x20] = lookup2[0x08] = lookup2[0x02] = ANTIC_cl[C_PF1];
+	lookup2[0xc0] = lookup2[0x30] = lookup2[0x0c] = lookup2[0x03] = ANTIC_cl[C_PF2];
+
+	CHAR_LOOP_BEGIN
+		UBYTE screendata = *antic_memptr++;
+		DRAW_LORES_NOPM(lookup2, screendata)
+	CHAR_LOOP_END
+	do_border_nopm();
+}
+
+static void draw_antic_f_nopm(int nchars, const UBYTE *antic_memptr, UWORD *ptr, const ULONG *t_pm_scanline_ptr)
+{
+	INIT_BACKGROUND_6
+	INIT_HIRES
+
+	CHAR_LOOP_BEGIN
+		int screendata = *antic_memptr++;
+		DRAW_HIRES_NOPM(screendata)
+	CHAR_LOOP_END
+	do_border_nopm();
+}
+
 /* pointer to a function that draws a single line of graphics */
 typedef void (*draw_antic_function)(int nchars, const UBYTE *antic_memptr, UWORD *ptr, const ULONG *t_pm_scanline_ptr);
 
@@ -2624,6 +2765,14 @@ static draw_antic_function draw_antic_table[4][16] = {
 		draw_antic_8_gtia11,	draw_antic_9_gtia11,	draw_antic_a_gtia11,	draw_antic_9_gtia11,
 		draw_antic_9_gtia11,	draw_antic_e_gtia11,	draw_antic_e_gtia11,	draw_antic_f_gtia11}};
 
+/* PMG-free variants of draw_antic_table[0], NULL where a mode has none.
+   Used only when draw_antic_ptr == draw_antic_table[0][anticmode]. */
+static draw_antic_function draw_antic_nopm_table[16] = {
+		NULL,			NULL,			draw_antic_2_nopm,	draw_antic_2_nopm,
+		draw_antic_4_nopm,	draw_antic_4_nopm,	NULL,			NULL,
+		NULL,			NULL,			NULL,			NULL,
+		NULL,			draw_antic_e_nopm,	draw_antic_e_nopm,	draw_antic_f_nopm};
+
 /* pointer to current GTIA/ANTIC mode routine */
 static draw_antic_function draw_antic_ptr = draw_antic_8;
 #ifdef NEW_CYCLE_EXACT
@@ -2669,9 +2818,15 @@ void ANTIC_UpdateArtifacting(void)
 	if (ANTIC_artif_mode == 0) {
 		draw_antic_table[0][2] = draw_antic_table[0][3] = draw_antic_2;
 		draw_antic_table[0][0xf] = draw_antic_f;
+		draw_antic_nopm_table[2] = draw_antic_nopm_table[3] = draw_antic_2_nopm;
+		draw_antic_nopm_table[0xf] = draw_antic_f_nopm;
 		return;
 	}
 
+	/* Artifacting kernels have no PMG-free variants. */
+	draw_antic_nopm_table[2] = draw_antic_nopm_table[3] = NULL;
+	draw_antic_nopm_table[0xf] = NULL;
+
 #ifndef USE_COLOUR_TRANSLATION_TABLE
 	if (ANTIC_artif_new) {
 		static UWORD new_art_colour_table[4][2] = {
@@ -3135,10 +3290,18 @@ void ANTIC_Frame(int draw_display)
 				ANTIC_xpos -= extra_cycles[md];
 		}
 
-		draw_antic_ptr(chars_displayed[md],
-			antic_memory + ANTIC_margin + ch_offset[md],
-			scrn_ptr + x_min[md],
-			(ULONG *) &GTIA_pm_scanline[x_min[md]]);
+		{
+			/* Pick the kernel once per mode line: lines without PMG
+			   use the PMG-free variant if the mode has one. */
+			draw_antic_function draw_line = draw_antic_ptr;
+			if (!GTIA_pm_dirty && draw_line == draw_antic_table[0][anticmode]
+			    && draw_antic_nopm_table[anticmode] != NULL)
+				draw_line = draw_antic_nopm_table[anticmode];
+			draw_line(chars_displayed[md],
+				antic_memory + ANTIC_margin + ch_offset[md],
+				scrn_ptr + x_min[md],
+				(ULONG *) &GTIA_pm_scanline[x_min[md]]);
+		}
 
 		GOEOL;
 #endif /* NEW_CYCLE_EXACT */
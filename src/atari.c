@@ -62,6 +62,8 @@
 #include "artifact.h"
 #include "atari.h"
 #include "binload.h"
+#include "blkcache.h"
+#include "bootsnap.h"
 #include "cartridge.h"
 #include "cassette.h"
 #include "cfg.h"
@@ -79,13 +81,17 @@
 #ifdef POKEYREC
 #include "pokeyrec.h"
 #endif
+#include "pacing.h"
 #include "pia.h"
 #include "platform.h"
 #include "pokey.h"
+#include "region.h"
+#include "sramtab.h"
 #include "rtime.h"
 #include "pbi.h"
 #include "sio.h"
 #include "sysrom.h"
+#include "telemetry.h"
 #include "util.h"
 #if !defined(BASIC) && !defined(CURSES_BASIC)
 #include "colours.h"
@@ -277,6 +283,8 @@ void Atari800_Coldstart(void)
 		BIT3_Reset();
 	}
 #endif
+	/* restore the rest of the cold start, or have it saved */
+	BOOTSNAP_Coldstart();
 }
 
 int Atari800_LoadImage(const char *filename, UBYTE *buffer, int nbytes) {
@@ -783,6 +791,11 @@ int Atari800_Initialise(int *argc, char *argv[])
 		|| !Colours_Initialise(argc, argv)
 		|| !ARTIFACT_Initialise(argc, argv)
 #endif
+		|| !SRAMTAB_Initialise(argc, argv)
+		/* the regions leave the heap the block cache takes at its sizes */
+		|| !BLKCACHE_Initialise(argc, argv)
+		|| !REGION_Initialise(argc, argv)
+		|| !BOOTSNAP_Initialise(argc, argv)
 		|| !Devices_Initialise(argc, argv)
 		|| !RTIME_Initialise(argc, argv)
 #ifdef IDE
@@ -1009,6 +1022,9 @@ int Atari800_Exit(int run_monitor)
 			sums[0], sums[1], sums[2], sums[3], sums[4], sums[5]);
 	}
 #endif /* STAT_UNALIGNED_WORDS */
+#ifdef SRAMTAB_STATS
+	SRAMTAB_Report();
+#endif
 	restart = PLATFORM_Exit(run_monitor);
 #ifdef CTRL_C_HANDLER
 	/* If a user pressed Ctrl+C in the monitor, avoid immediate return to it. */
@@ -1052,6 +1068,7 @@ int Atari800_Exit(int run_monitor)
 		POKEYREC_Exit();
 #endif
 		Devices_Exit();
+		BLKCACHE_Exit();
 #ifdef R_IO_DEVICE
 		RDevice_Exit(); /* R: Device cleanup */
 #endif
@@ -1290,8 +1307,6 @@ void Atari800_Frame(void)
 {
 #ifndef BASIC
 	static int refresh_counter = 0;
-	static int frame_timer_start = 0;
-	if (!frame_timer_start) frame_timer_start = time_us_64();
 #ifdef CTRL_C_HANDLER
 	if (sigint_flag) {
 		sigint_flag = FALSE;
@@ -1351,12 +1366,14 @@ void Atari800_Frame(void)
 #ifndef BASIC
 	INPUT_Frame();
 #endif
+	TELEMETRY_Switch(TELEMETRY_GTIA);
 	GTIA_Frame();
+	TELEMETRY_Switch(TELEMETRY_ANTIC);
 
 #ifdef BASIC
 	basic_frame();
 #else /* BASIC */
-	if (++refresh_counter >= Atari800_refresh_rate) {
+	if (++refresh_counter >= Atari800_refresh_rate + PACING_extra_skip) {
 		refresh_counter = 0;
 #ifdef USE_CURSES
 		curses_clear_screen();
@@ -1365,10 +1382,14 @@ void Atari800_Frame(void)
 		basic_frame();
 #else
 		ANTIC_Frame(TRUE);
+		TELEMETRY_Switch(TELEMETRY_PRESENT);
 		INPUT_DrawMousePointer();
 		Screen_DrawAtariSpeed(Util_time());
 		Screen_DrawDiskLED();
 		Screen_Draw1200LED();
+#ifdef TELEMETRY
+		Screen_DrawFrameTimes();
+#endif
 #endif /* CURSES_BASIC */
 #ifdef DONT_DISPLAY
 		Atari800_display_screen = FALSE;
@@ -1385,6 +1406,7 @@ void Atari800_Frame(void)
 		Atari800_display_screen = FALSE;
 	}
 #endif /* BASIC */
+	TELEMETRY_Switch(TELEMETRY_SOUND);
 	POKEY_Frame();
 #ifdef VIDEO_RECORDING
 	File_Export_WriteVideo();
@@ -1397,14 +1419,8 @@ void Atari800_Frame(void)
 	Screen_DrawMultimediaStats();
 #endif
 	Atari800_nframes++;
-    if (!Atari800_turbo) { // Тормозилка
-		static frame_cnt = 0;
-        if (++frame_cnt == (Atari800_tv_mode == Atari800_TV_PAL ? 5 : 6)) {
-		    while (time_us_64() - frame_timer_start < (Atari800_tv_mode == Atari800_TV_PAL ? 20000*6 : 16666*6)); // 60 Hz
-            frame_timer_start = time_us_64();
-            frame_cnt = 0;
-        }
-    }
+	TELEMETRY_Switch(TELEMETRY_OTHER);
+	/* real-time pacing is done by the host loop, see pacing.h */
 #ifndef LIBATARI800
 #ifdef BENCHMARK
 	if (Atari800_nframes >= BENCHMARK) {
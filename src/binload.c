@@ -23,6 +23,9 @@
 */
 
 #include "config.h"
+#include <stdlib.h>
+#include <string.h>
+#include <pico/time.h>
 #include "atari.h"
 #include "binload.h"
 #include "cpu.h"
@@ -31,6 +34,7 @@
 #include "log.h"
 #include "memory.h"
 #include "sio.h"
+#include "util.h"
 
 int BINLOAD_start_binloading = FALSE;
 int BINLOAD_loading_basic = 0;
@@ -52,6 +56,28 @@ static int init2e3 = FALSE;
 static int segfinished = TRUE;
 int BINLOAD_pause_loading;
 
+BINLOAD_stats_t BINLOAD_stats;
+
+/* Segment of a DOS file: LENGTH bytes at file offset OFFSET go to FROM.
+   Only the last segment of a file can be shorter than its header says. */
+typedef struct {
+	ULONG offset;
+	ULONG length;
+	UWORD from;
+	UBYTE truncated;
+} segment_t;
+
+/* Segment index, built when the file is opened so that the whole file is
+   checked before the reboot and loader_cont only copies.  Files with more
+   segments than this are read header by header as they load. */
+#define MAX_INDEXED_SEGMENTS 512
+static segment_t *segments = NULL;
+static int n_segments;
+static int next_index;
+static int start_frame;
+
+static void run_program(int call_init);
+
 /* Read a word from file */
 static int read_word(void) {
 	if (!BINLOAD_bin_file_open) {
@@ -60,20 +86,218 @@ static int read_word(void) {
 	}
 	UBYTE buf[2];
 	UINT br;
-	if (f_read(&BINLOAD_bin_file, buf, 2, &br) != FR_OK) {
-		f_close(&BINLOAD_bin_file);
-		BINLOAD_bin_file_open = FALSE;
+	if (f_read(&BINLOAD_bin_file, buf, 2, &br) != FR_OK || br != 2) {
 		if (BINLOAD_start_binloading) {
+			f_close(&BINLOAD_bin_file);
+			BINLOAD_bin_file_open = FALSE;
 			BINLOAD_start_binloading = FALSE;
 			Log_print("binload: not valid BIN file");
 			return -1;
 		}
-		CPU_regPC = MEMORY_dGetWordAligned(0x2e0);
+		run_program(FALSE);
 		return -1;
 	}
 	return buf[0] + (buf[1] << 8);
 }
 
+/* Reads the header of the next segment.  Returns FALSE at the end of the
+   file. */
+static int read_header(segment_t *seg)
+{
+	UBYTE buf[4];
+	UINT br;
+	ULONG size;
+	ULONG left;
+	do {
+		if (f_read(&BINLOAD_bin_file, buf, 2, &br) != FR_OK || br != 2)
+			return FALSE;
+	} while (buf[0] == 0xff && buf[1] == 0xff);
+	if (f_read(&BINLOAD_bin_file, buf + 2, 2, &br) != FR_OK || br != 2)
+		return FALSE;
+	seg->from = (UWORD) (buf[0] + (buf[1] << 8));
+	size = (UWORD) (buf[2] + (buf[3] << 8) - seg->from) + 1;
+	seg->offset = (ULONG) f_tell(&BINLOAD_bin_file);
+	left = (ULONG) f_size(&BINLOAD_bin_file) - seg->offset;
+	seg->length = size < left ? size : left;
+	seg->truncated = seg->length < size;
+	return TRUE;
+}
+
+static void free_index(void)
+{
+	Util_free(segments);
+	segments = NULL;
+	n_segments = 0;
+}
+
+/* The index as build_index allocates it, before it is cut to size. */
+size_t BINLOAD_HeapSize(void)
+{
+	return MAX_INDEXED_SEGMENTS * sizeof(segment_t);
+}
+
+/* Indexes the segments from the current position of the file on and
+   returns their number; the index is dropped if it would be too big. */
+static int build_index(void)
+{
+	FSIZE_t start = f_tell(&BINLOAD_bin_file);
+	segment_t seg;
+	int count = 0;
+	free_index();
+	segments = (segment_t *) Util_malloc(MAX_INDEXED_SEGMENTS * sizeof(segment_t), "binload_index");
+	while (read_header(&seg)) {
+		if (count < MAX_INDEXED_SEGMENTS)
+			segments[count] = seg;
+		count++;
+		if (seg.truncated)
+			break;
+		f_lseek(&BINLOAD_bin_file, seg.offset + seg.length);
+	}
+	if (count <= MAX_INDEXED_SEGMENTS) {
+		n_segments = count;
+		segments = (segment_t *) Util_realloc(segments, (count > 0 ? count : 1) * sizeof(segment_t), "binload_index");
+	}
+	else
+		free_index();
+	next_index = 0;
+	f_lseek(&BINLOAD_bin_file, start);
+	return count;
+}
+
+static int next_segment(segment_t *seg)
+{
+	if (segments == NULL)
+		return read_header(seg);
+	/* skip what the byte-wise loader has read already */
+	while (next_index < n_segments && segments[next_index].offset < f_tell(&BINLOAD_bin_file))
+		next_index++;
+	if (next_index >= n_segments)
+		return FALSE;
+	*seg = segments[next_index++];
+	return TRUE;
+}
+
+/* Copies a segment into memory: runs of RAM pages straight from the file,
+   anything else through MEMORY_PutByte as the byte-wise loader does.
+   Returns FALSE if the file could not be read, which the index says it
+   can. */
+static int copy_segment(const segment_t *seg)
+{
+	UWORD addr = seg->from;
+	ULONG left = seg->length;
+	UINT br;
+	if (f_tell(&BINLOAD_bin_file) != seg->offset
+	 && f_lseek(&BINLOAD_bin_file, seg->offset) != FR_OK)
+		return FALSE;
+	while (left > 0) {
+		ULONG run = 0;
+		ULONG size = 0x10000 - addr;
+		if (size > left)
+			size = left;
+#ifdef PAGED_ATTRIB
+		while (run < size && MEMORY_writemap[(addr + run) >> 8] == NULL)
+			run += 0x100 - ((addr + run) & 0xff);
+#else
+		while (run < size && MEMORY_attrib[addr + run] == MEMORY_RAM)
+			run++;
+#endif
+		if (run > size)
+			run = size;
+		if (run > 0) {
+			MEMORY_SetDirty(addr, run);
+			if (f_read(&BINLOAD_bin_file, MEMORY_mem + addr, run, &br) != FR_OK || br != run)
+				return FALSE;
+		}
+		else {
+			UBYTE buf[0x100];
+			UINT i;
+			run = 0x100 - (addr & 0xff);
+			if (run > size)
+				run = size;
+			if (f_read(&BINLOAD_bin_file, buf, run, &br) != FR_OK || br != run)
+				return FALSE;
+			for (i = 0; i < br; i++)
+				MEMORY_PutByte((UWORD) (addr + i), buf[i]);
+		}
+		addr += run;
+		left -= run;
+		BINLOAD_stats.bytes += run;
+	}
+	return TRUE;
+}
+
+/* Gives up a load that could not read the file, rather than run what
+   part of the program is in memory. */
+static void abort_load(void)
+{
+	f_close(&BINLOAD_bin_file);
+	BINLOAD_bin_file_open = FALSE;
+	BINLOAD_start_binloading = FALSE;
+	free_index();
+	Log_print("binload: read error, loading aborted");
+	Atari800_Coldstart();
+}
+
+/* End of the file: jumps to RUNAD, through INITAD if a segment set it. */
+static void run_program(int call_init)
+{
+	f_close(&BINLOAD_bin_file);
+	BINLOAD_bin_file_open = FALSE;
+	free_index();
+	CPU_regPC = MEMORY_dGetWordAligned(0x2e0);
+	if (call_init && MEMORY_dGetByte(0x2e3) != 0xd7) {
+		/* run INIT routine which RTSes directly to RUN routine */
+		CPU_regPC--;
+		MEMORY_dPutByte(0x0100 + CPU_regS--, CPU_regPC >> 8);		/* high */
+		MEMORY_dPutByte(0x0100 + CPU_regS--, CPU_regPC & 0xff);	/* low */
+		CPU_regPC = MEMORY_dGetWordAligned(0x2e2);
+	}
+	BINLOAD_stats.boot_frames = Atari800_nframes - start_frame;
+	Log_print("binload: %d segments, %lu bytes in %lu us, running after %d frames",
+	          BINLOAD_stats.segments, (unsigned long) BINLOAD_stats.bytes,
+	          (unsigned long) BINLOAD_stats.load_us, BINLOAD_stats.boot_frames);
+}
+
+/* Copies whole segments until one of them sets INITAD, in a single call
+   and so without emulated time passing.  Returns FALSE when the file has
+   ended and the program has been started. */
+static int load_segments(void)
+{
+	ULONG start = time_us_32();
+	segment_t seg;
+	do {
+		if (!next_segment(&seg)) {
+			BINLOAD_stats.load_us += time_us_32() - start;
+			if (BINLOAD_start_binloading) {
+				f_close(&BINLOAD_bin_file);
+				BINLOAD_bin_file_open = FALSE;
+				free_index();
+				BINLOAD_start_binloading = FALSE;
+				Log_print("binload: not valid BIN file");
+				return FALSE;
+			}
+			run_program(FALSE);
+			return FALSE;
+		}
+		if (BINLOAD_start_binloading) {
+			MEMORY_dPutWordAligned(0x2e0, seg.from);
+			BINLOAD_start_binloading = FALSE;
+		}
+		if (!copy_segment(&seg)) {
+			BINLOAD_stats.load_us += time_us_32() - start;
+			abort_load();
+			return FALSE;
+		}
+		if (seg.truncated) {
+			BINLOAD_stats.load_us += time_us_32() - start;
+			run_program(TRUE);
+			return FALSE;
+		}
+	} while (MEMORY_dGetByte(0x2e3) == 0xd7);
+	BINLOAD_stats.load_us += time_us_32() - start;
+	return TRUE;
+}
+
 /* Start or continue loading */
 static void loader_cont(void)
 {
@@ -87,7 +311,11 @@ static void loader_cont(void)
 	if (init2e3)
 		MEMORY_dPutByte(0x2e3, 0xd7);
 	init2e3=FALSE;
-	do {
+	if (!BINLOAD_slow_xex_loading && segfinished) {
+		if (!load_segments())
+			return;
+	}
+	else do {
 		if((!BINLOAD_wait_active || !BINLOAD_slow_xex_loading) && segfinished){
 			int temp;
 			do
@@ -126,16 +354,7 @@ static void loader_cont(void)
 			}
 			byte = _fgetc(&BINLOAD_bin_file);
 			if (byte == EOF) {
-				f_close(&BINLOAD_bin_file);
-				BINLOAD_bin_file_open = FALSE;
-				CPU_regPC = MEMORY_dGetWordAligned(0x2e0);
-				if (MEMORY_dGetByte(0x2e3) != 0xd7) {
-					/* run INIT routine which RTSes directly to RUN routine */
-					CPU_regPC--;
-					MEMORY_dPutByte(0x0100 + CPU_regS--, CPU_regPC >> 8);		/* high */
-					MEMORY_dPutByte(0x0100 + CPU_regS--, CPU_regPC & 0xff);	/* low */
-					CPU_regPC = MEMORY_dGetWordAligned(0x2e2);
-				}
+				run_program(TRUE);
 				return;
 			}
 			MEMORY_PutByte(from, (UBYTE) byte);
@@ -184,6 +403,7 @@ int BINLOAD_Loader(const char *filename)
 		BINLOAD_bin_file_open = FALSE;
 		BINLOAD_loading_basic = 0;
 	}
+	free_index();
 	if (Atari800_machine_type == Atari800_MACHINE_5200) {
 		Log_print("binload: can't run Atari programs directly on the 5200");
 #ifdef LIBATARI800
@@ -200,8 +420,17 @@ int BINLOAD_Loader(const char *filename)
 	if (SIO_drive_status[0] == SIO_NO_DISK)
 		SIO_DisableDrive(1);
 	UINT rb;
-	if (fread(&BINLOAD_bin_file, buf, 2, &rb) == FR_OK) {
+	if (f_read(&BINLOAD_bin_file, buf, 2, &rb) == FR_OK && rb == 2) {
 		if (buf[0] == 0xff && buf[1] == 0xff) {
+			memset(&BINLOAD_stats, 0, sizeof(BINLOAD_stats));
+			BINLOAD_stats.segments = build_index();
+			if (BINLOAD_stats.segments == 0) {
+				f_close(&BINLOAD_bin_file);
+				BINLOAD_bin_file_open = FALSE;
+				Log_print("binload: \"%s\" has no segments", filename);
+				return FALSE;
+			}
+			start_frame = Atari800_nframes;
 			BINLOAD_start_binloading = TRUE; /* force SIO to call BINLOAD_LoaderStart at boot */
 			Atari800_Coldstart();             /* reboot */
 			return TRUE;
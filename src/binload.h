@@ -8,6 +8,8 @@ extern FIL BINLOAD_bin_file;
 extern int BINLOAD_bin_file_open;
 
 int BINLOAD_Loader(const char *filename);
+/* Returns the heap the segment index of a file takes at most. */
+size_t BINLOAD_HeapSize(void);
 extern int BINLOAD_start_binloading;
 extern int BINLOAD_loading_basic;
 
@@ -20,6 +22,16 @@ extern int BINLOAD_wait_active;
 /* Set it to TRUE to pause the current loading of a DOS file. */
 extern int BINLOAD_pause_loading;
 
+/* Figures of the last DOS file loaded. */
+typedef struct {
+	int segments;		/* segments in the file */
+	ULONG bytes;		/* bytes copied into memory */
+	ULONG load_us;		/* time spent copying them */
+	int boot_frames;	/* frames from the cold start until the program runs */
+} BINLOAD_stats_t;
+
+extern BINLOAD_stats_t BINLOAD_stats;
+
 #define BINLOAD_LOADING_BASIC_SAVED              1
 #define BINLOAD_LOADING_BASIC_LISTED             2
 #define BINLOAD_LOADING_BASIC_LISTED_ATARI       3
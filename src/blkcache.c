@@ -0,0 +1,895 @@
+/*
+ * blkcache.c - Block cache for disk image and host files
+ *
+ * Copyright (C) 2026 Atari800 development team (see DOC/CREDITS)
+ *
+ * This file is part of the Atari800 emulator project which emulates
+ * the Atari 400, 800, 800XL, 130XE, and 5200 8-bit computers.
+ *
+ * Atari800 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Atari800 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Atari800; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "config.h"
+#include <stdlib.h>
+#include <string.h>
+#include "atari.h"
+#include "blkcache.h"
+#include "log.h"
+#include "util.h"
+#include "psram_spi.h"
+#include "diskio.h"
+#include "ioqueue.h"
+
+int BLKCACHE_sram_kb = 16;
+int BLKCACHE_psram_kb = 256;
+
+#define BS BLKCACHE_BLOCK_SIZE
+
+/* Slots 0 to sram_slots - 1 keep their blocks in SRAM, the others in
+   PSRAM.  Blocks come into SRAM; the least recently used one there moves
+   to PSRAM, and the least recently used one in PSRAM is dropped. */
+typedef struct {
+	FIL *file;			/* NULL if the slot is free */
+	ULONG block;
+	UWORD len;			/* bytes of the file in the block */
+	UBYTE dirty;
+	ULONG used;			/* clock of the last use */
+	BLKCACHE_dev_t *dev;	/* that wrote it, while dirty */
+	int next;			/* in the hash chain, -1 ends it */
+} slot_t;
+
+static int ready = FALSE;
+static int sram_slots;
+static int total_slots;
+static slot_t *slots = NULL;
+static UBYTE *sram = NULL;
+static UBYTE *run_buf = NULL;	/* BLKCACHE_RUN blocks for FatFS calls */
+static int *hash = NULL;
+static int hash_mask;
+static ULONG clock;
+static int dirty_count;
+static int idle_frames;
+static BLKCACHE_dev_t *devs = NULL;
+
+/* Card accesses handed to the storage worker, when there is one: reading
+   ahead of a device, and writing back once the writes have stopped. */
+#define JOBS 2
+
+typedef struct {
+	IOQUEUE_req_t req;	/* first, the job is passed as its request */
+	int write;
+	int sync;			/* f_sync the file after writing */
+	int stale;			/* some of the blocks read got written meanwhile */
+	int fetch;			/* for BLKCACHE_Fetch */
+	BLKCACHE_dev_t *dev;
+	FIL *file;
+	ULONG block;
+	UINT len;
+	UINT moved;
+	int ok;
+	UBYTE buf[BLKCACHE_RUN * BS];
+} job_t;
+
+static job_t *jobs = NULL;
+
+static void JobWork(IOQUEUE_req_t *req);
+static void JobDone(IOQUEUE_req_t *req);
+
+/* Sets the slot counts and the hash mask for the sizes set.  Returns
+   FALSE if the cache is off. */
+static int Size(int *sram_n, int *total_n, int *mask)
+{
+	int psram_n = 0;
+	*sram_n = BLKCACHE_sram_kb * 1024 / BS;
+	if (*sram_n <= BLKCACHE_RUN) {
+		*sram_n = 0;
+		return FALSE;
+	}
+	if (PSRAM_AVAILABLE) {
+		psram_n = BLKCACHE_psram_kb * 1024 / BS;
+		if (psram_n > BLKCACHE_PSRAM_MAX / BS)
+			psram_n = BLKCACHE_PSRAM_MAX / BS;
+	}
+	*total_n = *sram_n + psram_n;
+	for (*mask = 1; *mask < *total_n; *mask <<= 1);
+	(*mask)--;
+	return TRUE;
+}
+
+static int Setup(void)
+{
+	int i;
+	if (ready)
+		return sram_slots > 0;
+	ready = TRUE;
+	if (!Size(&sram_slots, &total_slots, &hash_mask))
+		return FALSE;
+	slots = (slot_t *) Util_malloc(total_slots * sizeof(slot_t), "BLKCACHE slots");
+	hash = (int *) Util_malloc((hash_mask + 1) * sizeof(int), "BLKCACHE hash");
+	sram = (UBYTE *) Util_malloc(sram_slots * BS, "BLKCACHE sram");
+	run_buf = (UBYTE *) Util_malloc(BLKCACHE_RUN * BS, "BLKCACHE run");
+	for (i = 0; i < total_slots; i++) {
+		slots[i].file = NULL;
+		slots[i].used = 0;
+	}
+	for (i = 0; i <= hash_mask; i++)
+		hash[i] = -1;
+	if (IOQUEUE_HaveWorker()) {
+		jobs = (job_t *) Util_malloc(JOBS * sizeof(job_t), "BLKCACHE jobs");
+		for (i = 0; i < JOBS; i++) {
+			jobs[i].req.work = JobWork;
+			jobs[i].req.done = JobDone;
+			jobs[i].req.state = IOQUEUE_IDLE;
+			jobs[i].file = NULL;
+		}
+	}
+	return TRUE;
+}
+
+static void Register(BLKCACHE_dev_t *dev)
+{
+	if (!dev->registered) {
+		dev->registered = TRUE;
+		dev->link = devs;
+		devs = dev;
+	}
+}
+
+static int Hash(const FIL *file, ULONG block)
+{
+	ULONG h = (ULONG) (size_t) file >> 3;
+	h ^= block * 0x9e3779b1;
+	return (int) (h ^ (h >> 16)) & hash_mask;
+}
+
+static int Find(const FIL *file, ULONG block)
+{
+	int i;
+	for (i = hash[Hash(file, block)]; i >= 0; i = slots[i].next)
+		if (slots[i].file == file && slots[i].block == block)
+			return i;
+	return -1;
+}
+
+static void Link(int i)
+{
+	int h = Hash(slots[i].file, slots[i].block);
+	slots[i].next = hash[h];
+	hash[h] = i;
+}
+
+static void Unlink(int i)
+{
+	int *p = &hash[Hash(slots[i].file, slots[i].block)];
+	while (*p != i)
+		p = &slots[*p].next;
+	*p = slots[i].next;
+	slots[i].file = NULL;
+}
+
+static void CopyOut(int i, UINT off, UBYTE *dst, UINT n)
+{
+	if (i < sram_slots)
+		memcpy(dst, sram + i * BS + off, n);
+	else
+		readpsram(BLKCACHE_PSRAM_BASE + (i - sram_slots) * BS + off, dst, n);
+}
+
+static void CopyIn(int i, UINT off, const UBYTE *src, UINT n)
+{
+	if (i < sram_slots)
+		memcpy(sram + i * BS + off, src, n);
+	else
+		writepsram(BLKCACHE_PSRAM_BASE + (i - sram_slots) * BS + off, src, n);
+}
+
+/* Most sectors in one disk_read or disk_write call. */
+#define CARD_RUN 128
+
+/* Returns the card sector holding POS of FILE if the LEN bytes there can
+   be moved with the disk driver: FILE is mapped and in one fragment, the
+   transfer is of whole sectors in the clusters of the file, and FatFS's
+   sector buffer of FILE is not among them.  Otherwise returns 0. */
+static LBA_t CardSector(FIL *file, FSIZE_t pos, UINT len)
+{
+	FATFS *fs = file->obj.fs;
+	LBA_t sect;
+#if FF_MIN_SS != BS || FF_MAX_SS != BS
+	return 0;
+#endif
+	if (file->cltbl == NULL || file->cltbl[0] != 4 || len == 0
+	    || pos % BS != 0 || len % BS != 0
+	    || pos + len > (f_size(file) + BS - 1) / BS * BS)
+		return 0;
+	sect = fs->database + (LBA_t) (file->cltbl[2] - 2) * fs->csize + (LBA_t) (pos / BS);
+	if (file->sect >= sect && file->sect < sect + len / BS)
+		return 0;
+	return sect;
+}
+
+/* Direct card accesses hold the volume like FatFS calls do, as the other
+   core may be in FatFS meanwhile. */
+static int Lock(FATFS *fs)
+{
+#if FF_FS_REENTRANT
+	return ff_req_grant(fs->sobj);
+#else
+	return TRUE;
+#endif
+}
+
+static void Unlock(FATFS *fs)
+{
+#if FF_FS_REENTRANT
+	ff_rel_grant(fs->sobj);
+#endif
+}
+
+static void Unmap(FIL *file)
+{
+	if (file->cltbl != NULL) {
+		Util_free(file->cltbl);
+		file->cltbl = NULL;
+	}
+}
+
+static int ReadDirect(FIL *file, FSIZE_t pos, void *buf, UINT len, UINT *br)
+{
+	LBA_t sect = CardSector(file, pos, len);
+	if (sect != 0) {
+		FATFS *fs = file->obj.fs;
+		UBYTE *dst = (UBYTE *) buf;
+		UINT done;
+		if (!Lock(fs))
+			return FALSE;
+		for (done = 0; done < len; done += CARD_RUN * BS) {
+			UINT n = len - done < CARD_RUN * BS ? len - done : CARD_RUN * BS;
+			if (disk_read(fs->pdrv, dst + done, sect + done / BS, n / BS) != RES_OK) {
+				Unlock(fs);
+				return FALSE;
+			}
+		}
+		Unlock(fs);
+		*br = f_size(file) - pos < len ? (UINT) (f_size(file) - pos) : len;
+		return TRUE;
+	}
+	return f_lseek(file, pos) == FR_OK && f_read(file, buf, len, br) == FR_OK;
+}
+
+static int WriteDirect(FIL *file, FSIZE_t pos, const void *buf, UINT len, UINT *bw)
+{
+	LBA_t sect;
+	if (pos + len > f_size(file))
+		/* a mapped file cannot grow */
+		Unmap(file);
+	else if ((sect = CardSector(file, pos, len)) != 0) {
+		FATFS *fs = file->obj.fs;
+		const UBYTE *src = (const UBYTE *) buf;
+		UINT done;
+		if (!Lock(fs))
+			return FALSE;
+		for (done = 0; done < len; done += CARD_RUN * BS) {
+			UINT n = len - done < CARD_RUN * BS ? len - done : CARD_RUN * BS;
+			if (disk_write(fs->pdrv, src + done, sect + done / BS, n / BS) != RES_OK) {
+				Unlock(fs);
+				return FALSE;
+			}
+		}
+		Unlock(fs);
+		*bw = len;
+		return TRUE;
+	}
+	return f_lseek(file, pos) == FR_OK && f_write(file, buf, len, bw) == FR_OK;
+}
+
+/* Waits for the worker to finish with FILE, before the card is accessed
+   for it here. */
+static void WaitFile(const FIL *file)
+{
+	int j;
+	for (j = 0; jobs != NULL && j < JOBS; j++)
+		if (jobs[j].file == file)
+			IOQUEUE_Wait(&jobs[j].req);
+}
+
+/* Returns TRUE if a job reading BLOCK of FILE has not been completed yet. */
+static int Pending(const FIL *file, ULONG block)
+{
+	int j;
+	for (j = 0; jobs != NULL && j < JOBS; j++)
+		if (jobs[j].req.state != IOQUEUE_IDLE && !jobs[j].write && jobs[j].file == file
+		    && block >= jobs[j].block && block < jobs[j].block + jobs[j].len / BS)
+			return TRUE;
+	return FALSE;
+}
+
+/* Returns TRUE if a job for FILE has not been completed yet. */
+static int Busy(const FIL *file)
+{
+	int j;
+	for (j = 0; jobs != NULL && j < JOBS; j++)
+		if (jobs[j].req.state != IOQUEUE_IDLE && jobs[j].file == file)
+			return TRUE;
+	return FALSE;
+}
+
+static job_t *FreeJob(void)
+{
+	int j;
+	for (j = 0; jobs != NULL && j < JOBS; j++)
+		if (jobs[j].req.state == IOQUEUE_IDLE)
+			return &jobs[j];
+	return NULL;
+}
+
+/* Copies the dirty block in slot I and the dirty ones around it to BUF,
+   stores the first block in *FIRST and their number in *COUNT, and
+   returns their length. */
+static UINT Gather(int i, ULONG *first_block, UBYTE *buf, int *count)
+{
+	FIL *file = slots[i].file;
+	ULONG first = slots[i].block;
+	UINT len = 0;
+	int n, j;
+	while (first > 0 && slots[i].block - first < BLKCACHE_RUN - 1
+	       && (j = Find(file, first - 1)) >= 0 && slots[j].dirty && slots[j].len == BS)
+		first--;
+	for (n = 0; n < BLKCACHE_RUN; n++) {
+		j = Find(file, first + n);
+		if (j < 0 || !slots[j].dirty)
+			break;
+		CopyOut(j, 0, buf + n * BS, slots[j].len);
+		len = n * BS + slots[j].len;
+		if (slots[j].len < BS) {
+			n++;
+			break;
+		}
+	}
+	*first_block = first;
+	*count = n;
+	return len;
+}
+
+static void MarkClean(const FIL *file, ULONG first, int n)
+{
+	while (--n >= 0) {
+		int j = Find(file, first + n);
+		slots[j].dirty = FALSE;
+		dirty_count--;
+	}
+}
+
+/* Writes the dirty block in slot I together with the dirty ones around
+   it, with a single f_write. */
+static int WriteBack(int i)
+{
+	FIL *file = slots[i].file;
+	BLKCACHE_dev_t *dev = slots[i].dev;
+	ULONG first;
+	UINT len;
+	UINT bw;
+	int n;
+	WaitFile(file);
+	len = Gather(i, &first, run_buf, &n);
+	dev->card_writes++;
+	if (!WriteDirect(file, (FSIZE_t) first * BS, run_buf, len, &bw) || bw != len)
+		return FALSE;
+	MarkClean(file, first, n);
+	return TRUE;
+}
+
+/* Returns the least recently used slot from FROM to TO - 1, only a clean
+   one with CLEAN, or -1 if there is none. */
+static int Victim(int from, int to, int clean)
+{
+	int best = -1;
+	int i;
+	for (i = from; i < to; i++) {
+		if (slots[i].file == NULL)
+			return i;
+		if ((!clean || !slots[i].dirty) && (best < 0 || slots[i].used < slots[best].used))
+			best = i;
+	}
+	return best;
+}
+
+/* Returns a slot for BLOCK of FILE, which must not be cached, or -1 if
+   a dirty block could not be written back to make room.  Without
+   WRITE_BACK only clean blocks are dropped, and -1 means there is none. */
+static int Alloc(FIL *file, ULONG block, int write_back)
+{
+	int i = Victim(0, sram_slots, !write_back && total_slots == sram_slots);
+	if (i < 0)
+		return -1;
+	if (slots[i].file != NULL) {
+		if (total_slots > sram_slots) {
+			int j = Victim(sram_slots, total_slots, !write_back);
+			if (j < 0)
+				return -1;
+			if (slots[j].file != NULL) {
+				if (slots[j].dirty && !WriteBack(j))
+					return -1;
+				Unlink(j);
+			}
+			CopyIn(j, 0, sram + i * BS, slots[i].len);
+			slots[j] = slots[i];
+			Unlink(i);
+			Link(j);
+		}
+		else {
+			if (slots[i].dirty && !WriteBack(i))
+				return -1;
+			Unlink(i);
+		}
+	}
+	slots[i].file = file;
+	slots[i].block = block;
+	slots[i].len = 0;
+	slots[i].dirty = FALSE;
+	slots[i].used = ++clock;
+	Link(i);
+	return i;
+}
+
+/* Reads BLOCK of FILE, which must not be cached, and the blocks up to LAST
+   that are missing too, with a single f_read; with AHEAD, up to
+   BLKCACHE_RUN blocks whatever LAST is.  Returns FALSE if nothing could
+   be read. */
+static int Fill(BLKCACHE_dev_t *dev, FIL *file, ULONG block, ULONG last, int ahead)
+{
+	FSIZE_t size = f_size(file);
+	UINT got;
+	int n, k;
+	if (ahead || last >= block + BLKCACHE_RUN)
+		last = block + BLKCACHE_RUN - 1;
+	if (last > (size - 1) / BS)
+		last = (ULONG) ((size - 1) / BS);
+	int slot[BLKCACHE_RUN];
+	WaitFile(file);
+	for (n = 1; block + n <= last && Find(file, block + n) < 0; n++);
+	/* room is made first, as writing back uses run_buf */
+	for (k = 0; k < n; k++)
+		if ((slot[k] = Alloc(file, block + k, TRUE)) < 0)
+			break;
+	dev->card_reads++;
+	if (k < n || !ReadDirect(file, (FSIZE_t) block * BS, run_buf, n * BS, &got))
+		got = 0;
+	for (k = 0; k < n && slot[k] >= 0; k++) {
+		if (k * BS >= got) {
+			Unlink(slot[k]);
+			continue;
+		}
+		slots[slot[k]].len = got - k * BS < BS ? got - k * BS : BS;
+		CopyIn(slot[k], 0, run_buf + k * BS, slots[slot[k]].len);
+	}
+	return got > 0;
+}
+
+static void JobWork(IOQUEUE_req_t *req)
+{
+	job_t *job = (job_t *) req;
+	FSIZE_t pos = (FSIZE_t) job->block * BS;
+	if (job->write)
+		job->ok = WriteDirect(job->file, pos, job->buf, job->len, &job->moved)
+		          && job->moved == job->len
+		          && (!job->sync || f_sync(job->file) == FR_OK);
+	else
+		job->ok = ReadDirect(job->file, pos, job->buf, job->len, &job->moved);
+}
+
+/* Caches the blocks a job has read, those not cached meanwhile, as long
+   as that needs no writing back. */
+static void JobDone(IOQUEUE_req_t *req)
+{
+	job_t *job = (job_t *) req;
+	UINT k;
+	if (job->write) {
+		if (!job->ok)
+			Log_print("%s: could not write back cached blocks", job->dev->name);
+		return;
+	}
+	if (job->fetch)
+		job->dev->fetched = TRUE;
+	if (!job->ok || job->stale)
+		return;
+	for (k = 0; k * BS < job->moved; k++) {
+		int i;
+		if (Find(job->file, job->block + k) >= 0
+		    || (i = Alloc(job->file, job->block + k, FALSE)) < 0)
+			continue;
+		slots[i].len = job->moved - k * BS < BS ? job->moved - k * BS : BS;
+		CopyIn(i, 0, job->buf + k * BS, slots[i].len);
+	}
+}
+
+/* Marks BLOCK of FILE as written for the jobs reading it. */
+static void Stale(const FIL *file, ULONG block)
+{
+	int j;
+	for (j = 0; jobs != NULL && j < JOBS; j++)
+		if (jobs[j].req.state != IOQUEUE_IDLE && !jobs[j].write && jobs[j].file == file
+		    && block >= jobs[j].block && block < jobs[j].block + jobs[j].len / BS)
+			jobs[j].stale = TRUE;
+}
+
+/* Has the worker read BLOCK of FILE, which must not be cached, and the
+   missing blocks after it, up to BLKCACHE_RUN.  Returns FALSE if there
+   is no free job. */
+static int ReadLater(BLKCACHE_dev_t *dev, FIL *file, ULONG block, int fetch)
+{
+	ULONG last = (ULONG) ((f_size(file) - 1) / BS);
+	job_t *job = FreeJob();
+	UINT n;
+	if (job == NULL)
+		return FALSE;
+	for (n = 1; n < BLKCACHE_RUN && block + n <= last && Find(file, block + n) < 0; n++);
+	job->write = FALSE;
+	job->stale = FALSE;
+	job->fetch = fetch;
+	job->dev = dev;
+	job->file = file;
+	job->block = block;
+	job->len = n * BS;
+	dev->card_reads++;
+	return IOQUEUE_Submit(&job->req);
+}
+
+/* Hands dirty blocks to the worker while it has free jobs; the last
+   writes to each file sync it. */
+static void WriteBackLater(void)
+{
+	job_t *job;
+	int i;
+	for (i = 0; dirty_count > 0 && i < total_slots && (job = FreeJob()) != NULL; i++) {
+		int n, j;
+		if (slots[i].file == NULL || !slots[i].dirty)
+			continue;
+		job->write = TRUE;
+		job->dev = slots[i].dev;
+		job->file = slots[i].file;
+		job->len = Gather(i, &job->block, job->buf, &n);
+		MarkClean(job->file, job->block, n);
+		job->sync = TRUE;
+		for (j = 0; j < total_slots; j++)
+			if (slots[j].file == job->file && slots[j].dirty) {
+				job->sync = FALSE;
+				break;
+			}
+		job->dev->card_writes++;
+		IOQUEUE_Submit(&job->req);
+	}
+}
+
+int BLKCACHE_Read(BLKCACHE_dev_t *dev, FIL *file, FSIZE_t pos, void *buf, UINT len, UINT *br)
+{
+	UBYTE *dst = (UBYTE *) buf;
+	ULONG block = (ULONG) (pos / BS);
+	ULONG last = (ULONG) ((pos + len - 1) / BS);
+	UINT off = (UINT) (pos % BS);
+	UINT done = 0;
+	int stream = file == dev->stream && pos == dev->stream_pos;
+	Register(dev);
+	*br = 0;
+	if (!Setup()) {
+		dev->card_reads++;
+		return ReadDirect(file, pos, buf, len, br);
+	}
+	IOQUEUE_Poll();
+	while (done < len) {
+		UINT n = BS - off;
+		int i = Find(file, block);
+		dev->reads++;
+		if (i < 0 && Busy(file)) {
+			/* the worker may be reading it */
+			WaitFile(file);
+			IOQUEUE_Poll();
+			i = Find(file, block);
+		}
+		if (i >= 0)
+			dev->hits++;
+		else {
+			/* a device reading on from the last position, or from right
+			   after a block still cached, reads a stream */
+			int ahead = stream || (block > 0 && Find(file, block - 1) >= 0);
+			if ((FSIZE_t) block * BS >= f_size(file))
+				break;
+			if (!Fill(dev, file, block, last, ahead))
+				return FALSE;
+			if ((i = Find(file, block)) < 0)
+				break;
+		}
+		slots[i].used = ++clock;
+		if (off >= slots[i].len)
+			break;
+		if (n > slots[i].len - off)
+			n = slots[i].len - off;
+		if (n > len - done)
+			n = len - done;
+		CopyOut(i, off, dst + done, n);
+		done += n;
+		if (slots[i].len < BS)
+			break;
+		block++;
+		off = 0;
+	}
+	*br = done;
+	dev->stream = file;
+	dev->stream_pos = pos + done;
+	/* with a worker, a stream is read on meanwhile */
+	if (stream && jobs != NULL && !Busy(file)) {
+		ULONG next = (ULONG) ((pos + done + BS - 1) / BS);
+		int k;
+		for (k = 0; k < BLKCACHE_RUN && (FSIZE_t) (next + k) * BS < f_size(file); k++)
+			if (Find(file, next + k) < 0) {
+				ReadLater(dev, file, next + k, FALSE);
+				break;
+			}
+	}
+	return TRUE;
+}
+
+int BLKCACHE_Write(BLKCACHE_dev_t *dev, FIL *file, FSIZE_t pos, const void *buf, UINT len, UINT *bw)
+{
+	const UBYTE *src = (const UBYTE *) buf;
+	ULONG block = (ULONG) (pos / BS);
+	UINT off = (UINT) (pos % BS);
+	UINT done = 0;
+	Register(dev);
+	*bw = 0;
+	if (!Setup() || dev->write_through) {
+		WaitFile(file);
+		dev->card_writes++;
+		if (!WriteDirect(file, pos, buf, len, bw))
+			return FALSE;
+		if (sram_slots == 0)
+			return TRUE;
+		/* keep cached copies up to date */
+		len = *bw;
+	}
+	while (done < len) {
+		UINT n = BS - off < len - done ? BS - off : len - done;
+		int i = Find(file, block);
+		dev->writes++;
+		if (i < 0 && Pending(file, block)) {
+			WaitFile(file);
+			IOQUEUE_Poll();
+			i = Find(file, block);
+		}
+		Stale(file, block);
+		if (i < 0) {
+			if (dev->write_through) {
+				done += n;
+				block++;
+				off = 0;
+				continue;
+			}
+			/* what the write leaves of a block must be read first */
+			if ((off != 0 || n != BS) && (FSIZE_t) block * BS < f_size(file)) {
+				if (!Fill(dev, file, block, block, FALSE))
+					return FALSE;
+				i = Find(file, block);
+			}
+			if (i < 0 && (i = Alloc(file, block, TRUE)) < 0)
+				return FALSE;
+		}
+		slots[i].used = ++clock;
+		if (slots[i].len < off) {
+			static const UBYTE zero[BS];
+			CopyIn(i, slots[i].len, zero, off - slots[i].len);
+		}
+		CopyIn(i, off, src + done, n);
+		if (slots[i].len < off + n)
+			slots[i].len = off + n;
+		if (!dev->write_through && !slots[i].dirty) {
+			slots[i].dirty = TRUE;
+			slots[i].dev = dev;
+			dirty_count++;
+		}
+		done += n;
+		block++;
+		off = 0;
+	}
+	if (!dev->write_through) {
+		*bw = done;
+		idle_frames = 0;
+	}
+	return TRUE;
+}
+
+int BLKCACHE_Flush(FIL *file)
+{
+	int ret = TRUE;
+	int i;
+	if (file == NULL) {
+		for (i = 0; dirty_count > 0 && i < total_slots; i++)
+			if (slots[i].file != NULL && slots[i].dirty && !BLKCACHE_Flush(slots[i].file))
+				ret = FALSE;
+		return ret;
+	}
+	WaitFile(file);
+	for (i = 0; i < total_slots; i++)
+		if (slots[i].file == file && slots[i].dirty && !WriteBack(i))
+			ret = FALSE;
+	if (f_sync(file) != FR_OK)
+		ret = FALSE;
+	return ret;
+}
+
+/* Link map items tried first, enough for a file in 7 fragments. */
+#define MAP_START 16
+#define MAP_MAX 1024
+
+int BLKCACHE_Map(FIL *file)
+{
+	UINT size = MAP_START;
+	Unmap(file);
+	for (;;) {
+		DWORD *tbl = (DWORD *) Util_malloc(size * sizeof(DWORD), "BLKCACHE map");
+		FRESULT fr;
+		tbl[0] = size;
+		file->cltbl = tbl;
+		fr = f_lseek(file, CREATE_LINKMAP);
+		if (fr == FR_OK)
+			break;
+		/* with FR_NOT_ENOUGH_CORE the items needed are in tbl[0] */
+		size = tbl[0];
+		Unmap(file);
+		if (fr != FR_NOT_ENOUGH_CORE || size > MAP_MAX)
+			return FALSE;
+	}
+	return file->cltbl[0] == 4;
+}
+
+size_t BLKCACHE_HeapSize(void)
+{
+	/* link maps of 8 images, one in many fragments and the others in few */
+	size_t size = (MAP_MAX + 7 * MAP_START) * sizeof(DWORD);
+	int sram_n;
+	int total_n;
+	int mask;
+	if (!Size(&sram_n, &total_n, &mask))
+		return size;
+	/* the jobs too, in case the worker is started later */
+	return size + total_n * sizeof(slot_t) + (mask + 1) * sizeof(int)
+	       + sram_n * BS + BLKCACHE_RUN * BS + JOBS * sizeof(job_t);
+}
+
+void BLKCACHE_Release(FIL *file)
+{
+	BLKCACHE_dev_t *dev;
+	int i;
+	/* what the worker read for the file is dropped below, not cached later */
+	WaitFile(file);
+	IOQUEUE_Poll();
+	if (!BLKCACHE_Flush(file))
+		Log_print("Could not write back the cached blocks of a file");
+	Unmap(file);
+	for (i = 0; i < total_slots; i++)
+		if (slots[i].file == file) {
+			if (slots[i].dirty)
+				dirty_count--;
+			Unlink(i);
+		}
+	for (dev = devs; dev != NULL; dev = dev->link)
+		if (dev->stream == file)
+			dev->stream = NULL;
+}
+
+int BLKCACHE_Fetch(BLKCACHE_dev_t *dev, FIL *file, FSIZE_t pos, UINT len)
+{
+	ULONG block = (ULONG) (pos / BS);
+	ULONG last = (ULONG) ((pos + len - 1) / BS);
+	if (!Setup() || jobs == NULL || len == 0 || pos >= f_size(file))
+		return TRUE;
+	Register(dev);
+	IOQUEUE_Poll();
+	if (last > (f_size(file) - 1) / BS)
+		last = (ULONG) ((f_size(file) - 1) / BS);
+	while (block <= last && Find(file, block) >= 0)
+		block++;
+	if (block > last || dev->fetched) {
+		/* cached, or the worker could not cache it: read it now */
+		dev->fetched = FALSE;
+		return TRUE;
+	}
+	if (!Busy(file))
+		ReadLater(dev, file, block, TRUE);
+	return FALSE;
+}
+
+void BLKCACHE_Frame(void)
+{
+	if (jobs != NULL)
+		IOQUEUE_Poll();
+	if (dirty_count > 0 && ++idle_frames >= BLKCACHE_WRITEBACK_FRAMES) {
+		if (jobs != NULL)
+			WriteBackLater();
+		else
+			BLKCACHE_Flush(NULL);
+		/* with a worker, the rest follows as jobs get free */
+		if (jobs == NULL || dirty_count == 0)
+			idle_frames = 0;
+	}
+}
+
+int BLKCACHE_Initialise(int *argc, char *argv[])
+{
+	int i;
+	int j;
+	for (i = j = 1; i < *argc; i++) {
+		int i_a = (i + 1 < *argc);		/* is argument available? */
+		int a_m = FALSE;			/* error, argument missing! */
+		if (strcmp(argv[i], "-blkcache-sram") == 0) {
+			if (i_a)
+				BLKCACHE_sram_kb = Util_sscandec(argv[++i]);
+			else a_m = TRUE;
+		}
+		else if (strcmp(argv[i], "-blkcache-psram") == 0) {
+			if (i_a)
+				BLKCACHE_psram_kb = Util_sscandec(argv[++i]);
+			else a_m = TRUE;
+		}
+		else {
+			if (strcmp(argv[i], "-help") == 0) {
+				Log_print("\t-blkcache-sram <kb>  Disk block cache in SRAM (0: none)");
+				Log_print("\t-blkcache-psram <kb> Disk block cache in PSRAM");
+			}
+			argv[j++] = argv[i];
+		}
+		if (a_m) {
+			Log_print("Missing argument for '%s'", argv[i]);
+			return FALSE;
+		}
+	}
+	*argc = j;
+	if (BLKCACHE_sram_kb < 0)
+		BLKCACHE_sram_kb = 0;
+	if (BLKCACHE_psram_kb < 0)
+		BLKCACHE_psram_kb = 0;
+	return TRUE;
+}
+
+int BLKCACHE_ReadConfig(char *string, char *ptr)
+{
+	if (strcmp(string, "BLKCACHE_SRAM_KB") == 0)
+		BLKCACHE_sram_kb = Util_sscandec(ptr);
+	else if (strcmp(string, "BLKCACHE_PSRAM_KB") == 0)
+		BLKCACHE_psram_kb = Util_sscandec(ptr);
+	else
+		return FALSE;
+	return BLKCACHE_sram_kb >= 0 && BLKCACHE_psram_kb >= 0;
+}
+
+void BLKCACHE_WriteConfig(FIL *fp)
+{
+	fprintf(fp, "BLKCACHE_SRAM_KB=%d\n", BLKCACHE_sram_kb);
+	fprintf(fp, "BLKCACHE_PSRAM_KB=%d\n", BLKCACHE_psram_kb);
+}
+
+void BLKCACHE_Exit(void)
+{
+	BLKCACHE_dev_t *dev;
+	int j;
+	for (j = 0; jobs != NULL && j < JOBS; j++)
+		IOQUEUE_Wait(&jobs[j].req);
+	IOQUEUE_Poll();
+	if (dirty_count > 0 && !BLKCACHE_Flush(NULL))
+		Log_print("Could not write back the disk block cache");
+	for (dev = devs; dev != NULL; dev = dev->link)
+		Log_print("%s: %lu blocks read, %lu from cache, %lu written; %lu card reads, %lu card writes",
+		          dev->name, (unsigned long) dev->reads, (unsigned long) dev->hits,
+		          (unsigned long) dev->writes, (unsigned long) dev->card_reads,
+		          (unsigned long) dev->card_writes);
+}
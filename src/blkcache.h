@@ -0,0 +1,93 @@
+#ifndef BLKCACHE_H_
+#define BLKCACHE_H_
+
+#include "config.h"
+#include "atari.h"
+#include "ff.h"
+
+/* Block cache for the files behind emulated storage: disk images of SIO
+   drives, IDE and SCSI hard disk images and files opened through H:.
+   Files are read and written in BLKCACHE_BLOCK_SIZE blocks at offsets that
+   are multiples of it, so each FatFS call moves whole card sectors, and
+   the blocks are kept in an LRU in SRAM, backed by a larger one in PSRAM
+   when there is PSRAM.  A device reading on from where it stopped gets
+   the following blocks read ahead.  Blocks written stay dirty until they
+   are evicted, the device flushes or releases the file, or no device has
+   written for BLKCACHE_WRITEBACK_FRAMES frames.
+
+   With a storage worker (see ioqueue.h), reading ahead and writing back
+   after the frames without writes are done by the worker, and a device
+   can have blocks read meanwhile with BLKCACHE_Fetch.
+
+   Each device has a BLKCACHE_dev_t, which counts its requests and card
+   accesses.  A file is only to be accessed through the cache from its
+   first BLKCACHE_Read or BLKCACHE_Write until BLKCACHE_Release. */
+
+#define BLKCACHE_BLOCK_SIZE 512
+/* Most blocks moved by one FatFS call, also the read-ahead. */
+#define BLKCACHE_RUN 8
+#define BLKCACHE_WRITEBACK_FRAMES 50
+/* The top of the PSRAM chip, above the cartridge images, holds the second
+   level.  The chip is 2 MB at least (see psram_spi.h); on one too small
+   for all of them the rewind log is cut short, and there are no boot
+   snapshots and less room or none for cartridge images. */
+#define BLKCACHE_PSRAM_MAX 0x80000
+#define BLKCACHE_PSRAM_BASE (PSRAM_SIZE - BLKCACHE_PSRAM_MAX)
+
+typedef struct BLKCACHE_dev_t {
+	const char *name;
+	int write_through;	/* writes reach the file at once */
+	ULONG reads;		/* blocks requested */
+	ULONG hits;			/* of them found in the cache */
+	ULONG writes;		/* blocks written */
+	ULONG card_reads;	/* FatFS reads made for the device */
+	ULONG card_writes;	/* FatFS writes made for the device */
+	/* private */
+	FIL *stream;		/* file and position following the last read */
+	FSIZE_t stream_pos;
+	struct BLKCACHE_dev_t *link;
+	int registered;
+	int fetched;		/* the worker has read for BLKCACHE_Fetch */
+} BLKCACHE_dev_t;
+
+/* Cache sizes in KB, taking effect when the cache is first used.  With
+   BLKCACHE_sram_kb 0 the devices access their files directly. */
+extern int BLKCACHE_sram_kb;
+extern int BLKCACHE_psram_kb;
+
+int BLKCACHE_Initialise(int *argc, char *argv[]);
+int BLKCACHE_ReadConfig(char *string, char *ptr);
+void BLKCACHE_WriteConfig(FIL *fp);
+/* Writes back all dirty blocks and logs what each device did. */
+void BLKCACHE_Exit(void);
+
+/* Reads LEN bytes of FILE at POS to BUF and stores the number read, less
+   than LEN only at the end of the file, in *BR.  Returns FALSE on a FatFS
+   error. */
+int BLKCACHE_Read(BLKCACHE_dev_t *dev, FIL *file, FSIZE_t pos, void *buf, UINT len, UINT *br);
+/* Writes LEN bytes from BUF to FILE at POS and stores the number written
+   in *BW.  Returns FALSE on a FatFS error. */
+int BLKCACHE_Write(BLKCACHE_dev_t *dev, FIL *file, FSIZE_t pos, const void *buf, UINT len, UINT *bw);
+/* Writes the dirty blocks of FILE, or of all files if NULL, and syncs the
+   files.  Returns FALSE on a FatFS error. */
+int BLKCACHE_Flush(FIL *file);
+/* Builds a cluster link map of FILE, so that seeking in it does not follow
+   the FAT chain, and returns TRUE if the file is in one fragment on the
+   card.  Whole blocks of such a file are then read and written with the
+   disk driver directly.  Meant for images that do not grow: the map goes
+   when FILE is written past its end, or released. */
+int BLKCACHE_Map(FIL *file);
+/* Returns TRUE if LEN bytes of FILE at POS can be read at once: they are
+   cached, the worker has just tried to read them, or there is no worker.
+   Otherwise has the worker read them and returns FALSE; the device asks
+   again later, letting emulated time pass meanwhile. */
+int BLKCACHE_Fetch(BLKCACHE_dev_t *dev, FIL *file, FSIZE_t pos, UINT len);
+/* Flushes FILE and forgets its blocks, before it is closed. */
+void BLKCACHE_Release(FIL *file);
+/* Returns the heap the cache takes at the sizes set, with link maps. */
+size_t BLKCACHE_HeapSize(void);
+
+/* Called between frames; writes back once writes have stopped. */
+void BLKCACHE_Frame(void);
+
+#endif /* BLKCACHE_H_ */
@@ -0,0 +1,297 @@
+/*
+ * bootsnap.c - Machine snapshots taken where the OS starts booting
+ *
+ * Copyright (C) 2026 Atari800 development team (see DOC/CREDITS)
+ *
+ * This file is part of the Atari800 emulator project which emulates
+ * the Atari 400, 800, 800XL, 130XE, and 5200 8-bit computers.
+ *
+ * Atari800 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Atari800 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Atari800; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "config.h"
+#include <string.h>
+#include <pico/time.h>
+#include "atari.h"
+#include "antic.h"
+#include "binload.h"
+#include "blkcache.h"
+#include "bootsnap.h"
+#include "cartcache.h"
+#include "cartridge.h"
+#include "cassette.h"
+#include "cpu.h"
+#include "crc32.h"
+#include "devices.h"
+#include "esc.h"
+#include "gtia.h"
+#include "log.h"
+#include "memory.h"
+#include "pokey.h"
+#include "util.h"
+#include "psram_spi.h"
+#include "libatari800/statesav.h"
+#ifdef AF80
+#include "af80.h"
+#endif
+#ifdef BIT3
+#include "bit3.h"
+#endif
+
+BOOTSNAP_stats_t BOOTSNAP_stats;
+int BOOTSNAP_enabled = TRUE;
+
+/* BOOTSNAP_DIR/<CRC32 of the key>.snp holds a header_t and the state. */
+#define BOOTSNAP_DIR "/.a800boot"
+#define BOOTSNAP_MAGIC 0x53423841 /* "A8BS" */
+#define BOOTSNAP_VERSION 1
+
+/* What the OS initialisation depends on */
+typedef struct {
+	ULONG magic;
+	ULONG version;
+	ULONG machine_type;
+	ULONG os_version;
+	ULONG os_crc;
+	ULONG ram_size;
+	ULONG builtin_basic;
+	ULONG basic;		/* BASIC not disabled by Option */
+	ULONG tv_mode;
+	ULONG patches;		/* devices patched into the OS */
+} snapkey_t;
+
+typedef struct {
+	snapkey_t key;
+	ULONG size;			/* of the state */
+	/* what the state leaves out */
+	ULONG consol_override;
+	ULONG random_counter;
+} header_t;
+
+/* the key of the snapshot to be taken at the next SIO call, if taking */
+static snapkey_t pending;
+static int taking = FALSE;
+/* set while a cold start is run again after a failed restore */
+static int redo = FALSE;
+
+/* Returns FALSE if a cold start in the current configuration has to run
+   in full, otherwise sets KEY. */
+static int GetKey(snapkey_t *key)
+{
+	if (!BOOTSNAP_enabled || redo || !PSRAM_AVAILABLE || !ESC_enable_sio_patch
+	    || BOOTSNAP_PSRAM_BASE + BOOTSNAP_PSRAM_SIZE > BLKCACHE_PSRAM_BASE
+	    || Atari800_machine_type == Atari800_MACHINE_5200
+	    || CARTRIDGE_main.type != CARTRIDGE_NONE
+	    || CARTRIDGE_piggyback.type != CARTRIDGE_NONE
+	    || CASSETTE_hold_start)
+		return FALSE;
+#ifdef AF80
+	if (AF80_enabled)
+		return FALSE;
+#endif
+#ifdef BIT3
+	if (BIT3_enabled)
+		return FALSE;
+#endif
+	memset(key, 0, sizeof(*key));
+	key->magic = BOOTSNAP_MAGIC;
+	key->version = BOOTSNAP_VERSION;
+	key->machine_type = Atari800_machine_type;
+	key->os_version = Atari800_os_version;
+	/* computed each time: the OS is loaded again when the system or the
+	   ROM settings change */
+	key->os_crc = CRC32_Update(0xffffffff, MEMORY_os, sizeof(MEMORY_os));
+	key->ram_size = MEMORY_ram_size;
+	key->builtin_basic = Atari800_builtin_basic;
+	key->basic = !Atari800_disable_basic || BINLOAD_loading_basic;
+	key->tv_mode = Atari800_tv_mode;
+	key->patches = Devices_enable_h_patch | Devices_enable_p_patch << 1
+	               | Devices_enable_r_patch << 2 | Devices_enable_b_patch << 3;
+	return TRUE;
+}
+
+static void Name(char *path, const snapkey_t *key)
+{
+	snprintf(path, FILENAME_MAX, BOOTSNAP_DIR "/%08lx.snp",
+	         (unsigned long) CRC32_Update(0xffffffff, (const UBYTE *) key, sizeof(*key)));
+}
+
+/* Copies the snapshot of KEY from the card to PSRAM.  Returns FALSE if
+   there is none, or none that can be read. */
+static int ReadFile(const snapkey_t *key, header_t *header)
+{
+	char path[FILENAME_MAX];
+	UBYTE buf[512];
+	FIL f;
+	UINT n;
+	ULONG pos;
+	int ok;
+	Name(path, key);
+	if (f_open(&f, path, FA_READ) != FR_OK)
+		return FALSE;
+	ok = f_read(&f, header, sizeof(*header), &n) == FR_OK && n == sizeof(*header)
+	  && memcmp(&header->key, key, sizeof(*key)) == 0
+	  && header->size <= BOOTSNAP_PSRAM_SIZE;
+	for (pos = 0; ok && pos < header->size; pos += n) {
+		UINT len = header->size - pos < sizeof(buf) ? header->size - pos : sizeof(buf);
+		ok = f_read(&f, buf, len, &n) == FR_OK && n == len;
+		if (ok)
+			writepsram(BOOTSNAP_PSRAM_BASE + pos, buf, n);
+	}
+	f_close(&f);
+	if (!ok) {
+		Log_print("Boot snapshot %s is damaged", path);
+		BOOTSNAP_stats.failures++;
+		f_unlink(path);
+	}
+	return ok;
+}
+
+/* Saves the snapshot in PSRAM under HEADER to the card. */
+static int WriteFile(const header_t *header)
+{
+	char path[FILENAME_MAX];
+	UBYTE buf[512];
+	FIL f;
+	UINT n;
+	ULONG pos;
+	int ok;
+	Name(path, &header->key);
+	f_mkdir(BOOTSNAP_DIR);
+	if (f_open(&f, path, FA_WRITE | FA_CREATE_ALWAYS) != FR_OK)
+		return FALSE;
+	ok = f_write(&f, header, sizeof(*header), &n) == FR_OK && n == sizeof(*header);
+	for (pos = 0; ok && pos < header->size; pos += n) {
+		UINT len = header->size - pos < sizeof(buf) ? header->size - pos : sizeof(buf);
+		readpsram(BOOTSNAP_PSRAM_BASE + pos, buf, len);
+		ok = f_write(&f, buf, len, &n) == FR_OK && n == len;
+	}
+	if (f_close(&f) != FR_OK || !ok) {
+		f_unlink(path);
+		return FALSE;
+	}
+	return TRUE;
+}
+
+void BOOTSNAP_Coldstart(void)
+{
+	header_t header;
+	ULONG start = time_us_32();
+	/* the snapshot is of the middle of a frame; the frame goes on */
+	int xpos = ANTIC_xpos;
+	int xpos_limit = ANTIC_xpos_limit;
+	int ypos = ANTIC_ypos;
+
+	taking = FALSE;
+	if (!GetKey(&pending))
+		return;
+	if (!ReadFile(&pending, &header)) {
+		BOOTSNAP_stats.misses++;
+		taking = TRUE;
+		return;
+	}
+	if (!LIBATARI800_MachineLoadPSRAM(BOOTSNAP_PSRAM_BASE)) {
+		char path[FILENAME_MAX];
+		Name(path, &pending);
+		Log_print("Boot snapshot %s could not be restored", path);
+		BOOTSNAP_stats.failures++;
+		f_unlink(path);
+		/* the machine may be half restored */
+		redo = TRUE;
+		Atari800_Coldstart();
+		redo = FALSE;
+		return;
+	}
+	ANTIC_xpos = xpos;
+	ANTIC_xpos_limit = xpos_limit;
+	ANTIC_ypos = ypos;
+	GTIA_consol_override = header.consol_override;
+	POKEY_SetRandomCounter(header.random_counter);
+#ifdef DIRTY_PAGES
+	MEMORY_SetAllDirty();
+#endif
+	BOOTSNAP_stats.restores++;
+	BOOTSNAP_stats.restore_us = time_us_32() - start;
+}
+
+void BOOTSNAP_SIOCall(void)
+{
+	header_t header;
+	statesav_tags_t tags;
+	ULONG start;
+	int ok;
+
+	/* a large cartridge image may lie over the snapshot, if it was
+	   inserted without a reboot */
+	if (!taking || CARTCACHE_HoldsRewindArea())
+		return;
+	taking = FALSE;
+	/* COLDST is cleared when the OS has booted: this is a program, and
+	   the OS never called SIO to boot */
+	if (MEMORY_dGetByte(0x244) == 0)
+		return;
+	start = time_us_32();
+	/* the restored machine starts with the call to the SIO patch */
+	CPU_regPC -= 2;
+	ok = LIBATARI800_MachineSavePSRAM(BOOTSNAP_PSRAM_BASE, &tags);
+	CPU_regPC += 2;
+	if (ok) {
+		memset(&header, 0, sizeof(header));
+		header.key = pending;
+		header.size = tags.size;
+		header.consol_override = GTIA_consol_override;
+		header.random_counter = POKEY_GetRandomCounter();
+		ok = WriteFile(&header);
+	}
+	if (!ok) {
+		BOOTSNAP_stats.failures++;
+		return;
+	}
+	BOOTSNAP_stats.captures++;
+	BOOTSNAP_stats.capture_us = time_us_32() - start;
+}
+
+int BOOTSNAP_Initialise(int *argc, char *argv[])
+{
+	int i;
+	int j;
+	for (i = j = 1; i < *argc; i++) {
+		if (strcmp(argv[i], "-bootsnap") == 0)
+			BOOTSNAP_enabled = TRUE;
+		else if (strcmp(argv[i], "-no-bootsnap") == 0)
+			BOOTSNAP_enabled = FALSE;
+		else {
+			if (strcmp(argv[i], "-help") == 0) {
+				Log_print("\t-bootsnap            Restore cold starts from boot snapshots");
+				Log_print("\t-no-bootsnap         Always run cold starts in full");
+			}
+			argv[j++] = argv[i];
+		}
+	}
+	*argc = j;
+	return TRUE;
+}
+
+int BOOTSNAP_ReadConfig(char *string, char *ptr)
+{
+	if (strcmp(string, "BOOT_SNAPSHOTS") == 0)
+		return (BOOTSNAP_enabled = Util_sscanbool(ptr)) != -1;
+	return FALSE;
+}
+
+void BOOTSNAP_WriteConfig(FIL *fp)
+{
+	fprintf(fp, "BOOT_SNAPSHOTS=%d\n", BOOTSNAP_enabled);
+}
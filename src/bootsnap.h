@@ -0,0 +1,50 @@
+#ifndef BOOTSNAP_H_
+#define BOOTSNAP_H_
+
+#include "config.h"
+#include "atari.h"
+#include "ff.h"
+#include "rewind.h"
+
+/* Boot snapshots.  A cold start runs the OS memory test and initialisation
+   before the OS first calls SIO to boot from disk, and all of that comes
+   out the same for the same machine type, OS ROM, RAM size, BASIC and
+   patched devices.  So the machine is saved to the card at that first SIO
+   call, and a later cold start with the same configuration restores it
+   instead and goes on with the SIO call, booting whatever is mounted by
+   then.  A cold start with a cartridge inserted, Start held for a cassette
+   boot, without the SIO patch, without PSRAM or with a chip of 4 MB or less
+   (see blkcache.h) runs in full. */
+
+/* PSRAM between the rewind ring and the cartridge images holds the
+   snapshot while it is saved or restored. */
+#define BOOTSNAP_PSRAM_BASE (REWIND_PSRAM_BASE + REWIND_HEAD_SIZE + REWIND_LOG_SIZE)
+#define BOOTSNAP_PSRAM_SIZE REWIND_HEAD_SIZE
+
+typedef struct {
+	ULONG captures;		/* snapshots saved */
+	ULONG restores;		/* cold starts restored from a snapshot */
+	ULONG misses;		/* cold starts with no snapshot for them */
+	ULONG failures;		/* snapshots that could not be saved or read */
+	ULONG capture_us;	/* duration of the last save */
+	ULONG restore_us;	/* duration of the last restore */
+} BOOTSNAP_stats_t;
+
+extern BOOTSNAP_stats_t BOOTSNAP_stats;
+
+/* TRUE to use boot snapshots (default). */
+extern int BOOTSNAP_enabled;
+
+int BOOTSNAP_Initialise(int *argc, char *argv[]);
+int BOOTSNAP_ReadConfig(char *string, char *ptr);
+void BOOTSNAP_WriteConfig(FIL *fp);
+
+/* Called at the end of Atari800_Coldstart; restores the snapshot of the
+   current configuration, or has one taken if there is none. */
+void BOOTSNAP_Coldstart(void);
+
+/* Called by the SIO patch before it runs a command; saves the snapshot
+   when one is to be taken. */
+void BOOTSNAP_SIOCall(void);
+
+#endif /* BOOTSNAP_H_ */
@@ -0,0 +1,554 @@
+/*
+ * cartcache.c - Bank cache for large cartridge images
+ *
+ * Copyright (C) 2026 Atari800 development team (see DOC/CREDITS)
+ *
+ * This file is part of the Atari800 emulator project which emulates
+ * the Atari 400, 800, 800XL, 130XE, and 5200 8-bit computers.
+ *
+ * Atari800 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Atari800 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Atari800; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "config.h"
+#include <stdlib.h>
+#include <string.h>
+#include <pico/time.h>
+#include "atari.h"
+#include "cartcache.h"
+#include "cartdb.h"
+#include "cartridge.h"
+#include "log.h"
+#include "rewind.h"
+#include "util.h"
+#include "psram_spi.h"
+
+CARTCACHE_stats_t CARTCACHE_stats;
+
+/* Where an image is kept.  The main cartridge fills PSRAM upwards from
+   CARTCACHE_PSRAM_BASE, or from CARTCACHE_PSRAM_LOW if it is too big for
+   that, and the piggyback one downwards from CARTCACHE_PSRAM_END; an image
+   that does not fit stays in its file.
+   Images of up to 128 KB get room for a decoded copy after (or before)
+   them, for CARTCACHE_Decode. */
+enum { STORE_NONE, STORE_PSRAM, STORE_FILE };
+
+typedef struct {
+	const CARTRIDGE_image_t *cart;	/* owner, NULL if the store is free */
+	int kind;
+	ULONG addr;			/* PSRAM address of the image in use */
+	ULONG raw_addr;		/* PSRAM address of the image as read */
+	ULONG size;
+	ULONG offset;		/* of the image in its file */
+	FIL file;			/* open while kind is STORE_FILE */
+	int dirty;			/* written since it was read */
+	int next_bank;		/* first bank to be read ahead, -1 if none */
+	int next_count;		/* banks to be read ahead */
+	/* What raw_addr holds after the store is closed, so that inserting
+	   the same cartridge again (e.g. when a state is restored) does not
+	   copy it from the card once more. */
+	char held_name[FILENAME_MAX];
+	FSIZE_t held_fsize;
+	ULONG held_stamp;
+	ULONG held_offset;
+	ULONG held_addr;
+	ULONG held_size;
+	CARTDB_scan_t held_scan;
+} store_t;
+
+static store_t stores[2];
+
+typedef struct {
+	store_t *store;		/* NULL if the slot is free */
+	int bank;
+	ULONG used;			/* clock of the last use */
+	int prefetched;		/* read ahead and not used yet */
+} slot_t;
+
+static slot_t slots[CARTCACHE_SLOTS];
+static UBYTE *slot_data = NULL;
+static ULONG clock;
+
+#define DECODE_MAX_SIZE 0x20000
+
+static store_t *find_store(const CARTRIDGE_image_t *cart)
+{
+	int i;
+	for (i = 0; i < 2; i++)
+		if (stores[i].cart == cart)
+			return &stores[i];
+	return NULL;
+}
+
+static int in_use(void)
+{
+	return stores[0].cart != NULL || stores[1].cart != NULL;
+}
+
+/* PSRAM taken by a store, the decoded copy included. */
+static ULONG reserved(ULONG size)
+{
+	size = (size + 0xfff) & ~0xfff;
+	return size <= DECODE_MAX_SIZE ? 2 * size : size;
+}
+
+/* Sets *LO and *HI to the PSRAM range that STORE takes with an image of
+   SIZE bytes at ADDR, the decoded copy included. */
+static void reserved_range(const store_t *store, ULONG addr, ULONG size, ULONG *lo, ULONG *hi)
+{
+	*lo = addr;
+	if (store != &stores[0])
+		*lo -= reserved(size) - ((size + 0xfff) & ~0xfff);
+	*hi = *lo + reserved(size);
+}
+
+static void free_slots(void)
+{
+	if (!in_use()) {
+		Util_free(slot_data);
+		slot_data = NULL;
+	}
+}
+
+static void drop_slots(const store_t *store)
+{
+	int i;
+	for (i = 0; i < CARTCACHE_SLOTS; i++)
+		if (slots[i].store == store)
+			slots[i].store = NULL;
+}
+
+static void read_store(store_t *store, ULONG pos, UBYTE *dst, ULONG len)
+{
+	UINT br = 0;
+	if (store->kind == STORE_PSRAM) {
+		readpsram(store->addr + pos, dst, len);
+		return;
+	}
+	if (f_lseek(&store->file, store->offset + pos) != FR_OK
+	    || f_read(&store->file, dst, len, &br) != FR_OK)
+		br = 0;
+	/* a short file reads as unconnected lines */
+	if (br < len)
+		memset(dst + br, 0xff, len - br);
+}
+
+static void write_store(store_t *store, ULONG pos, const UBYTE *src, ULONG len)
+{
+	UINT bw;
+	if (store->kind == STORE_PSRAM)
+		writepsram(store->addr + pos, src, len);
+	else if (f_lseek(&store->file, store->offset + pos) == FR_OK)
+		f_write(&store->file, src, len, &bw);
+	store->dirty = TRUE;
+}
+
+/* Returns the slot holding BANK, reading it in the least recently used
+   slot if no slot does. */
+static slot_t *get_bank(store_t *store, int bank, int prefetch)
+{
+	slot_t *victim = &slots[0];
+	ULONG len;
+	int i;
+	for (i = 0; i < CARTCACHE_SLOTS; i++) {
+		slot_t *s = &slots[i];
+		if (s->store == store && s->bank == bank) {
+			if (!prefetch) {
+				CARTCACHE_stats.hits++;
+				if (s->prefetched)
+					CARTCACHE_stats.prefetch_hits++;
+				s->prefetched = FALSE;
+				s->used = ++clock;
+			}
+			return s;
+		}
+		if (s->store == NULL)
+			victim = s;
+		else if (victim->store != NULL && s->used < victim->used)
+			victim = s;
+	}
+	len = store->size - (ULONG) bank * CARTCACHE_BANK_SIZE;
+	if (len > CARTCACHE_BANK_SIZE)
+		len = CARTCACHE_BANK_SIZE;
+	read_store(store, (ULONG) bank * CARTCACHE_BANK_SIZE, slot_data + (victim - slots) * CARTCACHE_BANK_SIZE, len);
+	victim->store = store;
+	victim->bank = bank;
+	victim->prefetched = prefetch;
+	victim->used = ++clock;
+	if (prefetch)
+		CARTCACHE_stats.prefetches++;
+	else
+		CARTCACHE_stats.misses++;
+	return victim;
+}
+
+/* Copies the image from the store's file to PSRAM, scanning it on the way. */
+static int load_psram(store_t *store, CARTDB_scan_t *scan)
+{
+	UBYTE *buf = slot_data;
+	ULONG pos = 0;
+	while (pos < store->size) {
+		UINT br;
+		ULONG len = store->size - pos;
+		if (len > CARTCACHE_BANK_SIZE * CARTCACHE_SLOTS)
+			len = CARTCACHE_BANK_SIZE * CARTCACHE_SLOTS;
+		if (f_read(&store->file, buf, len, &br) != FR_OK || br != len)
+			return FALSE;
+		writepsram(store->raw_addr + pos, buf, len);
+		CARTDB_Scan(scan, buf, len);
+		pos += len;
+	}
+	CARTDB_ScanEnd(scan);
+	return TRUE;
+}
+
+static void scan_file(store_t *store, CARTDB_scan_t *scan)
+{
+	ULONG pos;
+	for (pos = 0; pos < store->size; pos += CARTCACHE_BANK_SIZE * CARTCACHE_SLOTS) {
+		ULONG len = store->size - pos;
+		if (len > CARTCACHE_BANK_SIZE * CARTCACHE_SLOTS)
+			len = CARTCACHE_BANK_SIZE * CARTCACHE_SLOTS;
+		read_store(store, pos, slot_data, len);
+		CARTDB_Scan(scan, slot_data, len);
+	}
+	CARTDB_ScanEnd(scan);
+}
+
+int CARTCACHE_Open(const CARTRIDGE_image_t *cart, const char *filename, ULONG offset, ULONG size, CARTDB_scan_t *scan)
+{
+	store_t *store = &stores[cart == &CARTRIDGE_piggyback];
+	store_t *other = &stores[cart != &CARTRIDGE_piggyback];
+	FILINFO info;
+	ULONG stamp;
+
+	CARTCACHE_Close(cart, FALSE);
+	if (f_stat(filename, &info) != FR_OK)
+		return FALSE;
+	stamp = ((ULONG) info.fdate << 16) | info.ftime;
+	if (slot_data == NULL)
+		slot_data = (UBYTE *) Util_malloc(CARTCACHE_SLOTS * CARTCACHE_BANK_SIZE, "cartcache_slots");
+	memset(slots, 0, sizeof(slots));
+
+	/* both stores must fit between the ends of the area */
+	store->kind = STORE_FILE;
+	if (PSRAM_AVAILABLE) {
+		ULONG lo = CARTCACHE_PSRAM_BASE;
+		ULONG hi = CARTCACHE_PSRAM_END;
+		if (other->cart != NULL && other->kind == STORE_PSRAM) {
+			if (store == &stores[0])
+				hi = other->raw_addr - (reserved(other->size) - ((other->size + 0xfff) & ~0xfff));
+			else
+				lo = other->raw_addr + reserved(other->size);
+		}
+		if (lo < hi && reserved(size) <= hi - lo) {
+			store->kind = STORE_PSRAM;
+			store->raw_addr = store == &stores[0] ? lo : hi - ((size + 0xfff) & ~0xfff);
+		}
+		else if (store == &stores[0] && reserved(size) <= hi - CARTCACHE_PSRAM_LOW) {
+			store->kind = STORE_PSRAM;
+			store->raw_addr = CARTCACHE_PSRAM_LOW;
+		}
+	}
+	/* the image the other store kept after it was closed is lost if this
+	   store's image or decoded copy goes over it */
+	if (store->kind == STORE_PSRAM && other->cart == NULL && other->held_name[0] != '\0') {
+		ULONG lo, hi;
+		reserved_range(store, store->raw_addr, size, &lo, &hi);
+		if (lo < other->held_addr + ((other->held_size + 0xfff) & ~0xfff) && other->held_addr < hi)
+			other->held_name[0] = '\0';
+	}
+	if (f_open(&store->file, filename, FA_READ | FA_WRITE) != FR_OK
+	    && f_open(&store->file, filename, FA_READ) != FR_OK) {
+		free_slots();
+		return FALSE;
+	}
+	store->size = size;
+	store->offset = offset;
+	store->addr = store->raw_addr;
+	store->dirty = FALSE;
+	store->next_bank = -1;
+
+	if (store->kind == STORE_PSRAM) {
+		/* the image scanned when it was copied here still holds */
+		if (store->held_addr != store->raw_addr || store->held_size != size
+		    || store->held_offset != offset || store->held_fsize != info.fsize
+		    || store->held_stamp != stamp || strcmp(store->held_name, filename) != 0) {
+			store->held_name[0] = '\0';
+			CARTDB_ScanInit(&store->held_scan);
+			if (f_lseek(&store->file, offset) != FR_OK || !load_psram(store, &store->held_scan)) {
+				f_close(&store->file);
+				free_slots();
+				return FALSE;
+			}
+			Util_strlcpy(store->held_name, filename, sizeof(store->held_name));
+			store->held_fsize = info.fsize;
+			store->held_stamp = stamp;
+			store->held_offset = offset;
+			store->held_addr = store->raw_addr;
+			store->held_size = size;
+		}
+		/* a writable image may be written back; keep the file until then */
+		f_close(&store->file);
+		if (scan != NULL)
+			*scan = store->held_scan;
+	}
+	else {
+		if (f_size(&store->file) < offset + size) {
+			f_close(&store->file);
+			free_slots();
+			return FALSE;
+		}
+		/* banks are fetched from all over the image */
+		BLKCACHE_Map(&store->file);
+		if (scan != NULL) {
+			CARTDB_ScanInit(scan);
+			scan_file(store, scan);
+		}
+	}
+	store->cart = cart;
+	Log_print("cartcache: %lu KB image kept in %s", (unsigned long) (size >> 10),
+	          store->kind == STORE_PSRAM ? "PSRAM" : "its file");
+	if (CARTCACHE_HoldsRewindArea()) {
+		REWIND_Clear();
+		Log_print("cartcache: no rewind while the image is inserted");
+	}
+	return TRUE;
+}
+
+void CARTCACHE_Close(const CARTRIDGE_image_t *cart, int write_back)
+{
+	store_t *store = find_store(cart);
+	if (store == NULL)
+		return;
+	if (write_back && store->dirty) {
+		FIL *fp = &store->file;
+		UINT bw;
+		int sum = 0;
+		ULONG pos;
+		if (store->kind == STORE_PSRAM && f_open(fp, store->held_name, FA_WRITE) != FR_OK)
+			fp = NULL;
+		for (pos = 0; fp != NULL && pos < store->size; pos += CARTCACHE_BANK_SIZE) {
+			ULONG len = store->size - pos;
+			ULONG i;
+			if (len > CARTCACHE_BANK_SIZE)
+				len = CARTCACHE_BANK_SIZE;
+			read_store(store, pos, slot_data, len);
+			if (store->kind == STORE_PSRAM && (f_lseek(fp, store->offset + pos) != FR_OK
+			                                   || f_write(fp, slot_data, len, &bw) != FR_OK))
+				fp = NULL;
+			for (i = 0; i < len; i++)
+				sum += slot_data[i];
+		}
+		if (fp != NULL && !cart->raw && store->offset >= 16) {
+			UBYTE header[8];
+			header[0] = cart->type >> 24;
+			header[1] = cart->type >> 16;
+			header[2] = cart->type >> 8;
+			header[3] = cart->type;
+			header[4] = sum >> 24;
+			header[5] = sum >> 16;
+			header[6] = sum >> 8;
+			header[7] = sum;
+			if (f_lseek(fp, 4) == FR_OK)
+				f_write(fp, header, sizeof(header), &bw);
+		}
+		if (fp == NULL)
+			Log_print("cartcache: error writing \"%s\"", store->held_name);
+		if (store->kind == STORE_PSRAM && fp != NULL)
+			f_close(fp);
+	}
+	if (store->kind == STORE_FILE) {
+		BLKCACHE_Release(&store->file);
+		f_close(&store->file);
+	}
+	/* the file has changed, or no longer matches the PSRAM copy; or the
+	   rewind ring is to write over it */
+	if (store->dirty || store->raw_addr < CARTCACHE_PSRAM_BASE)
+		store->held_name[0] = '\0';
+	drop_slots(store);
+	store->cart = NULL;
+	store->kind = STORE_NONE;
+	free_slots();
+}
+
+int CARTCACHE_Holds(const CARTRIDGE_image_t *cart)
+{
+	return find_store(cart) != NULL;
+}
+
+int CARTCACHE_HoldsRewindArea(void)
+{
+	return stores[0].cart != NULL && stores[0].kind == STORE_PSRAM
+	       && stores[0].raw_addr < CARTCACHE_PSRAM_BASE;
+}
+
+void CARTCACHE_Read(const CARTRIDGE_image_t *cart, ULONG offset, UBYTE *dst, ULONG len)
+{
+	store_t *store = find_store(cart);
+	ULONG start = time_us_32();
+	ULONG us;
+	int first = offset / CARTCACHE_BANK_SIZE;
+	int bank = first;
+	if (store == NULL)
+		return;
+	while (len > 0) {
+		ULONG pos = offset % CARTCACHE_BANK_SIZE;
+		ULONG n = CARTCACHE_BANK_SIZE - pos;
+		slot_t *s;
+		if (n > len)
+			n = len;
+		bank = offset / CARTCACHE_BANK_SIZE;
+		if (offset >= store->size)
+			memset(dst, 0xff, n);
+		else {
+			s = get_bank(store, bank, FALSE);
+			memcpy(dst, slot_data + (s - slots) * CARTCACHE_BANK_SIZE + pos, n);
+		}
+		offset += n;
+		dst += n;
+		len -= n;
+	}
+	/* a program that steps through the banks maps the same number of
+	   them from the next one on */
+	if ((ULONG) (bank + 1) * CARTCACHE_BANK_SIZE < store->size) {
+		store->next_bank = bank + 1;
+		store->next_count = bank + 1 - first;
+		if (store->next_count > CARTCACHE_SLOTS / 2)
+			store->next_count = CARTCACHE_SLOTS / 2;
+	}
+	us = time_us_32() - start;
+	CARTCACHE_stats.switch_us = us;
+	if (us > CARTCACHE_stats.max_switch_us)
+		CARTCACHE_stats.max_switch_us = us;
+}
+
+void CARTCACHE_Write(const CARTRIDGE_image_t *cart, ULONG offset, const UBYTE *src, ULONG len)
+{
+	store_t *store = find_store(cart);
+	int i;
+	if (store == NULL || offset >= store->size)
+		return;
+	if (len > store->size - offset)
+		len = store->size - offset;
+	write_store(store, offset, src, len);
+	/* keep cached copies of the banks written in step */
+	for (i = 0; i < CARTCACHE_SLOTS; i++) {
+		ULONG bank_start = (ULONG) slots[i].bank * CARTCACHE_BANK_SIZE;
+		ULONG from = offset > bank_start ? offset : bank_start;
+		ULONG to = offset + len < bank_start + CARTCACHE_BANK_SIZE ? offset + len : bank_start + CARTCACHE_BANK_SIZE;
+		if (slots[i].store == store && from < to)
+			memcpy(slot_data + i * CARTCACHE_BANK_SIZE + (from - bank_start), src + (from - offset), to - from);
+	}
+	CARTCACHE_stats.writes++;
+}
+
+/* Returns where the byte at ROM_ADDR goes in a decoded image.  The ATRAX
+   maps swap single address lines, so the result for an address is the OR
+   of those for its low and its high bits. */
+static ULONG decoded_addr(ULONG rom_addr, const unsigned int addr[17])
+{
+	ULONG to = 0;
+	int n;
+	for (n = 0; n < 17; n++)
+		if (rom_addr & addr[n])
+			to |= 1 << n;
+	return to;
+}
+
+/* Decoding writes the image out through a window of DECODE_WINDOW bytes of
+   slot_data, in as many passes as it takes.  The rest of slot_data holds
+   the tables and a piece of the image as read. */
+#define DECODE_WINDOW 0x4000
+#define DECODE_PIECE 0x100
+
+int CARTCACHE_Decode(const CARTRIDGE_image_t *cart, const unsigned int addr[17], const unsigned char data[8])
+{
+	store_t *store = find_store(cart);
+	ULONG *to_low;
+	UBYTE *value;
+	UBYTE *piece;
+	ULONG low_bits = 0;
+	ULONG decoded;
+	ULONG window;
+	int i;
+	if (store == NULL || store->kind != STORE_PSRAM || store->size > DECODE_MAX_SIZE)
+		return FALSE;
+	/* the decoded copy goes beside the image as read, so that decoding
+	   again starts from the same bytes */
+	if (store == &stores[0])
+		decoded = store->raw_addr + ((store->size + 0xfff) & ~0xfff);
+	else
+		decoded = store->raw_addr - ((store->size + 0xfff) & ~0xfff);
+	/* the work takes slot_data, whichever store its banks are of */
+	for (i = 0; i < CARTCACHE_SLOTS; i++)
+		slots[i].store = NULL;
+	to_low = (ULONG *) (slot_data + DECODE_WINDOW);
+	value = (UBYTE *) (to_low + DECODE_PIECE);
+	piece = value + 256;
+	for (i = 0; i < DECODE_PIECE; i++) {
+		to_low[i] = decoded_addr(i, addr);
+		low_bits |= to_low[i];
+	}
+	for (i = 0; i < 256; i++) {
+		int n;
+		value[i] = 0;
+		for (n = 0; n < 8; n++)
+			if (i & (1 << n))
+				value[i] |= data[n];
+	}
+	for (window = 0; window < store->size; window += DECODE_WINDOW) {
+		ULONG len = store->size - window;
+		ULONG pos;
+		if (len > DECODE_WINDOW)
+			len = DECODE_WINDOW;
+		memset(slot_data, 0xff, len);
+		/* read the image in pieces and scatter the bytes of each that go
+		   in the window */
+		for (pos = 0; pos < store->size; pos += DECODE_PIECE) {
+			ULONG to_high = decoded_addr(pos, addr);
+			ULONG piece_len = store->size - pos;
+			ULONG j;
+			if ((to_high & ~(ULONG) (DECODE_WINDOW - 1) & ~window) != 0
+			    || (window & ~(to_high | low_bits)) != 0)
+				continue;
+			if (piece_len > DECODE_PIECE)
+				piece_len = DECODE_PIECE;
+			readpsram(store->raw_addr + pos, piece, piece_len);
+			for (j = 0; j < piece_len; j++) {
+				ULONG to = (to_high | to_low[j]) - window;
+				if (to < len)
+					slot_data[to] = value[piece[j]];
+			}
+		}
+		writepsram(decoded + window, slot_data, len);
+	}
+	store->addr = decoded;
+	return TRUE;
+}
+
+void CARTCACHE_Frame(void)
+{
+	int i;
+	for (i = 0; i < 2; i++) {
+		store_t *store = &stores[i];
+		int n;
+		if (store->cart == NULL || store->next_bank < 0)
+			continue;
+		for (n = 0; n < store->next_count; n++)
+			if ((ULONG) (store->next_bank + n) * CARTCACHE_BANK_SIZE < store->size)
+				get_bank(store, store->next_bank + n, TRUE);
+		store->next_bank = -1;
+	}
+}
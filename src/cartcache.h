@@ -0,0 +1,81 @@
+#ifndef CARTCACHE_H_
+#define CARTCACHE_H_
+
+#include "config.h"
+#include "atari.h"
+#include "cartridge.h"
+#include "cartdb.h"
+#include "bootsnap.h"
+#include "blkcache.h"
+
+/* Bank cache for cartridge images too big to keep in SRAM.  The image of
+   such a cartridge stays in PSRAM, or on the card when PSRAM has no room
+   for it, and the banks the cartridge maps are read through a small LRU
+   of CARTCACHE_SLOTS banks in SRAM.  Between frames the bank after the
+   last one read is fetched ahead.  RAM cartridges write their banks
+   through to the store and back to the file when they are removed.
+
+   A main cartridge too big for the PSRAM area of the images (e.g. a 4 MB
+   MegaCart) takes the rewind ring and the boot snapshot below it as well,
+   and there are no rewind snapshots while it is inserted.  Only without
+   PSRAM, or with a piggyback cartridge taking the top of the area, does
+   such a cartridge run from the card, and then each bank it maps that is
+   not cached stops the emulation for an 8 KB card read, about 6 ms. */
+
+#define CARTCACHE_BANK_SIZE 0x2000
+#define CARTCACHE_SLOTS 4
+/* Images up to this size are still loaded whole by CARTRIDGE_Insert. */
+#define CARTCACHE_RESIDENT_SIZE 0x8000
+/* PSRAM between the boot snapshot and the disk block cache holds the
+   images. */
+#define CARTCACHE_PSRAM_BASE (BOOTSNAP_PSRAM_BASE + BOOTSNAP_PSRAM_SIZE)
+#define CARTCACHE_PSRAM_END BLKCACHE_PSRAM_BASE
+/* Where a main image too big for the area starts. */
+#define CARTCACHE_PSRAM_LOW REWIND_PSRAM_BASE
+
+typedef struct {
+	ULONG hits;			/* banks found in the cache */
+	ULONG misses;		/* banks read from PSRAM or the card */
+	ULONG prefetches;	/* banks read ahead between frames */
+	ULONG prefetch_hits;	/* hits on banks read ahead */
+	ULONG writes;		/* bank writes of RAM cartridges */
+	ULONG switch_us;	/* duration of the last bank copy */
+	ULONG max_switch_us;	/* longest bank copy */
+} CARTCACHE_stats_t;
+
+extern CARTCACHE_stats_t CARTCACHE_stats;
+
+/* Makes the SIZE bytes of FILENAME from OFFSET on the image of CART.  If
+   SCAN is not NULL, stores the completed scan of the image in it; an image
+   copied to PSRAM is scanned while it is copied.  Returns FALSE if the
+   file could not be read. */
+int CARTCACHE_Open(const CARTRIDGE_image_t *cart, const char *filename, ULONG offset, ULONG size, CARTDB_scan_t *scan);
+
+/* Forgets the image of CART.  With WRITE_BACK, an image that was written
+   to is saved to its file first, with a new checksum if the file has a
+   CART header. */
+void CARTCACHE_Close(const CARTRIDGE_image_t *cart, int write_back);
+
+/* TRUE if the image of CART is kept by the cache. */
+int CARTCACHE_Holds(const CARTRIDGE_image_t *cart);
+
+/* TRUE while a main image lies over the rewind ring and the boot
+   snapshot, see above. */
+int CARTCACHE_HoldsRewindArea(void);
+
+/* Copies LEN bytes of the image from OFFSET on to DST. */
+void CARTCACHE_Read(const CARTRIDGE_image_t *cart, ULONG offset, UBYTE *dst, ULONG len);
+
+/* Stores LEN bytes from SRC in the image at OFFSET. */
+void CARTCACHE_Write(const CARTRIDGE_image_t *cart, ULONG offset, const UBYTE *src, ULONG len);
+
+/* Decodes an image whose address and data lines are crossed, see
+   PreprocessCart.  Byte I of the decoded image is the byte at the OR of
+   ADDR[n] for the bits n set in I, with bit n moved to DATA[n].  Needs the
+   image in PSRAM; returns FALSE if it is on the card. */
+int CARTCACHE_Decode(const CARTRIDGE_image_t *cart, const unsigned int addr[17], const unsigned char data[8]);
+
+/* Called after every frame; reads ahead the bank after the last one read. */
+void CARTCACHE_Frame(void);
+
+#endif /* CARTCACHE_H_ */
@@ -0,0 +1,273 @@
+/*
+ * cartdb.c - Identification of raw cartridge images
+ *
+ * Copyright (C) 2026 Atari800 development team (see DOC/CREDITS)
+ *
+ * This file is part of the Atari800 emulator project which emulates
+ * the Atari 400, 800, 800XL, 130XE, and 5200 8-bit computers.
+ *
+ * Atari800 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Atari800 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Atari800; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "config.h"
+#include <string.h>
+#include "atari.h"
+#include "cartdb.h"
+#include "cartridge.h"
+#include "crc32.h"
+
+/* Known images, sorted by CRC.  Generated by util/cartdb.sh, which adds
+   the images of the CART files given to it. */
+static const struct {
+	ULONG crc;
+	UWORD kb;
+	UBYTE type;
+} known[] = {
+	{ 0x3b7eeadf,    8, CARTRIDGE_STD_8 },	/* Altirra BASIC 1.58 */
+	{ 0x7d684184,    8, CARTRIDGE_STD_8 }	/* Atari BASIC revision C */
+};
+
+/* How a type switches banks, as seen in the code of its image. */
+enum {
+	SIG_NONE,	/* it does not */
+	SIG_VALUE,	/* the bank is the value stored in $D500 */
+	SIG_ADDR	/* the bank is in the address accessed, in the pages of MASK */
+};
+
+/* Which block is at $A000 after reset: the first or the second one, or
+   the last one, which the XEGS types keep there. */
+enum {
+	BOOT_FIRST,
+	BOOT_SECOND,
+	BOOT_LAST
+};
+
+/* Types CARTDB_Guess can tell apart.  Some differ only in ways the code
+   does not show (XEGS and switchable XEGS, Williams 32 and 64 KB), so an
+   image often fits more than one of them. */
+static const struct {
+	UBYTE type;
+	UBYTE boot;
+	UBYTE sig;
+	UWORD mask;
+} guesses[] = {
+	{ CARTRIDGE_STD_8,          BOOT_FIRST,  SIG_NONE,  0 },
+	{ CARTRIDGE_STD_16,         BOOT_SECOND, SIG_NONE,  0 },
+	{ CARTRIDGE_XEGS_32,        BOOT_LAST,   SIG_VALUE, 0 },
+	{ CARTRIDGE_SWXEGS_32,      BOOT_LAST,   SIG_VALUE, 0 },
+	{ CARTRIDGE_XEGS_07_64,     BOOT_LAST,   SIG_VALUE, 0 },
+	{ CARTRIDGE_SWXEGS_64,      BOOT_LAST,   SIG_VALUE, 0 },
+	{ CARTRIDGE_XEGS_128,       BOOT_LAST,   SIG_VALUE, 0 },
+	{ CARTRIDGE_SWXEGS_128,     BOOT_LAST,   SIG_VALUE, 0 },
+	{ CARTRIDGE_XEGS_256,       BOOT_LAST,   SIG_VALUE, 0 },
+	{ CARTRIDGE_SWXEGS_256,     BOOT_LAST,   SIG_VALUE, 0 },
+	{ CARTRIDGE_XEGS_512,       BOOT_LAST,   SIG_VALUE, 0 },
+	{ CARTRIDGE_SWXEGS_512,     BOOT_LAST,   SIG_VALUE, 0 },
+	{ CARTRIDGE_XEGS_1024,      BOOT_LAST,   SIG_VALUE, 0 },
+	{ CARTRIDGE_SWXEGS_1024,    BOOT_LAST,   SIG_VALUE, 0 },
+	{ CARTRIDGE_DB_32,          BOOT_LAST,   SIG_ADDR,  0x0001 },
+	{ CARTRIDGE_MEGA_16,        BOOT_SECOND, SIG_VALUE, 0 },
+	{ CARTRIDGE_MEGA_32,        BOOT_SECOND, SIG_VALUE, 0 },
+	{ CARTRIDGE_MEGA_64,        BOOT_SECOND, SIG_VALUE, 0 },
+	{ CARTRIDGE_MEGA_128,       BOOT_SECOND, SIG_VALUE, 0 },
+	{ CARTRIDGE_MEGA_256,       BOOT_SECOND, SIG_VALUE, 0 },
+	{ CARTRIDGE_MEGA_512,       BOOT_SECOND, SIG_VALUE, 0 },
+	{ CARTRIDGE_MEGA_1024,      BOOT_SECOND, SIG_VALUE, 0 },
+	{ CARTRIDGE_MEGA_2048,      BOOT_SECOND, SIG_VALUE, 0 },
+	{ CARTRIDGE_WILL_32,        BOOT_FIRST,  SIG_ADDR,  0x0001 },
+	{ CARTRIDGE_WILL_64,        BOOT_FIRST,  SIG_ADDR,  0x0001 },
+	{ CARTRIDGE_EXP_64,         BOOT_FIRST,  SIG_ADDR,  0x0080 },
+	{ CARTRIDGE_DIAMOND_64,     BOOT_FIRST,  SIG_ADDR,  0x2000 },
+	{ CARTRIDGE_SDX_64,         BOOT_FIRST,  SIG_ADDR,  0x4000 },
+	{ CARTRIDGE_ATRAX_SDX_64,   BOOT_FIRST,  SIG_ADDR,  0x4000 },
+	{ CARTRIDGE_ATMAX_128,      BOOT_FIRST,  SIG_ADDR,  0x0003 },
+	{ CARTRIDGE_ATMAX_NEW_1024, BOOT_FIRST,  SIG_ADDR,  0x00ff },
+	{ CARTRIDGE_ATMAX_OLD_1024, BOOT_LAST,   SIG_ADDR,  0x00ff }
+};
+
+void CARTDB_ScanInit(CARTDB_scan_t *scan)
+{
+	memset(scan, 0, sizeof(*scan));
+	scan->crc = 0xffffffff;
+}
+
+/* 1 for an instruction with an absolute address, 2 if it also stores. */
+static int AbsoluteOp(UBYTE op)
+{
+	switch (op) {
+	case 0x8c: /* STY abs */
+	case 0x8d: /* STA abs */
+	case 0x8e: /* STX abs */
+	case 0x99: /* STA abs,Y */
+	case 0x9d: /* STA abs,X */
+		return 2;
+	case 0x2c: /* BIT abs */
+	case 0xac: /* LDY abs */
+	case 0xad: /* LDA abs */
+	case 0xae: /* LDX abs */
+	case 0xb9: /* LDA abs,Y */
+	case 0xbc: /* LDY abs,X */
+	case 0xbd: /* LDA abs,X */
+	case 0xbe: /* LDX abs,Y */
+	case 0xcd: /* CMP abs */
+		return 1;
+	default:
+		return 0;
+	}
+}
+
+static void EndBlock(CARTDB_scan_t *scan, ULONG block)
+{
+	UWORD run = scan->tail[0] | (scan->tail[1] << 8);
+	int trailer = 0;
+	if (scan->tail[2] == 0 && run >= 0x8000 && run < 0xc000)
+		trailer = run >= 0xa000 ? CARTDB_TRAILER_VALID | CARTDB_TRAILER_A000 : CARTDB_TRAILER_VALID;
+	if (block < 2)
+		scan->trailer[block] = trailer;
+	scan->trailer[2] = trailer;
+}
+
+void CARTDB_Scan(CARTDB_scan_t *scan, const UBYTE *buf, ULONG len)
+{
+	UBYTE p0 = scan->prev[0];
+	UBYTE p1 = scan->prev[1];
+	ULONG i;
+
+	scan->crc = CRC32_Update(scan->crc, buf, len);
+	for (i = 0; i < len; i++) {
+		UBYTE b = buf[i];
+		scan->sum += b;
+		if (b == 0xd5) {
+			int op = AbsoluteOp(p0);
+			if (op != 0) {
+				scan->hits[p1 >> 4]++;
+				if (p1 < 0x10)
+					scan->d50x[p1]++;
+				if (op == 2 && p1 == 0)
+					scan->d500_stores++;
+			}
+		}
+		p0 = p1;
+		p1 = b;
+	}
+	scan->prev[0] = p0;
+	scan->prev[1] = p1;
+
+	/* keep the last 6 bytes of each 8 KB block */
+	for (i = 0; i < len; ) {
+		ULONG pos = (scan->len + i) & 0x1fff;
+		if (pos < 0x1ffa) {
+			i += 0x1ffa - pos;
+			continue;
+		}
+		scan->tail[pos - 0x1ffa] = buf[i];
+		if (pos == 0x1fff)
+			EndBlock(scan, (scan->len + i) >> 13);
+		i++;
+	}
+	scan->len += len;
+}
+
+ULONG CARTDB_ScanEnd(CARTDB_scan_t *scan)
+{
+	scan->crc = ~scan->crc;
+	return scan->crc;
+}
+
+int CARTDB_Lookup(ULONG crc, int kb)
+{
+	int lo = 0;
+	int hi = sizeof(known) / sizeof(known[0]);
+	while (lo < hi) {
+		int mid = (lo + hi) >> 1;
+		if (known[mid].crc < crc)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	/* a CRC may be shared by images of different sizes */
+	for (; lo < (int) (sizeof(known) / sizeof(known[0])) && known[lo].crc == crc; lo++)
+		if (known[lo].kb == kb)
+			return known[lo].type;
+	return CARTRIDGE_UNKNOWN;
+}
+
+/* TRUE if the accesses to page $D5 are mostly the ones of SIG and MASK.
+   Data have $D5 bytes after what looks like an instruction too, over 200
+   in every 1 MB spread evenly over the page, so the accesses a type needs
+   must stand out from the rate there is in the rest of the page. */
+static int SignatureFits(const CARTDB_scan_t *scan, int sig, int mask)
+{
+	ULONG total = 0;
+	ULONG fit = 0;
+	ULONG d50x = scan->hits[0];
+	ULONG d501_d50f = d50x - scan->d50x[0];
+	int bits = 0;
+	int n;
+	for (n = 0; n < 16; n++) {
+		total += scan->hits[n];
+		if (mask & (1 << n)) {
+			fit += scan->hits[n];
+			bits++;
+		}
+	}
+	switch (sig) {
+	case SIG_NONE:
+		/* $D500-$D50F at the rate of the other 15 rows, allowing twice */
+		return d50x * 15 <= 2 * (total - d50x) + 15;
+	case SIG_VALUE:
+		/* $D501-$D50F at the rate of the rest of the page (1 in 16) */
+		return scan->d500_stores >= 2 && scan->d50x[0] * 240 >= 4 * (total - d50x) + 480
+		       && d501_d50f * 8 <= total - d50x + 16;
+	default:
+		if (fit * (16 - bits) < 3 * bits * (total - fit) + 2 * (16 - bits))
+			return FALSE;
+		/* switching by address uses more than one address */
+		if (mask & 1) {
+			int used = 0;
+			for (n = 1; n < 16; n++)
+				if (scan->d50x[n] != 0)
+					used++;
+			return used >= 2 && d501_d50f * 8 >= total - d50x + 16;
+		}
+		return TRUE;
+	}
+}
+
+int CARTDB_Guess(const CARTDB_scan_t *scan, int kb)
+{
+	int found = -1;
+	int i;
+
+	/* the table only has cartridges for the computers */
+	if (Atari800_machine_type == Atari800_MACHINE_5200)
+		return CARTRIDGE_UNKNOWN;
+	for (i = 0; i < (int) (sizeof(guesses) / sizeof(guesses[0])); i++) {
+		int trailer;
+		if (CARTRIDGES[guesses[i].type].kb != kb)
+			continue;
+		trailer = scan->trailer[guesses[i].boot];
+		if (!(trailer & CARTDB_TRAILER_VALID)
+		    || (guesses[i].boot == BOOT_FIRST && !(trailer & CARTDB_TRAILER_A000)))
+			continue;
+		if (!SignatureFits(scan, guesses[i].sig, guesses[i].mask))
+			continue;
+		/* when more than one type fits, the user has to choose */
+		if (found >= 0)
+			return CARTRIDGE_UNKNOWN;
+		found = i;
+	}
+	return found < 0 ? CARTRIDGE_UNKNOWN : guesses[found].type;
+}
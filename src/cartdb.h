@@ -0,0 +1,47 @@
+#ifndef CARTDB_H_
+#define CARTDB_H_
+
+#include "config.h"
+#include "atari.h"
+
+/* Identification of raw cartridge images.  While an image is read it is
+   passed through CARTDB_Scan, which works out its CRC32 and CART checksum,
+   notes which 8 KB blocks end in a valid cartridge trailer and counts the
+   instructions that address page $D5, where bank-switched cartridges have
+   their registers.  The CRC is looked up in a table of known images,
+   which util/cartdb.sh generates; an image not in the table may still be
+   recognised by where its trailer is and how it switches banks. */
+
+typedef struct {
+	ULONG crc;			/* CRC32 of the image, final after CARTDB_ScanEnd */
+	int sum;			/* as in the CART header */
+	ULONG len;			/* bytes scanned */
+	ULONG hits[16];		/* instructions addressing $D5n0-$D5nF, by n */
+	ULONG d50x[16];		/* instructions addressing $D500+n, by n */
+	ULONG d500_stores;	/* stores to $D500 */
+	UBYTE prev[2];		/* the last two bytes scanned */
+	UBYTE tail[6];		/* the trailer of the current 8 KB block */
+	UBYTE trailer[3];	/* CARTDB_TRAILER_* of the first, second and last block */
+} CARTDB_scan_t;
+
+/* The block ends in $BFFA-$BFFF of a cartridge: the cartridge present
+   byte is zero and the run address is in the cartridge area ... */
+#define CARTDB_TRAILER_VALID 1
+/* ... and at $A000 or above, as it must be for an 8 KB cartridge. */
+#define CARTDB_TRAILER_A000 2
+
+void CARTDB_ScanInit(CARTDB_scan_t *scan);
+/* Feeds the next LEN bytes of the image. */
+void CARTDB_Scan(CARTDB_scan_t *scan, const UBYTE *buf, ULONG len);
+/* Completes the scan and returns the CRC32. */
+ULONG CARTDB_ScanEnd(CARTDB_scan_t *scan);
+
+/* Returns the type of the KB kilobyte image with CRC32 CRC, or
+   CARTRIDGE_UNKNOWN if the table does not have it. */
+int CARTDB_Lookup(ULONG crc, int kb);
+
+/* Returns the type of bank switching the scanned KB kilobyte image
+   clearly uses, or CARTRIDGE_UNKNOWN if there is no single such type. */
+int CARTDB_Guess(const CARTDB_scan_t *scan, int kb);
+
+#endif /* CARTDB_H_ */
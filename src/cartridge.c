@@ -30,12 +30,15 @@
 
 #include "atari.h"
 #include "binload.h" /* BINLOAD_loading_basic */
+#include "cartcache.h"
+#include "cartdb.h"
 #include "cartridge.h"
 #include "memory.h"
 #ifdef IDE
 #  include "ide.h"
 #endif
 #include "pia.h"
+#include "region.h"
 #include "rtime.h"
 #include "util.h"
 #ifndef BASIC
@@ -87,6 +90,28 @@ CARTRIDGE_image_t CARTRIDGE_piggyback = { CARTRIDGE_NONE, 0, 0, NULL, "", TRUE }
    cartridge is a SpartaDOS X. */
 static CARTRIDGE_image_t *active_cart = &CARTRIDGE_main;
 
+/* Maps ADDR1..ADDR2 to the bytes of the active cartridge's image from
+   OFFSET on, which the bank cache provides when the image is not in
+   memory. */
+static void CopyFromImage(UWORD addr1, UWORD addr2, ULONG offset)
+{
+	if (active_cart->image != NULL)
+		MEMORY_CopyFromCart(addr1, addr2, active_cart->image + offset);
+	else {
+		MEMORY_SetDirty(addr1, addr2 - addr1 + 1);
+		CARTCACHE_Read(active_cart, offset, MEMORY_mem + addr1, addr2 - addr1 + 1);
+	}
+}
+
+/* Stores ADDR1..ADDR2 in the image of a RAM cartridge at OFFSET. */
+static void CopyToImage(UWORD addr1, UWORD addr2, ULONG offset)
+{
+	if (active_cart->image != NULL)
+		MEMORY_CopyToCart(addr1, addr2, active_cart->image + offset);
+	else
+		CARTCACHE_Write(active_cart, offset, MEMORY_mem + addr1, addr2 - addr1 + 1);
+}
+
 static ULONG Calculate_RamCart_Address(int cart_type, int cart_state)
 {
 	int state = cart_state;
@@ -124,9 +149,9 @@ static void set_bank_809F(int main, int old_state)
 	else {
 		MEMORY_Cart809fEnable();
 		MEMORY_CartA0bfEnable();
-		MEMORY_CopyFromCart(0x8000, 0x9fff, active_cart->image + active_cart->state * 0x2000);
+		CopyFromImage(0x8000, 0x9fff, active_cart->state * 0x2000);
 		if (old_state & 0x80)
-			MEMORY_CopyFromCart(0xa000, 0xbfff, active_cart->image + main);
+			CopyFromImage(0xa000, 0xbfff, main);
 	}
 }
 
@@ -134,7 +159,7 @@ static void set_bank_809F(int main, int old_state)
 static void set_bank_XEGS_8F_64(void)
 {
 	if (active_cart->state & 0x08)
-		MEMORY_CopyFromCart(0x8000, 0x9fff, active_cart->image + (active_cart->state & ~0x08) * 0x2000);
+		CopyFromImage(0x8000, 0x9fff, (active_cart->state & ~0x08) * 0x2000);
 	else
 		/* $8000-$9FFF is left unconnected. */
 		MEMORY_dFillMem(0x8000, 0xff, 0x2000);
@@ -151,9 +176,9 @@ static void set_bank_A0AF(int main, int old_state)
 			/* Fill cart area with 0xFF. */
 			MEMORY_dFillMem(0xa000, 0xff, 0x1000);
 		else
-			MEMORY_CopyFromCart(0xa000, 0xafff, active_cart->image + active_cart->state * 0x1000);
+			CopyFromImage(0xa000, 0xafff, active_cart->state * 0x1000);
 		if (old_state < 0)
-			MEMORY_CopyFromCart(0xb000, 0xbfff, active_cart->image + main);
+			CopyFromImage(0xb000, 0xbfff, main);
 	}
 }
 
@@ -167,7 +192,7 @@ static void set_bank_A0BF(int disable_mask, int bank_mask)
 		MEMORY_CartA0bfDisable();
 	else {
 		MEMORY_CartA0bfEnable();
-		MEMORY_CopyFromCart(0xa000, 0xbfff, active_cart->image + (active_cart->state & bank_mask) * 0x2000);
+		CopyFromImage(0xa000, 0xbfff, (active_cart->state & bank_mask) * 0x2000);
 	}
 }
 
@@ -182,13 +207,13 @@ static void set_bank_80BF(void)
 	else {
 		MEMORY_Cart809fEnable();
 		MEMORY_CartA0bfEnable();
-		MEMORY_CopyFromCart(0x8000, 0xbfff, active_cart->image + (active_cart->state & 0x7f) * 0x4000);
+		CopyFromImage(0x8000, 0xbfff, (active_cart->state & 0x7f) * 0x4000);
 	}
 }
 
 static void set_bank_5200_SUPER(void)
 {
-	MEMORY_CopyFromCart(0x4000, 0xbfff, active_cart->image + active_cart->state * 0x8000);
+	CopyFromImage(0x4000, 0xbfff, active_cart->state * 0x8000);
 }
 
 static void set_bank_SDX_128(void)
@@ -197,8 +222,8 @@ static void set_bank_SDX_128(void)
 		MEMORY_CartA0bfDisable();
 	else {
 		MEMORY_CartA0bfEnable();
-		MEMORY_CopyFromCart(0xa000, 0xbfff,
-			active_cart->image + ((active_cart->state & 7) + ((active_cart->state & 0x10) >> 1)) * 0x2000);
+		CopyFromImage(0xa000, 0xbfff,
+			((active_cart->state & 7) + ((active_cart->state & 0x10) >> 1)) * 0x2000);
 	}
 }
 static void set_bank_SIC(int n)
@@ -207,15 +232,13 @@ static void set_bank_SIC(int n)
 		MEMORY_Cart809fDisable();
 	else {
 		MEMORY_Cart809fEnable();
-		MEMORY_CopyFromCart(0x8000, 0x9fff,
-			active_cart->image + (active_cart->state & n) * 0x4000);
+		CopyFromImage(0x8000, 0x9fff, (active_cart->state & n) * 0x4000);
 	}
 	if (active_cart->state & 0x40)
 		MEMORY_CartA0bfDisable();
 	else {
 		MEMORY_CartA0bfEnable();
-		MEMORY_CopyFromCart(0xa000, 0xbfff,
-			active_cart->image + (active_cart->state & n) * 0x4000 + 0x2000);
+		CopyFromImage(0xa000, 0xbfff, (active_cart->state & n) * 0x4000 + 0x2000);
 	}
 }
 
@@ -229,7 +252,7 @@ static void set_bank_MEGA_4096(void)
 	else {
 		MEMORY_Cart809fEnable();
 		MEMORY_CartA0bfEnable();
-		MEMORY_CopyFromCart(0x8000, 0xbfff, active_cart->image + active_cart->state * 0x4000);
+		CopyFromImage(0x8000, 0xbfff, active_cart->state * 0x4000);
 	}
 }
 
@@ -241,11 +264,11 @@ static void set_bank_RAMCART(int mask, int old_state)
 	if (old_state & 0x1000) {
 		if (old_state & 0x0002) {
 			offset = Calculate_RamCart_Address(active_cart->type, old_state & mask);
-			MEMORY_CopyToCart(0x8000, 0x9fff, active_cart->image + offset);
+			CopyToImage(0x8000, 0x9fff, offset);
 		}
 		if (old_state & 0x0001) {
 			offset = Calculate_RamCart_Address(active_cart->type, old_state & mask);
-			MEMORY_CopyToCart(0xa000, 0xbfff, active_cart->image + offset + 0x2000);
+			CopyToImage(0xa000, 0xbfff, offset + 0x2000);
 		}
 	}
 
@@ -254,7 +277,7 @@ static void set_bank_RAMCART(int mask, int old_state)
 		MEMORY_Cart809fEnable();
 		if (active_cart->state & 0x1000)
 			MEMORY_SetRAM(0x8000, 0x9fff);
-		MEMORY_CopyFromCart(0x8000, 0x9fff, active_cart->image + offset);
+		CopyFromImage(0x8000, 0x9fff, offset);
 	}
 	else
 		MEMORY_Cart809fDisable();
@@ -266,7 +289,7 @@ static void set_bank_RAMCART(int mask, int old_state)
 		MEMORY_CartA0bfEnable();
 		if (active_cart->state & 0x1000)
 			MEMORY_SetRAM(0xa000, 0xbfff);
-		MEMORY_CopyFromCart(0xa000, 0xbfff, active_cart->image + offset + 0x2000);
+		CopyFromImage(0xa000, 0xbfff, offset + 0x2000);
 	}
 }
 
@@ -277,14 +300,14 @@ static void set_bank_SIDICAR(int mask, int old_state)
 
 	if (old_state & 0x10) {
 		offset = Calculate_SiDiCar_Address(active_cart->type, old_state & mask);
-		MEMORY_CopyToCart(0x8000, 0x9fff, active_cart->image + offset);
+		CopyToImage(0x8000, 0x9fff, offset);
 	}
 
 	if (active_cart->state & 0x10) {
 		offset = Calculate_SiDiCar_Address(active_cart->type, active_cart->state & mask);
 		MEMORY_Cart809fEnable();
 		MEMORY_SetRAM(0x8000, 0x9fff);
-		MEMORY_CopyFromCart(0x8000, 0x9fff, active_cart->image + offset);
+		CopyFromImage(0x8000, 0x9fff, offset);
 	}
 	else
 		MEMORY_Cart809fDisable();
@@ -480,18 +503,18 @@ static void MapActiveCart(void)
 #endif
 			break;
 		case CARTRIDGE_5200_32:
-			MEMORY_CopyFromCart(0x4000, 0xbfff, active_cart->image);
+			CopyFromImage(0x4000, 0xbfff, 0);
 			break;
 		case CARTRIDGE_5200_EE_16:
-			MEMORY_CopyFromCart(0x4000, 0x5fff, active_cart->image);
-			MEMORY_CopyFromCart(0x6000, 0x9fff, active_cart->image);
-			MEMORY_CopyFromCart(0xa000, 0xbfff, active_cart->image + 0x2000);
+			CopyFromImage(0x4000, 0x5fff, 0);
+			CopyFromImage(0x6000, 0x9fff, 0);
+			CopyFromImage(0xa000, 0xbfff, 0x2000);
 			break;
 		case CARTRIDGE_5200_40:
-			MEMORY_CopyFromCart(0x4000, 0x4fff, active_cart->image + (active_cart->state & 0x03) * 0x1000);
-			MEMORY_CopyFromCart(0x5000, 0x5fff, active_cart->image + 0x4000 + ((active_cart->state & 0x0c) >> 2) * 0x1000);
-			MEMORY_CopyFromCart(0x8000, 0x9fff, active_cart->image + 0x8000);
-			MEMORY_CopyFromCart(0xa000, 0xbfff, active_cart->image + 0x8000);
+			CopyFromImage(0x4000, 0x4fff, (active_cart->state & 0x03) * 0x1000);
+			CopyFromImage(0x5000, 0x5fff, 0x4000 + ((active_cart->state & 0x0c) >> 2) * 0x1000);
+			CopyFromImage(0x8000, 0x9fff, 0x8000);
+			CopyFromImage(0xa000, 0xbfff, 0x8000);
 #ifndef PAGED_ATTRIB
 			MEMORY_SetHARDWARE(0x4ff6, 0x4ff9);
 			MEMORY_SetHARDWARE(0x5ff6, 0x5ff9);
@@ -503,17 +526,17 @@ static void MapActiveCart(void)
 #endif
 			break;
 		case CARTRIDGE_5200_NS_16:
-			MEMORY_CopyFromCart(0x8000, 0xbfff, active_cart->image);
+			CopyFromImage(0x8000, 0xbfff, 0);
 			break;
 		case CARTRIDGE_5200_8:
-			MEMORY_CopyFromCart(0x8000, 0x9fff, active_cart->image);
-			MEMORY_CopyFromCart(0xa000, 0xbfff, active_cart->image);
+			CopyFromImage(0x8000, 0x9fff, 0);
+			CopyFromImage(0xa000, 0xbfff, 0);
 			break;
 		case CARTRIDGE_5200_4:
-			MEMORY_CopyFromCart(0x8000, 0x8fff, active_cart->image);
-			MEMORY_CopyFromCart(0x9000, 0x9fff, active_cart->image);
-			MEMORY_CopyFromCart(0xa000, 0xafff, active_cart->image);
-			MEMORY_CopyFromCart(0xb000, 0xbfff, active_cart->image);
+			CopyFromImage(0x8000, 0x8fff, 0);
+			CopyFromImage(0x9000, 0x9fff, 0);
+			CopyFromImage(0xa000, 0xafff, 0);
+			CopyFromImage(0xb000, 0xbfff, 0);
 			break;
 		default:
 			/* clear cartridge area so the 5200 will crash */
@@ -527,43 +550,43 @@ static void MapActiveCart(void)
 			MEMORY_Cart809fDisable();
 			MEMORY_CartA0bfEnable();
 			MEMORY_dFillMem(0xa000, 0xff, 0x1800);
-			MEMORY_CopyFromCart(0xb800, 0xbfff, active_cart->image);
+			CopyFromImage(0xb800, 0xbfff, 0);
 			break;
 		case CARTRIDGE_STD_4:
 			MEMORY_Cart809fDisable();
 			MEMORY_CartA0bfEnable();
 			MEMORY_dFillMem(0xa000, 0xff, 0x1000);
-			MEMORY_CopyFromCart(0xb000, 0xbfff, active_cart->image);
+			CopyFromImage(0xb000, 0xbfff, 0);
 			break;
 		case CARTRIDGE_BLIZZARD_4:
 			MEMORY_Cart809fDisable();
 			MEMORY_CartA0bfEnable();
-			MEMORY_CopyFromCart(0xa000, 0xafff, active_cart->image);
-			MEMORY_CopyFromCart(0xb000, 0xbfff, active_cart->image);
+			CopyFromImage(0xa000, 0xafff, 0);
+			CopyFromImage(0xb000, 0xbfff, 0);
 			break;
 		case CARTRIDGE_STD_8:
 		case CARTRIDGE_PHOENIX_8:
 			MEMORY_Cart809fDisable();
 			MEMORY_CartA0bfEnable();
-			MEMORY_CopyFromCart(0xa000, 0xbfff, active_cart->image);
+			CopyFromImage(0xa000, 0xbfff, 0);
 			break;
 		case CARTRIDGE_LOW_BANK_8:
 			MEMORY_Cart809fEnable();
 			MEMORY_CartA0bfDisable();
-			MEMORY_CopyFromCart(0x8000, 0x9fff, active_cart->image);
+			CopyFromImage(0x8000, 0x9fff, 0);
 			break;
 		case CARTRIDGE_STD_16:
 		case CARTRIDGE_BLIZZARD_16:
 			MEMORY_Cart809fEnable();
 			MEMORY_CartA0bfEnable();
-			MEMORY_CopyFromCart(0x8000, 0xbfff, active_cart->image);
+			CopyFromImage(0x8000, 0xbfff, 0);
 			break;
 		case CARTRIDGE_OSS_034M_16:
 		case CARTRIDGE_OSS_043M_16:
 			MEMORY_Cart809fDisable();
 			if (active_cart->state >= 0) {
 				MEMORY_CartA0bfEnable();
-				MEMORY_CopyFromCart(0xb000, 0xbfff, active_cart->image + 0x3000);
+				CopyFromImage(0xb000, 0xbfff, 0x3000);
 			}
 			break;
 		case CARTRIDGE_OSS_M091_16:
@@ -571,7 +594,7 @@ static void MapActiveCart(void)
 			MEMORY_Cart809fDisable();
 			if (active_cart->state >= 0) {
 				MEMORY_CartA0bfEnable();
-				MEMORY_CopyFromCart(0xb000, 0xbfff, active_cart->image);
+				CopyFromImage(0xb000, 0xbfff, 0);
 			}
 			break;
 		case CARTRIDGE_WILL_64:
@@ -603,7 +626,7 @@ static void MapActiveCart(void)
 		case CARTRIDGE_SWXEGS_32:
 			if (!(active_cart->state & 0x80)) {
 				MEMORY_CartA0bfEnable();
-				MEMORY_CopyFromCart(0xa000, 0xbfff, active_cart->image + 0x6000);
+				CopyFromImage(0xa000, 0xbfff, 0x6000);
 			}
 			break;
 		case CARTRIDGE_XEGS_07_64:
@@ -611,43 +634,43 @@ static void MapActiveCart(void)
 		case CARTRIDGE_XEGS_8F_64:
 			if (!(active_cart->state & 0x80)) {
 				MEMORY_CartA0bfEnable();
-				MEMORY_CopyFromCart(0xa000, 0xbfff, active_cart->image + 0xe000);
+				CopyFromImage(0xa000, 0xbfff, 0xe000);
 			}
 			break;
 		case CARTRIDGE_XEGS_128:
 		case CARTRIDGE_SWXEGS_128:
 			if (!(active_cart->state & 0x80)) {
 				MEMORY_CartA0bfEnable();
-				MEMORY_CopyFromCart(0xa000, 0xbfff, active_cart->image + 0x1e000);
+				CopyFromImage(0xa000, 0xbfff, 0x1e000);
 			}
 			break;
 		case CARTRIDGE_XEGS_256:
 		case CARTRIDGE_SWXEGS_256:
 			if (!(active_cart->state & 0x80)) {
 				MEMORY_CartA0bfEnable();
-				MEMORY_CopyFromCart(0xa000, 0xbfff, active_cart->image + 0x3e000);
+				CopyFromImage(0xa000, 0xbfff, 0x3e000);
 			}
 			break;
 		case CARTRIDGE_XEGS_512:
 		case CARTRIDGE_SWXEGS_512:
 			if (!(active_cart->state & 0x80)) {
 				MEMORY_CartA0bfEnable();
-				MEMORY_CopyFromCart(0xa000, 0xbfff, active_cart->image + 0x7e000);
+				CopyFromImage(0xa000, 0xbfff, 0x7e000);
 			}
 			break;
 		case CARTRIDGE_XEGS_1024:
 		case CARTRIDGE_SWXEGS_1024:
 			if (!(active_cart->state & 0x80)) {
 				MEMORY_CartA0bfEnable();
-				MEMORY_CopyFromCart(0xa000, 0xbfff, active_cart->image + 0xfe000);
+				CopyFromImage(0xa000, 0xbfff, 0xfe000);
 			}
 			break;
 		case CARTRIDGE_BBSB_40:
 			MEMORY_Cart809fEnable();
 			MEMORY_CartA0bfEnable();
-			MEMORY_CopyFromCart(0x8000, 0x8fff, active_cart->image + (active_cart->state & 0x03) * 0x1000);
-			MEMORY_CopyFromCart(0x9000, 0x9fff, active_cart->image + 0x4000 + ((active_cart->state & 0x0c) >> 2) * 0x1000);
-			MEMORY_CopyFromCart(0xa000, 0xbfff, active_cart->image + 0x8000);
+			CopyFromImage(0x8000, 0x8fff, (active_cart->state & 0x03) * 0x1000);
+			CopyFromImage(0x9000, 0x9fff, 0x4000 + ((active_cart->state & 0x0c) >> 2) * 0x1000);
+			CopyFromImage(0xa000, 0xbfff, 0x8000);
 #ifndef PAGED_ATTRIB
 			MEMORY_SetHARDWARE(0x8ff6, 0x8ff9);
 			MEMORY_SetHARDWARE(0x9ff6, 0x9ff9);
@@ -663,7 +686,7 @@ static void MapActiveCart(void)
 			if (Atari800_machine_type == Atari800_MACHINE_800) {
 				MEMORY_Cart809fEnable();
 				MEMORY_dFillMem(0x8000, 0xff, 0x1000);
-				MEMORY_CopyFromCart(0x9000, 0x9fff, active_cart->image);
+				CopyFromImage(0x9000, 0x9fff, 0);
 				if ((!Atari800_disable_basic || BINLOAD_loading_basic) && MEMORY_have_basic) {
 					MEMORY_CartA0bfEnable();
 					MEMORY_CopyFromCart(0xa000, 0xbfff, MEMORY_basic);
@@ -680,7 +703,7 @@ static void MapActiveCart(void)
 		case CARTRIDGE_RIGHT_8:
 			if (Atari800_machine_type == Atari800_MACHINE_800) {
 				MEMORY_Cart809fEnable();
-				MEMORY_CopyFromCart(0x8000, 0x9fff, active_cart->image);
+				CopyFromImage(0x8000, 0x9fff, 0);
 				if (!Atari800_builtin_basic
 				    && (!Atari800_disable_basic || BINLOAD_loading_basic) && MEMORY_have_basic) {
 					MEMORY_CartA0bfEnable();
@@ -702,7 +725,7 @@ static void MapActiveCart(void)
 				MEMORY_CartA0bfEnable();
 				/* Copy the chosen bank 32 times over 0xa000-0xbfff. */
 				for (i = 0xa000; i < 0xc000; i += 0x100)
-					MEMORY_CopyFromCart(i, i + 0xff, active_cart->image + (active_cart->state & 0xffff));
+					CopyFromImage(i, i + 0xff, active_cart->state & 0xffff);
 			}
 			break;
 		case CARTRIDGE_MEGA_16:
@@ -1270,8 +1293,7 @@ static void access_BountyBob1(UWORD addr)
 		addr -= 0xf6;
 		new_state = (active_cart->state & 0x0c) | addr;
 		if (new_state != active_cart->state) {
-			MEMORY_CopyFromCart(base_addr, base_addr + 0x0fff,
-			               active_cart->image + addr * 0x1000);
+			CopyFromImage(base_addr, base_addr + 0x0fff, addr * 0x1000);
 			active_cart->state = new_state;
 		}
 	}
@@ -1287,8 +1309,7 @@ static void access_BountyBob2(UWORD addr)
 		addr -= 0xf6;
 		new_state = (active_cart->state & 0x03) | (addr << 2);
 		if (new_state != active_cart->state) {
-			MEMORY_CopyFromCart(base_addr, base_addr + 0x0fff,
-			               active_cart->image + 0x4000 + addr * 0x1000);
+			CopyFromImage(base_addr, base_addr + 0x0fff, 0x4000 + addr * 0x1000);
 			active_cart->state = new_state;
 		}
 	}
@@ -1379,6 +1400,35 @@ static void ResetCartState(CARTRIDGE_image_t *cart)
 	}
 }
 
+/* Returns the memory region of CART's image, or -1 for a cartridge that
+   is not inserted (the UI's converters read one and write it back). */
+static int ImageRegion(const CARTRIDGE_image_t *cart)
+{
+	if (cart == &CARTRIDGE_main)
+		return REGION_CART;
+	if (cart == &CARTRIDGE_piggyback)
+		return REGION_PIGGYBACK;
+	return -1;
+}
+
+/* Allocates SIZE bytes for an image of CART, to be stored in CART->IMAGE.
+   Returns NULL if there is no room. */
+static UBYTE *AllocImage(CARTRIDGE_image_t *cart, ULONG size, const char *from)
+{
+	int region = ImageRegion(cart);
+	if (region < 0)
+		return (UBYTE *) Util_malloc(size, from);
+	return (UBYTE *) REGION_Alloc(region, &cart->image, size, from);
+}
+
+static void FreeImage(CARTRIDGE_image_t *cart, UBYTE *image)
+{
+	if (ImageRegion(cart) < 0)
+		Util_free(image);
+	else
+		REGION_Release(image);
+}
+
 /* Before first use of the cartridge, preprocess its contents if needed. */
 static void PreprocessCart(CARTRIDGE_image_t *cart)
 {
@@ -1464,10 +1514,19 @@ static void PreprocessCart(CARTRIDGE_image_t *cart)
 		return;
 	}
 
+	if (cart->image == NULL) {
+		if (!CARTCACHE_Decode(cart, map->addr, map->data))
+			Log_print("Cartridge image must be in PSRAM to be decoded");
+		return;
+	}
+
 	{
 		unsigned int i;
 		unsigned int const size = cart->size << 10;
-		UBYTE *new_image = (UBYTE *) Util_malloc(size, "PreprocessCart new_image");
+		UBYTE *old_image = cart->image;
+		UBYTE *new_image = AllocImage(cart, size, "PreprocessCart new_image");
+		if (new_image == NULL)
+			return;
 		/* FIXME: Can be optimised by caching the results in a conversion
 		   table, but doesn't seem to be worth it. */
 		for (i = 0; i < size; i++) {
@@ -1501,8 +1560,8 @@ static void PreprocessCart(CARTRIDGE_image_t *cart)
 				(byte & 0x40 ? map->data[6] : 0) |
 				(byte & 0x80 ? map->data[7] : 0);
 		}
-		free(cart->image);
 		cart->image = new_image;
+		FreeImage(cart, old_image);
 	}
 }
 
@@ -1578,24 +1637,33 @@ int CARTRIDGE_WriteImage(char *filename, int type, UBYTE *image, int size, int r
 	}
 }
 
+static int CartIsRAM(int type)
+{
+	switch (type) {
+	case CARTRIDGE_RAMCART_64:
+	case CARTRIDGE_RAMCART_128:
+	case CARTRIDGE_DOUBLE_RAMCART_256:
+	case CARTRIDGE_RAMCART_1M:
+	case CARTRIDGE_RAMCART_2M:
+	case CARTRIDGE_RAMCART_4M:
+	case CARTRIDGE_RAMCART_8M:
+	case CARTRIDGE_RAMCART_16M:
+	case CARTRIDGE_RAMCART_32M:
+	case CARTRIDGE_SIDICAR_32:
+		return TRUE;
+	default:
+		break;
+	}
+	return FALSE;
+}
+
 static void RemoveCart(CARTRIDGE_image_t *cart)
 {
+	CARTCACHE_Close(cart, CartIsRAM(cart->type));
 	if (cart->image != NULL) {
-		switch (cart->type) {
-		case CARTRIDGE_RAMCART_64:
-		case CARTRIDGE_RAMCART_128:
-		case CARTRIDGE_DOUBLE_RAMCART_256:
-		case CARTRIDGE_RAMCART_1M:
-		case CARTRIDGE_RAMCART_2M:
-		case CARTRIDGE_RAMCART_4M:
-		case CARTRIDGE_RAMCART_8M:
-		case CARTRIDGE_RAMCART_16M:
-		case CARTRIDGE_RAMCART_32M:
-		case CARTRIDGE_SIDICAR_32:
+		if (CartIsRAM(cart->type))
 			CARTRIDGE_WriteImage(cart->filename, cart->type, cart->image, cart->size << 10, cart->raw, -1);
-		}
-
-		free(cart->image);
+		FreeImage(cart, cart->image);
 		cart->image = NULL;
 	}
 	if (cart->type != CARTRIDGE_NONE) {
@@ -1638,13 +1706,45 @@ void CARTRIDGE_ColdStart(void) {
 	MapActiveCart();
 }
 
-int CARTRIDGE_ReadImage(const char *filename, CARTRIDGE_image_t *cart)
+/* Reads LEN bytes of image from FP, which is at OFFSET of FILENAME, and
+   closes FP.  With STREAM, an image too big for SRAM is left to the bank
+   cache.  Scans the image into *SCAN if it is not NULL.  Returns FALSE if
+   there were too few data. */
+static int LoadImage(FIL *fp, const char *filename, CARTRIDGE_image_t *cart, ULONG offset, int len, int stream, CARTDB_scan_t *scan)
+{
+	if (stream && len > CARTCACHE_RESIDENT_SIZE) {
+		fclose(fp);
+		cart->image = NULL;
+		return CARTCACHE_Open(cart, filename, offset, len, scan);
+	}
+	cart->image = AllocImage(cart, len, "CARTRIDGE_ReadImage cart->image");
+	if (cart->image == NULL) {
+		fclose(fp);
+		return FALSE;
+	}
+	if (fread(cart->image, 1, len, fp) < len) {
+		fclose(fp);
+		FreeImage(cart, cart->image);
+		cart->image = NULL;
+		return FALSE;
+	}
+	fclose(fp);
+	if (scan != NULL) {
+		CARTDB_ScanInit(scan);
+		CARTDB_Scan(scan, cart->image, len);
+		CARTDB_ScanEnd(scan);
+	}
+	return TRUE;
+}
+
+static int ReadImage(const char *filename, CARTRIDGE_image_t *cart, int stream)
 {
 	FIL f;
 	FIL *fp = &f;
 	int len;
 	int type;
 	UBYTE header[16];
+	CARTDB_scan_t scan;
 
 	/* open file */
 	if (FR_OK != f_open(&f, filename, FA_READ))
@@ -1662,37 +1762,40 @@ int CARTRIDGE_ReadImage(const char *filename, CARTRIDGE_image_t *cart)
 
 	/* if full kilobytes, assume it is raw image */
 	if ((len & 0x3ff) == 0) {
-		/* alloc memory and read data */
-		cart->image = (UBYTE *) Util_malloc(len, "CARTRIDGE_ReadImage cart");
-		if (fread(cart->image, 1, len, fp) < len) {
-			Log_print("Error reading cartridge.\n");
-			fclose(fp);
-			free(cart->image);
-			cart->image = NULL;
-			return CARTRIDGE_TOO_FEW_DATA;
-		}
-		fclose(fp);
+		int kb = len >> 10;	/* number of kilobytes */
+		int count = 0;
 		/* find cart type */
 		cart->type = CARTRIDGE_NONE;
-		len >>= 10;	/* number of kilobytes */
-		cart->size = len;
 		for (type = 1; type < CARTRIDGE_TYPE_COUNT; type++)
-			if (CARTRIDGES[type].kb == len) {
-				if (cart->type == CARTRIDGE_NONE) {
+			if (CARTRIDGES[type].kb == kb) {
+				if (cart->type == CARTRIDGE_NONE)
 					cart->type = type;
-				} else {
-					/* more than one cartridge type of such length - user must select */
-					cart->type = CARTRIDGE_UNKNOWN;
-					return len;
-				}
+				count++;
 			}
-		if (cart->type != CARTRIDGE_NONE) {
-			/*InitCartridge(cart);*/
-			return 0;	/* ok */
+		if (cart->type == CARTRIDGE_NONE) {
+			fclose(fp);
+			return CARTRIDGE_BAD_FORMAT;
 		}
-		free(cart->image);
-		cart->image = NULL;
-		return CARTRIDGE_BAD_FORMAT;
+		/* alloc memory and read data; an image of an ambiguous size is
+		   scanned on the way to recognise it without asking */
+		if (!LoadImage(fp, filename, cart, 0, len, stream, count > 1 ? &scan : NULL)) {
+			cart->type = CARTRIDGE_NONE;
+			Log_print("Error reading cartridge.\n");
+			return CARTRIDGE_TOO_FEW_DATA;
+		}
+		cart->size = kb;
+		if (count > 1) {
+			/* more than one cartridge type of such length - look the image
+			   up, then try to tell from its code; else user must select */
+			cart->type = CARTDB_Lookup(scan.crc, kb);
+			if (cart->type == CARTRIDGE_UNKNOWN)
+				cart->type = CARTDB_Guess(&scan, kb);
+			if (cart->type == CARTRIDGE_UNKNOWN)
+				return kb;
+			Log_print("Cartridge %08lx recognised as type %d", (unsigned long) scan.crc, cart->type);
+		}
+		/*InitCartridge(cart);*/
+		return 0;	/* ok */
 	}
 
 	/* if not full kilobytes, assume it is CART file */
@@ -1716,21 +1819,16 @@ int CARTRIDGE_ReadImage(const char *filename, CARTRIDGE_image_t *cart)
 			cart->raw = FALSE;
 			cart->size = CARTRIDGES[type].kb;
 			/* alloc memory and read data */
-			cart->image = (UBYTE *) Util_malloc(len, "CARTRIDGE_ReadImage cart->image");
-			if (fread(cart->image, 1, len, fp) < len) {
+			if (!LoadImage(fp, filename, cart, 16, len, stream, &scan)) {
 				Log_print("Error reading cartridge.\n");
-				fclose(fp);
-				free(cart->image);
-				cart->image = NULL;
 				return CARTRIDGE_TOO_FEW_DATA;
 			}
-			fclose(fp);
 			checksum = (header[8] << 24) |
 				(header[9] << 16) |
 				(header[10] << 8) |
 				header[11];
 			cart->type = type;
-			result = checksum == CARTRIDGE_Checksum(cart->image, len) ? 0 : CARTRIDGE_BAD_CHECKSUM;
+			result = checksum == scan.sum ? 0 : CARTRIDGE_BAD_CHECKSUM;
 			/*InitCartridge(cart);*/
 			return result;
 		}
@@ -1739,6 +1837,11 @@ int CARTRIDGE_ReadImage(const char *filename, CARTRIDGE_image_t *cart)
 	return CARTRIDGE_BAD_FORMAT;
 }
 
+int CARTRIDGE_ReadImage(const char *filename, CARTRIDGE_image_t *cart)
+{
+	return ReadImage(filename, cart, FALSE);
+}
+
 /* Loads a cartridge from FILENAME. Copies FILENAME to CART->FILENAME.
    If loading failed, sets CART->TYPE to CARTRIDGE_NONE and returns one of:
    * CARTRIDGE_CANT_OPEN if there was an error when opening file,
@@ -1755,7 +1858,7 @@ int CARTRIDGE_ReadImage(const char *filename, CARTRIDGE_image_t *cart)
      CARTRIDGE_SetType() or CARTRIDGE_SetTypeAutoReboot(). */
 static int InsertCartridge(const char *filename, CARTRIDGE_image_t *cart)
 {
-	int kb = CARTRIDGE_ReadImage(filename, cart);
+	int kb = ReadImage(filename, cart, TRUE);
 	if ((kb == CARTRIDGE_BAD_CHECKSUM) || (kb == 0)) {
 		InitCartridge(cart);
 	}
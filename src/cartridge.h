@@ -50,7 +50,7 @@ typedef struct CARTRIDGE_image_t {
 	int type;
 	int state; /* Cartridge's state, such as selected bank or switch on/off. */
 	int size; /* Size of the image, in kilobytes. */
-	UBYTE *image;
+	UBYTE *image; /* NULL while the bank cache holds the image, see cartcache.h */
 	char filename[FILENAME_MAX];
 	int raw; /* File contains RAW data (important for writeable cartridges). */
 } CARTRIDGE_image_t;
@@ -76,10 +76,12 @@ void CARTRIDGE_Exit(void);
    * CARTRIDGE_BAD_FORMAT if the file is not a proper cartridge image.
 
    If loading succeeded, allocates a buffer with cartridge image data and puts
-   it in CARTRIDGE_main.image. Then sets CARTRIDGE_main.type if possible, and
-   returns one of:
-   * 0 if cartridge type was recognized; CARTRIDGE_main.type is then set
-     correctly;
+   it in CARTRIDGE_main.image; an image bigger than CARTCACHE_RESIDENT_SIZE
+   is handed to the bank cache instead. Then sets CARTRIDGE_main.type if
+   possible, and returns one of:
+   * 0 if cartridge type was recognized, from the CART header or, for a raw
+     image of a size several types share, by CARTDB_Lookup() or
+     CARTDB_Guess(); CARTRIDGE_main.type is then set correctly;
    * CARTRIDGE_BAD_CHECKSUM if cartridge is a CART file but with invalid
      checksum; CARTRIDGE_main.type is then set correctly;
    * a positive integer: size in KB if cartridge type was not guessed;
@@ -58,6 +58,24 @@ static UBYTE pending_serin_byte = 0xff;
 /* Byte most recently loaded from tape; will be accessed by SIO_GetByte(). */
 static UBYTE serin_byte = 0xff;
 
+int CASSETTE_turbo = TRUE;
+CASSETTE_turbo_stats_t CASSETTE_turbo_stats;
+
+/* Mark tone left before a record when the gap is cut short, in CPU ticks;
+   a reader polling for the start bit must see the line idle first. */
+#define TURBO_LEAD_TICKS (8 * 114)
+/* Duration of an accelerated byte: 10 bits at 19200 baud, as from a disk. */
+#define TURBO_BYTE_TICKS (10 * 1789790 / 19200)
+/* Reads of the DATA IN line within one scanline that make a polling loop. */
+#define TURBO_POLLS 4
+
+/* Reads of the DATA IN line since the last scanline. */
+static int turbo_polls = 0;
+/* Scanlines the serial input interrupt has been enabled during this gap. */
+static int turbo_irq_lines = 0;
+/* Ticks saved that do not make a whole scanline yet. */
+static ULONG turbo_saved_ticks = 0;
+
 char CASSETTE_filename[FILENAME_MAX];
 CASSETTE_status_t CASSETTE_status = CASSETTE_STATUS_NONE;
 int CASSETTE_write_protect = FALSE;
@@ -105,6 +123,12 @@ int CASSETTE_ReadConfig(char *string, char *ptr)
 			return FALSE;
 		CASSETTE_write_protect = value;
 	}
+	else if (strcmp(string, "CASSETTE_TURBO") == 0) {
+		int value = Util_sscanbool(ptr);
+		if (value == -1)
+			return FALSE;
+		CASSETTE_turbo = value;
+	}
 	else return FALSE;
 	return TRUE;
 }
@@ -114,6 +138,7 @@ void CASSETTE_WriteConfig(FIL *fp)
 	fprintf(fp, "CASSETTE_FILENAME=%s\n", CASSETTE_filename);
 	fprintf(fp, "CASSETTE_LOADED=%d\n", CASSETTE_status != CASSETTE_STATUS_NONE);
 	fprintf(fp, "CASSETTE_WRITE_PROTECT=%d\n", CASSETTE_write_protect);
+	fprintf(fp, "CASSETTE_TURBO=%d\n", CASSETTE_turbo);
 }
 
 int CASSETTE_Initialise(int *argc, char *argv[])
@@ -148,11 +173,17 @@ int CASSETTE_Initialise(int *argc, char *argv[])
 		}
 		else if (strcmp(argv[i], "-tape-readonly") == 0)
 			protect = TRUE;
+		else if (strcmp(argv[i], "-tape-turbo") == 0)
+			CASSETTE_turbo = TRUE;
+		else if (strcmp(argv[i], "-no-tape-turbo") == 0)
+			CASSETTE_turbo = FALSE;
 		else {
 			if (strcmp(argv[i], "-help") == 0) {
 				Log_print("\t-tape <file>      Insert cassette image");
 				Log_print("\t-boottape <file>  Insert cassette image and boot it");
 				Log_print("\t-tape-readonly    Mark the attached cassette image as read-only");
+				Log_print("\t-tape-turbo       Skip gaps and speed up standard tape records (default)");
+				Log_print("\t-no-tape-turbo    Play tapes with exact timing");
 			}
 			argv[j++] = argv[i];
 		}
@@ -186,6 +217,30 @@ void CASSETTE_Exit(void)
 	CASSETTE_Remove();
 }
 
+static void TurboSaved(ULONG ticks)
+{
+	turbo_saved_ticks += ticks;
+	CASSETTE_turbo_stats.skipped_lines += turbo_saved_ticks / 114;
+	turbo_saved_ticks %= 114;
+}
+
+/* Logs the load time of the tape, then starts the statistics anew. */
+static void TurboReport(void)
+{
+	CASSETTE_turbo_stats_t *st = &CASSETTE_turbo_stats;
+	if (st->skipped_lines != 0) {
+		ULONG lines = st->play_lines + st->skipped_lines;
+		Log_print("Tape played in %lu s instead of %lu s (%lu.%lux), %lu records fast%s",
+		          (unsigned long) (st->play_lines / 15700), (unsigned long) (lines / 15700),
+		          (unsigned long) (lines / st->play_lines), (unsigned long) (lines * 10 / st->play_lines % 10),
+		          (unsigned long) st->fast_records, st->exact ? ", then exact timing" : "");
+	}
+	memset(st, 0, sizeof(*st));
+	turbo_polls = 0;
+	turbo_irq_lines = 0;
+	turbo_saved_ticks = 0;
+}
+
 int CASSETTE_Insert(const char *filename)
 {
 	int writable;
@@ -219,6 +274,7 @@ int CASSETTE_Insert(const char *filename)
 
 void CASSETTE_Remove(void)
 {
+	TurboReport();
 	if (cassette_file != NULL) {
 		IMG_TAPE_Close(cassette_file);
 		cassette_file = NULL;
@@ -293,6 +349,7 @@ int CASSETTE_IOLineStatus(void)
 		return 1;
 	}
 
+	turbo_polls++;
 	return IMG_TAPE_SerinStatus(cassette_file, event_time_left);
 }
 
@@ -346,6 +403,33 @@ static void CassetteWrite(int num_ticks)
 		IMG_TAPE_WriteAdvance(cassette_file, num_ticks);
 }
 
+/* Called every scanline before the tape advances; cuts the gap short when
+   the program is ready for the next standard record, or gives up the
+   acceleration when the program reads the bits of a record itself. */
+static void TurboScanLine(void)
+{
+	int polling = turbo_polls >= TURBO_POLLS;
+	turbo_polls = 0;
+	CASSETTE_turbo_stats.play_lines++;
+	if (!CASSETTE_turbo || CASSETTE_turbo_stats.exact || !IMG_TAPE_StandardRecord(cassette_file))
+		return;
+	if (passing_gap) {
+		if (POKEY_IRQEN & 0x20)
+			turbo_irq_lines++;
+		else
+			turbo_irq_lines = 0;
+		if ((polling || turbo_irq_lines >= Atari800_tv_mode) && event_time_left > TURBO_LEAD_TICKS) {
+			TurboSaved(event_time_left - TURBO_LEAD_TICKS);
+			event_time_left = TURBO_LEAD_TICKS;
+		}
+	}
+	else if (polling && IMG_TAPE_GetRecordPosition(cassette_file) > 2) {
+		/* The OS polls only during the two sync bytes. */
+		CASSETTE_turbo_stats.exact = TRUE;
+		Log_print("Tape read bit by bit, playing it with exact timing");
+	}
+}
+
 /* Sets the stamp of next SERIN IRQ event and loads new record if necessary.
    Returns TRUE if a new byte was loaded and POKEY_SERIN should be updated.
    The function assumes that current_block <= max_block. */
@@ -353,6 +437,7 @@ static int CassetteRead(int num_ticks)
 {
 	if (CASSETTE_readable) {
 		int loaded = FALSE; /* Function's return value */
+		TurboScanLine();
 		event_time_left -= num_ticks;
 		while (event_time_left < 0) {
 			unsigned int length;
@@ -370,6 +455,17 @@ static int CassetteRead(int num_ticks)
 				UpdateFlags();
 				return loaded;
 			}
+			if (passing_gap)
+				turbo_irq_lines = 0;
+			/* The byte after the sync bytes still comes in real time, to
+			   catch a program that reads the bits itself. */
+			else if (CASSETTE_turbo && !CASSETTE_turbo_stats.exact && length > TURBO_BYTE_TICKS
+			         && IMG_TAPE_GetRecordPosition(cassette_file) > 3 && IMG_TAPE_StandardRecord(cassette_file)) {
+				if (IMG_TAPE_GetRecordPosition(cassette_file) == 4)
+					CASSETTE_turbo_stats.fast_records++;
+				TurboSaved(length - TURBO_BYTE_TICKS);
+				length = TURBO_BYTE_TICKS;
+			}
 
 			event_time_left += length;
 		}
@@ -58,6 +58,24 @@ void CASSETTE_TapeMotor(int onoff);
 /* Advance the tape by a scanline. Return TRUE if a new byte has been loaded
    and POKEY_SERIN must be updated. */
 int CASSETTE_AddScanLine(void);
+/* Tape acceleration, on by default.  While the program waits for a standard
+   record (it polls the DATA IN line in a loop, or has had the serial input
+   interrupt enabled for a whole frame), the rest of the leader or gap before
+   it is skipped, and the bytes after its two sync bytes come at disk speed.
+   A program that polls the line during those bytes reads the bits itself;
+   the tape then plays with exact timing until it is removed. */
+extern int CASSETTE_turbo;
+
+typedef struct {
+	ULONG play_lines;		/* scanlines the tape was played for */
+	ULONG skipped_lines;	/* scanlines of tape time saved by acceleration */
+	ULONG fast_records;		/* records delivered at disk speed */
+	int exact;				/* the tape fell back to exact timing */
+} CASSETTE_turbo_stats_t;
+
+/* Statistics of the mounted tape; logged when it is removed. */
+extern CASSETTE_turbo_stats_t CASSETTE_turbo_stats;
+
 /* Reset cassette serial transmission; call when resseting POKEY by SKCTL. */
 void CASSETTE_ResetPOKEY(void);
 
@@ -10,6 +10,10 @@
 #include "sound.h"
 #include "binload.h"
 #include "devices.h"
+#include "blkcache.h"
+#include "bootsnap.h"
+#include "region.h"
+#include "sramtab.h"
 #include "pokeysnd.h"
 
 int CFG_save_on_exit = FALSE;
@@ -227,6 +231,14 @@ int CFG_LoadConfig(const char *alternate_config_filename) {
 			}
 			else if (CASSETTE_ReadConfig(string, ptr)) {
 			}
+			else if (REGION_ReadConfig(string, ptr)) {
+			}
+			else if (SRAMTAB_ReadConfig(string, ptr)) {
+			}
+			else if (BLKCACHE_ReadConfig(string, ptr)) {
+			}
+			else if (BOOTSNAP_ReadConfig(string, ptr)) {
+			}
 			else if (RTIME_ReadConfig(string, ptr)) {
 			}
 #ifdef XEP80_EMULATION
@@ -375,6 +387,10 @@ int CFG_WriteConfig(void)
 	PBI_WriteConfig(fp);
 	CARTRIDGE_WriteConfig(fp);
 	CASSETTE_WriteConfig(fp);
+	REGION_WriteConfig(fp);
+	SRAMTAB_WriteConfig(fp);
+	BLKCACHE_WriteConfig(fp);
+	BOOTSNAP_WriteConfig(fp);
 	RTIME_WriteConfig(fp);
 #ifdef XEP80_EMULATION
 	XEP80_WriteConfig(fp);
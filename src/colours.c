@@ -138,6 +138,154 @@ double Colours_Linear2sRGB(double c)
 		return 1.055 * pow(c, 1.0/2.4) - 0.055;
 }
 
+/* sin(k * 2pi / 256) for k = 0..64 (first quarter of a turn), Q16.16. */
+static SLONG const sin_table[65] = {
+	0, 1608, 3216, 4821, 6424, 8022, 9616, 11204,
+	12785, 14359, 15924, 17479, 19024, 20557, 22078, 23586,
+	25080, 26558, 28020, 29466, 30893, 32303, 33692, 35062,
+	36410, 37736, 39040, 40320, 41576, 42806, 44011, 45190,
+	46341, 47464, 48559, 49624, 50660, 51665, 52639, 53581,
+	54491, 55368, 56212, 57022, 57798, 58538, 59244, 59914,
+	60547, 61145, 61705, 62228, 62714, 63162, 63572, 63944,
+	64277, 64571, 64827, 65043, 65220, 65358, 65457, 65516,
+	65536
+};
+
+/* log2(1 + k / 64) for k = 0..64, Q16.16. */
+static SLONG const log2_table[65] = {
+	0, 1466, 2909, 4331, 5732, 7112, 8473, 9814,
+	11136, 12440, 13727, 14996, 16248, 17484, 18704, 19909,
+	21098, 22272, 23433, 24579, 25711, 26830, 27936, 29029,
+	30109, 31178, 32234, 33279, 34312, 35334, 36346, 37346,
+	38336, 39316, 40286, 41246, 42196, 43137, 44068, 44990,
+	45904, 46809, 47705, 48593, 49472, 50344, 51207, 52063,
+	52911, 53751, 54584, 55410, 56229, 57040, 57845, 58643,
+	59434, 60219, 60997, 61769, 62534, 63294, 64047, 64794,
+	65536
+};
+
+/* 2 ^ (k / 64) for k = 0..64, Q16.16. */
+static SLONG const exp2_table[65] = {
+	65536, 66250, 66971, 67700, 68438, 69183, 69936, 70698,
+	71468, 72246, 73032, 73828, 74632, 75444, 76266, 77096,
+	77936, 78785, 79642, 80510, 81386, 82273, 83169, 84074,
+	84990, 85915, 86851, 87796, 88752, 89719, 90696, 91684,
+	92682, 93691, 94711, 95743, 96785, 97839, 98905, 99982,
+	101070, 102171, 103283, 104408, 105545, 106694, 107856, 109031,
+	110218, 111418, 112631, 113858, 115098, 116351, 117618, 118899,
+	120194, 121502, 122825, 124163, 125515, 126882, 128263, 129660,
+	131072
+};
+
+/* Linearly interpolates TABLE at position X, given in 1/1024 of an entry.
+   X must be below 64 * 1024. */
+static SLONG Interpolate(SLONG const table[65], ULONG x)
+{
+	ULONG idx = x >> 10;
+	SLONG frac = x & 0x3ff;
+	return table[idx] + (((table[idx + 1] - table[idx]) * frac) >> 10);
+}
+
+SLONG Colours_FixSin(SLONG angle)
+{
+	/* Position within the turn, in 1/1024 of a sin_table entry. */
+	ULONG pos = ((ULONG) angle & 0xffff) << 2;
+	ULONG quarter = pos >> 16;
+	pos &= 0xffff;
+	if (quarter & 1)
+		pos = 0x10000 - pos;
+	/* pos == 0x10000 is the exact peak of the wave. */
+	{
+		SLONG result = pos >= 0x10000 ? COLOURS_FIX_ONE : Interpolate(sin_table, pos);
+		return quarter & 2 ? -result : result;
+	}
+}
+
+SLONG Colours_FixCos(SLONG angle)
+{
+	return Colours_FixSin(angle + COLOURS_FIX_ONE / 4);
+}
+
+/* Returns log2(X) for a positive Q16.16 X, in Q16.16. */
+static SLONG FixLog2(SLONG x)
+{
+	int msb = 30;
+	ULONG mant;
+	while (!(x & (1 << msb)))
+		msb --;
+	/* Normalise the mantissa to 1.0 <= mant < 2.0 with the fraction in
+	   bits 0..15, then look up its logarithm. */
+	mant = msb >= 16 ? (ULONG) x >> (msb - 16) : (ULONG) x << (16 - msb);
+	return ((msb - COLOURS_FIX_SHIFT) << COLOURS_FIX_SHIFT) + Interpolate(log2_table, mant & 0xffff);
+}
+
+/* Returns 2^X for a Q16.16 X, in Q16.16. Saturates on overflow. */
+static SLONG FixExp2(SLONG x)
+{
+	int shift = x >> COLOURS_FIX_SHIFT; /* floor */
+	SLONG mant = Interpolate(exp2_table, x & 0xffff);
+	if (shift >= 14)
+		return 0x7fffffff;
+	if (shift >= 0)
+		return mant << shift;
+	if (shift <= -18)
+		return 0;
+	return mant >> -shift;
+}
+
+void Colours_FixGammaSetup(Colours_fixgamma_t *gamma, double gamma_adj)
+{
+	gamma->gamma = COLOURS_FIX(gamma_adj);
+	gamma->srgb_exp = COLOURS_FIX(gamma_adj / 2.4);
+}
+
+SLONG Colours_FixGamma2sRGB(SLONG c, Colours_fixgamma_t const *gamma)
+{
+	/* log2(0.0031308) - the linear-segment threshold of sRGB. */
+	static SLONG const srgb_threshold = COLOURS_FIX(-8.319235);
+	SLONG log_c;
+	SLONG log_linear;
+	if (c <= 0)
+		/* Negative values pass unchanged, see Colours_Gamma2Linear. */
+		return c;
+	log_c = FixLog2(c);
+	log_linear = COLOURS_FIX_MUL(log_c, gamma->gamma);
+	if (log_linear <= srgb_threshold)
+		return COLOURS_FIX_MUL(FixExp2(log_linear), COLOURS_FIX(12.92));
+	/* 1.055 * (c ^ gamma) ^ (1 / 2.4) - 0.055 */
+	return COLOURS_FIX_MUL(FixExp2(COLOURS_FIX_MUL(log_c, gamma->srgb_exp)), COLOURS_FIX(1.055)) - COLOURS_FIX(0.055);
+}
+
+void Colours_FixRGB2YUV(SLONG r, SLONG g, SLONG b, SLONG *y, SLONG *u, SLONG *v)
+{
+	*y = COLOURS_FIX_MUL(r, COLOURS_FIX(0.299)) + COLOURS_FIX_MUL(g, COLOURS_FIX(0.587)) + COLOURS_FIX_MUL(b, COLOURS_FIX(0.114));
+	*u = COLOURS_FIX_MUL(r, COLOURS_FIX(-0.14713)) + COLOURS_FIX_MUL(g, COLOURS_FIX(-0.28886)) + COLOURS_FIX_MUL(b, COLOURS_FIX(0.436));
+	*v = COLOURS_FIX_MUL(r, COLOURS_FIX(0.615)) + COLOURS_FIX_MUL(g, COLOURS_FIX(-0.51499)) + COLOURS_FIX_MUL(b, COLOURS_FIX(-0.10001));
+}
+
+void Colours_FixYUV2RGB(SLONG y, SLONG u, SLONG v, SLONG *r, SLONG *g, SLONG *b)
+{
+	*r = y + COLOURS_FIX_MUL(v, COLOURS_FIX(1.13983));
+	*g = y + COLOURS_FIX_MUL(u, COLOURS_FIX(-0.39465)) + COLOURS_FIX_MUL(v, COLOURS_FIX(-0.58060));
+	*b = y + COLOURS_FIX_MUL(u, COLOURS_FIX(2.03211));
+}
+
+/* Converts a Q16.16 colour component to 0..255, truncating towards zero as
+   (int) (c * 255) does. */
+static int FixToByte(SLONG c)
+{
+	if (c <= 0)
+		return 0;
+	if (c >= COLOURS_FIX_ONE)
+		return 255;
+	return (c * 255) >> COLOURS_FIX_SHIFT;
+}
+
+void Colours_SetRGBFix(int i, SLONG r, SLONG g, SLONG b)
+{
+	Colours_SetRGB(i, FixToByte(r), FixToByte(g), FixToByte(b));
+}
+
 static void UpdateModeDependentPointers(int tv_mode)
 {
 	/* Set pointers to the current setup and external palette. */
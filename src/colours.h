@@ -1,6 +1,7 @@
 #ifndef COLOURS_H_
 #define COLOURS_H_
 
+#include "atari.h"
 #include "colours_external.h"
 
 ///extern int Colours_table[256];
@@ -96,6 +97,41 @@ void Colours_RGB2YUV(double r, double g, double b, double *y, double *u, double
    0.0 - 1.0 range). */
 void Colours_YUV2RGB(double y, double u, double v, double *r, double *g, double *b);
 
+/* Fixed-point palette arithmetic. The palette generators work in Q16.16
+   (COLOURS_FIX_ONE == 1.0) so that rebuilding the palette needs no
+   floating-point maths apart from converting the Colours_setup_t controls.
+   Angles are expressed in Q16 turns (COLOURS_FIX_ONE == 360 degrees). */
+#define COLOURS_FIX_SHIFT 16
+#define COLOURS_FIX_ONE (1 << COLOURS_FIX_SHIFT)
+/* Converts a double X to Q16.16, rounding to nearest. Also usable in
+   constant initialisers. */
+#define COLOURS_FIX(x) ((SLONG) ((x) * COLOURS_FIX_ONE + ((x) < 0 ? -0.5 : 0.5)))
+/* Multiplies two Q16.16 values. */
+#define COLOURS_FIX_MUL(a, b) ((SLONG) (((long long) (a) * (b)) >> COLOURS_FIX_SHIFT))
+
+/* Sine and cosine of ANGLE given in Q16 turns; result in Q16.16. */
+SLONG Colours_FixSin(SLONG angle);
+SLONG Colours_FixCos(SLONG angle);
+
+/* Fixed-point counterparts of Colours_RGB2YUV and Colours_YUV2RGB. */
+void Colours_FixRGB2YUV(SLONG r, SLONG g, SLONG b, SLONG *y, SLONG *u, SLONG *v);
+void Colours_FixYUV2RGB(SLONG y, SLONG u, SLONG v, SLONG *r, SLONG *g, SLONG *b);
+
+/* Precomputed exponents for Colours_FixGamma2sRGB. */
+typedef struct Colours_fixgamma_t {
+	SLONG gamma; /* CRT gamma, Q16.16 */
+	SLONG srgb_exp; /* gamma / 2.4, Q16.16 */
+} Colours_fixgamma_t;
+/* Fills GAMMA for the given gamma adjustment value. */
+void Colours_FixGammaSetup(Colours_fixgamma_t *gamma, double gamma_adj);
+/* Equivalent of Colours_Linear2sRGB(Colours_Gamma2Linear(C, gamma_adj))
+   for a Q16.16 value C. */
+SLONG Colours_FixGamma2sRGB(SLONG c, Colours_fixgamma_t const *gamma);
+
+/* Same as Colours_SetRGB, but takes Q16.16 R, G, B values in the 0.0 - 1.0
+   range. */
+void Colours_SetRGBFix(int i, SLONG r, SLONG g, SLONG b);
+
 /* Converts a gamma-adjusted color value c (0 <= c <= 1) into linear value. */
 double Colours_Gamma2Linear(double c, double gamma_adj);
 /* Converts a linear color value c (0 <= c <= 1) into sRGB gamma-corrected
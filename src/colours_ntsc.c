@@ -50,8 +50,9 @@ COLOURS_EXTERNAL_t COLOURS_NTSC_external = { "", FALSE, FALSE };
  * 33 degrees. So by looking at screenshots at Wikipedia we can
  * conclude that the colorburst angle is 270+33 in YIQ.
  * (See http://en.wikipedia.org/wiki/YUV and
- * http://en.wikipedia.org/wiki/YIQ) */
-static const double colorburst_angle = (303.0f) * M_PI / 180.0f;
+ * http://en.wikipedia.org/wiki/YIQ)
+ * The angle is given in Q16 turns, see COLOURS_FIX. */
+static const SLONG colorburst_angle = COLOURS_FIX(303.0 / 360.0);
 
 /* In COLOURS_NTSC colours are generated in 2 stages:
    1. Generate Y, I and Q values for all 256 colours and store in an
@@ -60,42 +61,46 @@ static const double colorburst_angle = (303.0f) * M_PI / 180.0f;
    Splitting the process to 2 stages is necessary to allow the NTSC_FILTER
    module to use the same palette generation routines. Without such
    requirement, NTSC palette generation would be performed in one stage,
-   similarly to the COLOURS_PAL module. */
+   similarly to the COLOURS_PAL module.
+   All values in yiq_table are Q16.16 fixed-point numbers, so that a palette
+   update does not depend on floating-point maths. */
 
 /* Creates YIQ_TABLE from external palette. START_ANGLE and START_SATURATIION
    are provided as parameters, because NTSC_FILTER needs to set these values
    according to its internal setup (burst_phase etc.).
    External palette is not adjusted if COLOURS_NTSC_external.adjust is false. */
-static void UpdateYIQTableFromExternal(double yiq_table[768], double start_angle, const double start_saturation)
+static void UpdateYIQTableFromExternal(SLONG yiq_table[768], SLONG start_angle, const SLONG start_saturation)
 {
 	unsigned char *ext_ptr = COLOURS_NTSC_external.palette;
 	int n;
+	SLONG s, c;
+	SLONG const y_mult = COLOURS_FIX(COLOURS_NTSC_setup.contrast * 0.5 + 1);
+	SLONG const y_add = COLOURS_FIX(COLOURS_NTSC_setup.brightness * 0.5);
 
 	start_angle -= colorburst_angle;
+	s = Colours_FixSin(start_angle);
+	c = Colours_FixCos(start_angle);
 
 	for (n = 0; n < 256; n ++) {
 		/* Convert RGB values from external palette to YIQ. */
-		double r = (double)*ext_ptr++ / 255.0;
-		double g = (double)*ext_ptr++ / 255.0;
-		double b = (double)*ext_ptr++ / 255.0;
-		double y = 0.299 * r + 0.587 * g + 0.114 * b;
-		double i = 0.595716 * r - 0.274453 * g - 0.321263 * b;
-		double q = 0.211456 * r - 0.522591 * g + 0.311135 * b;
-		double s = sin(start_angle);
-		double c = cos(start_angle);
-		double tmp_i = i;
-		i = tmp_i * c - q * s;
-		q = tmp_i * s + q * c;
+		SLONG r = ((SLONG)*ext_ptr++ << COLOURS_FIX_SHIFT) / 255;
+		SLONG g = ((SLONG)*ext_ptr++ << COLOURS_FIX_SHIFT) / 255;
+		SLONG b = ((SLONG)*ext_ptr++ << COLOURS_FIX_SHIFT) / 255;
+		SLONG y = COLOURS_FIX_MUL(r, COLOURS_FIX(0.299)) + COLOURS_FIX_MUL(g, COLOURS_FIX(0.587)) + COLOURS_FIX_MUL(b, COLOURS_FIX(0.114));
+		SLONG i = COLOURS_FIX_MUL(r, COLOURS_FIX(0.595716)) - COLOURS_FIX_MUL(g, COLOURS_FIX(0.274453)) - COLOURS_FIX_MUL(b, COLOURS_FIX(0.321263));
+		SLONG q = COLOURS_FIX_MUL(r, COLOURS_FIX(0.211456)) - COLOURS_FIX_MUL(g, COLOURS_FIX(0.522591)) + COLOURS_FIX_MUL(b, COLOURS_FIX(0.311135));
+		SLONG tmp_i = i;
+		i = COLOURS_FIX_MUL(tmp_i, c) - COLOURS_FIX_MUL(q, s);
+		q = COLOURS_FIX_MUL(tmp_i, s) + COLOURS_FIX_MUL(q, c);
 		/* Optionally adjust external palette. */
 		if (COLOURS_NTSC_external.adjust) {
-			y *= COLOURS_NTSC_setup.contrast * 0.5 + 1;
-			y += COLOURS_NTSC_setup.brightness * 0.5;
-			if (y > 1.0)
-				y = 1.0;
-			else if (y < 0.0)
-				y = 0.0;
-			i *= start_saturation + 1;
-			q *= start_saturation + 1;
+			y = COLOURS_FIX_MUL(y, y_mult) + y_add;
+			if (y > COLOURS_FIX_ONE)
+				y = COLOURS_FIX_ONE;
+			else if (y < 0)
+				y = 0;
+			i = COLOURS_FIX_MUL(i, start_saturation + COLOURS_FIX_ONE);
+			q = COLOURS_FIX_MUL(q, start_saturation + COLOURS_FIX_ONE);
 		}
 
 		*yiq_table++ = y;
@@ -107,44 +112,52 @@ static void UpdateYIQTableFromExternal(double yiq_table[768], double start_angle
 /* Generates NTSC palette into YIQ_TABLE. START_ANGLE and START_SATURATIION
    are provided as parameters, because NTSC_FILTER needs to set these values
    according to its internal setup (burst_phase etc.) */
-static void UpdateYIQTableFromGenerated(double yiq_table[768], const double start_angle, const double start_saturation)
+static void UpdateYIQTableFromGenerated(SLONG yiq_table[768], const SLONG start_angle, const SLONG start_saturation)
 {
-	/* Difference between two consecutive chrominances, in radians. */
-	double color_diff = COLOURS_NTSC_setup.color_delay * M_PI / 180.0;
+	/* Difference between two consecutive chrominances, in Q16 turns. */
+	SLONG const color_diff = COLOURS_FIX(COLOURS_NTSC_setup.color_delay / 360.0);
 
 	int cr, lm;
 
-	double scaled_black_level = (double)COLOURS_NTSC_setup.black_level / 255.0;
-	double scaled_white_level = (double)COLOURS_NTSC_setup.white_level / 255.0;
+	SLONG const scaled_black_level = (COLOURS_NTSC_setup.black_level << COLOURS_FIX_SHIFT) / 255;
+	SLONG const scaled_white_level = (COLOURS_NTSC_setup.white_level << COLOURS_FIX_SHIFT) / 255;
+	SLONG const y_mult = COLOURS_FIX(COLOURS_NTSC_setup.contrast * 0.5 + 1);
+	SLONG const y_add = COLOURS_FIX(COLOURS_NTSC_setup.brightness * 0.5);
 
 	/* NTSC luma multipliers from CGIA.PDF */
-	double luma_mult[16]={
-		0.6941, 0.7091, 0.7241, 0.7401, 
-		0.7560, 0.7741, 0.7931, 0.8121,
-		0.8260, 0.8470, 0.8700, 0.8930,
-		0.9160, 0.9420, 0.9690, 1.0000};
+	static SLONG const luma_mult[16]={
+		COLOURS_FIX(0.6941), COLOURS_FIX(0.7091), COLOURS_FIX(0.7241), COLOURS_FIX(0.7401),
+		COLOURS_FIX(0.7560), COLOURS_FIX(0.7741), COLOURS_FIX(0.7931), COLOURS_FIX(0.8121),
+		COLOURS_FIX(0.8260), COLOURS_FIX(0.8470), COLOURS_FIX(0.8700), COLOURS_FIX(0.8930),
+		COLOURS_FIX(0.9160), COLOURS_FIX(0.9420), COLOURS_FIX(0.9690), COLOURS_FIX(1.0000)};
+
+	/* Luma does not depend on chroma, so compute it once per palette. */
+	SLONG luma[16];
+
+	for (lm = 0; lm < 16; lm ++) {
+		/* calculate y for luma entry */
+		SLONG y = (SLONG) (((long long) (luma_mult[lm] - luma_mult[0]) << COLOURS_FIX_SHIFT) / (luma_mult[15] - luma_mult[0]));
+		y = COLOURS_FIX_MUL(y, y_mult) + y_add;
+		/* Scale the Y signal's range from 0..1 to
+		* scaled_black_level..scaled_white_level */
+		y = COLOURS_FIX_MUL(y, scaled_white_level - scaled_black_level) + scaled_black_level;
+		/*
+		if (y < scaled_black_level)
+			y = scaled_black_level;
+		else if (y > scaled_white_level)
+			y = scaled_white_level;
+		*/
+		luma[lm] = y;
+	}
 
 	for (cr = 0; cr < 16; cr ++) {
-		double angle = start_angle + (cr - 1) * color_diff;
-		double saturation = (cr ? (start_saturation + 1) * 0.175f: 0.0);
-		double i = cos(angle) * saturation;
-		double q = sin(angle) * saturation;
+		SLONG angle = start_angle + (cr - 1) * color_diff;
+		SLONG saturation = (cr ? COLOURS_FIX_MUL(start_saturation + COLOURS_FIX_ONE, COLOURS_FIX(0.175)) : 0);
+		SLONG i = COLOURS_FIX_MUL(Colours_FixCos(angle), saturation);
+		SLONG q = COLOURS_FIX_MUL(Colours_FixSin(angle), saturation);
 
 		for (lm = 0; lm < 16; lm ++) {
-			/* calculate yiq for color entry */
-			double y = (luma_mult[lm] - luma_mult[0]) / (luma_mult[15] - luma_mult[0]);
-			y *= COLOURS_NTSC_setup.contrast * 0.5 + 1;
-			y += COLOURS_NTSC_setup.brightness * 0.5;
-			/* Scale the Y signal's range from 0..1 to
-			* scaled_black_level..scaled_white_level */
-			y = y * (scaled_white_level - scaled_black_level) + scaled_black_level;
-			/*
-			if (y < scaled_black_level)
-				y = scaled_black_level;
-			else if (y > scaled_white_level)
-				y = scaled_white_level;
-			*/
-			*yiq_table++ = y;
+			*yiq_table++ = luma[lm];
 			*yiq_table++ = i;
 			*yiq_table++ = q;
 		}
@@ -153,7 +166,7 @@ static void UpdateYIQTableFromGenerated(double yiq_table[768], const double star
 
 /* Fills YIQ_TABLE with palette. Depending on the current setup, it is
    computed from an internally-generated or external palette. */
-static void UpdateYIQTable(double yiq_table[768], double start_angle, const double start_saturation)
+static void UpdateYIQTable(SLONG yiq_table[768], SLONG start_angle, const SLONG start_saturation)
 {
 	if (COLOURS_NTSC_external.loaded)
 		UpdateYIQTableFromExternal(yiq_table, start_angle, start_saturation);
@@ -163,47 +176,50 @@ static void UpdateYIQTable(double yiq_table[768], double start_angle, const doub
 
 void COLOURS_NTSC_GetYIQ(double yiq_table[768], const double start_angle)
 {
+	SLONG fix_table[768];
+	int n;
 	/* Set the generated palette's saturation to 0.0, because NTSC_FILTER
 	   applies the saturation setting internally. */
-	UpdateYIQTable(yiq_table, start_angle, 0.0);
+	UpdateYIQTable(fix_table, COLOURS_FIX(start_angle / (2.0 * M_PI)), 0);
+	for (n = 0; n < 768; n ++)
+		yiq_table[n] = (double) fix_table[n] / COLOURS_FIX_ONE;
 }
 
 /* Converts YIQ values from YIQ_TABLE to RGB values. Stores them in
    COLOURTABLE. */
-static void YIQ2RGB(const double yiq_table[768])
+static void YIQ2RGB(const SLONG yiq_table[768])
 {
-	const double *yiq_ptr = yiq_table;
+	const SLONG *yiq_ptr = yiq_table;
 	int n;
+	Colours_fixgamma_t gamma;
+	Colours_FixGammaSetup(&gamma, COLOURS_NTSC_setup.gamma);
 	for (n = 0; n < 256; n ++) {
-		double y = *yiq_ptr++;
-		double i = *yiq_ptr++;
-		double q = *yiq_ptr++;
-		double r, g, b;
-		r = y + 0.9563 * i + 0.6210 * q;
-		g = y - 0.2721 * i - 0.6474 * q;
-		b = y - 1.1070 * i + 1.7046 * q;
+		SLONG y = *yiq_ptr++;
+		SLONG i = *yiq_ptr++;
+		SLONG q = *yiq_ptr++;
+		SLONG r, g, b;
+		r = y + COLOURS_FIX_MUL(i, COLOURS_FIX(0.9563)) + COLOURS_FIX_MUL(q, COLOURS_FIX(0.6210));
+		g = y - COLOURS_FIX_MUL(i, COLOURS_FIX(0.2721)) - COLOURS_FIX_MUL(q, COLOURS_FIX(0.6474));
+		b = y - COLOURS_FIX_MUL(i, COLOURS_FIX(1.1070)) + COLOURS_FIX_MUL(q, COLOURS_FIX(1.7046));
 
 		if (!COLOURS_NTSC_external.loaded || COLOURS_NTSC_external.adjust) {
 			/* The r, g, b values derived from the YIQ signal are non-linear
 			   (ie. gamma-corrected). We convert them to linear values,
-			   assuming the CRT TV's gamma = COLOURS_NTSC_setup.gamma. */
-			r = Colours_Gamma2Linear(r, COLOURS_NTSC_setup.gamma);
-			g = Colours_Gamma2Linear(g, COLOURS_NTSC_setup.gamma);
-			b = Colours_Gamma2Linear(b, COLOURS_NTSC_setup.gamma);
-			/* Now we convert the linear values to the sRGB colourspace. */
-			r = Colours_Linear2sRGB(r);
-			g = Colours_Linear2sRGB(g);
-			b = Colours_Linear2sRGB(b);
+			   assuming the CRT TV's gamma = COLOURS_NTSC_setup.gamma, and
+			   then to the sRGB colourspace. */
+			r = Colours_FixGamma2sRGB(r, &gamma);
+			g = Colours_FixGamma2sRGB(g, &gamma);
+			b = Colours_FixGamma2sRGB(b, &gamma);
 		}
 
-		Colours_SetRGB(n, (int) (r * 255), (int) (g * 255), (int) (b * 255));
+		Colours_SetRGBFix(n, r, g, b);
 	}
 }
 
 void COLOURS_NTSC_Update()
 {
-	double yiq_table[768];
-	UpdateYIQTable(yiq_table, colorburst_angle + COLOURS_NTSC_setup.hue * M_PI, COLOURS_NTSC_setup.saturation);
+	SLONG yiq_table[768];
+	UpdateYIQTable(yiq_table, colorburst_angle + COLOURS_FIX(COLOURS_NTSC_setup.hue * 0.5), COLOURS_FIX(COLOURS_NTSC_setup.saturation));
 	YIQ2RGB(yiq_table);
 }
 
@@ -47,36 +47,39 @@ static struct {
 COLOURS_EXTERNAL_t COLOURS_PAL_external = { "", FALSE, FALSE };
 
 /* Fills YUV_TABLE from external palette. External palette is not adjusted if
-   COLOURS_PAL_external.adjust is false. */
-static void GetYUVFromExternal(double yuv_table[256*5])
+   COLOURS_PAL_external.adjust is false. All values in YUV_TABLE are Q16.16
+   fixed-point numbers. */
+static void GetYUVFromExternal(SLONG yuv_table[256*5])
 {
 	unsigned char *ext_ptr = COLOURS_PAL_external.palette;
 	int n;
 
-	double const hue = COLOURS_PAL_setup.hue * M_PI;
-	double const s = sin(hue);
-	double const c = cos(hue);
+	SLONG const hue = COLOURS_FIX(COLOURS_PAL_setup.hue * 0.5);
+	SLONG const s = Colours_FixSin(hue);
+	SLONG const c = Colours_FixCos(hue);
+	SLONG const y_mult = COLOURS_FIX(COLOURS_PAL_setup.contrast * 0.5 + 1);
+	SLONG const y_add = COLOURS_FIX(COLOURS_PAL_setup.brightness * 0.5);
+	SLONG const uv_mult = COLOURS_FIX(COLOURS_PAL_setup.saturation + 1.0);
 
 	for (n = 0; n < 256; n ++) {
 		/* Convert RGB values from external palette to YUV. */
-		double r = (double)*ext_ptr++ / 255.0;
-		double g = (double)*ext_ptr++ / 255.0;
-		double b = (double)*ext_ptr++ / 255.0;
-		double y, u, v, tmp_u;
-		Colours_RGB2YUV(r, g, b, &y, &u, &v);
+		SLONG r = ((SLONG)*ext_ptr++ << COLOURS_FIX_SHIFT) / 255;
+		SLONG g = ((SLONG)*ext_ptr++ << COLOURS_FIX_SHIFT) / 255;
+		SLONG b = ((SLONG)*ext_ptr++ << COLOURS_FIX_SHIFT) / 255;
+		SLONG y, u, v, tmp_u;
+		Colours_FixRGB2YUV(r, g, b, &y, &u, &v);
 		tmp_u = u;
-		u = tmp_u * c - v * s;
-		v = tmp_u * s + v * c;
+		u = COLOURS_FIX_MUL(tmp_u, c) - COLOURS_FIX_MUL(v, s);
+		v = COLOURS_FIX_MUL(tmp_u, s) + COLOURS_FIX_MUL(v, c);
 		/* Optionally adjust external palette. */
 		if (COLOURS_PAL_external.adjust) {
-			y *= COLOURS_PAL_setup.contrast * 0.5 + 1;
-			y += COLOURS_PAL_setup.brightness * 0.5;
-			if (y > 1.0)
-				y = 1.0;
-			else if (y < 0.0)
-				y = 0.0;
-			u *= COLOURS_PAL_setup.saturation + 1.0;
-			v *= COLOURS_PAL_setup.saturation + 1.0;
+			y = COLOURS_FIX_MUL(y, y_mult) + y_add;
+			if (y > COLOURS_FIX_ONE)
+				y = COLOURS_FIX_ONE;
+			else if (y < 0)
+				y = 0;
+			u = COLOURS_FIX_MUL(u, uv_mult);
+			v = COLOURS_FIX_MUL(v, uv_mult);
 		}
 
 		*yuv_table++ = y;
@@ -189,8 +192,9 @@ static void GetYUVFromExternal(double yuv_table[256*5])
    shifted by 180 deg.
 */
 
-/* Generates PAL palette into YUV_TABLE. */
-static void GetYUVFromGenerated(double yuv_table[256*5])
+/* Generates PAL palette into YUV_TABLE. All delays and angles are computed
+   in Q16 turns of the colour subcarrier, see COLOURS_FIX. */
+static void GetYUVFromGenerated(SLONG yuv_table[256*5])
 {
 	struct del_coeff {
 		int add;
@@ -237,88 +241,100 @@ static void GetYUVFromGenerated(double yuv_table[256*5])
 	};
 	int cr, lm;
 
-	double const scaled_black_level = (double)COLOURS_PAL_setup.black_level / 255.0f;
-	double const scaled_white_level = (double)COLOURS_PAL_setup.white_level / 255.0f;
+	SLONG const scaled_black_level = (COLOURS_PAL_setup.black_level << COLOURS_FIX_SHIFT) / 255;
+	SLONG const scaled_white_level = (COLOURS_PAL_setup.white_level << COLOURS_FIX_SHIFT) / 255;
+	SLONG const y_mult = COLOURS_FIX(COLOURS_PAL_setup.contrast * 0.5 + 1);
+	SLONG const y_add = COLOURS_FIX(COLOURS_PAL_setup.brightness * 0.5);
 
 	/* NTSC luma multipliers from CGIA.PDF */
-	static double const luma_mult[16] = {
-		0.6941, 0.7091, 0.7241, 0.7401,
-		0.7560, 0.7741, 0.7931, 0.8121,
-		0.8260, 0.8470, 0.8700, 0.8930,
-		0.9160, 0.9420, 0.9690, 1.0000};
+	static SLONG const luma_mult[16] = {
+		COLOURS_FIX(0.6941), COLOURS_FIX(0.7091), COLOURS_FIX(0.7241), COLOURS_FIX(0.7401),
+		COLOURS_FIX(0.7560), COLOURS_FIX(0.7741), COLOURS_FIX(0.7931), COLOURS_FIX(0.8121),
+		COLOURS_FIX(0.8260), COLOURS_FIX(0.8470), COLOURS_FIX(0.8700), COLOURS_FIX(0.8930),
+		COLOURS_FIX(0.9160), COLOURS_FIX(0.9420), COLOURS_FIX(0.9690), COLOURS_FIX(1.0000)};
 
 	/* When phase shift between even and odd colorbursts is close to 180 deg, the
 	   TV stops interpreting color signal. This value determines how close to 180
 	   deg that phase shift must be. It is specific to a TV set. */
-	static double const color_disable_threshold = 0.05;
+	static SLONG const color_disable_threshold = COLOURS_FIX(0.05);
 	/* Base delay - 1/4.43MHz * base_del = ca. 95.2ns */
-	static double const base_del = 0.421894970414201;
+	static SLONG const base_del = COLOURS_FIX(0.421894970414201);
 	/* Additional delay - 1/4.43MHz * add_del = ca. 100.7ns */
-	static double const add_del = 0.446563064859117;
+	static SLONG const add_del = COLOURS_FIX(0.446563064859117);
 	/* Delay introduced by the DEL pin voltage. */
-	double const del_adj = COLOURS_PAL_setup.color_delay / 360.0;
+	SLONG const del_adj = COLOURS_FIX(COLOURS_PAL_setup.color_delay / 360.0);
 
 	/* Phase delays of colorbursts in even and odd lines. They are equal to
 	   Hue 1. */
-	double const even_burst_del = base_del + add_del * del_coeffs.even[0].add + del_adj * del_coeffs.even[0].mult;
-	double const odd_burst_del = base_del + add_del * del_coeffs.odd[0].add + del_adj * del_coeffs.odd[0].mult;
+	SLONG const even_burst_del = base_del + add_del * del_coeffs.even[0].add + del_adj * del_coeffs.even[0].mult;
+	SLONG const odd_burst_del = base_del + add_del * del_coeffs.odd[0].add + del_adj * del_coeffs.odd[0].mult;
 
 	/* Reciprocal of the recreated subcarrier's amplitude. */
-	double saturation_mult;
+	SLONG saturation_mult;
 	/* Phase delay of the recreated amplitude. */
-	double subcarrier_del = (even_burst_del + odd_burst_del + COLOURS_PAL_setup.hue) / 2.0;
+	SLONG subcarrier_del = (even_burst_del + odd_burst_del + COLOURS_FIX(COLOURS_PAL_setup.hue)) / 2;
+	SLONG saturation;
 
 	/* Phase difference between colorbursts in even and odd lines. */
-	double burst_diff = even_burst_del - odd_burst_del;
-	burst_diff -= floor(burst_diff); /* Normalize to 0..1. */
+	SLONG burst_diff = even_burst_del - odd_burst_del;
+	burst_diff &= COLOURS_FIX_ONE - 1; /* Normalize to 0..1. */
 
-	if (burst_diff > 0.5 - color_disable_threshold && burst_diff < 0.5 + color_disable_threshold)
+	/* Luma does not depend on chroma, so compute it once per palette. */
+	SLONG luma[16];
+
+	if (burst_diff > COLOURS_FIX_ONE / 2 - color_disable_threshold && burst_diff < COLOURS_FIX_ONE / 2 + color_disable_threshold)
 		/* Shift between colorbursts close to 180 deg. Don't produce color. */
-		saturation_mult = 0.0;
+		saturation_mult = 0;
 	else {
 		/* Subcarrier is a sum of two waves with equal frequency and amplitude,
 		   but phase-shifted by 2pi*burst_diff. The formula is derived from
-		   http://2000clicks.com/mathhelp/GeometryTrigEquivPhaseShift.aspx */
-		double subcarrier_amplitude = sqrt(2.0 * cos(burst_diff*2.0*M_PI) + 2.0);
+		   http://2000clicks.com/mathhelp/GeometryTrigEquivPhaseShift.aspx
+		   and simplified with sqrt(2 * cos(x) + 2) == 2 * |cos(x / 2)|. */
+		SLONG subcarrier_amplitude = 2 * Colours_FixCos(burst_diff / 2);
+		if (subcarrier_amplitude < 0)
+			subcarrier_amplitude = -subcarrier_amplitude;
 		/* Normalise saturation_mult by multiplying by sqrt(2), so that it
 		   equals 1.0 when odd & even colorbursts are shifted by 90 deg (ie.
 		   burst_diff == 0.25). */
-		saturation_mult = sqrt(2.0) / subcarrier_amplitude;
+		saturation_mult = (SLONG) (((long long) COLOURS_FIX(1.41421356237310) << COLOURS_FIX_SHIFT) / subcarrier_amplitude);
+	}
+	saturation = COLOURS_FIX_MUL(COLOURS_FIX_MUL(COLOURS_FIX(COLOURS_PAL_setup.saturation + 1), COLOURS_FIX(0.175)), saturation_mult);
+
+	for (lm = 0; lm < 16; lm ++) {
+		/* calculate y for luma entry */
+		SLONG y = (SLONG) (((long long) (luma_mult[lm] - luma_mult[0]) << COLOURS_FIX_SHIFT) / (luma_mult[15] - luma_mult[0]));
+		y = COLOURS_FIX_MUL(y, y_mult) + y_add;
+		/* Scale the Y signal's range from 0..1 to
+		   scaled_black_level..scaled_white_level */
+		y = COLOURS_FIX_MUL(y, scaled_white_level - scaled_black_level) + scaled_black_level;
+		/*
+		if (y < scaled_black_level)
+			y = scaled_black_level;
+		else if (y > scaled_white_level)
+			y = scaled_white_level;
+		*/
+		luma[lm] = y;
 	}
 
 	for (cr = 0; cr < 16; cr ++) {
-		double even_u = 0.0;
-		double odd_u = 0.0;
-		double even_v = 0.0;
-		double odd_v = 0.0;
+		SLONG even_u = 0;
+		SLONG odd_u = 0;
+		SLONG even_v = 0;
+		SLONG odd_v = 0;
 		if (cr) {
 			struct del_coeff const *even_delay = &(del_coeffs.even[cr - 1]);
 			struct del_coeff const *odd_delay = &(del_coeffs.odd[cr - 1]);
-			double even_del = base_del + add_del * even_delay->add + del_adj * even_delay->mult;
-			double odd_del = base_del + add_del * odd_delay->add + del_adj * odd_delay->mult;
-			double even_angle = (0.5 - (even_del - subcarrier_del)) * 2.0 * M_PI;
-			double odd_angle = (0.5 + (odd_del - subcarrier_del)) * 2.0 * M_PI;
-			double saturation = (COLOURS_PAL_setup.saturation + 1) * 0.175 * saturation_mult;
-			even_u = cos(even_angle) * saturation;
-			even_v = sin(even_angle) * saturation;
-			odd_u = cos(odd_angle) * saturation;
-			odd_v = sin(odd_angle) * saturation;
+			SLONG even_del = base_del + add_del * even_delay->add + del_adj * even_delay->mult;
+			SLONG odd_del = base_del + add_del * odd_delay->add + del_adj * odd_delay->mult;
+			SLONG even_angle = COLOURS_FIX_ONE / 2 - (even_del - subcarrier_del);
+			SLONG odd_angle = COLOURS_FIX_ONE / 2 + (odd_del - subcarrier_del);
+			even_u = COLOURS_FIX_MUL(Colours_FixCos(even_angle), saturation);
+			even_v = COLOURS_FIX_MUL(Colours_FixSin(even_angle), saturation);
+			odd_u = COLOURS_FIX_MUL(Colours_FixCos(odd_angle), saturation);
+			odd_v = COLOURS_FIX_MUL(Colours_FixSin(odd_angle), saturation);
 		}
 		for (lm = 0; lm < 16; lm ++) {
-			/* calculate yuv for color entry */
-			double y = (luma_mult[lm] - luma_mult[0]) / (luma_mult[15] - luma_mult[0]);
-			y *= COLOURS_PAL_setup.contrast * 0.5 + 1;
-			y += COLOURS_PAL_setup.brightness * 0.5;
-			/* Scale the Y signal's range from 0..1 to
-			   scaled_black_level..scaled_white_level */
-			y = y * (scaled_white_level - scaled_black_level) + scaled_black_level;
-			/*
-			if (y < scaled_black_level)
-				y = scaled_black_level;
-			else if (y > scaled_white_level)
-				y = scaled_white_level;
-			*/
-			*yuv_table++ = y;
+			*yuv_table++ = luma[lm];
 			*yuv_table++ = even_u;
 			*yuv_table++ = odd_u;
 			*yuv_table++ = even_v;
@@ -327,7 +343,7 @@ static void GetYUVFromGenerated(double yuv_table[256*5])
 	}
 }
 
-void COLOURS_PAL_GetYUV(double yuv_table[256*5])
+static void GetYUV(SLONG yuv_table[256*5])
 {
 	if (COLOURS_PAL_external.loaded)
 		GetYUVFromExternal(yuv_table);
@@ -335,46 +351,54 @@ void COLOURS_PAL_GetYUV(double yuv_table[256*5])
 		GetYUVFromGenerated(yuv_table);
 }
 
+void COLOURS_PAL_GetYUV(double yuv_table[256*5])
+{
+	SLONG fix_table[256*5];
+	int n;
+	GetYUV(fix_table);
+	for (n = 0; n < 256*5; n ++)
+		yuv_table[n] = (double) fix_table[n] / COLOURS_FIX_ONE;
+}
+
 /* Averages YUV values from YUV_TABLE and converts them to RGB values. Stores
    them in COLOURTABLE. */
-static void YUV2RGB(double const yuv_table[256*5])
+static void YUV2RGB(SLONG const yuv_table[256*5])
 {
-	double const *yuv_ptr = yuv_table;
+	SLONG const *yuv_ptr = yuv_table;
 	int n;
+	Colours_fixgamma_t gamma;
+	Colours_FixGammaSetup(&gamma, COLOURS_PAL_setup.gamma);
 	for (n = 0; n < 256; ++n) {
-		double y = *yuv_ptr++;
-		double even_u = *yuv_ptr++;
-		double odd_u = *yuv_ptr++;
-		double even_v = *yuv_ptr++;
-		double odd_v = *yuv_ptr++;
-		double r, g, b;
+		SLONG y = *yuv_ptr++;
+		SLONG even_u = *yuv_ptr++;
+		SLONG odd_u = *yuv_ptr++;
+		SLONG even_v = *yuv_ptr++;
+		SLONG odd_v = *yuv_ptr++;
+		SLONG r, g, b;
 		/* The different colors in odd and even lines are not
 		   emulated - instead the palette contains averaged values. */
-		double u = (even_u + odd_u) / 2.0;
-		double v = (even_v + odd_v) / 2.0;
-		Colours_YUV2RGB(y, u, v, &r, &g, &b);
+		SLONG u = (even_u + odd_u) / 2;
+		SLONG v = (even_v + odd_v) / 2;
+		Colours_FixYUV2RGB(y, u, v, &r, &g, &b);
 
 		if (!COLOURS_PAL_external.loaded || COLOURS_PAL_external.adjust) {
 			/* The r, g, b values derived from the YUV signal are non-linear
 			   (ie. gamma-corrected). We convert them to linear values,
-			   assuming the CRT TV's gamma = COLOURS_PAL_setup.gamma. */
-			r = Colours_Gamma2Linear(r, COLOURS_PAL_setup.gamma);
-			g = Colours_Gamma2Linear(g, COLOURS_PAL_setup.gamma);
-			b = Colours_Gamma2Linear(b, COLOURS_PAL_setup.gamma);
-			/* Now we convert the linear values to the sRGB colourspace. */
-			r = Colours_Linear2sRGB(r);
-			g = Colours_Linear2sRGB(g);
-			b = Colours_Linear2sRGB(b);
+			   assuming the CRT TV's gamma = COLOURS_PAL_setup.gamma, and
+			   then to the sRGB colourspace. */
+			r = Colours_FixGamma2sRGB(r, &gamma);
+			g = Colours_FixGamma2sRGB(g, &gamma);
+			b = Colours_FixGamma2sRGB(b, &gamma);
 		}
 
-		Colours_SetRGB(n, (int) (r * 255), (int) (g * 255), (int) (b * 255));
+		Colours_SetRGBFix(n, r, g, b);
 	}
 }
 
 void COLOURS_PAL_Update()
 {
-	double yuv_table[256*5];
-	COLOURS_PAL_GetYUV(yuv_table);
+	SLONG yuv_table[256*5];
+	GetYUV(yuv_table);
 	YUV2RGB(yuv_table);
 }
 
@@ -62,7 +62,7 @@ int CompFile_ExtractGZ(const char *infilename, FIL *outfp)
 				result = -1;
 		}
 	} while (result == UNCOMPRESS_BUFFER_SIZE);
-	free(buf);
+	Util_free(buf);
 	gzclose(gzf);
 	return result >= 0;
 #endif	/* HAVE_LIBZ */
@@ -16,6 +16,14 @@
 #define EMUOS_ALTIRRA 1
 #define SUPPORTS_PLATFORM_SLEEP 1
 #define DIR_SEP_BACKSLASH 1
+/* per-frame time breakdown, see telemetry.h */
+#define TELEMETRY
+/* track written memory pages for incremental snapshots, see memory.h */
+#define DIRTY_PAGES
+/* heap usage per Util_malloc() tag, see util.h */
+#define HEAP_STATS
+/* count lookup table reads for SRAMTAB_Report(), see sramtab.h */
+//#define SRAMTAB_STATS
 
 #include "debug.h"
 
@@ -57,6 +57,7 @@
 
 #include "config.h"
 #include <stdlib.h>	/* exit() */
+#include <string.h>	/* memcmp() */
 
 #include "cpu.h"
 #ifdef ASAP /* external project, see http://asap.sf.net */
@@ -301,6 +302,7 @@ void CPU_PutStatus(void)
 		if ((addr ^ GET_PC()) & 0xff00) \
 			ANTIC_xpos++; \
 		ANTIC_xpos++; \
+		BRANCH_IDLE \
 		SET_PC(addr); \
 		DONE \
 	} \
@@ -312,6 +314,321 @@ void CPU_PutStatus(void)
 #define NCYCLES_X   if ((UBYTE) addr < X) ANTIC_xpos++
 #define NCYCLES_Y   if ((UBYTE) addr < Y) ANTIC_xpos++
 
+/* Busy-waiting.  STA/STX/STY WSYNC halt the CPU without calling
+   ANTIC_PutByte.  A loop of LDA VCOUNT, optionally CMP #, and a conditional
+   branch back to the LDA reads the same value until VCOUNT changes at
+   ANTIC_LINE_C, so CPU_GO skips the iterations before that, or before
+   ANTIC_xpos_limit, at once.  An idle loop - a short one that only reads
+   RAM or ROM into registers it sets before using, and tests them, leaving
+   by branches not taken - cannot end before an interrupt, and interrupts
+   come between CPU_GO calls, so once it has run a whole iteration it is
+   skipped to ANTIC_xpos_limit.  None of this works with NEW_CYCLE_EXACT,
+   where the ANTIC cycle depends on DMA, nor when every instruction is
+   watched. */
+#if !defined(NEW_CYCLE_EXACT) && !defined(MONITOR_BREAK) && !defined(MONITOR_BREAKPOINTS) \
+	&& !defined(MONITOR_PROFILE) && !defined(MONITOR_TRACE)
+#define FAST_WAITS
+#endif
+
+ULONG CPU_vcount_skipped = 0;
+ULONG CPU_idle_skipped = 0;
+
+#ifdef FAST_WAITS
+
+#define ABSOLUTE_PutByte(addr, byte) \
+	if ((addr & 0xff0f) == 0xd40a) { \
+		if (ANTIC_xpos <= ANTIC_WSYNC_C && ANTIC_xpos_limit >= ANTIC_WSYNC_C) \
+			ANTIC_xpos = ANTIC_WSYNC_C; \
+		else { \
+			ANTIC_wsync_halt = TRUE; \
+			ANTIC_xpos = ANTIC_xpos_limit; \
+		} \
+	} \
+	else \
+		MEMORY_PutByte(addr, byte)
+
+/* Returns the cycles of the iterations to skip of a VCOUNT loop whose LDA
+   VCOUNT is at PC and reads now. */
+static int VcountWait(UWORD pc)
+{
+	UBYTE const v = ANTIC_GetByte(0xd40b, TRUE);
+	UWORD next = pc + 3;
+	UBYTE n = v;
+	int cmp = FALSE;
+	int loop = 4 + 3;
+	int taken;
+	int change;
+	int skip;
+	if (MEMORY_dGetByte(next) == 0xc9) {	/* CMP #ab */
+		n = v - MEMORY_dGetByte(next + 1);
+		cmp = TRUE;
+		next += 2;
+		loop += 2;
+	}
+	switch (MEMORY_dGetByte(next)) {
+	case 0x10:	/* BPL */
+		taken = !(n & 0x80);
+		break;
+	case 0x30:	/* BMI */
+		taken = n & 0x80;
+		break;
+	case 0x90:	/* BCC, the carry known after CMP only */
+		taken = cmp && v < MEMORY_dGetByte(next - 1);
+		break;
+	case 0xb0:	/* BCS */
+		taken = cmp && v >= MEMORY_dGetByte(next - 1);
+		break;
+	case 0xd0:	/* BNE */
+		taken = n != 0;
+		break;
+	case 0xf0:	/* BEQ */
+		taken = n == 0;
+		break;
+	default:
+		return 0;
+	}
+	next += 2;
+	if (!taken || (UWORD) (next + (SBYTE) MEMORY_dGetByte(next - 1)) != pc)
+		return 0;
+	if ((pc ^ next) & 0xff00)
+		loop++;
+	/* the next iteration starts at ANTIC_xpos - 4 + loop, while below the
+	   limit, and reads at ANTIC_xpos + loop */
+	skip = (ANTIC_xpos_limit - ANTIC_xpos + 4 - 1) / loop;
+	if (ANTIC_xpos < ANTIC_LINE_C) {
+		change = (ANTIC_LINE_C - ANTIC_xpos - 1) / loop + 1;
+		if (change < skip)
+			skip = change;
+	}
+	if (skip <= 0)
+		return 0;
+	CPU_vcount_skipped += skip * loop;
+	return skip * loop;
+}
+
+/* Longest idle loop, in bytes */
+#define IDLE_LOOP_SIZE 24
+
+/* Loops found not idle, by the low bits of the PC after their branch,
+   with their code: loading a program or switching a bank may put an idle
+   loop where a busy one was, without a reset. */
+static struct {
+	UWORD top;
+	UWORD end;
+	UBYTE code[IDLE_LOOP_SIZE];
+} busy_loops[8];
+
+/* Cycles CPU_GO has run, less ANTIC_xpos while it runs */
+static ULONG go_cycles = 0;
+
+/* The idle loop whose branch was taken last, and when.  Until the loop has
+   run from the top, the branch may have been reached from outside it. */
+static UWORD idle_end = 0;
+static ULONG idle_cycles = 0;
+
+/* The last loop found idle, its code and its cycles, or 0 */
+static UWORD idle_top;
+static UBYTE idle_code[IDLE_LOOP_SIZE];
+static int idle_loop = 0;
+
+/* Register and flag bits for IdleLoop */
+#define IDLE_A 0x01
+#define IDLE_X 0x02
+#define IDLE_Y 0x04
+#define IDLE_NZ 0x08
+#define IDLE_C 0x10
+#define IDLE_V 0x20
+
+/* Returns the cycles of an iteration of the loop from TOP to the branch
+   ending at END if it is idle, or 0. */
+static int IdleLoopCycles(UWORD top, UWORD end)
+{
+	UBYTE reads[IDLE_LOOP_SIZE];
+	UBYTE writes[IDLE_LOOP_SIZE];
+	int written = 0;	/* by the whole loop */
+	int set = 0;		/* by the loop so far */
+	int n = 0;
+	int i;
+	int loop = 0;
+	UWORD pc = top;
+	while (pc != (UWORD) (end - 2)) {
+		UBYTE const op = MEMORY_dGetByte(pc);
+		int len = 1;
+		int cycles = 2;
+		/* operand: immediate, zero page or absolute */
+		switch (op & 0x1f) {
+		case 0x00:
+		case 0x02:
+		case 0x09:
+			len = 2;
+			break;
+		case 0x04:
+		case 0x05:
+		case 0x06:
+			len = 2;
+			cycles = 3;
+			break;
+		case 0x0c:
+		case 0x0d:
+		case 0x0e:
+#ifdef PAGED_ATTRIB
+			if (MEMORY_readmap[MEMORY_dGetByte(pc + 2)] != NULL)
+#else
+			if (MEMORY_attrib[MEMORY_dGetWord(pc + 1)] == MEMORY_HARDWARE)
+#endif
+				goto busy;	/* hardware */
+			len = 3;
+			cycles = 4;
+			break;
+		default:
+			break;
+		}
+		switch (op) {
+		case 0xa9: case 0xa5: case 0xad:	/* LDA */
+			reads[n] = 0;
+			writes[n] = IDLE_A | IDLE_NZ;
+			break;
+		case 0xa2: case 0xa6: case 0xae:	/* LDX */
+			reads[n] = 0;
+			writes[n] = IDLE_X | IDLE_NZ;
+			break;
+		case 0xa0: case 0xa4: case 0xac:	/* LDY */
+			reads[n] = 0;
+			writes[n] = IDLE_Y | IDLE_NZ;
+			break;
+		case 0xc9: case 0xc5: case 0xcd:	/* CMP */
+			reads[n] = IDLE_A;
+			writes[n] = IDLE_NZ | IDLE_C;
+			break;
+		case 0xe0: case 0xe4: case 0xec:	/* CPX */
+			reads[n] = IDLE_X;
+			writes[n] = IDLE_NZ | IDLE_C;
+			break;
+		case 0xc0: case 0xc4: case 0xcc:	/* CPY */
+			reads[n] = IDLE_Y;
+			writes[n] = IDLE_NZ | IDLE_C;
+			break;
+		case 0x29: case 0x25: case 0x2d:	/* AND */
+		case 0x09: case 0x05: case 0x0d:	/* ORA */
+		case 0x49: case 0x45: case 0x4d:	/* EOR */
+			reads[n] = IDLE_A;
+			writes[n] = IDLE_A | IDLE_NZ;
+			break;
+		case 0x24: case 0x2c:	/* BIT */
+			reads[n] = IDLE_A;
+			writes[n] = IDLE_NZ | IDLE_V;
+			break;
+		case 0xaa:	/* TAX */
+			reads[n] = IDLE_A;
+			writes[n] = IDLE_X | IDLE_NZ;
+			break;
+		case 0xa8:	/* TAY */
+			reads[n] = IDLE_A;
+			writes[n] = IDLE_Y | IDLE_NZ;
+			break;
+		case 0x8a:	/* TXA */
+			reads[n] = IDLE_X;
+			writes[n] = IDLE_A | IDLE_NZ;
+			break;
+		case 0x98:	/* TYA */
+			reads[n] = IDLE_Y;
+			writes[n] = IDLE_A | IDLE_NZ;
+			break;
+		case 0x0a:	/* ASL A */
+		case 0x4a:	/* LSR A */
+			reads[n] = IDLE_A;
+			writes[n] = IDLE_A | IDLE_NZ | IDLE_C;
+			break;
+		case 0xea:	/* NOP */
+			reads[n] = 0;
+			writes[n] = 0;
+			break;
+		case 0x10: case 0x30:	/* BPL, BMI */
+		case 0x50: case 0x70:	/* BVC, BVS */
+		case 0x90: case 0xb0:	/* BCC, BCS */
+		case 0xd0: case 0xf0:	/* BNE, BEQ */
+			{
+				/* not taken in the iteration that got to the end, and
+				   never taken while the flag is the same; leaving the loop */
+				UWORD const target = pc + 2 + (SBYTE) MEMORY_dGetByte(pc + 1);
+				if ((UWORD) (target - top) < (UWORD) (end - top))
+					goto busy;
+				reads[n] = op < 0x40 ? IDLE_NZ : op < 0x80 ? IDLE_V : op < 0xc0 ? IDLE_C : IDLE_NZ;
+				writes[n] = 0;
+				len = 2;
+			}
+			break;
+		default:
+			goto busy;
+		}
+		written |= writes[n++];
+		loop += cycles;
+		pc += len;
+		if ((UWORD) (pc - top) > IDLE_LOOP_SIZE - 2)
+			goto busy;
+	}
+	/* a register the loop changes must be set before it is used, or it may
+	   differ from one iteration to the next */
+	for (i = 0; i < n; i++) {
+		if (reads[i] & written & ~set)
+			goto busy;
+		set |= writes[i];
+	}
+	return loop + (((top ^ end) & 0xff00) ? 4 : 3);
+busy:
+	busy_loops[end & 7].top = top;
+	busy_loops[end & 7].end = end;
+	memcpy(busy_loops[end & 7].code, &MEMORY_dGetByte(top), end - top);
+	return 0;
+}
+
+/* Returns the cycles of the iterations to skip of the loop from TOP to the
+   branch ending at END, taken just now, if it is idle and has just run a
+   whole iteration. */
+static int IdleLoop(UWORD top, UWORD end)
+{
+	int skip;
+	ULONG now;
+	if (busy_loops[end & 7].end == end && busy_loops[end & 7].top == top
+	 && memcmp(&MEMORY_dGetByte(top), busy_loops[end & 7].code, end - top) == 0)
+		return 0;
+	/* a loop that does not store cannot change its code */
+	if (idle_loop == 0 || top != idle_top || end != idle_end
+	 || memcmp(&MEMORY_dGetByte(top), idle_code, end - top) != 0) {
+		idle_loop = IdleLoopCycles(top, end);
+		if (idle_loop == 0)
+			return 0;
+		idle_top = top;
+		idle_end = end;
+		idle_cycles = go_cycles + ANTIC_xpos;
+		memcpy(idle_code, &MEMORY_dGetByte(top), end - top);
+		return 0;
+	}
+	now = go_cycles + ANTIC_xpos;
+	if (now - idle_cycles != idle_loop) {
+		idle_cycles = now;
+		return 0;
+	}
+	/* the branch of the last iteration skipped starts below the limit */
+	skip = (ANTIC_xpos_limit - ANTIC_xpos + (((top ^ end) & 0xff00) ? 4 : 3) - 1) / idle_loop;
+	if (skip < 0)
+		skip = 0;
+	idle_cycles = now + skip * idle_loop;
+	CPU_idle_skipped += skip * idle_loop;
+	return skip * idle_loop;
+}
+
+#define BRANCH_IDLE \
+	if ((UWORD) (GET_PC() - addr - 2) <= IDLE_LOOP_SIZE - 2) \
+		ANTIC_xpos += IdleLoop(addr, GET_PC());
+
+#else /* FAST_WAITS */
+
+#define ABSOLUTE_PutByte(addr, byte) MEMORY_PutByte(addr, byte)
+#define BRANCH_IDLE
+
+#endif /* FAST_WAITS */
+
 /* Triggers a Non-Maskable Interrupt */
 void CPU_NMI(void)
 {
@@ -584,6 +901,10 @@ void CPU_GO(int limit)
 
 	UPDATE_LOCAL_REGS;
 
+#ifdef FAST_WAITS
+	go_cycles -= ANTIC_xpos;
+#endif
+
 	CPUCHECKIRQ;
 
 #ifndef FALCON_CPUASM
@@ -1648,17 +1969,17 @@ void CPU_GO(int limit)
 
 	OPCODE(8c)				/* STY abcd */
 		ABSOLUTE;
-		MEMORY_PutByte(addr, Y);
+		ABSOLUTE_PutByte(addr, Y);
 		DONE
 
 	OPCODE(8d)				/* STA abcd */
 		ABSOLUTE;
-		MEMORY_PutByte(addr, A);
+		ABSOLUTE_PutByte(addr, A);
 		DONE
 
 	OPCODE(8e)				/* STX abcd */
 		ABSOLUTE;
-		MEMORY_PutByte(addr, X);
+		ABSOLUTE_PutByte(addr, X);
 		DONE
 
 	OPCODE(8f)				/* SAX abcd [unofficial - Store result A AND X] */
@@ -1839,6 +2160,10 @@ void CPU_GO(int limit)
 
 	OPCODE(ad)				/* LDA abcd */
 		ABSOLUTE;
+#ifdef FAST_WAITS
+		if ((addr & 0xff0f) == 0xd40b)
+			ANTIC_xpos += VcountWait(GET_PC() - 3);
+#endif
 		LDA(MEMORY_GetByte(addr));
 		DONE
 
@@ -2424,6 +2749,9 @@ void CPU_GO(int limit)
 	}
 
 #endif /* FALCON_CPUASM */
+#ifdef FAST_WAITS
+	go_cycles += ANTIC_xpos;
+#endif
 	UPDATE_GLOBAL_REGS;
 }
 
@@ -2439,6 +2767,11 @@ void CPU_Reset(void)
 	CPU_PutStatus();	/* Make sure flags are all updated */
 	CPU_regS = 0xff;
 	CPU_regPC = MEMORY_dGetWordAligned(0xfffc);
+#ifdef FAST_WAITS
+	/* the memory map may have changed */
+	memset(busy_loops, 0, sizeof(busy_loops));
+	idle_loop = 0;
+#endif
 }
 
 #if !defined(BASIC) && !defined(ASAP)
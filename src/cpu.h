@@ -67,4 +67,9 @@ extern unsigned int CPU_remember_jmp_curpos;
 extern int CPU_instruction_count[256];
 #endif
 
+/* 6502 cycles of VCOUNT busy-waiting and of idle loops CPU_GO skipped
+   rather than ran */
+extern ULONG CPU_vcount_skipped;
+extern ULONG CPU_idle_skipped;
+
 #endif /* CPU_H_ */
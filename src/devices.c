@@ -65,6 +65,7 @@
 
 #include "atari.h"
 #include "binload.h"
+#include "blkcache.h"
 #include "cpu.h"
 #include "devices.h"
 #include "esc.h"
@@ -507,11 +508,16 @@ char Devices_h_current_dir[4][FILENAME_MAX];
 typedef struct FILE_t {
 	int open;
     FIL fil;
+	FSIZE_t pos;	/* read/write position, the file is accessed through BLKCACHE */
 } FILE_t;
 
 /* stream open via H: device per IOCB */
 static FILE_t h_fp[8] = { { FALSE }, { FALSE }, { FALSE }, { FALSE }, { FALSE }, { FALSE }, { FALSE }, { FALSE } };
 
+/* H: writes go straight to the file, so that it is complete when the
+   host side or a binary load looks at it */
+static BLKCACHE_dev_t h_blk = { "H:", TRUE };
+
 /* H: text mode per IOCB */
 static int h_textmode[8];
 
@@ -557,14 +563,46 @@ int Devices_H_CountOpen(void)
 	return r;
 }
 
+static void Devices_H_CloseFile(int iocb)
+{
+	if (h_fp[iocb].open) {
+		BLKCACHE_Release(&h_fp[iocb].fil);
+		f_close(&h_fp[iocb].fil);
+		h_fp[iocb].open = FALSE;
+	}
+}
+
 void Devices_H_CloseAll(void)
 {
 	int i;
 	for (i = 0; i < 8; i++)
-		if (h_fp[i].open) {
-			f_close(&h_fp[i].fil);
-			h_fp[i].open = FALSE;
-		}
+		Devices_H_CloseFile(i);
+}
+
+/* Reads up to LEN bytes of the current IOCB's file and advances it. */
+static UINT Devices_H_ReadBytes(UBYTE *buf, UINT len)
+{
+	FILE_t *f = &h_fp[h_iocb];
+	UINT got;
+	if (!BLKCACHE_Read(&h_blk, &f->fil, f->pos, buf, len, &got))
+		got = 0;
+	f->pos += got;
+	return got;
+}
+
+static int Devices_H_Getc(void)
+{
+	UBYTE ch;
+	return Devices_H_ReadBytes(&ch, 1) == 1 ? ch : EOF;
+}
+
+static void Devices_H_WriteBytes(const UBYTE *buf, UINT len)
+{
+	FILE_t *f = &h_fp[h_iocb];
+	UINT written;
+	if (!BLKCACHE_Write(&h_blk, &f->fil, f->pos, buf, len, &written))
+		written = 0;
+	f->pos += written;
 }
 
 static void Devices_H_Init(void)
@@ -833,10 +871,7 @@ static void Devices_H_Open(void)
 	if (Devices_GetHostPath(TRUE) == 0)
 		return;
 
-	if (h_fp[h_iocb].open) {
-		f_close(&h_fp[h_iocb].fil);
-		h_fp[h_iocb].open = FALSE;
-	}
+	Devices_H_CloseFile(h_iocb);
 #if 0
 	if (devbug)
 		Log_print("atari_filename=\"%s\", atari_path=\"%s\" host_path=\"%s\"", atari_filename, atari_path, host_path);
@@ -849,13 +884,15 @@ static void Devices_H_Open(void)
 	case 4:
 		/* don't bother using "r" for textmode:
 		   we want to support LF, CR/LF and CR, not only native EOLs */
-		if (f_open(&h_fp[h_iocb], host_path, FA_READ) != FR_OK) {
-			h_fp[h_iocb].open = FALSE;
+		if (f_open(&h_fp[h_iocb].fil, host_path, FA_READ) == FR_OK) {
+			h_fp[h_iocb].open = TRUE;
+			h_fp[h_iocb].pos = 0;
+			BLKCACHE_Map(&h_fp[h_iocb].fil);
 			CPU_regY = 1;
 			CPU_ClrN;
 		}
 		else {
-			h_fp[h_iocb].open = TRUE;
+			h_fp[h_iocb].open = FALSE;
 			CPU_regY = 170; /* file not found */
 			CPU_SetN;
 		}
@@ -955,19 +992,21 @@ static void Devices_H_Open(void)
 			break;
 		}
 		{
-			BYTE mode = FA_READ;
-            if (aux1 & 1) mode |= FA_OPEN_APPEND;
-			if (aux1 < 12) mode |= FA_WRITE;
-			if (aux1 >= 12) mode |= FA_OPEN_APPEND;
+			/* "w", "a", "r+", "a+" */
+			static const BYTE modes[4] = {
+				FA_WRITE | FA_CREATE_ALWAYS, FA_WRITE | FA_OPEN_APPEND,
+				FA_READ | FA_WRITE, FA_READ | FA_WRITE | FA_OPEN_APPEND
+			};
+			BYTE mode = modes[((aux1 >> 1) & 2) | (aux1 & 1)];
 			FRESULT fr = f_open(&h_fp[h_iocb].fil, host_path, mode);
+			if (fr != FR_OK && aux1 == 12)
+				/* "w+" */
+				fr = f_open(&h_fp[h_iocb].fil, host_path, mode | FA_CREATE_ALWAYS);
 			h_fp[h_iocb].open = fr == FR_OK;
-			if (fr != FR_OK && aux1 == 12) {
-				mode |= FA_WRITE;
-				fr = f_open(&h_fp[h_iocb].fil, host_path, mode);
-				h_fp[h_iocb].open = fr == FR_OK;
-			}
 		}
 		if (h_fp[h_iocb].open) {
+			/* at the end in the append modes */
+			h_fp[h_iocb].pos = f_tell(&h_fp[h_iocb].fil);
 			CPU_regY = 1;
 			CPU_ClrN;
 		}
@@ -989,14 +1028,173 @@ static void Devices_H_Close(void)
 		Log_print("HHCLOS");
 	if (!Devices_GetIOCB())
 		return;
-	if (h_fp[h_iocb].open) {
-		f_close(&h_fp[h_iocb]);
-		h_fp[h_iocb].open = FALSE;
-	}
+	Devices_H_CloseFile(h_iocb);
 	CPU_regY = 1;
 	CPU_ClrN;
 }
 
+/* Block transfers.  CIO calls the handler once per byte of a GET RECORD,
+   GET CHARACTERS, PUT RECORD or PUT CHARACTERS command and keeps its
+   progress in the zero page IOCB.  When that shows more bytes to go, the
+   handler moves them with one FatFS call and advances ICBALZ and ICBLLZ
+   as CIO would have.  The last byte of the buffer and the EOL of a record
+   are left to CIO, so that the command ends the usual way. */
+
+#define H_BLOCK_SIZE 256
+
+/* Returns how many bytes at *bufadr, following the one the handler was
+   called for, may be moved by a block transfer; 0 if the handler was not
+   called from a CIO block command, -1 if the rest of a GET RECORD does not
+   fit in the buffer and CIO only waits for its EOL. */
+static int Devices_H_BlockLength(int put, UWORD *bufadr)
+{
+	int iocb = Devices_IOCB0 + h_iocb * 16;
+	int com = MEMORY_dGetByte(Devices_ICCOMZ);
+	UWORD addr = MEMORY_dGetWordAligned(Devices_ICBALZ);
+	int len = MEMORY_dGetWordAligned(Devices_ICBLLZ);
+	int n = 0;
+	if (put ? (com != 9 && com != 11) : (com != 5 && com != 7))
+		return 0;
+	/* the zero page IOCB must be CIO's copy of this IOCB, part way through
+	   its buffer - not left over from an earlier call */
+	if (MEMORY_dGetByte(iocb + Devices_ICCOM) != com
+	 || (UWORD) (addr - MEMORY_dGetWordAligned(iocb + Devices_ICBAL)) + len
+	    != MEMORY_dGetWordAligned(iocb + Devices_ICBLL))
+		return 0;
+	if (len == 0)
+		return com == 5 ? -1 : 0;
+	if (put) {
+		/* CIO has fetched the byte at addr already */
+		addr++;
+		len -= 2;
+	}
+	else
+		/* CIO stores the byte returned in A at addr */
+		len -= 1;
+	if (len > 0x10000 - addr)
+		len = 0x10000 - addr;
+	/* only plain RAM (or ROM, to read from) is accessed directly */
+	while (n < len) {
+#ifdef PAGED_ATTRIB
+		if ((put ? (void *) MEMORY_readmap[(addr + n) >> 8] : (void *) MEMORY_writemap[(addr + n) >> 8]) != NULL)
+			break;
+		n += 0x100 - ((addr + n) & 0xff);
+#else
+		if (MEMORY_attrib[addr + n] != MEMORY_RAM && (!put || MEMORY_attrib[addr + n] != MEMORY_ROM))
+			break;
+		n++;
+#endif
+	}
+	*bufadr = addr;
+	return n < len ? n : len;
+}
+
+static void Devices_H_BlockDone(int n)
+{
+	/* MEMORY_dPutWord evaluates the value for each byte */
+	UWORD bufadr = MEMORY_dGetWordAligned(Devices_ICBALZ) + n;
+	UWORD buflen = MEMORY_dGetWordAligned(Devices_ICBLLZ) - n;
+	MEMORY_dPutWordAligned(Devices_ICBALZ, bufadr);
+	MEMORY_dPutWordAligned(Devices_ICBLLZ, buflen);
+}
+
+/* Moves the bytes of a GET command up to the last one, which is left in
+   h_lastbyte for Devices_H_Read to return. */
+static void Devices_H_ReadBlock(void)
+{
+	int textmode = h_textmode[h_iocb];
+	int record = MEMORY_dGetByte(Devices_ICCOMZ) == 5;
+	UWORD bufadr;
+	int n = Devices_H_BlockLength(FALSE, &bufadr);
+	int ch = h_lastbyte[h_iocb];
+	UINT got = 0;
+	int moved = 0;
+	if (n == 0 || ch == EOF)
+		return;
+	if (n > 0)
+		MEMORY_SetDirty(bufadr, n);
+	if (!textmode && !record) {
+		/* straight into Atari memory, the read-ahead byte first */
+		MEMORY_mem[bufadr] = (UBYTE) ch;
+		got = Devices_H_ReadBytes(MEMORY_mem + bufadr + 1, n - 1);
+		if (got == (UINT) n - 1) {
+			moved = n;
+			ch = Devices_H_Getc();
+		}
+		else {
+			moved = got;
+			ch = MEMORY_mem[bufadr + got];
+		}
+	}
+	else {
+		/* In text mode CR, LF and CR/LF become EOL, as in Devices_H_Read.
+		   The EOL ending a record is left for Devices_H_Read to return. */
+		int wascr = h_wascr[h_iocb];
+		UBYTE buf[H_BLOCK_SIZE];
+		UINT pos = 0;
+		while (n < 0 || moved < n) {
+			if (textmode && ch == 0x0a && wascr)
+				wascr = FALSE; /* ignore LF next to CR */
+			else {
+				int out = (textmode && (ch == 0x0d || ch == 0x0a)) ? 0x9b : ch;
+				if (out == 0x9b && record)
+					break;
+				/* n < 0: the record is cut short, CIO drops the rest */
+				if (n > 0)
+					MEMORY_mem[bufadr + moved++] = (UBYTE) out;
+				wascr = ch == 0x0d;
+			}
+			if (pos == got) {
+				pos = 0;
+				if ((got = Devices_H_ReadBytes(buf, sizeof(buf))) == 0) {
+					ch = EOF;
+					break;
+				}
+			}
+			ch = buf[pos++];
+		}
+		/* give back the bytes not used */
+		h_fp[h_iocb].pos -= got - pos;
+		h_wascr[h_iocb] = wascr;
+	}
+	h_lastbyte[h_iocb] = ch;
+	Devices_H_BlockDone(moved);
+}
+
+/* Writes the bytes of a PUT command following the one in A, up to the
+   last one or the EOL of a record. */
+static void Devices_H_WriteBlock(void)
+{
+	UWORD bufadr;
+	int n = Devices_H_BlockLength(TRUE, &bufadr);
+	if (n <= 0)
+		return;
+	if (MEMORY_dGetByte(Devices_ICCOMZ) == 9) {
+		const UBYTE *eol = (const UBYTE *) memchr(MEMORY_mem + bufadr, 0x9b, n);
+		if (CPU_regA == 0x9b)
+			return;
+		if (eol != NULL)
+			n = eol - (MEMORY_mem + bufadr);
+	}
+	if (!h_textmode[h_iocb])
+		Devices_H_WriteBytes(MEMORY_mem + bufadr, n);
+	else {
+		UBYTE buf[H_BLOCK_SIZE];
+		int done;
+		for (done = 0; done < n; ) {
+			int i;
+			int len = n - done < H_BLOCK_SIZE ? n - done : H_BLOCK_SIZE;
+			for (i = 0; i < len; i++) {
+				UBYTE ch = MEMORY_mem[bufadr + done + i];
+				buf[i] = ch == 0x9b ? '\n' : ch;
+			}
+			Devices_H_WriteBytes(buf, len);
+			done += len;
+		}
+	}
+	Devices_H_BlockDone(n);
+}
+
 static void Devices_H_Read(void)
 {
 	if (devbug)
@@ -1008,9 +1206,10 @@ static void Devices_H_Read(void)
 		if (h_lastop[h_iocb] != 'r') {
 		///	if (h_lastop[h_iocb] == 'w')
 		///		fseek(h_fp[h_iocb], 0, SEEK_CUR);
-			h_lastbyte[h_iocb] = _fgetc(&h_fp[h_iocb].fil);
+			h_lastbyte[h_iocb] = Devices_H_Getc();
 			h_lastop[h_iocb] = 'r';
 		}
+		Devices_H_ReadBlock();
 		ch = h_lastbyte[h_iocb];
 		if (ch != EOF) {
 			if (h_textmode[h_iocb]) {
@@ -1022,14 +1221,11 @@ static void Devices_H_Read(void)
 				case 0x0a:
 					if (h_wascr[h_iocb]) {
 						/* ignore LF next to CR */
-						ch = _fgetc(&h_fp[h_iocb].fil);
+						ch = Devices_H_Getc();
 						if (ch != EOF) {
-							if (ch == 0x0d) {
-								h_wascr[h_iocb] = TRUE;
+							h_wascr[h_iocb] = ch == 0x0d;
+							if (ch == 0x0d || ch == 0x0a)
 								ch = 0x9b;
-							}
-							else
-								h_wascr[h_iocb] = FALSE;
 						}
 						else {
 							CPU_regY = 136; /* end of file */
@@ -1048,8 +1244,8 @@ static void Devices_H_Read(void)
 			CPU_regA = (UBYTE) ch;
 			/* [OSMAN] p. 79: Status should be 3 if next read would yield EOF.
 			   But to set the stream's EOF flag, we need to read the next byte. */
-			h_lastbyte[h_iocb] = _fgetc(&h_fp[h_iocb].open);
-			CPU_regY = f_size(&h_fp[h_iocb].fil) == f_tell(&h_fp[h_iocb].fil) ? 3 : 1;
+			h_lastbyte[h_iocb] = Devices_H_Getc();
+			CPU_regY = h_fp[h_iocb].pos >= f_size(&h_fp[h_iocb].fil) ? 3 : 1;
 			CPU_ClrN;
 		}
 		else {
@@ -1073,11 +1269,14 @@ static void Devices_H_Write(void)
 		int ch;
 	///	if (h_lastop[h_iocb] == 'r')
 	///		fseek(h_fp[h_iocb], 0, SEEK_CUR);
+		UBYTE byte;
 		h_lastop[h_iocb] = 'w';
 		ch = CPU_regA;
 		if (ch == 0x9b && h_textmode[h_iocb])
 			ch = '\n';
-		fputc(ch, &h_fp[h_iocb].fil);
+		byte = (UBYTE) ch;
+		Devices_H_WriteBytes(&byte, 1);
+		Devices_H_WriteBlock();
 		CPU_regY = 1;
 		CPU_ClrN;
 	}
@@ -1348,7 +1547,7 @@ static void Devices_H_Note(void)
 	if (!Devices_GetIOCB())
 		return;
 	if (h_fp[h_iocb].open) {
-		long pos = f_tell(&h_fp[h_iocb].fil);
+		long pos = (long) h_fp[h_iocb].pos;
 		if (pos >= 0) {
 			int iocb = Devices_IOCB0 + h_iocb * 16;
 			/* In Devices_H_Read one byte is read ahead. Take it into account. */
@@ -1381,14 +1580,12 @@ static void Devices_H_Point(void)
 		int iocb = Devices_IOCB0 + h_iocb * 16;
 		long pos = (MEMORY_dGetByte(iocb + Devices_ICAX4) << 16) +
 			(MEMORY_dGetByte(iocb + Devices_ICAX3) << 8) + (MEMORY_dGetByte(iocb + Devices_ICAX5));
-		if (f_lseek(&h_fp[h_iocb].fil, pos) == FR_OK) {
-			CPU_regY = 1;
-			CPU_ClrN;
-		}
-		else {
-			CPU_regY = 166; /* invalid POINT request */
-			CPU_SetN;
-		}
+		/* as with f_lseek, only a file open for writing grows */
+		if (!(h_fp[h_iocb].fil.flag & FA_WRITE) && pos > (long) f_size(&h_fp[h_iocb].fil))
+			pos = (long) f_size(&h_fp[h_iocb].fil);
+		h_fp[h_iocb].pos = pos;
+		CPU_regY = 1;
+		CPU_ClrN;
 		h_lastop[h_iocb] = 'p';
 	}
 	else {
@@ -1613,10 +1810,18 @@ static void Devices_H_FileLength(void)
 
 		/* In Devices_H_Read one byte is read ahead. Take it into account. */
 		if (h_lastop[h_iocb] == 'r' && h_lastbyte[h_iocb] != EOF)
-			f_lseek(&h_fp[h_iocb].fil, f_tell(&h_fp[h_iocb].fil) - 1);
-
-		binf = &h_fp[h_iocb];
-		Devices_H_LoadProceed(TRUE);
+			h_fp[h_iocb].pos--;
+
+		/* the segments are read from the file itself */
+		BLKCACHE_Release(&h_fp[h_iocb].fil);
+		binf = &h_fp[h_iocb].fil;
+		if (f_lseek(binf, h_fp[h_iocb].pos) == FR_OK)
+			Devices_H_LoadProceed(TRUE);
+		if (binf == NULL)
+			/* closed at the end of the file */
+			h_fp[h_iocb].open = FALSE;
+		else
+			h_fp[h_iocb].pos = f_tell(binf);
 		binf = &binfile;
 		h_lastop[h_iocb] = 'b';
 	}
@@ -1630,10 +1835,7 @@ static void Devices_H_FileLength(void)
 		fstat(fileno(h_fp[h_iocb]), &fstatus);
 		filesize = fstatus.st_size;
 #else
-		FIL *fp = &h_fp[h_iocb].fil;
-		long currentpos = f_tell(fp);
-		filesize = f_size(fp);
-		f_lseek(fp, currentpos);
+		filesize = f_size(&h_fp[h_iocb].fil);
 #endif
 		MEMORY_dPutByte(iocb + Devices_ICAX3, (UBYTE) filesize);
 		MEMORY_dPutByte(iocb + Devices_ICAX4, (UBYTE) (filesize >> 8));
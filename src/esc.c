@@ -33,6 +33,7 @@
 #include "pia.h"
 #include "sio.h"
 #include "sysrom.h"
+#include "telemetry.h"
 #ifndef BASIC
 ///#include "ui.h"
 #endif
@@ -139,7 +140,9 @@ void ESC_Remove(UBYTE esc_code)
 void ESC_Run(UBYTE esc_code)
 {
 	if (esc_address[esc_code] == CPU_regPC - 2 && esc_function[esc_code] != NULL) {
+		int telemetry_prev = TELEMETRY_Switch(TELEMETRY_SIO);
 		esc_function[esc_code]();
+		TELEMETRY_Switch(telemetry_prev);
 		return;
 	}
 #ifdef CRASH_MENU
@@ -1,39 +1,685 @@
-const double __in_flash() __aligned(8) filter_data[601] = {
-  0.980043363000000, 0.979855473000000, 0.979817895000000, 0.979780181000000, 0.979742331000000, 0.979704344000000, 0.979666222000000, 0.979627963000000, 0.979586552000000, 0.979541989000000, 0.979494274000000, 0.979443407000000, 0.979389388000000, 0.979332085000000, 0.979271501000000, 0.979207633000000 // 0x0
-, 0.979140483000000, 0.979070050000000, 0.978996573000000, 0.978920053000000, 0.978840490000000, 0.978757882000000, 0.978672232000000, 0.978584247000000, 0.978493928000000, 0.978401275000000, 0.978306288000000, 0.978208966000000, 0.978110560000000, 0.978011069000000, 0.977910493000000, 0.977808832000000 // 0x16
-, 0.977706086000000, 0.977604078000000, 0.977502807000000, 0.977402273000000, 0.977302476000000, 0.977203416000000, 0.977107465000000, 0.977014621000000, 0.976924886000000, 0.976838259000000, 0.976754740000000, 0.976677169000000, 0.976605544000000, 0.976539866000000, 0.976480135000000, 0.976426351000000 // 0x32
-, 0.976381665000000, 0.976346076000000, 0.976319584000000, 0.976302190000000, 0.976293893000000, 0.976297931000000, 0.976314304000000, 0.976343013000000, 0.976384056000000, 0.976437434000000, 0.976506185000000, 0.976590310000000, 0.976689807000000, 0.976804677000000, 0.976934921000000, 0.977083053000000 // 0x48
-, 0.977249074000000, 0.977432984000000, 0.977634783000000, 0.977854471000000, 0.978093696000000, 0.978352458000000, 0.978630757000000, 0.978928594000000, 0.979245968000000, 0.979583319000000, 0.979940649000000, 0.980317956000000, 0.980715240000000, 0.981132503000000, 0.981568670000000, 0.982023743000000 // 0x64
-, 0.982497722000000, 0.982990605000000, 0.983502394000000, 0.984030292000000, 0.984574300000000, 0.985134416000000, 0.985710642000000, 0.986302977000000, 0.986906803000000, 0.987522121000000, 0.988148931000000, 0.988787232000000, 0.989437024000000, 0.990091904000000, 0.990751872000000, 0.991416927000000 // 0x80
-, 0.992087069000000, 0.992762298000000, 0.993434620000000, 0.994104033000000, 0.994770537000000, 0.995434133000000, 0.996094821000000, 0.996743412000000, 0.997379909000000, 0.998004309000000, 0.998616614000000, 0.999216823000000, 0.999795095000000, 1.000351430000000, 1.000885828000000, 1.001398290000000 // 0x96
-, 1.001888814000000, 1.002347591000000, 1.002774620000000, 1.003169901000000, 1.003533434000000, 1.003865220000000, 1.004156314000000, 1.004406716000000, 1.004616427000000, 1.004785447000000, 1.004913775000000, 1.004994164000000, 1.005026616000000, 1.005011129000000, 1.004947705000000, 1.004836342000000 // 0x112
-, 1.004672380000000, 1.004455821000000, 1.004186663000000, 1.003864906000000, 1.003490552000000, 1.003062285000000, 1.002580106000000, 1.002044014000000, 1.001454011000000, 1.000810095000000, 1.000114931000000, 0.999368518000000, 0.998570857000000, 0.997721948000000, 0.996821790000000, 0.995877406000000 // 0x128
-, 0.994888796000000, 0.993855960000000, 0.992778898000000, 0.991657610000000, 0.990503577000000, 0.989316800000000, 0.988097278000000, 0.986845011000000, 0.985559999000000, 0.984257928000000, 0.982938796000000, 0.981602605000000, 0.980249355000000, 0.978879044000000, 0.977510945000000, 0.976145056000000 // 0x144
-, 0.974781379000000, 0.973419913000000, 0.972060658000000, 0.970725474000000, 0.969414361000000, 0.968127319000000, 0.966864348000000, 0.965625449000000, 0.964433743000000, 0.963289231000000, 0.962191913000000, 0.961141789000000, 0.960138859000000, 0.959205893000000, 0.958342892000000, 0.957549855000000 // 0x160
-, 0.956826782000000, 0.956173674000000, 0.955611142000000, 0.955139186000000, 0.954757806000000, 0.954467003000000, 0.954266775000000, 0.954173688000000, 0.954187740000000, 0.954308933000000, 0.954537265000000, 0.954872737000000, 0.955326030000000, 0.955897144000000, 0.956586079000000, 0.957392835000000 // 0x176
-, 0.958317412000000, 0.959362954000000, 0.960529460000000, 0.961816930000000, 0.963225366000000, 0.964754765000000, 0.966399410000000, 0.968159301000000, 0.970034436000000, 0.972024818000000, 0.974130444000000, 0.976335858000000, 0.978641060000000, 0.981046049000000, 0.983550826000000, 0.986155391000000 // 0x192
-, 0.988834228000000, 0.991587338000000, 0.994414719000000, 0.997316373000000, 1.000292300000000, 1.003307229000000, 1.006361160000000, 1.009454094000000, 1.012586031000000, 1.015756970000000, 1.018922865000000, 1.022083716000000, 1.025239523000000, 1.028390285000000, 1.031536004000000, 1.034625469000000 // 0x208
-, 1.037658680000000, 1.040635637000000, 1.043556340000000, 1.046420789000000, 1.049172831000000, 1.051812465000000, 1.054339692000000, 1.056754513000000, 1.059056925000000, 1.061188547000000, 1.063149378000000, 1.064939418000000, 1.066558667000000, 1.068007125000000, 1.069227236000000, 1.070219002000000 // 0x224
-, 1.070982420000000, 1.071517492000000, 1.071824218000000, 1.071849114000000, 1.071592179000000, 1.071053415000000, 1.070232821000000, 1.069130398000000, 1.067699951000000, 1.065941482000000, 1.063854990000000, 1.061440476000000, 1.058697939000000, 1.055591479000000, 1.052121096000000, 1.048286791000000 // 0x240
-, 1.044088563000000, 1.039526412000000, 1.034577308000000, 1.029241250000000, 1.023518240000000, 1.017408276000000, 1.010911358000000, 1.004019305000000, 0.996732114000000, 0.989049787000000, 0.980972324000000, 0.972499724000000, 0.963639879000000, 0.954392789000000, 0.944758454000000, 0.934736874000000 // 0x256
-, 0.924328049000000, 0.913556329000000, 0.902421714000000, 0.890924204000000, 0.879063799000000, 0.866840499000000, 0.854294587000000, 0.841426063000000, 0.828234927000000, 0.814721179000000, 0.800884820000000, 0.786780654000000, 0.772408681000000, 0.757768902000000, 0.742861316000000, 0.727685923000000 // 0x272
-, 0.712309805000000, 0.696732961000000, 0.680955392000000, 0.664977097000000, 0.648798076000000, 0.632494731000000, 0.616067061000000, 0.599515068000000, 0.582838750000000, 0.566038108000000, 0.549195364000000, 0.532310519000000, 0.515383572000000, 0.498414523000000, 0.481403372000000, 0.464434324000000 // 0x288
-, 0.447507376000000, 0.430622531000000, 0.413779787000000, 0.396979145000000, 0.380302827000000, 0.363750834000000, 0.347323164000000, 0.331019819000000, 0.314840798000000, 0.298862503000000, 0.283084934000000, 0.267508090000000, 0.252131972000000, 0.236956579000000, 0.222048994000000, 0.207409214000000 // 0x304
-, 0.193037242000000, 0.178933075000000, 0.165096716000000, 0.151582968000000, 0.138391832000000, 0.125523308000000, 0.112977396000000, 0.100754096000000, 0.088893691000000, 0.077396181000000, 0.066261566000000, 0.055489846000000, 0.045081021000000, 0.035059441000000, 0.025425106000000, 0.016178016000000 // 0x320
-, 0.007318171000000, -0.001154429000000, -0.009231892000000, -0.016914219000000, -0.024201409000000, -0.031093463000000, -0.037590381000000, -0.043700345000000, -0.049423355000000, -0.054759413000000, -0.059708517000000, -0.064270668000000, -0.068468896000000, -0.072303201000000, -0.075773584000000, -0.078880044000000 // 0x336
-, -0.081622581000000, -0.084037095000000, -0.086123587000000, -0.087882056000000, -0.089312503000000, -0.090414926000000, -0.091235520000000, -0.091774284000000, -0.092031218000000, -0.092006323000000, -0.091699597000000, -0.091164525000000, -0.090401106000000, -0.089409341000000, -0.088189230000000, -0.086740772000000 // 0x352
-, -0.085121523000000, -0.083331483000000, -0.081370652000000, -0.079239030000000, -0.076936617000000, -0.074521797000000, -0.071994570000000, -0.069354935000000, -0.066602894000000, -0.063738444000000, -0.060817741000000, -0.057840785000000, -0.054807574000000, -0.051718109000000, -0.048572390000000, -0.045421628000000 // 0x368
-, -0.042265821000000, -0.039104970000000, -0.035939075000000, -0.032768136000000, -0.029636199000000, -0.026543265000000, -0.023489334000000, -0.020474405000000, -0.017498478000000, -0.014596824000000, -0.011769442000000, -0.009016333000000, -0.006337496000000, -0.003732931000000, -0.001228154000000, 0.001176835000000 // 0x384
-, 0.003482037000000, 0.005687451000000, 0.007793078000000, 0.009783459000000, 0.011658594000000, 0.013418485000000, 0.015063130000000, 0.016592529000000, 0.018000965000000, 0.019288435000000, 0.020454942000000, 0.021500483000000, 0.022425060000000, 0.023231817000000, 0.023920752000000, 0.024491866000000 // 0x400
-, 0.024945159000000, 0.025280630000000, 0.025508962000000, 0.025630155000000, 0.025644207000000, 0.025551120000000, 0.025350893000000, 0.025060089000000, 0.024678709000000, 0.024206753000000, 0.023644221000000, 0.022991113000000, 0.022268040000000, 0.021475003000000, 0.020612002000000, 0.019679036000000 // 0x416
-, 0.018676106000000, 0.017625982000000, 0.016528664000000, 0.015384152000000, 0.014192447000000, 0.012953547000000, 0.011690576000000, 0.010403534000000, 0.009092421000000, 0.007757237000000, 0.006397982000000, 0.005036516000000, 0.003672839000000, 0.002306950000000, 0.000938851000000, -0.000431460000000 // 0x432
-, -0.001784710000000, -0.003120901000000, -0.004440032000000, -0.005742104000000, -0.007027115000000, -0.008279382000000, -0.009498905000000, -0.010685682000000, -0.011839715000000, -0.012961003000000, -0.014038065000000, -0.015070901000000, -0.016059511000000, -0.017003895000000, -0.017904053000000, -0.018752962000000 // 0x448
-, -0.019550623000000, -0.020297036000000, -0.020992200000000, -0.021636116000000, -0.022226119000000, -0.022762210000000, -0.023244390000000, -0.023672656000000, -0.024047011000000, -0.024368767000000, -0.024637925000000, -0.024854485000000, -0.025018446000000, -0.025129809000000, -0.025193234000000, -0.025208721000000 // 0x464
-, -0.025176269000000, -0.025095880000000, -0.024967552000000, -0.024798532000000, -0.024588821000000, -0.024338419000000, -0.024047325000000, -0.023715539000000, -0.023352006000000, -0.022956724000000, -0.022529696000000, -0.022070919000000, -0.021580394000000, -0.021067933000000, -0.020533535000000, -0.019977200000000 // 0x480
-, -0.019398928000000, -0.018798719000000, -0.018186414000000, -0.017562013000000, -0.016925517000000, -0.016276925000000, -0.015616238000000, -0.014952642000000, -0.014286137000000, -0.013616725000000, -0.012944403000000, -0.012269174000000, -0.011599031000000, -0.010933977000000, -0.010274009000000, -0.009619129000000 // 0x496
-, -0.008969337000000, -0.008331036000000, -0.007704226000000, -0.007088908000000, -0.006485082000000, -0.005892747000000, -0.005316521000000, -0.004756405000000, -0.004212397000000, -0.003684499000000, -0.003172710000000, -0.002679826000000, -0.002205848000000, -0.001750775000000, -0.001314607000000, -0.000897345000000 // 0x512
-, -0.000500060000000, -0.000122753000000, 0.000234576000000, 0.000571927000000, 0.000889301000000, 0.001187138000000, 0.001465437000000, 0.001724199000000, 0.001963424000000, 0.002183112000000, 0.002384911000000, 0.002568821000000, 0.002734842000000, 0.002882975000000, 0.003013218000000, 0.003128088000000 // 0x528
-, 0.003227585000000, 0.003311710000000, 0.003380461000000, 0.003433839000000, 0.003474883000000, 0.003503591000000, 0.003519964000000, 0.003524002000000, 0.003515705000000, 0.003498311000000, 0.003471819000000, 0.003436230000000, 0.003391544000000, 0.003337760000000, 0.003278029000000, 0.003212351000000 // 0x544
-, 0.003140726000000, 0.003063155000000, 0.002979636000000, 0.002893009000000, 0.002803274000000, 0.002710431000000, 0.002614479000000, 0.002515419000000, 0.002415623000000, 0.002315088000000, 0.002213817000000, 0.002111809000000, 0.002009063000000, 0.001907402000000, 0.001806827000000, 0.001707335000000 // 0x560
-, 0.001608929000000, 0.001511607000000, 0.001416620000000, 0.001323967000000, 0.001233648000000, 0.001145663000000, 0.001060013000000, 0.000977406000000, 0.000897842000000, 0.000821322000000, 0.000747845000000, 0.000677412000000, 0.000610262000000, 0.000546394000000, 0.000485810000000, 0.000428508000000 // 0x576
-, 0.000374488000000, 0.000323621000000, 0.000275906000000, 0.000231343000000, 0.000189932000000, 0.000151673000000, 0.000113551000000, 0.000075564000000, 0.000037714000000};
+/* Resampling filters of the MZ POKEY engine, written by write_filter_tables() */
+static const double __in_flash() __aligned(8) filter_8192_0[1201] = {
+  1.044335391560353, 1.050465779169656, 1.051691856691516, 1.052704678636917, 1.053504245005856, 1.054090555798336, 1.054463611014356, 1.054623410653915, 1.054785199688707, 1.054948978118732, 1.055114745943989, 1.055282503164479, 1.055452249780201, 1.055623966364172, 1.055797652916393, 1.055973309436862 // 0x0
+, 1.056150935925579, 1.056330532382546, 1.056512127029827, 1.056695719867423, 1.056881310895333, 1.057068900113558, 1.057258487522097, 1.057450047995004, 1.057643581532277, 1.057839088133918, 1.058036567799925, 1.058236020530300, 1.058437457089926, 1.058640877478802, 1.058846281696929, 1.059053669744306 // 0x16
+, 1.059263041620935, 1.059474369081931, 1.059687652127296, 1.059902890757030, 1.060120084971131, 1.060339234769601, 1.060560337646242, 1.060783393601054, 1.061008402634037, 1.061235364745191, 1.061464279934516, 1.061695107258738, 1.061927846717857, 1.062162498311872, 1.062399062040785, 1.062637537904595 // 0x32
+, 1.062877924777606, 1.063120222659818, 1.063364431551232, 1.063610551451846, 1.063858582361662, 1.064108468731028, 1.064360210559943, 1.064613807848407, 1.064869260596420, 1.065126568803983, 1.065385723149664, 1.065646723633464, 1.065909570255382, 1.066174263015418, 1.066440801913573, 1.066709105997190 // 0x48
+, 1.066979175266271, 1.067251009720814, 1.067524609360820, 1.067799974186289, 1.068077075564258, 1.068355913494728, 1.068636487977697, 1.068918799013167, 1.069202846601137, 1.069488522106440, 1.069775825529075, 1.070064756869042, 1.070355316126343, 1.070647503300976, 1.070941265180892, 1.071236601766093 // 0x64
+, 1.071533513056578, 1.071831999052346, 1.072132059753399, 1.072433556844570, 1.072736490325861, 1.073040860197271, 1.073346666458800, 1.073653909110448, 1.073962506062591, 1.074272457315229, 1.074583762868361, 1.074896422721988, 1.075210436876109, 1.075525639430202, 1.075842030384266, 1.076159609738302 // 0x80
+, 1.076478377492310, 1.076798333646289, 1.077119381744552, 1.077441521787100, 1.077764753773932, 1.078089077705048, 1.078414493580449, 1.078740828921098, 1.079068083726995, 1.079396257998141, 1.079725351734534, 1.080055364936176, 1.080386218830676, 1.080717913418035, 1.081050448698252, 1.081383824671327 // 0x96
+, 1.081718041337261, 1.082052928875768, 1.082388487286848, 1.082724716570500, 1.083061616726726, 1.083399187755524, 1.083737368631881, 1.084076159355797, 1.084415559927271, 1.084755570346303, 1.085096190612894, 1.085437201243769, 1.085778602238930, 1.086120393598375, 1.086462575322104, 1.086805147410119 // 0x112
+, 1.087148018766736, 1.087491189391954, 1.087834659285774, 1.088178428448196, 1.088522496879220, 1.088866506126203, 1.089210456189145, 1.089554347068047, 1.089898178762909, 1.090241951273729, 1.090585523923936, 1.090928896713528, 1.091272069642505, 1.091615042710868, 1.091957815918617, 1.092299987211339 // 0x128
+, 1.092641556589034, 1.092982524051702, 1.093322889599344, 1.093662653231959, 1.094002120589674, 1.094341291672490, 1.094680166480406, 1.095018745013422, 1.095357027271539, 1.095694672578736, 1.096031680935015, 1.096368052340375, 1.096703786794816, 1.097038884298339, 1.097372644200352, 1.097705066500855 // 0x144
+, 1.098036151199848, 1.098365898297332, 1.098694307793306, 1.099021685090186, 1.099348030187972, 1.099673343086664, 1.099997623786262, 1.100320872286765, 1.100642521047291, 1.100962570067838, 1.101281019348408, 1.101597868889000, 1.101913118689614, 1.102226705875379, 1.102538630446294, 1.102848892402360 // 0x160
+, 1.103157491743577, 1.103464428469945, 1.103769313363068, 1.104072146422948, 1.104372927649585, 1.104671657042977, 1.104968334603126, 1.105262808476125, 1.105555078661976, 1.105845145160679, 1.106133007972232, 1.106418667096636, 1.106701771175605, 1.106982320209138, 1.107260314197234, 1.107535753139895 // 0x176
+, 1.107808637037120, 1.108078762515291, 1.108346129574410, 1.108610738214477, 1.108872588435490, 1.109131680237450, 1.109387675847193, 1.109640575264717, 1.109890378490023, 1.110137085523111, 1.110380696363981, 1.110620982918879, 1.110857945187805, 1.111091583170760, 1.111321896867743, 1.111548886278754 // 0x192
+, 1.111772215196553, 1.111991883621138, 1.112207891552511, 1.112420238990670, 1.112628925935616, 1.112833705194411, 1.113034576767055, 1.113231540653547, 1.113424596853887, 1.113613745368077, 1.113798641352902, 1.113979284808364, 1.114155675734462, 1.114327814131196, 1.114495699998567, 1.114659074667640 // 0x208
+, 1.114817938138415, 1.114972290410893, 1.115122131485073, 1.115267461360955, 1.115407935417880, 1.115543553655846, 1.115674316074855, 1.115800222674905, 1.115921273455997, 1.116037212783305, 1.116148040656829, 1.116253757076569, 1.116354362042525, 1.116449855554697, 1.116539901739056, 1.116624500595603 // 0x224
+, 1.116703652124337, 1.116777356325259, 1.116845613198368, 1.116908165090794, 1.116965012002537, 1.117016153933596, 1.117061590883971, 1.117101322853663, 1.117135011365714, 1.117162656420124, 1.117184258016894, 1.117199816156022, 1.117209330837510, 1.117212525826064, 1.117209401121683, 1.117199956724368 // 0x240
+, 1.117184192634118, 1.117162108850934, 1.117133362456808, 1.117097953451739, 1.117055881835729, 1.117007147608776, 1.116951750770880, 1.116889408800216, 1.116820121696783, 1.116743889460582, 1.116660712091612, 1.116570589589873, 1.116473201922954, 1.116368549090855, 1.116256631093576, 1.116137447931116 // 0x256
+, 1.116010999603476, 1.115877027316578, 1.115735531070423, 1.115586510865010, 1.115429966700339, 1.115265898576410, 1.115094014111987, 1.114914313307070, 1.114726796161658, 1.114531462675751, 1.114328312849350, 1.114117101441221, 1.113897828451363, 1.113670493879778, 1.113435097726464, 1.113191639991422 // 0x272
+, 1.112939763279245, 1.112679467589934, 1.112410752923487, 1.112133619279905, 1.111848066659187, 1.111553834719088, 1.111250923459606, 1.110939332880742, 1.110619062982496, 1.110290113764868, 1.109952164889488, 1.109605216356358, 1.109249268165477, 1.108884320316845, 1.108510372810463, 1.108127345521070 // 0x288
+, 1.107735238448667, 1.107334051593253, 1.106923784954829, 1.106504438533394, 1.106075556991397, 1.105637140328837, 1.105189188545715, 1.104731701642031, 1.104264679617784, 1.103787965166638, 1.103301558288594, 1.102805458983652, 1.102299667251811, 1.101784183093072, 1.101258776493661, 1.100723447453578 // 0x304
+, 1.100178195972824, 1.099623022051397, 1.099057925689299, 1.098482644535500, 1.097897178590000, 1.097301527852799, 1.096695692323898, 1.096079672003295, 1.095453270176591, 1.094816486843786, 1.094169322004879, 1.093511775659870, 1.092843847808760, 1.092165316643346, 1.091476182163631, 1.090776444369612 // 0x320
+, 1.090066103261290, 1.089345158838666, 1.088613427140859, 1.087870908167871, 1.087117601919700, 1.086353508396348, 1.085578627597813, 1.084792765443308, 1.083995921932833, 1.083188097066388, 1.082369290843972, 1.081539503265586, 1.080698559646690, 1.079846459987285, 1.078983204287369, 1.078108792546945 // 0x336
+, 1.077223224766010, 1.076326341947458, 1.075418144091290, 1.074498631197504, 1.073567803266102, 1.072625660297083, 1.071672052505619, 1.070706979891709, 1.069730442455354, 1.068742440196553, 1.067742973115306, 1.066731921361972, 1.065709284936549, 1.064675063839039, 1.063629258069440, 1.062571867627754 // 0x352
+, 1.061502769274250, 1.060421963008929, 1.059329448831791, 1.058225226742836, 1.057109296742063, 1.055981565433482, 1.054842032817093, 1.053690698892896, 1.052527563660890, 1.051352627121076, 1.050165789011264, 1.048967049331453, 1.047756408081644, 1.046533865261836, 1.045299420872030, 1.044053005631596 // 0x368
+, 1.042794619540536, 1.041524262598849, 1.040241934806535, 1.038947636163595, 1.037641302198308, 1.036322932910677, 1.034992528300700, 1.033650088368377, 1.032295613113709, 1.030929070074095, 1.029550459249537, 1.028159780640033, 1.026757034245584, 1.025342220066190, 1.023915318749324, 1.022476330294985 // 0x384
+, 1.021025254703174, 1.019562091973891, 1.018086842107135, 1.016599508434024, 1.015100090954557, 1.013588589668734, 1.012065004576555, 1.010529335678020, 1.008981593763989, 1.007421778834462, 1.005849890889439, 1.004265929928920, 1.002669895952905, 1.001061817728554, 0.999441695255867, 0.997809528534844 // 0x400
+, 0.996165317565485, 0.994509062347791, 0.992840793267758, 0.991160510325387, 0.989468213520677, 0.987763902853629, 0.986047578324243, 0.984319312255806, 0.982579104648320, 0.980826955501783, 0.979062864816196, 0.977286832591558, 0.975498924247285, 0.973699139783377, 0.971887479199833, 0.970063942496653 // 0x416
+, 0.968228529673837, 0.966381392005529, 0.964522529491729, 0.962651942132435, 0.960769629927649, 0.958875592877371, 0.956969914323999, 0.955052594267535, 0.953123632707979, 0.951183029645330, 0.949230785079588, 0.947267043099541, 0.945291803705187, 0.943305066896528, 0.941306832673563, 0.939297101036293 // 0x432
+, 0.937275997470216, 0.935243521975335, 0.933199674551647, 0.931144455199154, 0.929077863917856, 0.927000108904398, 0.924911190158779, 0.922811107681001, 0.920699861471064, 0.918577451528966, 0.916444072898162, 0.914299725578651, 0.912144409570434, 0.909978124873511, 0.907800871487881, 0.905612796218227 // 0x448
+, 0.903413899064549, 0.901204180026847, 0.898983639105120, 0.896752276299370, 0.894510383270585, 0.892257960018766, 0.889995006543913, 0.887721522846025, 0.885437508925103, 0.883143164489602, 0.880838489539522, 0.878523484074863, 0.876198148095625, 0.873862481601809, 0.871516748902944, 0.869160949999031 // 0x464
+, 0.866795084890069, 0.864419153576060, 0.862033156057002, 0.859637362041019, 0.857231771528111, 0.854816384518279, 0.852391201011521, 0.849956221007839, 0.847511733389533, 0.845057738156605, 0.842594235309055, 0.840121224846881, 0.837638706770085, 0.835146996196435, 0.832646093125931, 0.830135997558572 // 0x480
+, 0.827616709494361, 0.825088228933295, 0.822550863778358, 0.820004614029550, 0.817449479686871, 0.814885460750322, 0.812312557219901, 0.809731109205849, 0.807141116708167, 0.804542579726853, 0.801935498261909, 0.799319872313333, 0.796696034464210, 0.794063984714540, 0.791423723064322, 0.788775249513557 // 0x496
+, 0.786118564062245, 0.783454035163064, 0.780781662816015, 0.778101447021097, 0.775413387778310, 0.772717485087655, 0.770014107599657, 0.767303255314315, 0.764584928231631, 0.761859126351603, 0.759125849674232, 0.756385494880846, 0.753638061971444, 0.750883550946026, 0.748121961804593, 0.745353294547144 // 0x512
+, 0.742577945999633, 0.739795916162060, 0.737007205034425, 0.734211812616727, 0.731409738908968, 0.728601397095064, 0.725786787175016, 0.722965909148824, 0.720138763016489, 0.717305348778009, 0.714466078916263, 0.711620953431251, 0.708769972322974, 0.705913135591430, 0.703050443236621, 0.700182325990649 // 0x528
+, 0.697308783853516, 0.694429816825221, 0.691545424905764, 0.688655608095144, 0.685760797336574, 0.682860992630053, 0.679956193975582, 0.677046401373159, 0.674131614822786, 0.671212294534161, 0.668288440507284, 0.665360052742154, 0.662427131238773, 0.659489675997140, 0.656548135363544, 0.653602509337984 // 0x544
+, 0.650652797920461, 0.647699001110975, 0.644741118909526, 0.641779635141197, 0.638814549805988, 0.635845862903900, 0.632873574434933, 0.629897684399085, 0.626918640313955, 0.623936442179542, 0.620951089995846, 0.617962583762867, 0.614970923480604, 0.611976601306723, 0.608979617241222, 0.605979971284102 // 0x560
+, 0.602977663435363, 0.599972693695004, 0.596965508781071, 0.593956108693562, 0.590944493432479, 0.587930662997822, 0.584914617389589, 0.581896866577129, 0.578877410560442, 0.575856249339527, 0.572833382914384, 0.569808811285015, 0.566783032035061, 0.563756045164522, 0.560727850673399, 0.557698448561692 // 0x576
+, 0.554667838829401, 0.551636478051558, 0.548604366228166, 0.545571503359222, 0.542537889444728, 0.539503524484683, 0.536468923219141, 0.533434085648100, 0.530399011771561, 0.527363701589525, 0.524328155101990, 0.521292844919954, 0.518257771043415, 0.515222933472375, 0.512188332206832, 0.509153967246787 // 0x592
+, 0.506120353332293, 0.503087490463350, 0.500055378639957, 0.497024017862115, 0.493993408129823, 0.490964006018116, 0.487935811526993, 0.484908824656455, 0.481883045406501, 0.478858473777131, 0.475835607351989, 0.472814446131074, 0.469794990114386, 0.466777239301926, 0.463761193693694, 0.460747363259036 // 0x608
+, 0.457735747997953, 0.454726347910445, 0.451719162996511, 0.448714193256153, 0.445711885407414, 0.442712239450293, 0.439715255384793, 0.436720933210911, 0.433729272928649, 0.430740766695669, 0.427755414511973, 0.424773216377560, 0.421794172292430, 0.418818282256583, 0.415845993787615, 0.412877306885527 // 0x624
+, 0.409912221550318, 0.406950737781989, 0.403992855580540, 0.401039058771054, 0.398089347353531, 0.395143721327971, 0.392202180694375, 0.389264725452742, 0.386331803949361, 0.383403416184232, 0.380479562157355, 0.377560241868729, 0.374645455318356, 0.371735662715934, 0.368830864061462, 0.365931059354941 // 0x640
+, 0.363036248596371, 0.360146431785752, 0.357262039866294, 0.354383072837999, 0.351509530700866, 0.348641413454894, 0.345778721100085, 0.342921884368542, 0.340070903260264, 0.337225777775252, 0.334386507913506, 0.331553093675027, 0.328725947542691, 0.325905069516499, 0.323090459596451, 0.320282117782548 // 0x656
+, 0.317480044074788, 0.314684651657090, 0.311895940529455, 0.309113910691882, 0.306338562144371, 0.303569894886922, 0.300808305745489, 0.298053794720071, 0.295306361810669, 0.292566007017283, 0.289832730339912, 0.287106928459884, 0.284388601377200, 0.281677749091858, 0.278974371603860, 0.276278468913205 // 0x672
+, 0.273590409670418, 0.270910193875500, 0.268237821528451, 0.265573292629270, 0.262916607177958, 0.260268133627193, 0.257627871976976, 0.254995822227305, 0.252371984378182, 0.249756358429607, 0.247149276964662, 0.244550739983348, 0.241960747485666, 0.239379299471614, 0.236806395941194, 0.234242377004644 // 0x688
+, 0.231687242661965, 0.229140992913158, 0.226603627758221, 0.224075147197155, 0.221555859132943, 0.219045763565585, 0.216544860495081, 0.214053149921430, 0.211570631844634, 0.209097621382461, 0.206634118534910, 0.204180123301982, 0.201735635683677, 0.199300655679994, 0.196875472173236, 0.194460085163404 // 0x704
+, 0.192054494650496, 0.189658700634513, 0.187272703115455, 0.184896771801446, 0.182530906692485, 0.180175107788571, 0.177829375089706, 0.175493708595890, 0.173168372616652, 0.170853367151993, 0.168548692201913, 0.166254347766412, 0.163970333845490, 0.161696850147603, 0.159433896672749, 0.157181473420930 // 0x720
+, 0.154939580392145, 0.152708217586395, 0.150487676664668, 0.148277957626966, 0.146079060473288, 0.143890985203634, 0.141713731818004, 0.139547447121081, 0.137392131112864, 0.135247783793353, 0.133114405162549, 0.130991995220451, 0.128880749010514, 0.126780666532736, 0.124691747787118, 0.122613992773659 // 0x736
+, 0.120547401492361, 0.118492182139868, 0.116448334716181, 0.114415859221299, 0.112394755655223, 0.110385024017952, 0.108386789794987, 0.106400052986328, 0.104424813591975, 0.102461071611927, 0.100508827046185, 0.098568223983536, 0.096639262423980, 0.094721942367516, 0.092816263814145, 0.090922226763866 // 0x752
+, 0.089039914559080, 0.087169327199787, 0.085310464685986, 0.083463327017678, 0.081627914194862, 0.079804377491683, 0.077992716908138, 0.076192932444230, 0.074405024099957, 0.072628991875319, 0.070864901189732, 0.069112752043195, 0.067372544435709, 0.065644278367272, 0.063927953837886, 0.062223643170838 // 0x768
+, 0.060531346366129, 0.058851063423757, 0.057182794343724, 0.055526539126030, 0.053882328156671, 0.052250161435649, 0.050630038962962, 0.049021960738611, 0.047425926762596, 0.045841965802077, 0.044270077857054, 0.042710262927527, 0.041162521013495, 0.039626852114960, 0.038103267022781, 0.036591765736958 // 0x784
+, 0.035092348257491, 0.033605014584380, 0.032129764717624, 0.030666601988341, 0.029215526396530, 0.027776537942192, 0.026349636625325, 0.024934822445931, 0.023532076051482, 0.022141397441978, 0.020762786617420, 0.019396243577807, 0.018041768323139, 0.016699328390816, 0.015368923780839, 0.014050554493207 // 0x800
+, 0.012744220527921, 0.011449921884980, 0.010167594092666, 0.008897237150979, 0.007638851059919, 0.006392435819486, 0.005157991429679, 0.003935448609872, 0.002724807360062, 0.001526067680251, 0.000339229570439, -0.000835706969375, -0.001998842201381, -0.003150176125578, -0.004289708741967, -0.005417440050548 // 0x816
+, -0.006533370051321, -0.007637592140276, -0.008730106317414, -0.009810912582735, -0.010880010936239, -0.011937401377925, -0.012983207147524, -0.014017428245034, -0.015040064670457, -0.016051116423791, -0.017050583505037, -0.018038585763838, -0.019015123200194, -0.019980195814104, -0.020933803605568, -0.021875946574587 // 0x832
+, -0.022806774505989, -0.023726287399774, -0.024634485255943, -0.025531368074494, -0.026416935855429, -0.027291347595854, -0.028154603295769, -0.029006702955174, -0.029847646574070, -0.030677434152456, -0.031496240374872, -0.032304065241317, -0.033100908751792, -0.033886770906297, -0.034661651704832, -0.035425745228184 // 0x848
+, -0.036179051476355, -0.036921570449343, -0.037653302147150, -0.038374246569774, -0.039084587678096, -0.039784325472115, -0.040473459951831, -0.041151991117244, -0.041819918968354, -0.042477465313363, -0.043124630152270, -0.043761413485076, -0.044387815311779, -0.045003835632382, -0.045609671161283, -0.046205321898484 // 0x864
+, -0.046790787843984, -0.047366068997783, -0.047931165359881, -0.048486339281308, -0.049031590762062, -0.049566919802145, -0.050092326401556, -0.050607810560295, -0.051113602292136, -0.051609701597078, -0.052096108475122, -0.052572822926268, -0.053039844950515, -0.053497331854199, -0.053945283637321, -0.054383700299881 // 0x880
+, -0.054812581841878, -0.055231928263313, -0.055642194901737, -0.056043381757151, -0.056435488829554, -0.056818516118947, -0.057192463625329, -0.057557411473961, -0.057913359664842, -0.058260308197972, -0.058598257073352, -0.058927206290980, -0.059247476189227, -0.059559066768091, -0.059861978027572, -0.060156209967672 // 0x896
+, -0.060441762588389, -0.060718896231971, -0.060987610898418, -0.061247906587730, -0.061499783299907, -0.061743241034948, -0.061978637188262, -0.062205971759848, -0.062425244749705, -0.062636456157834, -0.062839605984235, -0.063034939470142, -0.063222456615554, -0.063402157420471, -0.063574041884894, -0.063738110008823 // 0x912
+, -0.063894654173494, -0.064043674378907, -0.064185170625062, -0.064319142911960, -0.064445591239600, -0.064564774402060, -0.064676692399339, -0.064781345231438, -0.064878732898357, -0.064968855400096, -0.065052032769066, -0.065128265005267, -0.065197552108700, -0.065259894079364, -0.065315290917259, -0.065364025144212 // 0x928
+, -0.065406096760223, -0.065441505765292, -0.065470252159418, -0.065492335942602, -0.065508100032852, -0.065517544430167, -0.065520669134548, -0.065517474145994, -0.065507959464506, -0.065492401325377, -0.065470799728608, -0.065443154674197, -0.065409466162146, -0.065369734192455, -0.065324297242079, -0.065273155311021 // 0x944
+, -0.065216308399278, -0.065153756506852, -0.065085499633743, -0.065011795432821, -0.064932643904086, -0.064848045047540, -0.064757998863180, -0.064662505351009, -0.064561900385053, -0.064456183965313, -0.064345356091789, -0.064229416764481, -0.064108365983389, -0.063982459383338, -0.063851696964330, -0.063716078726364 // 0x960
+, -0.063575604669439, -0.063430274793557, -0.063280433719377, -0.063126081446899, -0.062967217976124, -0.062803843307051, -0.062635957439680, -0.062463819042946, -0.062287428116848, -0.062106784661386, -0.061921888676561, -0.061732740162372, -0.061539683962031, -0.061342720075539, -0.061141848502895, -0.060937069244100 // 0x976
+, -0.060728382299154, -0.060516034860995, -0.060300026929622, -0.060080358505037, -0.059857029587239, -0.059630040176227, -0.059399726479244, -0.059166088496290, -0.058929126227363, -0.058688839672465, -0.058445228831595, -0.058198521798507, -0.057948718573201, -0.057695819155677, -0.057439823545934, -0.057180731743974 // 0x992
+, -0.056918881522961, -0.056654272882895, -0.056386905823776, -0.056116780345604, -0.055843896448379, -0.055568457505719, -0.055290463517622, -0.055009914484089, -0.054726810405121, -0.054441151280716, -0.054153288469163, -0.053863221970461, -0.053570951784610, -0.053276477911610, -0.052979800351461, -0.052681070958069 // 0x1008
+, -0.052380289731433, -0.052077456671553, -0.051772571778429, -0.051465635052061, -0.051157035710845, -0.050846773754778, -0.050534849183863, -0.050221261998098, -0.049906012197484, -0.049589162656892, -0.049270713376323, -0.048950664355775, -0.048629015595249, -0.048305767094746, -0.047981486395149, -0.047656173496457 // 0x1024
+, -0.047329828398671, -0.047002451101791, -0.046674041605816, -0.046344294508332, -0.046013209809339, -0.045680787508836, -0.045347027606823, -0.045011930103301, -0.044676195648860, -0.044339824243500, -0.044002815887221, -0.043665170580023, -0.043326888321906, -0.042988309788890, -0.042649434980974, -0.042310263898158 // 0x1040
+, -0.041970796540443, -0.041631032907828, -0.041290667360186, -0.040949699897518, -0.040608130519823, -0.040265959227101, -0.039923186019353, -0.039580212950990, -0.039237040022012, -0.038893667232420, -0.038550094582214, -0.038206322071393, -0.037862490376531, -0.037518599497629, -0.037174649434687, -0.036830640187704 // 0x1056
+, -0.036486571756680, -0.036142802594258, -0.035799332700438, -0.035456162075220, -0.035113290718603, -0.034770718630588, -0.034428536906858, -0.034086745547413, -0.033745344552253, -0.033404333921378, -0.033063713654787, -0.032723703235755, -0.032384302664281, -0.032045511940365, -0.031707331064009, -0.031369760035210 // 0x1072
+, -0.031032859878984, -0.030696630595332, -0.030361072184252, -0.030026184645745, -0.029691967979811, -0.029358592006736, -0.029026056726519, -0.028694362139160, -0.028363508244660, -0.028033495043018, -0.027704401306625, -0.027376227035479, -0.027048972229582, -0.026722636888933, -0.026397221013532, -0.026072897082416 // 0x1088
+, -0.025749665095584, -0.025427525053036, -0.025106476954772, -0.024786520800793, -0.024467753046786, -0.024150173692750, -0.023833782738686, -0.023518580184593, -0.023204566030472, -0.022891906176845, -0.022580600623713, -0.022270649371075, -0.021962052418932, -0.021654809767284, -0.021349003505755, -0.021044633634345 // 0x1104
+, -0.020741700153054, -0.020440203061882, -0.020140142360830, -0.019841656365062, -0.019544745074577, -0.019249408489376, -0.018955646609460, -0.018663459434827, -0.018372900177526, -0.018083968837558, -0.017796665414923, -0.017510989909621, -0.017226942321651, -0.016944631286181, -0.016664056803211, -0.016385218872742 // 0x1120
+, -0.016108117494773, -0.015832752669304, -0.015559153029298, -0.015287318574755, -0.015017249305674, -0.014748945222057, -0.014482406323902, -0.014217713563865, -0.013954866941948, -0.013693866458148, -0.013434712112467, -0.013177403904904, -0.012921951156890, -0.012668353868426, -0.012416612039511, -0.012166725670146 // 0x1136
+, -0.011918694760330, -0.011672574859715, -0.011428365968302, -0.011186068086090, -0.010945681213079, -0.010707205349269, -0.010470641620356, -0.010235990026340, -0.010003250567222, -0.009772423243000, -0.009543508053675, -0.009316545942521, -0.009091536909538, -0.008868480954726, -0.008647378078085, -0.008428228279615 // 0x1152
+, -0.008211034065514, -0.007995795435780, -0.007782512390415, -0.007571184929418, -0.007361813052790, -0.007154425005413, -0.006949020787286, -0.006745600398409, -0.006544163838784, -0.006344711108409, -0.006147231442402, -0.005951724840761, -0.005758191303488, -0.005566630830581, -0.005377043422042, -0.005189454203817 // 0x1168
+, -0.005003863175907, -0.004820270338311, -0.004638675691030, -0.004459079234063, -0.004281452745345, -0.004105796224876, -0.003932109672656, -0.003760393088685, -0.003590646472963, -0.003422889252473, -0.003257121427215, -0.003093342997191, -0.002931553962399, -0.002771754322840, -0.002398699106820, -0.001812388314340 // 0x1184
+, -0.001012821945400
+};
+static const double __in_flash() __aligned(8) filter_11025_0[1201] = {
+  0.926801083258863, 0.920320106881487, 0.919023911606012, 0.917956386000100, 0.917117530063751, 0.916507343796964, 0.916125827199741, 0.915972980272080, 0.915818592528730, 0.915662663969689, 0.915505194594958, 0.915346184404537, 0.915185633398427, 0.915023619390844, 0.914860142381790, 0.914695202371263 // 0x0
+, 0.914528799359265, 0.914360933345796, 0.914191786339166, 0.914021358339377, 0.913849649346428, 0.913676659360320, 0.913502388381052, 0.913326942463974, 0.913150321609087, 0.912972525816390, 0.912793555085883, 0.912613409417566, 0.912432314216962, 0.912250269484069, 0.912067275218887, 0.911883331421417 // 0x16
+, 0.911698438091659, 0.911512743993981, 0.911326249128382, 0.911138953494863, 0.910950857093424, 0.910761959924064, 0.910572519136820, 0.910382534731691, 0.910192006708678, 0.910000935067780, 0.909809319808997, 0.909617354717782, 0.909425039794135, 0.909232375038056, 0.909039360449544, 0.908845996028601 // 0x32
+, 0.908652570265724, 0.908459083160915, 0.908265534714173, 0.908071924925498, 0.907878253794891, 0.907684740163259, 0.907491384030604, 0.907298185396925, 0.907105144262222, 0.906912260626495, 0.906719855522253, 0.906527928949495, 0.906336480908223, 0.906145511398436, 0.905955020420133, 0.905765243311547 // 0x48
+, 0.905576180072676, 0.905387830703522, 0.905200195204084, 0.905013273574363, 0.904827411134311, 0.904642607883930, 0.904458863823220, 0.904276178952180, 0.904094553270810, 0.903914235171901, 0.903735224655454, 0.903557521721467, 0.903381126369942, 0.903206038600877, 0.903032619954419, 0.902860870430569 // 0x64
+, 0.902690790029325, 0.902522378750688, 0.902355636594659, 0.902190824337457, 0.902027941979082, 0.901866989519535, 0.901707966958816, 0.901550874296925, 0.901396094947008, 0.901243628909067, 0.901093476183100, 0.900945636769108, 0.900800110667091, 0.900657172688810, 0.900516822834264, 0.900379061103453 // 0x80
+, 0.900243887496378, 0.900111302013039, 0.899981721910274, 0.899855147188082, 0.899731577846465, 0.899611013885423, 0.899493455304954, 0.899379189857653, 0.899268217543520, 0.899160538362556, 0.899056152314759, 0.898955059400130, 0.898857702327097, 0.898764081095659, 0.898674195705817, 0.898588046157569 // 0x96
+, 0.898505632450918, 0.898427234241235, 0.898352851528521, 0.898282484312776, 0.898216132594000, 0.898153796372192, 0.898095900031343, 0.898042443571450, 0.897993426992515, 0.897948850294538, 0.897908713477518, 0.897873240777846, 0.897842432195521, 0.897816287730544, 0.897794807382914, 0.897777991152632 // 0x112
+, 0.897766215453672, 0.897759480286036, 0.897757785649723, 0.897761131544733, 0.897769517971066, 0.897783072834048, 0.897801796133678, 0.897825687869958, 0.897854748042886, 0.897888976652464, 0.897928813555990, 0.897974258753465, 0.898025312244889, 0.898081974030261, 0.898144244109582, 0.898212282137625 // 0x128
+, 0.898286088114390, 0.898365662039877, 0.898451003914086, 0.898542113737017, 0.898639842352366, 0.898744189760136, 0.898855155960324, 0.898972740952931, 0.899096944737958, 0.899227420650352, 0.899364168690114, 0.899507188857243, 0.899656481151740, 0.899812045573604, 0.899974059655113, 0.900142523396266 // 0x144
+, 0.900317436797064, 0.900498799857507, 0.900686612577595, 0.900881507709941, 0.901083485254547, 0.901292545211412, 0.901508687580536, 0.901731912361920, 0.901962043451067, 0.902199080847977, 0.902443024552651, 0.902693874565089, 0.902951630885290, 0.903216649993202, 0.903488931888825, 0.903768476572159 // 0x160
+, 0.904055284043204, 0.904349354301960, 0.904650661745377, 0.904959206373454, 0.905274988186192, 0.905598007183591, 0.905928263365650, 0.906265946472793, 0.906611056505019, 0.906963593462329, 0.907323557344723, 0.907690948152199, 0.908065733271941, 0.908447912703946, 0.908837486448217, 0.909234454504751 // 0x176
+, 0.909638816873550, 0.910050653241111, 0.910469963607433, 0.910896747972518, 0.911331006336363, 0.911772738698971, 0.912221862484796, 0.912678377693837, 0.913142284326096, 0.913613582381572, 0.914092271860265, 0.914578343121178, 0.915071796164312, 0.915572630989666, 0.916080847597240, 0.916596445987034 // 0x192
+, 0.917119270685293, 0.917649321692017, 0.918186599007205, 0.918731102630859, 0.919282832562976, 0.919841681022595, 0.920407648009715, 0.920980733524337, 0.921560937566459, 0.922148260136082, 0.922742462905356, 0.923343545874282, 0.923951509042860, 0.924566352411089, 0.925188075978969, 0.925816467998817 // 0x208
+, 0.926451528470633, 0.927093257394415, 0.927741654770166, 0.928396720597883, 0.929058133899888, 0.929725894676178, 0.930400002926755, 0.931080458651619, 0.931767261850769, 0.932460105488812, 0.933158989565750, 0.933863914081581, 0.934574879036305, 0.935291884429924, 0.936014527878522, 0.936742809382101 // 0x224
+, 0.937476728940661, 0.938216286554200, 0.938961482222720, 0.939711921978904, 0.940467605822753, 0.941228533754265, 0.941994705773442, 0.942766121880282, 0.943542293649045, 0.944323221079729, 0.945108904172335, 0.945899342926862, 0.946694537343312, 0.947493995032380, 0.948297715994067, 0.949105700228373 // 0x240
+, 0.949917947735298, 0.950734458514843, 0.951554648981268, 0.952378519134574, 0.953206068974761, 0.954037298501829, 0.954872207715778, 0.955710188072863, 0.956551239573083, 0.957395362216439, 0.958242556002930, 0.959092820932556, 0.959945483981674, 0.960800545150284, 0.961658004438385, 0.962517861845978 // 0x256
+, 0.963380117373063, 0.964244068204984, 0.965109714341741, 0.965977055783335, 0.966846092529765, 0.967716824581031, 0.968588513213534, 0.969461158427272, 0.970334760222246, 0.971209318598455, 0.972084833555900, 0.972960571210490, 0.973836531562223, 0.974712714611101, 0.975589120357123, 0.976465748800289 // 0x272
+, 0.977341775370034, 0.978217200066357, 0.979092022889259, 0.979966243838740, 0.980839862914799, 0.981712037529476, 0.982582767682770, 0.983452053374681, 0.984319894605210, 0.985186291374356, 0.986050277461357, 0.986911852866213, 0.987771017588925, 0.988627771629493, 0.989482114987916, 0.990333147876527 // 0x288
+, 0.991180870295326, 0.992025282244314, 0.992866383723490, 0.993704174732855, 0.994537851606554, 0.995367414344587, 0.996192862946954, 0.997014197413656, 0.997831417744692, 0.998643362028287, 0.999450030264442, 1.000251422453156, 1.001047538594430, 1.001838378688263, 1.002623060251754, 1.003401583284902 // 0x304
+, 1.004173947787709, 1.004940153760173, 1.005700201202295, 1.006453040248922, 1.007198670900054, 1.007937093155691, 1.008668307015834, 1.009392312480480, 1.010108080873475, 1.010815612194817, 1.011514906444507, 1.012205963622544, 1.012888783728928, 1.013562329059547, 1.014226599614401, 1.014881595393489 // 0x320
+, 1.015527316396811, 1.016163762624367, 1.016789879277234, 1.017405666355411, 1.018011123858898, 1.018606251787694, 1.019191050141801, 1.019764473413660, 1.020326521603269, 1.020877194710630, 1.021416492735742, 1.021944415678605, 1.022459907715972, 1.022962968847844, 1.023453599074219, 1.023931798395099 // 0x336
+, 1.024397566810483, 1.024849852438771, 1.025288655279964, 1.025713975334062, 1.026125812601064, 1.026524167080971, 1.026907990995594, 1.027277284344934, 1.027632047128989, 1.027972279347761, 1.028297981001249, 1.028608118444905, 1.028902691678731, 1.029181700702725, 1.029445145516887, 1.029693026121219 // 0x352
+, 1.029924319983881, 1.030139027104873, 1.030337147484197, 1.030518681121851, 1.030683628017836, 1.030830997823898, 1.030960790540037, 1.031073006166254, 1.031167644702548, 1.031244706148920, 1.031303215905147, 1.031343173971229, 1.031364580347167, 1.031367435032959, 1.031351738028607, 1.031316556678214 // 0x368
+, 1.031261890981780, 1.031187740939305, 1.031094106550789, 1.030980987816232, 1.030847475423295, 1.030693569371978, 1.030519269662280, 1.030324576294202, 1.030109489267743, 1.029873142983602, 1.029615537441777, 1.029336672642270, 1.029036548585080, 1.028715165270207, 1.028371686048173, 1.028006110918978 // 0x384
+, 1.027618439882621, 1.027208672939103, 1.026776810088424, 1.026322070677220, 1.025844454705490, 1.025343962173235, 1.024820593080454, 1.024274347427148, 1.023704475033882, 1.023110975900654, 1.022493850027466, 1.021853097414317, 1.021188718061207, 1.020500045138949, 1.019787078647541, 1.019049818586985 // 0x400
+, 1.018288264957279, 1.017502417758424, 1.016691642241830, 1.015855938407495, 1.014995306255420, 1.014109745785605, 1.013199256998049, 1.012263294185063, 1.011301857346644, 1.010314946482794, 1.009302561593512, 1.008264702678798, 1.007200870925105, 1.006111066332433, 1.004995288900782, 1.003853538630151 // 0x416
+, 1.002685815520542, 1.001491659290568, 1.000271069940231, 0.999024047469529, 0.997750591878464, 0.996450703167035, 0.995124021900238, 0.993770548078073, 0.992390281700539, 0.990983222767638, 0.989549371279369, 0.988088434536777, 0.986600412539863, 0.985085305288626, 0.983543112783066, 0.981973835023184 // 0x432
+, 0.980377257620059, 0.978753380573692, 0.977102203884082, 0.975423727551229, 0.973717951575134, 0.971984756585356, 0.970224142581896, 0.968436109564752, 0.966620657533926, 0.964777786489417, 0.962907357036451, 0.961009369175028, 0.959083822905149, 0.957130718226812, 0.955150055140019, 0.953141900521971 // 0x448
+, 0.951106254372668, 0.949043116692111, 0.946952487480298, 0.944834366737231, 0.942688837088113, 0.940515898532945, 0.938315551071726, 0.936087794704457, 0.933832629431137, 0.931550186985606, 0.929240467367862, 0.926903470577906, 0.924539196615737, 0.922147645481357, 0.919729114264513, 0.917283602965204 // 0x464
+, 0.914811111583432, 0.912311640119196, 0.909785188572495, 0.907232059923660, 0.904652254172692, 0.902045771319589, 0.899412611364352, 0.896752774306981, 0.894066698828851, 0.891354384929961, 0.888615832610312, 0.885851041869904, 0.883060012708737, 0.880243219338708, 0.877400661759819, 0.874532339972069 // 0x480
+, 0.871638253975458, 0.868718403769986, 0.865773372043607, 0.862803158796321, 0.859807764028128, 0.856787187739028, 0.853741429929021, 0.850671130587627, 0.847576289714845, 0.844456907310676, 0.841312983375120, 0.838144517908177, 0.834952250081436, 0.831736179894899, 0.828496307348565, 0.825232632442433 // 0x496
+, 0.821945155176505, 0.818634669749071, 0.815301176160133, 0.811944674409689, 0.808565164497740, 0.805162646424287, 0.801738011539724, 0.798291259844053, 0.794822391337274, 0.791331406019386, 0.787818303890389, 0.784284024066780, 0.780728566548559, 0.777151931335727, 0.773554118428282, 0.769935127826225 // 0x512
+, 0.766295988144595, 0.762636699383391, 0.758957261542614, 0.755257674622264, 0.751537938622340, 0.747799128620256, 0.744041244616010, 0.740264286609604, 0.736468254601037, 0.732653148590310, 0.728820120239915, 0.724969169549854, 0.721100296520126, 0.717213501150731, 0.713308783441669, 0.709387340214337 // 0x528
+, 0.705449171468734, 0.701494277204862, 0.697522657422719, 0.693534312122306, 0.689530508805611, 0.685511247472633, 0.681476528123373, 0.677426350757832, 0.673360715376007, 0.669280925230950, 0.665186980322660, 0.661078880651136, 0.656956626216379, 0.652820217018389, 0.648671024129693, 0.644509047550290 // 0x544
+, 0.640334287280180, 0.636146743319364, 0.631946415667842, 0.627734698604461, 0.623511592129221, 0.619277096242123, 0.615031210943166, 0.610773936232350, 0.606506712565305, 0.602229539942030, 0.597942418362526, 0.593645347826791, 0.589338328334827, 0.585022835761059, 0.580698870105485, 0.576366431368107 // 0x560
+, 0.572025519548925, 0.567676134647937, 0.563319753469783, 0.558956376014462, 0.554586002281975, 0.550208632272320, 0.545824265985498, 0.541434467797861, 0.537039237709408, 0.532638575720139, 0.528232481830053, 0.523820956039152, 0.519405528147261, 0.514986198154378, 0.510562966060505, 0.506135831865641 // 0x576
+, 0.501704795569787, 0.497271402430903, 0.492835652448991, 0.488397545624051, 0.483957081956081, 0.479514261445083, 0.475070671866678, 0.470626313220866, 0.466181185507648, 0.461735288727023, 0.457288622878991, 0.452842726098366, 0.448397598385148, 0.443953239739336, 0.439509650160931, 0.435066829649933 // 0x592
+, 0.430626365981963, 0.426188259157022, 0.421752509175110, 0.417319116036227, 0.412888079740372, 0.408460945545508, 0.404037713451635, 0.399618383458753, 0.395202955566861, 0.390791429775960, 0.386385335885875, 0.381984673896606, 0.377589443808153, 0.373199645620515, 0.368815279333694, 0.364437909324039 // 0x608
+, 0.360067535591551, 0.355704158136230, 0.351347776958076, 0.346998392057089, 0.342657480237906, 0.338325041500528, 0.334001075844955, 0.329685583271186, 0.325378563779222, 0.321081493243488, 0.316794371663983, 0.312517199040708, 0.308249975373663, 0.303992700662848, 0.299746815363891, 0.295512319476793 // 0x624
+, 0.291289213001553, 0.287077495938172, 0.282877168286649, 0.278689624325833, 0.274514864055724, 0.270352887476321, 0.266203694587624, 0.262067285389634, 0.257945030954878, 0.253836931283354, 0.249742986375064, 0.245663196230006, 0.241597560848182, 0.237547383482640, 0.233512664133380, 0.229493402800403 // 0x640
+, 0.225489599483708, 0.221501254183295, 0.217529634401152, 0.213574740137279, 0.209636571391677, 0.205715128164345, 0.201810410455283, 0.197923615085888, 0.194054742056159, 0.190203791366098, 0.186370763015704, 0.182555657004976, 0.178759624996409, 0.174982666990003, 0.171224782985758, 0.167485972983674 // 0x656
+, 0.163766236983750, 0.160066650063400, 0.156387212222623, 0.152727923461419, 0.149088783779789, 0.145469793177732, 0.141871980270287, 0.138295345057454, 0.134739887539233, 0.131205607715624, 0.127692505586628, 0.124201520268740, 0.120732651761960, 0.117285900066289, 0.113861265181727, 0.110458747108273 // 0x672
+, 0.107079237196324, 0.103722735445881, 0.100389241856942, 0.097078756429509, 0.093791279163580, 0.090527604257449, 0.087287731711114, 0.084071661524577, 0.080879393697837, 0.077710928230893, 0.074567004295337, 0.071447621891168, 0.068352781018387, 0.065282481676992, 0.062236723866985, 0.059216147577885 // 0x688
+, 0.056220752809692, 0.053250539562406, 0.050305507836028, 0.047385657630556, 0.044491571633945, 0.041623249846195, 0.038780692267305, 0.035963898897277, 0.033172869736109, 0.030408078995701, 0.027669526676052, 0.024957212777163, 0.022271137299032, 0.019611300241661, 0.016978140286425, 0.014371657433322 // 0x704
+, 0.011791851682353, 0.009238723033519, 0.006712271486818, 0.004212800022581, 0.001740308640809, -0.000705202658499, -0.003123733875344, -0.005515285009724, -0.007879558971892, -0.010216555761848, -0.012526275379592, -0.014808717825124, -0.017063883098444, -0.019291639465713, -0.021491986926931, -0.023664925482100 // 0x720
+, -0.025810455131217, -0.027928575874285, -0.030019205086097, -0.032082342766655, -0.034117988915958, -0.036126143534006, -0.038106806620799, -0.040059911299135, -0.041985457569015, -0.043883445430437, -0.045753874883403, -0.047596745927912, -0.049412197958738, -0.051200230975882, -0.052960844979343, -0.054694039969120 // 0x736
+, -0.056399815945216, -0.058078292278068, -0.059729468967678, -0.061353346014045, -0.062949923417170, -0.064519201177052, -0.066061393682612, -0.067576500933849, -0.069064522930763, -0.070525459673355, -0.071959311161624, -0.073366370094526, -0.074746636472059, -0.076100110294224, -0.077426791561021, -0.078726680272450 // 0x752
+, -0.080000135863516, -0.081247158334217, -0.082467747684554, -0.083661903914528, -0.084829627024138, -0.085971377294768, -0.087087154726419, -0.088176959319091, -0.089240791072784, -0.090278649987498, -0.091291034876780, -0.092277945740630, -0.093239382579049, -0.094175345392036, -0.095085834179591, -0.095971394649406 // 0x768
+, -0.096832026801481, -0.097667730635816, -0.098478506152411, -0.099264353351265, -0.100025906980971, -0.100763167041528, -0.101476133532935, -0.102164806455194, -0.102829185808304, -0.103469938421453, -0.104087064294641, -0.104680563427868, -0.105250435821135, -0.105796681474441, -0.106320050567221, -0.106820543099477 // 0x784
+, -0.107298159071206, -0.107752898482411, -0.108184761333090, -0.108594528276608, -0.108982199312964, -0.109347774442160, -0.109691253664194, -0.110012636979067, -0.110312761036257, -0.110591625835764, -0.110849231377589, -0.111085577661730, -0.111300664688189, -0.111495358056267, -0.111669657765965, -0.111823563817282 // 0x800
+, -0.111957076210219, -0.112070194944776, -0.112163829333291, -0.112237979375766, -0.112292645072200, -0.112327826422594, -0.112343523426946, -0.112340668741153, -0.112319262365216, -0.112279304299134, -0.112220794542907, -0.112143733096535, -0.112049094560241, -0.111936878934024, -0.111807086217884, -0.111659716411822 // 0x816
+, -0.111494769515837, -0.111313235878183, -0.111115115498860, -0.110900408377867, -0.110669114515205, -0.110421233910874, -0.110157789096712, -0.109878780072718, -0.109584206838892, -0.109274069395236, -0.108948367741748, -0.108608135522976, -0.108253372738921, -0.107884079389581, -0.107500255474958, -0.107101900995051 // 0x832
+, -0.106690063728049, -0.106264743673951, -0.105825940832758, -0.105373655204470, -0.104907886789086, -0.104429687468206, -0.103939057241831, -0.103435996109959, -0.102920504072592, -0.102392581129729, -0.101853283104617, -0.101302609997256, -0.100740561807647, -0.100167138535788, -0.099582340181681, -0.098987212252885 // 0x848
+, -0.098381754749398, -0.097765967671221, -0.097139851018354, -0.096503404790798, -0.095857683787475, -0.095202688008388, -0.094538417453534, -0.093864872122915, -0.093182052016530, -0.092490994838493, -0.091791700588804, -0.091084169267462, -0.090368400874467, -0.089644395409820, -0.088913181549678, -0.088174759294041 // 0x864
+, -0.087429128642909, -0.086676289596282, -0.085916242154160, -0.085150036181696, -0.084377671678889, -0.083599148645740, -0.082814467082249, -0.082023626988416, -0.081227510847143, -0.080426118658428, -0.079619450422274, -0.078807506138678, -0.077990285807642, -0.077168951340941, -0.076343502738573, -0.075513940000540 // 0x880
+, -0.074680263126842, -0.073842472117477, -0.073001370638301, -0.072156958689313, -0.071309236270514, -0.070458203381902, -0.069603860023480, -0.068747105982912, -0.067887941260200, -0.067026365855344, -0.066162379768342, -0.065295982999196, -0.064428141768668, -0.063558856076757, -0.062688125923463, -0.061815951308786 // 0x896
+, -0.060942332232727, -0.060068111283246, -0.059193288460344, -0.058317863764021, -0.057441837194276, -0.056565208751110, -0.055688803005088, -0.054812619956210, -0.053936659604477, -0.053060921949887, -0.052185406992442, -0.051310848616233, -0.050437246821259, -0.049564601607521, -0.048692912975018, -0.047822180923752 // 0x912
+, -0.046953144177322, -0.046085802735728, -0.045220156598970, -0.044356205767049, -0.043493950239965, -0.042634092832372, -0.041776633544271, -0.040921572375661, -0.040068909326543, -0.039218644396917, -0.038371450610426, -0.037527327967070, -0.036686276466850, -0.035848296109765, -0.035013386895816, -0.034182157368748 // 0x928
+, -0.033354607528561, -0.032530737375254, -0.031710546908829, -0.030894036129285, -0.030081788622360, -0.029273804388054, -0.028470083426367, -0.027670625737298, -0.026875431320849, -0.026084992566322, -0.025299309473716, -0.024518382043032, -0.023742210274269, -0.022970794167428, -0.022204622148252, -0.021443694216739 // 0x944
+, -0.020688010372891, -0.019937570616707, -0.019192374948187, -0.018452817334647, -0.017718897776088, -0.016990616272509, -0.016267972823910, -0.015550967430292, -0.014840002475567, -0.014135077959736, -0.013436193882799, -0.012743350244755, -0.012056547045605, -0.011376091320742, -0.010701983070165, -0.010034222293874 // 0x960
+, -0.009372808991870, -0.008717743164152, -0.008069345788402, -0.007427616864619, -0.006792556392804, -0.006164164372956, -0.005542440805075, -0.004927597436846, -0.004319634268269, -0.003718551299343, -0.003124348530068, -0.002537025960445, -0.001956821918323, -0.001383736403702, -0.000817769416582, -0.000258920956963 // 0x976
+, 0.000292808975155, 0.000837312598808, 0.001374589913997, 0.001904640920720, 0.002427465618979, 0.002943064008774, 0.003451280616348, 0.003952115441701, 0.004445568484835, 0.004931639745748, 0.005410329224441, 0.005881627279917, 0.006345533912176, 0.006802049121218, 0.007251172907043, 0.007692905269650 // 0x992
+, 0.008127163633496, 0.008553947998580, 0.008973258364902, 0.009385094732463, 0.009789457101262, 0.010186425157797, 0.010575998902067, 0.010958178334073, 0.011332963453814, 0.011700354261291, 0.012060318143684, 0.012412855100994, 0.012757965133221, 0.013095648240363, 0.013425904422423, 0.013748923419822 // 0x1008
+, 0.014064705232560, 0.014373249860637, 0.014674557304054, 0.014968627562810, 0.015255435033855, 0.015534979717189, 0.015807261612812, 0.016072280720724, 0.016330037040925, 0.016580887053362, 0.016824830758036, 0.017061868154947, 0.017291999244094, 0.017515224025477, 0.017731366394601, 0.017940426351466 // 0x1024
+, 0.018142403896072, 0.018337299028419, 0.018525111748506, 0.018706474808949, 0.018881388209747, 0.019049851950901, 0.019211866032409, 0.019367430454273, 0.019516722748770, 0.019659742915899, 0.019796490955661, 0.019926966868055, 0.020051170653082, 0.020168755645689, 0.020279721845878, 0.020384069253647 // 0x1040
+, 0.020481797868997, 0.020572907691927, 0.020658249566136, 0.020737823491623, 0.020811629468388, 0.020879667496431, 0.020941937575752, 0.020998599361125, 0.021049652852548, 0.021095098050023, 0.021134934953549, 0.021169163563127, 0.021198223736055, 0.021222115472335, 0.021240838771966, 0.021254393634947 // 0x1056
+, 0.021262780061280, 0.021266125956290, 0.021264431319977, 0.021257696152341, 0.021245920453382, 0.021229104223099, 0.021207623875469, 0.021181479410492, 0.021150670828167, 0.021115198128495, 0.021075061311475, 0.021030484613498, 0.020981468034563, 0.020928011574671, 0.020870115233821, 0.020807779012014 // 0x1072
+, 0.020741427293237, 0.020671060077492, 0.020596677364778, 0.020518279155096, 0.020435865448444, 0.020349715900196, 0.020259830510354, 0.020166209278916, 0.020068852205883, 0.019967759291254, 0.019863373243457, 0.019755694062493, 0.019644721748360, 0.019530456301059, 0.019412897720591, 0.019292333759548 // 0x1088
+, 0.019168764417931, 0.019042189695740, 0.018912609592974, 0.018780024109635, 0.018644850502560, 0.018507088771749, 0.018366738917203, 0.018223800938922, 0.018078274836905, 0.017930435422913, 0.017780282696946, 0.017627816659005, 0.017473037309088, 0.017315944647197, 0.017156922086478, 0.016995969626931 // 0x1104
+, 0.016833087268556, 0.016668275011354, 0.016501532855324, 0.016333121576688, 0.016163041175444, 0.015991291651593, 0.015817873005136, 0.015642785236071, 0.015466389884546, 0.015288686950559, 0.015109676434112, 0.014929358335203, 0.014747732653833, 0.014565047782793, 0.014381303722083, 0.014196500471702 // 0x1120
+, 0.014010638031650, 0.013823716401928, 0.013636080902490, 0.013447731533336, 0.013258668294466, 0.013068891185880, 0.012878400207577, 0.012687430697790, 0.012495982656518, 0.012304056083760, 0.012111650979518, 0.011918767343791, 0.011725726209088, 0.011532527575409, 0.011339171442754, 0.011145657811122 // 0x1136
+, 0.010951986680515, 0.010758376891840, 0.010564828445098, 0.010371341340289, 0.010177915577412, 0.009984551156468, 0.009791536567957, 0.009598871811877, 0.009406556888230, 0.009214591797015, 0.009022976538233, 0.008831904897335, 0.008641376874322, 0.008451392469193, 0.008261951681949, 0.008073054512589 // 0x1152
+, 0.007884958111150, 0.007697662477630, 0.007511167612032, 0.007325473514353, 0.007140580184595, 0.006956636387125, 0.006773642121944, 0.006591597389051, 0.006410502188446, 0.006230356520130, 0.006051385789623, 0.005873589996926, 0.005696969142038, 0.005521523224960, 0.005347252245692, 0.005174262259584 // 0x1168
+, 0.005002553266635, 0.004832125266846, 0.004662978260217, 0.004495112246747, 0.004328709234749, 0.004163769224223, 0.004000292215168, 0.003838278207586, 0.003677727201475, 0.003518717011054, 0.003361247636323, 0.003205319077283, 0.003050931333932, 0.002898084406271, 0.002516567809048, 0.001906381542261 // 0x1184
+, 0.001067525605912
+};
+static const double __in_flash() __aligned(8) filter_22050_0[1001] = {
+  1.031590155956400, 1.031824795142591, 1.031871722979829, 1.031914650851166, 1.031953578756603, 1.031988506696138, 1.032019434669773, 1.032046362677506, 1.032074721387490, 1.032104510799724, 1.032135730914208, 1.032168381730942, 1.032202463249926, 1.032238132692386, 1.032275390058321, 1.032314235347732 // 0x0
+, 1.032354668560618, 1.032396689696981, 1.032440437037458, 1.032485910582051, 1.032533110330760, 1.032582036283584, 1.032632688440523, 1.032685185466839, 1.032739527362530, 1.032795714127598, 1.032853745762043, 1.032913622265863, 1.032975430715996, 1.033039171112442, 1.033104843455201, 1.033172447744272 // 0x16
+, 1.033241983979656, 1.033313508174477, 1.033387020328734, 1.033462520442428, 1.033540008515559, 1.033619484548127, 1.033700960754235, 1.033784437133883, 1.033869913687071, 1.033957390413800, 1.034046867314068, 1.034138311745703, 1.034231723708705, 1.034327103203074, 1.034424450228810, 1.034523764785913 // 0x32
+, 1.034624956257244, 1.034728024642805, 1.034832969942596, 1.034939792156615, 1.035048491284863, 1.035158918091663, 1.035271072577015, 1.035384954740920, 1.035500564583376, 1.035617902104384, 1.035736748809126, 1.035857104697602, 1.035978969769812, 1.036102344025755, 1.036227227465433, 1.036353335679806 // 0x48
+, 1.036480668668874, 1.036609226432638, 1.036739008971097, 1.036870016284251, 1.037001890725473, 1.037134632294761, 1.037268240992115, 1.037402716817536, 1.037538059771024, 1.037673844826212, 1.037810071983102, 1.037946741241693, 1.038083852601986, 1.038221406063979, 1.038358900443470, 1.038496335740457 // 0x64
+, 1.038633711954942, 1.038771029086923, 1.038908287136402, 1.039044916992030, 1.039180918653809, 1.039316292121737, 1.039451037395815, 1.039585154476044, 1.039718003405527, 1.039849584184265, 1.039979896812258, 1.040108941289505, 1.040236717616008, 1.040362533776310, 1.040486389770411, 1.040608285598312 // 0x80
+, 1.040728221260012, 1.040846196755511, 1.040961468892921, 1.041074037672240, 1.041183903093469, 1.041291065156608, 1.041395523861657, 1.041496500014735, 1.041593993615842, 1.041688004664978, 1.041778533162143, 1.041865579107337, 1.041948323187085, 1.042026765401387, 1.042100905750242, 1.042170744233651 // 0x96
+, 1.042236280851614, 1.042296687556711, 1.042351964348944, 1.042402111228312, 1.042447128194815, 1.042487015248453, 1.042520948657232, 1.042548928421152, 1.042570954540213, 1.042587027014415, 1.042597145843758, 1.042600520624024, 1.042597151355214, 1.042587038037328, 1.042570180670366, 1.042546579254327 // 0x112
+, 1.042515450527111, 1.042476794488717, 1.042430611139145, 1.042376900478396, 1.042315662506468, 1.042246202420136, 1.042168520219397, 1.042082615904254, 1.041988489474704, 1.041886140930750, 1.041774947125977, 1.041654908060386, 1.041526023733977, 1.041388294146750, 1.041241719298705, 1.041085766685606 // 0x128
+, 1.040920436307455, 1.040745728164251, 1.040561642255994, 1.040368178582684, 1.040164943775049, 1.039951937833090, 1.039729160756806, 1.039496612546197, 1.039254293201264, 1.039001936287233, 1.038739541804103, 1.038467109751876, 1.038184640130550, 1.037892132940126, 1.037589493488907, 1.037276721776893 // 0x144
+, 1.036953817804084, 1.036620781570480, 1.036277613076080, 1.035924387676697, 1.035561105372330, 1.035187766162979, 1.034804370048645, 1.034410917029326, 1.034007681587915, 1.033594663724410, 1.033171863438813, 1.032739280731123, 1.032296915601340, 1.031845244961304, 1.031384268811015, 1.030913987150474 // 0x160
+, 1.030434399979679, 1.029945507298632, 1.029448006069843, 1.028941896293313, 1.028427177969041, 1.027903851097028, 1.027371915677273, 1.026832287527218, 1.026284966646862, 1.025729953036207, 1.025167246695251, 1.024596847623996, 1.024019897096969, 1.023436395114169, 1.022846341675598, 1.022249736781254 // 0x176
+, 1.021646580431139, 1.021038233154810, 1.020424694952266, 1.019805965823508, 1.019182045768536, 1.018552934787350, 1.017920211231734, 1.017283875101687, 1.016643926397211, 1.016000365118304, 1.015353191264968, 1.014704184726151, 1.014053345501853, 1.013400673592076, 1.012746168996818, 1.012089831716080 // 0x192
+, 1.011433629022509, 1.010777560916103, 1.010121627396865, 1.009465828464793, 1.008810164119887, 1.008156762478747, 1.007505623541374, 1.006856747307767, 1.006210133777927, 1.005565782951853, 1.004925962370059, 1.004290672032545, 1.003659911939311, 1.003033682090357, 1.002411982485683, 1.001797186722170 // 0x208
+, 1.001189294799819, 1.000588306718630, 0.999994222478602, 0.999407042079735, 0.998829209748935, 0.998260725486203, 0.997701589291537, 0.997151801164938, 0.996611361106406, 0.996082739853266, 0.995565937405518, 0.995060953763162, 0.994567788926197, 0.994086442894624, 0.993619373197485, 0.993166579834779 // 0x224
+, 0.992728062806505, 0.992303822112665, 0.991893857753258, 0.991500566833229, 0.991123949352578, 0.990764005311305, 0.990420734709410, 0.990094137546893, 0.989786500259669, 0.989497822847737, 0.989228105311098, 0.988977347649751, 0.988745549863697, 0.988534832376597, 0.988345195188452, 0.988176638299262 // 0x240
+, 0.988029161709026, 0.987902765417744, 0.987799360722310, 0.987718947622722, 0.987661526118982, 0.987627096211088, 0.987615657899041, 0.987628855614070, 0.987666689356175, 0.987729159125354, 0.987816264921609, 0.987928006744940, 0.988065707158768, 0.988229366163093, 0.988418983757916, 0.988634559943236 // 0x256
+, 0.988876094719054, 0.989144551966541, 0.989439931685698, 0.989762233876526, 0.990111458539023, 0.990487605673190, 0.990891220582353, 0.991322303266514, 0.991780853725671, 0.992266871959825, 0.992780357968976, 0.993321408184069, 0.993890022605106, 0.994486201232085, 0.995109944065008, 0.995761251103873 // 0x272
+, 0.996439725250183, 0.997145366503939, 0.997878174865139, 0.998638150333784, 0.999425292909874, 1.000238683514460, 1.001078322147541, 1.001944208809117, 1.002836343499189, 1.003754726217756, 1.004697891396183, 1.005665839034471, 1.006658569132619, 1.007676081690627, 1.008718376708496, 1.009783425302868 // 0x288
+, 1.010871227473743, 1.011981783221120, 1.013115092545001, 1.014271155445385, 1.015447371430146, 1.016643740499285, 1.017860262652800, 1.019096937890693, 1.020353766212962, 1.021627573645778, 1.022918360189139, 1.024226125843046, 1.025550870607498, 1.026892594482496, 1.028247560052607, 1.029615767317832 // 0x304
+, 1.030997216278170, 1.032391906933621, 1.033799839284186, 1.035216731436025, 1.036642583389139, 1.038077395143527, 1.039521166699189, 1.040973898056125, 1.042430790735116, 1.043891844736160, 1.045357060059258, 1.046826436704410, 1.048299974671616, 1.049772396687501, 1.051243702752064, 1.052713892865306 // 0x320
+, 1.054182967027226, 1.055650925237826, 1.057112056693531, 1.058566361394343, 1.060013839340260, 1.061454490531284, 1.062888314967414, 1.064309226391914, 1.065717224804785, 1.067112310206027, 1.068494482595640, 1.069863741973623, 1.071213690701155, 1.072544328778236, 1.073855656204866, 1.075147672981045 // 0x336
+, 1.076420379106773, 1.077667136438428, 1.078887944976012, 1.080082804719523, 1.081251715668962, 1.082394677824329, 1.083504892213033, 1.084582358835075, 1.085627077690454, 1.086639048779171, 1.087618272101226, 1.088557872861657, 1.089457851060462, 1.090318206697643, 1.091138939773200, 1.091920050287132 // 0x352
+, 1.092654677459092, 1.093342821289080, 1.093984481777097, 1.094579658923142, 1.095128352727215, 1.095623807625389, 1.096066023617665, 1.096455000704042, 1.096790738884520, 1.097073238159100, 1.097295943529388, 1.097458854995385, 1.097561972557089, 1.097605296214502, 1.097588825967624, 1.097506304538751 // 0x368
+, 1.097357731927882, 1.097143108135020, 1.096862433160162, 1.096515707003310, 1.096097063359094, 1.095606502227513, 1.095044023608569, 1.094409627502261, 1.093703313908590, 1.092919697722136, 1.092058778942901, 1.091120557570885, 1.090105033606087, 1.089012207048508, 1.087837266574073, 1.086580212182785 // 0x384
+, 1.085241043874641, 1.083819761649643, 1.082316365507789, 1.080726695354832, 1.079050751190771, 1.077288533015606, 1.075440040829337, 1.073505274631964, 1.071480806596893, 1.069366636724125, 1.067162765013660, 1.064869191465498, 1.062485916079639, 1.060010308809924, 1.057442369656353, 1.054782098618926 // 0x400
+, 1.052029495697643, 1.049184560892505, 1.046245518868189, 1.043212369624694, 1.040085113162021, 1.036863749480169, 1.033548278579140, 1.030137830914166, 1.026632406485248, 1.023032005292385, 1.019336627335579, 1.015546272614828, 1.011661011102457, 1.007680842798465, 1.003605767702853, 0.999435785815620 // 0x416
+, 0.995170897136767, 0.990812138026999, 0.986359508486316, 0.981813008514719, 0.977172638112207, 0.972438397278780, 0.967612297251863, 0.962694338031455, 0.957684519617557, 0.952582842010168, 0.947389305209288, 0.942106895185994, 0.936735611940284, 0.931275455472160, 0.925726425781620, 0.920088522868665 // 0x432
+, 0.914365691648266, 0.908557932120421, 0.902665244285132, 0.896687628142397, 0.890625083692218, 0.884482485735478, 0.878259834272179, 0.871957129302320, 0.865574370825901, 0.859111558842922, 0.852574456636256, 0.845963064205903, 0.839277381551862, 0.832517408674134, 0.825683145572719, 0.818781187913144 // 0x448
+, 0.811811535695407, 0.804774188919509, 0.797669147585450, 0.790496411693231, 0.783263344566572, 0.775969946205472, 0.768616216609933, 0.761202155779954, 0.753727763715535, 0.746201092909819, 0.738622143362806, 0.730990915074497, 0.723307408044891, 0.715571622273988, 0.707792209629515, 0.699969170111471 // 0x464
+, 0.692102503719856, 0.684192210454671, 0.676238290315916, 0.668249900978212, 0.660227042441559, 0.652169714705958, 0.644077917771407, 0.635951651637908, 0.627800473269881, 0.619624382667325, 0.611423379830241, 0.603197464758629, 0.594946637452488, 0.586680746039332, 0.578399790519161, 0.570103770891976 // 0x480
+, 0.561792687157776, 0.553466539316561, 0.545135350472051, 0.536799120624248, 0.528457849773150, 0.520111537918758, 0.511760185061071, 0.503413873206679, 0.495072602355581, 0.486736372507777, 0.478405183663268, 0.470079035822053, 0.461767952087853, 0.453471932460668, 0.445190976940497, 0.436925085527341 // 0x496
+, 0.428674258221200, 0.420448343149587, 0.412247340312503, 0.404071249709948, 0.395920071341920, 0.387793805208421, 0.379702008273871, 0.371644680538269, 0.363621822001617, 0.355633432663913, 0.347679512525157, 0.339769219259972, 0.331902552868358, 0.324079513350314, 0.316300100705841, 0.308564314934938 // 0x512
+, 0.300880807905332, 0.293249579617022, 0.285670630070010, 0.278143959264294, 0.270669567199875, 0.263255506369896, 0.255901776774356, 0.248608378413257, 0.241375311286598, 0.234202575394378, 0.227097534060320, 0.220060187284422, 0.213090535066685, 0.206188577407109, 0.199354314305694, 0.192594341427966 // 0x528
+, 0.185908658773926, 0.179297266343573, 0.172760164136907, 0.166297352153928, 0.159914593677509, 0.153611888707650, 0.147389237244350, 0.141246639287611, 0.135184094837432, 0.129206478694697, 0.123313790859407, 0.117506031331563, 0.111783200111163, 0.106145297198209, 0.100596267507669, 0.095136111039545 // 0x544
+, 0.089764827793835, 0.084482417770541, 0.079288880969661, 0.074187203362272, 0.069177384948374, 0.064259425727966, 0.059433325701048, 0.054699084867622, 0.050058714465110, 0.045512214493512, 0.041059584952830, 0.036700825843062, 0.032435937164209, 0.028265955276976, 0.024190880181364, 0.020210711877372 // 0x560
+, 0.016325450365001, 0.012535095644250, 0.008839717687444, 0.005239316494581, 0.001733892065663, -0.001676555599311, -0.004992026500341, -0.008213390182192, -0.011340646644865, -0.014373795888360, -0.017312837912676, -0.020157772717815, -0.022910375639097, -0.025570646676524, -0.028138585830095, -0.030614193099810 // 0x576
+, -0.032997468485669, -0.035291042033832, -0.037494913744297, -0.039609083617064, -0.041633551652135, -0.043568317849508, -0.045416810035777, -0.047179028210942, -0.048854972375003, -0.050444642527961, -0.051948038669814, -0.053369320894812, -0.054708489202956, -0.055965543594245, -0.057140484068679, -0.058233310626258 // 0x592
+, -0.059248834591056, -0.060187055963073, -0.061047974742307, -0.061831590928761, -0.062537904522433, -0.063172300628741, -0.063734779247685, -0.064225340379265, -0.064643984023481, -0.064990710180333, -0.065271385155191, -0.065486008948053, -0.065634581558921, -0.065717102987795, -0.065733573234673, -0.065690249577260 // 0x608
+, -0.065587132015555, -0.065424220549559, -0.065201515179271, -0.064919015904691, -0.064583277724213, -0.064194300637836, -0.063752084645560, -0.063256629747386, -0.062707935943313, -0.062112758797268, -0.061471098309251, -0.060782954479263, -0.060048327307303, -0.059267216793371, -0.058446483717814, -0.057586128080633 // 0x624
+, -0.056686149881827, -0.055746549121397, -0.054767325799342, -0.053755354710625, -0.052710635855245, -0.051633169233203, -0.050522954844499, -0.049379992689132, -0.048211081739693, -0.047016221996182, -0.045795413458599, -0.044548656126943, -0.043275950001216, -0.041983933225037, -0.040672605798407, -0.039341967721326 // 0x640
+, -0.037992018993794, -0.036622759615810, -0.035240587226198, -0.033845501824956, -0.032437503412085, -0.031016591987585, -0.029582767551455, -0.028142116360431, -0.026694638414514, -0.025240333713702, -0.023779202257997, -0.022311244047398, -0.020842169885477, -0.019371979772235, -0.017900673707672, -0.016428251691787 // 0x656
+, -0.014954713724581, -0.013485337079429, -0.012020121756331, -0.010559067755287, -0.009102175076296, -0.007649443719360, -0.006205672163698, -0.004770860409310, -0.003345008456196, -0.001928116304357, -0.000520183953792, 0.000874506701659, 0.002255955661998, 0.003624162927222, 0.004979128497333, 0.006320852372331 // 0x672
+, 0.007645597136783, 0.008953362790690, 0.010244149334051, 0.011517956766867, 0.012774785089137, 0.014011460327029, 0.015227982480545, 0.016424351549683, 0.017600567534444, 0.018756630434828, 0.019889939758709, 0.021000495506087, 0.022088297676961, 0.023153346271333, 0.024195641289202, 0.025213153847210 // 0x688
+, 0.026205883945358, 0.027173831583646, 0.028116996762073, 0.029035379480640, 0.029927514170712, 0.030793400832288, 0.031633039465369, 0.032446430069955, 0.033233572646045, 0.033993548114690, 0.034726356475891, 0.035431997729646, 0.036110471875956, 0.036761778914822, 0.037385521747744, 0.037981700374724 // 0x704
+, 0.038550314795760, 0.039091365010854, 0.039604851020004, 0.040090869254158, 0.040549419713315, 0.040980502397476, 0.041384117306639, 0.041760264440806, 0.042109489103304, 0.042431791294131, 0.042727171013288, 0.042995628260775, 0.043237163036593, 0.043452739221913, 0.043642356816736, 0.043806015821061 // 0x720
+, 0.043943716234889, 0.044055458058220, 0.044142563854475, 0.044205033623655, 0.044242867365759, 0.044256065080788, 0.044244626768741, 0.044210196860848, 0.044152775357107, 0.044072362257520, 0.043968957562085, 0.043842561270804, 0.043695084680567, 0.043526527791377, 0.043336890603232, 0.043126173116132 // 0x736
+, 0.042894375330078, 0.042643617668731, 0.042373900132092, 0.042085222720160, 0.041777585432936, 0.041450988270419, 0.041107717668524, 0.040747773627252, 0.040371156146601, 0.039977865226571, 0.039567900867164, 0.039143660173324, 0.038705143145050, 0.038252349782344, 0.037785280085204, 0.037303934053632 // 0x752
+, 0.036810769216667, 0.036305785574311, 0.035788983126563, 0.035260361873423, 0.034719921814891, 0.034170133688292, 0.033610997493626, 0.033042513230894, 0.032464680900094, 0.031877500501227, 0.031283416261199, 0.030682428180010, 0.030074536257659, 0.029459740494146, 0.028838040889472, 0.028211811040518 // 0x768
+, 0.027581050947284, 0.026945760609770, 0.026305940027976, 0.025661589201902, 0.025014975672061, 0.024366099438455, 0.023714960501082, 0.023061558859942, 0.022405894515036, 0.021750095582964, 0.021094162063725, 0.020438093957320, 0.019781891263749, 0.019125553983011, 0.018471049387753, 0.017818377477975 // 0x784
+, 0.017167538253678, 0.016518531714861, 0.015871357861524, 0.015227796582618, 0.014587847878141, 0.013951511748095, 0.013318788192478, 0.012689677211292, 0.012065757156320, 0.011447028027562, 0.010833489825019, 0.010225142548689, 0.009621986198574, 0.009025381304231, 0.008435327865659, 0.007851825882860 // 0x800
+, 0.007274875355832, 0.006704476284577, 0.006141769943621, 0.005586756332966, 0.005039435452611, 0.004499807302556, 0.003967871882801, 0.003444545010787, 0.002929826686516, 0.002423716909985, 0.001926215681196, 0.001437323000149, 0.000957735829355, 0.000487454168813, 0.000026478018525, -0.000425192621511 // 0x816
+, -0.000867557751294, -0.001300140458985, -0.001722940744582, -0.002135958608086, -0.002539194049498, -0.002932647068816, -0.003316043183151, -0.003689382392502, -0.004052664696869, -0.004405890096252, -0.004749058590651, -0.005082094824256, -0.005404998797065, -0.005717770509079, -0.006020409960298, -0.006312917150722 // 0x832
+, -0.006595386772047, -0.006867818824275, -0.007130213307404, -0.007382570221435, -0.007624889566369, -0.007857437776977, -0.008080214853261, -0.008293220795220, -0.008496455602855, -0.008689919276165, -0.008874005184422, -0.009048713327626, -0.009214043705778, -0.009369996318876, -0.009516571166921, -0.009654300754149 // 0x848
+, -0.009783185080558, -0.009903224146149, -0.010014417950921, -0.010116766494876, -0.010210892924425, -0.010296797239569, -0.010374479440307, -0.010443939526640, -0.010505177498567, -0.010558888159316, -0.010605071508888, -0.010643727547282, -0.010674856274499, -0.010698457690537, -0.010715315057500, -0.010725428375386 // 0x864
+, -0.010728797644195, -0.010725422863929, -0.010715304034586, -0.010699231560384, -0.010677205441323, -0.010649225677403, -0.010615292268624, -0.010575405214986, -0.010530388248483, -0.010480241369116, -0.010424964576883, -0.010364557871785, -0.010299021253822, -0.010229182770413, -0.010155042421558, -0.010076600207256 // 0x880
+, -0.009993856127508, -0.009906810182314, -0.009816281685149, -0.009722270636013, -0.009624777034906, -0.009523800881828, -0.009419342176779, -0.009312180113640, -0.009202314692411, -0.009089745913092, -0.008974473775683, -0.008856498280183, -0.008736562618483, -0.008614666790583, -0.008490810796481, -0.008364994636179 // 0x896
+, -0.008237218309677, -0.008108173832429, -0.007977861204436, -0.007846280425698, -0.007713431496215, -0.007579314415987, -0.007444569141908, -0.007309195673980, -0.007173194012202, -0.007036564156573, -0.006899306107095, -0.006761988975113, -0.006624612760629, -0.006487177463641, -0.006349683084150, -0.006212129622157 // 0x912
+, -0.006075018261864, -0.005938349003273, -0.005802121846383, -0.005666336791194, -0.005530993837707, -0.005396518012286, -0.005262909314932, -0.005130167745644, -0.004998293304422, -0.004867285991268, -0.004737503452809, -0.004608945689045, -0.004481612699976, -0.004355504485603, -0.004230621045926, -0.004107246789982 // 0x928
+, -0.003985381717773, -0.003865025829297, -0.003746179124555, -0.003628841603546, -0.003513231761090, -0.003399349597186, -0.003287195111834, -0.003176768305034, -0.003068069176785, -0.002961246962766, -0.002856301662976, -0.002753233277415, -0.002652041806083, -0.002552727248981, -0.002455380223245, -0.002360000728876 // 0x944
+, -0.002266588765874, -0.002175144334238, -0.002085667433970, -0.001998190707242, -0.001912714154054, -0.001829237774406, -0.001747761568298, -0.001668285535730, -0.001590797462599, -0.001515297348905, -0.001441785194647, -0.001370260999826, -0.001300724764442, -0.001233120475371, -0.001167448132613, -0.001103707736167 // 0x960
+, -0.001041899286034, -0.000982022782213, -0.000923991147769, -0.000867804382701, -0.000813462487009, -0.000760965460694, -0.000710313303754, -0.000661387350930, -0.000614187602222, -0.000568714057629, -0.000524966717151, -0.000482945580789, -0.000442512367903, -0.000403667078492, -0.000366409712557, -0.000330740270097 // 0x976
+, -0.000296658751113, -0.000264007934379, -0.000232787819895, -0.000202998407661, -0.000174639697678, -0.000147711689944, -0.000116783716309, -0.000081855776774, -0.000042927871337
+};
+static const double __in_flash() __aligned(8) filter_22050_1[1001] = {
+  0.951207647059388, 0.950213227087918, 0.950014343093624, 0.949854139234188, 0.949732615509612, 0.949649771919893, 0.949605608465034, 0.949600125145033, 0.949595486190865, 0.949591691602529, 0.949588741380026, 0.949586635523356, 0.949585374032519, 0.949585552232357, 0.949587170122869, 0.949590227704057 // 0x0
+, 0.949594724975920, 0.949600661938457, 0.949608668070001, 0.949618743370550, 0.949630887840105, 0.949645101478666, 0.949661384286233, 0.949680367358378, 0.949702050695100, 0.949726434296401, 0.949753518162280, 0.949783302292737, 0.949816438228703, 0.949852925970176, 0.949892765517158, 0.949935956869648 // 0x16
+, 0.949982500027646, 0.950033027341890, 0.950087538812381, 0.950146034439116, 0.950208514222098, 0.950274978161326, 0.950346056181996, 0.950421748284110, 0.950502054467665, 0.950586974732664, 0.950676509079105, 0.950771239068486, 0.950871164700806, 0.950976285976065, 0.951086602894263, 0.951202115455401 // 0x32
+, 0.951323374071878, 0.951450378743694, 0.951583129470848, 0.951721626253340, 0.951865869091172, 0.952016321880942, 0.952172984622653, 0.952335857316302, 0.952504939961891, 0.952680232559420, 0.952862135579069, 0.953050649020839, 0.953245772884731, 0.953447507170743, 0.953655851878875, 0.953871089962404 // 0x48
+, 0.954093221421329, 0.954322246255650, 0.954558164465367, 0.954800976050479, 0.955050858481640, 0.955307811758849, 0.955571835882106, 0.955842930851411, 0.956121096666765, 0.956406362787308, 0.956698729213042, 0.956998195943965, 0.957304762980079, 0.957618430321383, 0.957939096235885, 0.958266760723586 // 0x64
+, 0.958601423784485, 0.958943085418583, 0.959291745625879, 0.959647126891700, 0.960009229216046, 0.960378052598916, 0.960753597040311, 0.961135862540230, 0.961524416210840, 0.961919258052141, 0.962320388064133, 0.962727806246815, 0.963141512600189, 0.963560879090911, 0.963985905718983, 0.964416592484403 // 0x80
+, 0.964852939387173, 0.965294946427291, 0.965741823063980, 0.966193569297239, 0.966650185127068, 0.967111670553467, 0.967578025576437, 0.968048264105907, 0.968522386141877, 0.969000391684348, 0.969482280733319, 0.969968053288791, 0.970456566160994, 0.970947819349928, 0.971441812855594, 0.971938546677992 // 0x96
+, 0.972438020817121, 0.972938907816982, 0.973441207677576, 0.973944920398902, 0.974450045980962, 0.974956584423753, 0.975463087325344, 0.975969554685735, 0.976475986504926, 0.976982382782916, 0.977488743519705, 0.977993465445704, 0.978496548560911, 0.978997992865327, 0.979497798358951, 0.979995965041785 // 0x112
+, 0.980490821354026, 0.980982367295675, 0.981470602866733, 0.981955528067198, 0.982437142897072, 0.982913668270849, 0.983385104188530, 0.983851450650115, 0.984312707655603, 0.984768875204995, 0.985218176175104, 0.985660610565932, 0.986096178377476, 0.986524879609739, 0.986946714262719, 0.987359844085915 // 0x128
+, 0.987764269079327, 0.988159989242956, 0.988547004576801, 0.988925315080863, 0.989293172248380, 0.989650576079352, 0.989997526573781, 0.990334023731665, 0.990660067553005, 0.990973850629717, 0.991275372961799, 0.991564634549253, 0.991841635392078, 0.992106375490274, 0.992357344566117, 0.992594542619607 // 0x144
+, 0.992817969650744, 0.993027625659528, 0.993223510645958, 0.993404231792773, 0.993569789099972, 0.993720182567554, 0.993855412195520, 0.993975477983870, 0.994079078617355, 0.994166214095975, 0.994236884419730, 0.994291089588621, 0.994328829602646, 0.994349173803300, 0.994352122190583, 0.994337674764494 // 0x160
+, 0.994305831525035, 0.994256592472204, 0.994189236258368, 0.994103762883526, 0.994000172347678, 0.993878464650825, 0.993738639792966, 0.993580345991053, 0.993403583245084, 0.993208351555061, 0.992994650920983, 0.992762481342850, 0.992511804269153, 0.992242619699891, 0.991954927635065, 0.991648728074674 // 0x176
+, 0.991324021018718, 0.990981176207639, 0.990620193641435, 0.990241073320108, 0.989843815243656, 0.989428419412080, 0.988995625669459, 0.988545434015791, 0.988077844451078, 0.987592856975319, 0.987090471588513, 0.986571859940719, 0.986037022031936, 0.985485957862165, 0.984918667431404, 0.984335150739655 // 0x192
+, 0.983736970641416, 0.983124127136687, 0.982496620225468, 0.981854449907758, 0.981197616183559, 0.980528101775943, 0.979845906684909, 0.979151030910459, 0.978443474452591, 0.977723237311306, 0.976992688450322, 0.976251827869640, 0.975500655569259, 0.974739171549180, 0.973967375809401, 0.973188007647647 // 0x208
+, 0.972401067063915, 0.971606554058208, 0.970804468630523, 0.969994810780863, 0.969180646465865, 0.968361975685529, 0.967538798439857, 0.966711114728847, 0.965878924552501, 0.965045594347782, 0.964211124114693, 0.963375513853231, 0.962538763563399, 0.961700873245195, 0.960865443848451, 0.960032475373166 // 0x224
+, 0.959201967819342, 0.958373921186977, 0.957548335476072, 0.956728996990015, 0.955915905728805, 0.955109061692443, 0.954308464880928, 0.953514115294261, 0.952729904487800, 0.951955832461546, 0.951191899215499, 0.950438104749659, 0.949694449064025, 0.948964866857391, 0.948249358129756, 0.947547922881122 // 0x240
+, 0.946860561111487, 0.946187272820853, 0.945531946284470, 0.944894581502338, 0.944275178474458, 0.943673737200829, 0.943090257681453, 0.942528505975429, 0.941988482082759, 0.941470186003442, 0.940973617737479, 0.940498777284869, 0.940049206642849, 0.939624905811418, 0.939225874790577, 0.938852113580326 // 0x256
+, 0.938503622180664, 0.938183647094370, 0.937892188321443, 0.937629245861884, 0.937394819715692, 0.937188909882867, 0.937014363377734, 0.936871180200293, 0.936759360350544, 0.936678903828488, 0.936629810634123, 0.936614457259532, 0.936632843704714, 0.936684969969670, 0.936770836054400, 0.936890441958902 // 0x272
+, 0.937045602278351, 0.937236317012746, 0.937462586162086, 0.937724409726372, 0.938021787705605, 0.938355909463275, 0.938726774999383, 0.939134384313930, 0.939578737406915, 0.940059834278337, 0.940578159163907, 0.941133712063624, 0.941726492977487, 0.942356501905497, 0.943023738847654, 0.943727930799984 // 0x288
+, 0.944469077762488, 0.945247179735165, 0.946062236718016, 0.946914248711041, 0.947802123007189, 0.948725859606461, 0.949685458508856, 0.950680919714375, 0.951712243223018, 0.952777495771915, 0.953876677361067, 0.955009787990474, 0.956176827660136, 0.957377796370052, 0.958609944612058, 0.959873272386153 // 0x304
+, 0.961167779692337, 0.962493466530610, 0.963850332900973, 0.965234701699525, 0.966646572926266, 0.968085946581196, 0.969552822664316, 0.971047201175625, 0.972564582739276, 0.974104967355269, 0.975668355023604, 0.977254745744281, 0.978864139517300, 0.980491195647065, 0.982135914133575, 0.983798294976831 // 0x320
+, 0.985478338176832, 0.987176043733579, 0.988885282467945, 0.990606054379930, 0.992338359469533, 0.994082197736755, 0.995837569181596, 0.997597611210910, 0.999362323824696, 1.001131707022955, 1.002905760805686, 1.004684485172891, 1.006460357214805, 1.008233376931429, 1.010003544322763, 1.011770859388806 // 0x336
+, 1.013535322129560, 1.015288839299083, 1.017031410897375, 1.018763036924438, 1.020483717380270, 1.022193452264871, 1.023883675876757, 1.025554388215926, 1.027205589282380, 1.028837279076117, 1.030449457597139, 1.032033209427986, 1.033588534568661, 1.035115433019162, 1.036613904779490, 1.038083949849644 // 0x352
+, 1.039516409641623, 1.040911284155425, 1.042268573391052, 1.043588277348503, 1.044870396027777, 1.046105689244284, 1.047294156998021, 1.048435799288991, 1.049530616117191, 1.050578607482623, 1.051570568852316, 1.052506500226270, 1.053386401604485, 1.054210272986961, 1.054978114373698, 1.055680905406164 // 0x368
+, 1.056318646084359, 1.056891336408281, 1.057398976377933, 1.057841565993313, 1.058210422887900, 1.058505547061694, 1.058726938514696, 1.058874597246905, 1.058948523258321, 1.058940515181539, 1.058850573016559, 1.058678696763380, 1.058424886422004, 1.058089141992429, 1.057663886137431, 1.057149118857012 // 0x384
+, 1.056544840151170, 1.055851050019905, 1.055067748463219, 1.054188115573516, 1.053212151350796, 1.052139855795060, 1.050971228906307, 1.049706270684537, 1.048339051519348, 1.046869571410739, 1.045297830358710, 1.043623828363262, 1.041847565424394, 1.039964118965781, 1.037973488987424, 1.035875675489322 // 0x400
+, 1.033670678471475, 1.031358497933884, 1.028935327555425, 1.026401167336098, 1.023756017275905, 1.020999877374843, 1.018132747632915, 1.015152020294760, 1.012057695360377, 1.008849772829769, 1.005528252702933, 1.002093134979870, 0.998543088434774, 0.994878113067645, 0.991098208878481, 0.987203375867284 // 0x416
+, 0.983193614034054, 0.979068920970103, 0.974829296675431, 0.970474741150039, 0.966005254393926, 0.961420836407092, 0.956722845339085, 0.951911281189905, 0.946986143959551, 0.941947433648024, 0.936795150255324, 0.931532030655168, 0.926158074847559, 0.920673282832494, 0.915077654609975, 0.909371190180001 // 0x432
+, 0.903557995277994, 0.897638069903954, 0.891611414057881, 0.885478027739775, 0.879237910949635, 0.872896513989484, 0.866453836859321, 0.859909879559147, 0.853264642088961, 0.846518124448764, 0.839677061845557, 0.832741454279340, 0.825711301750112, 0.818586604257875, 0.811367361802628, 0.804061528374356 // 0x448
+, 0.796669103973061, 0.789190088598742, 0.781624482251400, 0.773972284931033, 0.766242566119800, 0.758435325817700, 0.750550564024733, 0.742588280740900, 0.734548475966200, 0.726441258239896, 0.718266627561989, 0.710024583932478, 0.701715127351363, 0.693338257818645, 0.684904962361536, 0.676415240980037 // 0x464
+, 0.667869093674147, 0.659266520443867, 0.650607521289196, 0.641903825133364, 0.633155431976371, 0.624362341818217, 0.615524554658901, 0.606642070498424, 0.597727231559608, 0.588780037842454, 0.579800489346962, 0.570788586073131, 0.561744328020961, 0.552680476809929, 0.543597032440035, 0.534493994911279 // 0x480
+, 0.525371364223660, 0.516229140377179, 0.507080359609001, 0.497925021919128, 0.488763127307558, 0.479594675774292, 0.470419667319331, 0.461251215786065, 0.452089321174495, 0.442933983484622, 0.433785202716445, 0.424642978869963, 0.415520348182344, 0.406417310653588, 0.397333866283694, 0.388270015072662 // 0x496
+, 0.379225757020492, 0.370213853746661, 0.361234305251169, 0.352287111534015, 0.343372272595199, 0.334489788434722, 0.325652001275406, 0.316858911117252, 0.308110517960259, 0.299406821804427, 0.290747822649756, 0.282145249419476, 0.273599102113586, 0.265109380732087, 0.256676085274978, 0.248299215742259 // 0x512
+, 0.239989759161145, 0.231747715531634, 0.223573084853726, 0.215465867127423, 0.207426062352723, 0.199463779068890, 0.191579017275923, 0.183771776973823, 0.176042058162590, 0.168389860842223, 0.160824254494880, 0.153345239120562, 0.145952814719266, 0.138646981290995, 0.131427738835748, 0.124303041343511 // 0x528
+, 0.117272888814283, 0.110337281248066, 0.103496218644859, 0.096749701004662, 0.090104463534476, 0.083560506234302, 0.077117829104139, 0.070776432143988, 0.064536315353848, 0.058402929035742, 0.052376273189669, 0.046456347815629, 0.040643152913622, 0.034936688483648, 0.029341060261129, 0.023856268246065 // 0x544
+, 0.018482312438455, 0.013219192838299, 0.008066909445599, 0.003028199134072, -0.001896938096282, -0.006708502245462, -0.011406493313469, -0.015990911300303, -0.020460398056416, -0.024814953581808, -0.029054577876480, -0.033179270940431, -0.037189032773661, -0.041083865784858, -0.044863769974021, -0.048528745341151 // 0x560
+, -0.052078791886247, -0.055513909609310, -0.058835429736145, -0.062043352266754, -0.065137677201137, -0.068118404539292, -0.070985534281220, -0.073741674182282, -0.076386824242475, -0.078920984461802, -0.081344154840261, -0.083656335377852, -0.085861332395699, -0.087959145893801, -0.089949775872158, -0.091833222330771 // 0x576
+, -0.093609485269639, -0.095283487265087, -0.096855228317116, -0.098324708425725, -0.099691927590914, -0.100956885812684, -0.102125512701437, -0.103197808257173, -0.104173772479893, -0.105053405369596, -0.105836706926283, -0.106530497057547, -0.107134775763389, -0.107649543043808, -0.108074798898806, -0.108410543328381 // 0x592
+, -0.108664353669758, -0.108836229922936, -0.108926172087917, -0.108934180164699, -0.108860254153282, -0.108712595421073, -0.108491203968072, -0.108196079794277, -0.107827222899690, -0.107384633284310, -0.106876993314659, -0.106304302990736, -0.105666562312541, -0.104963771280076, -0.104195929893339, -0.103372058510863 // 0x608
+, -0.102492157132648, -0.101556225758693, -0.100564264389001, -0.099516273023569, -0.098421456195368, -0.097279813904399, -0.096091346150661, -0.094856052934155, -0.093573934254880, -0.092254230297429, -0.090896941061802, -0.089502066548000, -0.088069606756021, -0.086599561685867, -0.085101089925539, -0.083574191475038 // 0x624
+, -0.082018866334364, -0.080435114503516, -0.078822935982494, -0.077191246188757, -0.075540045122304, -0.073869332783134, -0.072179109171248, -0.070469374286647, -0.068748693830815, -0.067017067803752, -0.065274496205460, -0.063520979035937, -0.061756516295184, -0.059989201229140, -0.058219033837806, -0.056446014121182 // 0x640
+, -0.054670142079268, -0.052891417712064, -0.051117363929332, -0.049347980731073, -0.047583268117287, -0.045823226087973, -0.044067854643133, -0.042324016375911, -0.040591711286307, -0.038870939374323, -0.037161700639957, -0.035463995083210, -0.033783951883208, -0.032121571039952, -0.030476852553442, -0.028849796423677 // 0x656
+, -0.027240402650658, -0.025654011929981, -0.024090624261646, -0.022550239645653, -0.021032858082002, -0.019538479570693, -0.018071603487574, -0.016632229832643, -0.015220358605902, -0.013835989807350, -0.012479123436987, -0.011153436598714, -0.009858929292530, -0.008595601518435, -0.007363453276429, -0.006162484566513 // 0x672
+, -0.004995444896851, -0.003862334267444, -0.002763152678292, -0.001697900129395, -0.000666576620752, 0.000328884584767, 0.001288483487162, 0.002212220086434, 0.003100094382582, 0.003952106375607, 0.004767163358457, 0.005545265331135, 0.006286412293639, 0.006990604245969, 0.007657841188126, 0.008287850116136 // 0x688
+, 0.008880631029999, 0.009436183929716, 0.009954508815286, 0.010435605686708, 0.010879958779693, 0.011287568094240, 0.011658433630348, 0.011992555388018, 0.012289933367250, 0.012551756931537, 0.012778026080877, 0.012968740815272, 0.013123901134721, 0.013243507039223, 0.013329373123953, 0.013381499388909 // 0x704
+, 0.013399885834091, 0.013384532459500, 0.013335439265135, 0.013254982743079, 0.013143162893330, 0.012999979715889, 0.012825433210756, 0.012619523377932, 0.012385097231739, 0.012122154772180, 0.011830695999253, 0.011510720912959, 0.011162229513297, 0.010788468303046, 0.010389437282205, 0.009965136450775 // 0x720
+, 0.009515565808754, 0.009040725356144, 0.008544157090181, 0.008025861010864, 0.007485837118194, 0.006924085412171, 0.006340605892794, 0.005739164619165, 0.005119761591285, 0.004482396809154, 0.003827070272770, 0.003153781982136, 0.002466420212501, 0.001764984963867, 0.001049476236233, 0.000319894029598 // 0x736
+, -0.000423761656035, -0.001177556121876, -0.001941489367923, -0.002715561394177, -0.003499772200638, -0.004294121787305, -0.005094718598819, -0.005901562635182, -0.006714653896391, -0.007533992382449, -0.008359578093354, -0.009187624725719, -0.010018132279543, -0.010851100754827, -0.011686530151572, -0.012524420469776 // 0x752
+, -0.013361170759608, -0.014196781021069, -0.015031251254159, -0.015864581458877, -0.016696771635224, -0.017524455346234, -0.018347632591906, -0.019166303372241, -0.019980467687239, -0.020790125536900, -0.021592210964584, -0.022386723970292, -0.023173664554023, -0.023953032715778, -0.024724828455556, -0.025486312475636 // 0x768
+, -0.026237484776017, -0.026978345356699, -0.027708894217683, -0.028429131358968, -0.029136687816836, -0.029831563591286, -0.030513758682320, -0.031183273089936, -0.031840106814135, -0.032482277131845, -0.033109784043064, -0.033722627547793, -0.034320807646032, -0.034904324337781, -0.035471614768542, -0.036022678938313 // 0x784
+, -0.036557516847096, -0.037076128494890, -0.037578513881695, -0.038063501357455, -0.038531090922168, -0.038981282575836, -0.039414076318457, -0.039829472150033, -0.040226730226485, -0.040605850547812, -0.040966833114016, -0.041309677925095, -0.041634384981051, -0.041940584541442, -0.042228276606268, -0.042497461175530 // 0x800
+, -0.042748138249227, -0.042980307827360, -0.043194008461438, -0.043389240151461, -0.043566002897429, -0.043724296699343, -0.043864121557202, -0.043985829254055, -0.044089419789903, -0.044174893164745, -0.044242249378581, -0.044291488431412, -0.044323331670871, -0.044337779096959, -0.044334830709677, -0.044314486509023 // 0x816
+, -0.044276746494997, -0.044222541326107, -0.044151871002352, -0.044064735523732, -0.043961134890247, -0.043841069101897, -0.043705839473931, -0.043555446006348, -0.043389888699150, -0.043209167552335, -0.043013282565904, -0.042803626557120, -0.042580199525983, -0.042343001472493, -0.042092032396650, -0.041827292298454 // 0x832
+, -0.041550291455629, -0.041261029868176, -0.040959507536093, -0.040645724459382, -0.040319680638042, -0.039983183480158, -0.039636232985729, -0.039278829154756, -0.038910971987239, -0.038532661483178, -0.038145646149333, -0.037749925985704, -0.037345500992291, -0.036932371169095, -0.036510536516115, -0.036081835283853 // 0x848
+, -0.035646267472308, -0.035203833081481, -0.034754532111371, -0.034298364561979, -0.033837107556491, -0.033370761094907, -0.032899325177226, -0.032422799803448, -0.031941184973575, -0.031456259773109, -0.030968024202052, -0.030476478260402, -0.029981621948161, -0.029483455265328, -0.028983649771703, -0.028482205467287 // 0x864
+, -0.027979122352080, -0.027474400426082, -0.026968039689292, -0.026461643411302, -0.025955211592112, -0.025448744231721, -0.024942241330130, -0.024435702887338, -0.023930577305279, -0.023426864583952, -0.022924564723358, -0.022423677723497, -0.021924203584368, -0.021427469761971, -0.020933476256305, -0.020442223067370 // 0x880
+, -0.019953710195167, -0.019467937639696, -0.018986048590725, -0.018508043048254, -0.018033921012283, -0.017563682482813, -0.017097327459843, -0.016635842033444, -0.016179226203615, -0.015727479970356, -0.015280603333667, -0.014838596293549, -0.014402249390779, -0.013971562625359, -0.013546535997288, -0.013127169506565 // 0x896
+, -0.012713463153192, -0.012306044970509, -0.011904914958517, -0.011510073117216, -0.011121519446606, -0.010739253946687, -0.010363709505292, -0.009994886122422, -0.009632783798077, -0.009277402532256, -0.008928742324959, -0.008587080690862, -0.008252417629962, -0.007924753142261, -0.007604087227759, -0.007290419886455 // 0x912
+, -0.006983852850342, -0.006684386119418, -0.006392019693684, -0.006106753573141, -0.005828587757788, -0.005557492788482, -0.005293468665225, -0.005036515388016, -0.004786632956856, -0.004543821371743, -0.004307903162026, -0.004078878327705, -0.003856746868781, -0.003641508785252, -0.003433164077119, -0.003231429791107 // 0x928
+, -0.003036305927216, -0.002847792485445, -0.002665889465796, -0.002490596868267, -0.002321514222678, -0.002158641529029, -0.002001978787319, -0.001851525997548, -0.001707283159716, -0.001568786377224, -0.001436035650070, -0.001309030978254, -0.001187772361778, -0.001072259800640, -0.000961942882441, -0.000856821607182 // 0x944
+, -0.000756895974862, -0.000662165985481, -0.000572631639040, -0.000487711374042, -0.000407405190486, -0.000331713088373, -0.000260635067702, -0.000194171128474, -0.000131691345493, -0.000073195718757, -0.000018684248267, 0.000031843065978, 0.000078386223976, 0.000121577576466, 0.000161417123448, 0.000197904864921 // 0x960
+, 0.000231040800886, 0.000260824931343, 0.000287908797222, 0.000312292398523, 0.000333975735246, 0.000352958807391, 0.000369241614957, 0.000383455253518, 0.000395599723073, 0.000405675023623, 0.000413681155166, 0.000419618117704, 0.000424115389567, 0.000427172970754, 0.000428790861267, 0.000428969061105 // 0x976
+, 0.000427707570268, 0.000425601713598, 0.000422651491095, 0.000418856902759, 0.000414217948591, 0.000408734628590, 0.000364571173730, 0.000281727584012, 0.000160203859435
+};
+static const double __in_flash() __aligned(8) filter_22050_2[1001] = {
+  1.052968354507507, 1.050054797650897, 1.049472086279575, 1.048831057077295, 1.048131710044056, 1.047374045179859, 1.046558062484703, 1.045683761958588, 1.044981854103707, 1.044452338920061, 1.044095216407648, 1.043910486566468, 1.043898149396523, 1.043776000702604, 1.043544040484713, 1.043202268742848 // 0x0
+, 1.042750685477011, 1.042189290687200, 1.041678653555672, 1.041218774082426, 1.040809652267462, 1.040451288110780, 1.040143681612380, 1.039796962473194, 1.039411130693222, 1.038986186272463, 1.038522129210919, 1.038018959508588, 1.037529002113130, 1.037052257024546, 1.036588724242834, 1.036138403767996 // 0x16
+, 1.035701295600032, 1.035249496216592, 1.034783005617678, 1.034301823803290, 1.033805950773428, 1.033295386528091, 1.032787984009242, 1.032283743216880, 1.031782664151007, 1.031284746811621, 1.030789991198723, 1.030290620769459, 1.029786635523828, 1.029278035461830, 1.028764820583465, 1.028246990888733 // 0x32
+, 1.027731489521625, 1.027218316482141, 1.026707471770280, 1.026198955386043, 1.025692767329430, 1.025187721571362, 1.024683818111840, 1.024181056950863, 1.023679438088432, 1.023178961524546, 1.022683168775744, 1.022192059842024, 1.021705634723387, 1.021223893419833, 1.020746835931362, 1.020275394575591 // 0x48
+, 1.019809569352522, 1.019349360262154, 1.018894767304486, 1.018445790479519, 1.018004883288319, 1.017572045730885, 1.017147277807218, 1.016730579517318, 1.016321950861184, 1.015922884666850, 1.015533380934315, 1.015153439663581, 1.014783060854646, 1.014422244507512, 1.014072926130744, 1.013735105724342 // 0x64
+, 1.013408783288307, 1.013093958822639, 1.012790632327338, 1.012500269221420, 1.012222869504884, 1.011958433177732, 1.011706960239962, 1.011468450691576, 1.011244344682400, 1.011034642212436, 1.010839343281682, 1.010658447890139, 1.010491956037807, 1.010340936813744, 1.010205390217951, 1.010085316250428 // 0x80
+, 1.009980714911174, 1.009891586200190, 1.009818795547782, 1.009762342953951, 1.009722228418696, 1.009698451942018, 1.009691013523916, 1.009700383839040, 1.009726562887389, 1.009769550668963, 1.009829347183762, 1.009905952431787, 1.009999481473318, 1.010109934308355, 1.010237310936899, 1.010381611358948 // 0x96
+, 1.010542835574504, 1.010720758147918, 1.010915379079190, 1.011126698368321, 1.011354716015309, 1.011599432020156, 1.011860197661416, 1.012137012939090, 1.012429877853176, 1.012738792403675, 1.013063756590588, 1.013403749372724, 1.013758770750083, 1.014128820722665, 1.014513899290470, 1.014914006453497 // 0x112
+, 1.015327719592205, 1.015755038706592, 1.016195963796660, 1.016650494862406, 1.017118631903833, 1.017598505255660, 1.018090114917886, 1.018593460890513, 1.019108543173539, 1.019635361766966, 1.020171743182486, 1.020717687420102, 1.021273194479812, 1.021838264361617, 1.022412897065516, 1.022994465186383 // 0x128
+, 1.023582968724218, 1.024178407679021, 1.024780782050791, 1.025390091839529, 1.026003538534431, 1.026621122135496, 1.027242842642724, 1.027868700056116, 1.028498694375671, 1.029129711165488, 1.029761750425568, 1.030394812155911, 1.031028896356516, 1.031664003027383, 1.032296992164560, 1.032927863768047 // 0x144
+, 1.033556617837842, 1.034183254373946, 1.034807773376360, 1.035426851997701, 1.036040490237968, 1.036648688097161, 1.037251445575281, 1.037848762672329, 1.038437294681818, 1.039017041603749, 1.039588003438123, 1.040150180184939, 1.040703571844197, 1.041244845945362, 1.041774002488433, 1.042291041473410 // 0x160
+, 1.042795962900294, 1.043288766769084, 1.043766255154764, 1.044228428057335, 1.044675285476796, 1.045106827413147, 1.045523053866389, 1.045921028044717, 1.046300749948131, 1.046662219576632, 1.047005436930219, 1.047330402008892, 1.047634615476897, 1.047918077334233, 1.048180787580901, 1.048422746216901 // 0x176
+, 1.048643953242232, 1.048842218306388, 1.049017541409369, 1.049169922551173, 1.049299361731803, 1.049405858951257, 1.049487638964105, 1.049544701770347, 1.049577047369982, 1.049584675763012, 1.049567586949436, 1.049524476035116, 1.049455343020052, 1.049360187904245, 1.049239010687694, 1.049091811370400 // 0x192
+, 1.048918008814030, 1.048717603018585, 1.048490593984064, 1.048236981710468, 1.047956766197796, 1.047650062335236, 1.047316870122788, 1.046957189560451, 1.046571020648227, 1.046158363386114, 1.045719925181792, 1.045255706035261, 1.044765705946520, 1.044249924915571, 1.043708362942412, 1.043142265316624 // 0x208
+, 1.042551632038206, 1.041936463107158, 1.041296758523480, 1.040632518287173, 1.039945863949868, 1.039236795511565, 1.038505312972264, 1.037751416331965, 1.036975105590668, 1.036179212154848, 1.035363736024504, 1.034528677199636, 1.033674035680245, 1.032799811466331, 1.031909444745818, 1.031002935518707 // 0x224
+, 1.030080283784997, 1.029141489544690, 1.028186552797784, 1.027219288610680, 1.026239696983378, 1.025247777915878, 1.024243531408179, 1.023226957460283, 1.022202729686854, 1.021170848087893, 1.020131312663398, 1.019084123413371, 1.018029280337812, 1.016971814018132, 1.015911724454331, 1.014849011646410 // 0x240
+, 1.013783675594369, 1.012715716298208, 1.011650359457937, 1.010587605073557, 1.009527453145068, 1.008469903672469, 1.007414956655761, 1.006368157859228, 1.005329507282869, 1.004299004926685, 1.003276650790675, 1.002262444874840, 1.001262231933757, 1.000276011967427, 0.999303784975849, 0.998345550959023 // 0x256
+, 0.997401309916949, 0.996476645590243, 0.995571557978904, 0.994686047082932, 0.993820112902327, 0.992973755437089, 0.992152466884171, 0.991356247243571, 0.990585096515292, 0.989839014699331, 0.989118001795690, 0.988427416455376, 0.987767258678389, 0.987137528464729, 0.986538225814396, 0.985969350727390 // 0x272
+, 0.985435619677464, 0.984937032664618, 0.984473589688850, 0.984045290750163, 0.983652135848555, 0.983298310707753, 0.982983815327757, 0.982708649708568, 0.982472813850185, 0.982276307752609, 0.982122657348198, 0.982011862636954, 0.981943923618877, 0.981918840293965, 0.981936612662221, 0.981999952630136 // 0x288
+, 0.982108860197712, 0.982263335364948, 0.982463378131845, 0.982708988498402, 0.983001712835496, 0.983341551143128, 0.983728503421298, 0.984162569670005, 0.984643749889250, 0.985172909091197, 0.985750047275846, 0.986375164443197, 0.987048260593250, 0.987769335726005, 0.988537714908528, 0.989353398140819 // 0x304
+, 0.990216385422878, 0.991126676754706, 0.992084272136301, 0.993087561416628, 0.994136544595687, 0.995231221673477, 0.996371592649998, 0.997557657525251, 0.998786464060039, 1.000058012254361, 1.001372302108218, 1.002729333621609, 1.004129106794535, 1.005567462051985, 1.007044399393958, 1.008559918820454 // 0x320
+, 1.010114020331474, 1.011706703927017, 1.013332437029215, 1.014991219638068, 1.016683051753575, 1.018407933375737, 1.020165864504553, 1.021950428417693, 1.023761625115158, 1.025599454596946, 1.027463916863058, 1.029355011913495, 1.031264765219254, 1.033193176780335, 1.035140246596738, 1.037105974668464 // 0x336
+, 1.039090360995512, 1.041084704972965, 1.043089006600822, 1.045103265879083, 1.047127482807749, 1.049161657386819, 1.051195966920730, 1.053230411409483, 1.055264990853077, 1.057299705251512, 1.059334554604788, 1.061358944202720, 1.063372874045309, 1.065376344132553, 1.067369354464454, 1.069351905041011 // 0x352
+, 1.071312845682764, 1.073252176389711, 1.075169897161853, 1.077066007999191, 1.078940508901724, 1.080781664397020, 1.082589474485081, 1.084363939165906, 1.086105058439495, 1.087812832305848, 1.089475290716673, 1.091092433671972, 1.092664261171743, 1.094190773215987, 1.095671969804704, 1.097095814024560 // 0x368
+, 1.098462305875555, 1.099771445357689, 1.101023232470963, 1.102217667215375, 1.103342819883686, 1.104398690475896, 1.105385278992006, 1.106302585432015, 1.107150609795924, 1.107917806476835, 1.108604175474748, 1.109209716789665, 1.109734430421584, 1.110178316370506, 1.110530442033190, 1.110790807409635 // 0x384
+, 1.110959412499841, 1.111036257303809, 1.111021341821538, 1.110904384052505, 1.110685383996709, 1.110364341654151, 1.109941257024830, 1.109416130108746, 1.108779854855594, 1.108032431265373, 1.107173859338083, 1.106204139073725, 1.105123270472298, 1.103923118010244, 1.102603681687565, 1.101164961504259 // 0x400
+, 1.099606957460326, 1.097929669555768, 1.096126525127063, 1.094197524174212, 1.092142666697215, 1.089961952696072, 1.087655382170783, 1.085217842184162, 1.082649332736209, 1.079949853826925, 1.077119405456308, 1.074157987624361, 1.071061948070855, 1.067831286795793, 1.064466003799172, 1.060966099080995 // 0x416
+, 1.057331572641259, 1.053560921985073, 1.049654147112436, 1.045611248023348, 1.041432224717809, 1.037117077195820, 1.032665664091829, 1.028077985405838, 1.023354041137846, 1.018493831287854, 1.013497355855861, 1.008366773873431, 1.003102085340563, 0.997703290257259, 0.992170388623517, 0.986503380439338 // 0x432
+, 0.980705960023329, 0.974778127375491, 0.968719882495822, 0.962531225384323, 0.956212156040994, 0.949768446017539, 0.943200095313957, 0.936507103930249, 0.929689471866415, 0.922747199122455, 0.915687833932492, 0.908511376296527, 0.901217826214560, 0.893807183686590, 0.886279448712618, 0.878643817295033 // 0x448
+, 0.870900289433835, 0.863048865129024, 0.855089544380601, 0.847022327188564, 0.838858111376289, 0.830596896943773, 0.822238683891018, 0.813783472218024, 0.805231261924790, 0.796594258324208, 0.787872461416277, 0.779065871200997, 0.770174487678368, 0.761198310848391, 0.752150998462543, 0.743032550520824 // 0x464
+, 0.733842967023234, 0.724582247969773, 0.715250393360442, 0.705862050666867, 0.696417219889049, 0.686915901026989, 0.677358094080684, 0.667743799050137, 0.658088434916397, 0.648392001679465, 0.638654499339341, 0.628875927896024, 0.619056287349515, 0.609211874872297, 0.599342690464369, 0.589448734125732 // 0x480
+, 0.579530005856385, 0.569586505656330, 0.559634628526971, 0.549674374468308, 0.539705743480343, 0.529728735563074, 0.519743350716501, 0.509766342799232, 0.499797711811266, 0.489837457752604, 0.479885580623245, 0.469942080423189, 0.460023352153843, 0.450129395815206, 0.440260211407278, 0.430415798930060 // 0x496
+, 0.420596158383551, 0.410817586940234, 0.401080084600109, 0.391383651363177, 0.381728287229438, 0.372113992198890, 0.362556185252586, 0.353054866390525, 0.343610035612708, 0.334221692919133, 0.324889838309802, 0.315629119256341, 0.306439535758751, 0.297321087817032, 0.288273775431184, 0.279297598601207 // 0x512
+, 0.270406215078578, 0.261599624863298, 0.252877827955367, 0.244240824354785, 0.235688614061551, 0.227233402388557, 0.218875189335802, 0.210613974903287, 0.202449759091011, 0.194382541898974, 0.186423221150551, 0.178571796845740, 0.170828268984542, 0.163192637566957, 0.155664902592985, 0.148254260065015 // 0x528
+, 0.140960709983048, 0.133784252347083, 0.126724887157120, 0.119782614413160, 0.112964982349326, 0.106271990965618, 0.099703640262036, 0.093259930238581, 0.086940860895252, 0.080752203783753, 0.074693958904085, 0.068766126256246, 0.062968705840237, 0.057301697656058, 0.051768796022316, 0.046370000939012 // 0x544
+, 0.041105312406144, 0.035974730423714, 0.030978254991721, 0.026118045141729, 0.021394100873737, 0.016806422187746, 0.012355009083755, 0.008039861561766, 0.003860838256227, -0.000182060832861, -0.004088835705498, -0.007859486361684, -0.011494012801420, -0.014993917519597, -0.018359200516218, -0.021589861791280 // 0x560
+, -0.024685901344786, -0.027647319176734, -0.030477767547350, -0.033177246456634, -0.035745755904587, -0.038183295891208, -0.040489866416497, -0.042670580417641, -0.044725437894638, -0.046654438847488, -0.048457583276193, -0.050134871180752, -0.051692875224684, -0.053131595407990, -0.054451031730669, -0.055651184192723 // 0x576
+, -0.056732052794150, -0.057701773058509, -0.058560344985798, -0.059307768576019, -0.059944043829172, -0.060469170745255, -0.060892255374576, -0.061213297717134, -0.061432297772930, -0.061549255541963, -0.061564171024234, -0.061487326220266, -0.061318721130059, -0.061058355753614, -0.060706230090931, -0.060262344142009 // 0x592
+, -0.059737630510090, -0.059132089195173, -0.058445720197260, -0.057678523516349, -0.056830499152440, -0.055913192712431, -0.054926604196322, -0.053870733604111, -0.052745580935800, -0.051551146191388, -0.050299359078115, -0.048990219595981, -0.047623727744985, -0.046199883525129, -0.044718686936412, -0.043192174892168 // 0x608
+, -0.041620347392397, -0.040003204437098, -0.038340746026273, -0.036632972159920, -0.034891852886331, -0.033117388205506, -0.031309578117445, -0.029468422622149, -0.027593921719616, -0.025697810882278, -0.023780090110136, -0.021840759403189, -0.019879818761436, -0.017897268184879, -0.015904257852978, -0.013900787765733 // 0x624
+, -0.011886857923145, -0.009862468325213, -0.007827618971937, -0.005792904573502, -0.003758325129908, -0.001723880641155, 0.000310428892756, 0.002344603471826, 0.004368820400492, 0.006383079678753, 0.008387381306610, 0.010381725284063, 0.012366111611111, 0.014331839682837, 0.016278909499240, 0.018207321060321 // 0x640
+, 0.020117074366080, 0.022008169416516, 0.023872631682629, 0.025710461164417, 0.027521657861882, 0.029306221775022, 0.031064152903838, 0.032789034526000, 0.034480866641507, 0.036139649250359, 0.037765382352557, 0.039358065948101, 0.040912167459121, 0.042427686885617, 0.043904624227590, 0.045342979485040 // 0x656
+, 0.046742752657966, 0.048099784171357, 0.049414074025214, 0.050685622219536, 0.051914428754324, 0.053100493629577, 0.054240864606098, 0.055335541683888, 0.056384524862947, 0.057387814143274, 0.058345409524869, 0.059255700856696, 0.060118688138756, 0.060934371371047, 0.061702750553570, 0.062423825686325 // 0x672
+, 0.063096921836378, 0.063722039003729, 0.064299177188378, 0.064828336390325, 0.065309516609569, 0.065743582858277, 0.066130535136447, 0.066470373444079, 0.066763097781173, 0.067008708147730, 0.067208750914627, 0.067363226081863, 0.067472133649439, 0.067535473617354, 0.067553245985609, 0.067528162660698 // 0x688
+, 0.067460223642621, 0.067349428931377, 0.067195778526966, 0.066999272429390, 0.066763436571007, 0.066488270951818, 0.066173775571822, 0.065819950431020, 0.065426795529412, 0.064998496590724, 0.064535053614957, 0.064036466602111, 0.063502735552184, 0.062933860465179, 0.062334557814846, 0.061704827601186 // 0x704
+, 0.061044669824199, 0.060354084483885, 0.059633071580244, 0.058886989764283, 0.058115839036004, 0.057319619395404, 0.056498330842486, 0.055651973377248, 0.054786039196643, 0.053900528300671, 0.052995440689332, 0.052070776362626, 0.051126535320552, 0.050168301303726, 0.049196074312148, 0.048209854345818 // 0x720
+, 0.047209641404735, 0.046195435488900, 0.045173081352890, 0.044142578996706, 0.043103928420347, 0.042057129623814, 0.041002182607106, 0.039944633134507, 0.038884481206018, 0.037821726821638, 0.036756369981367, 0.035688410685206, 0.034623074633165, 0.033560361825244, 0.032500272261444, 0.031442805941764 // 0x736
+, 0.030387962866204, 0.029340773616177, 0.028301238191683, 0.027269356592721, 0.026245128819292, 0.025228554871396, 0.024224308363697, 0.023232389296197, 0.022252797668895, 0.021285533481791, 0.020330596734885, 0.019391802494578, 0.018469150760868, 0.017562641533757, 0.016672274813244, 0.015798050599330 // 0x752
+, 0.014943409079939, 0.014108350255071, 0.013292874124727, 0.012496980688907, 0.011720669947610, 0.010966773307311, 0.010235290768010, 0.009526222329707, 0.008839567992402, 0.008175327756095, 0.007535623172417, 0.006920454241369, 0.006329820962951, 0.005763723337163, 0.005222161364004, 0.004706380333055 // 0x768
+, 0.004216380244314, 0.003752161097783, 0.003313722893461, 0.002901065631348, 0.002514896719124, 0.002155216156787, 0.001822023944339, 0.001515320081779, 0.001235104569107, 0.000981492295511, 0.000754483260990, 0.000554077465545, 0.000380274909175, 0.000233075591881, 0.000111898375330, 0.000016743259523 // 0x784
+, -0.000052389755541, -0.000095500669861, -0.000112589483437, -0.000104961090408, -0.000072615490772, -0.000015552684530, 0.000066227328318, 0.000172724547772, 0.000302163728401, 0.000454544870206, 0.000629867973187, 0.000828133037342, 0.001049340062674, 0.001291298698673, 0.001554008945342, 0.001837470802678 // 0x800
+, 0.002141684270683, 0.002466649349356, 0.002809866702943, 0.003171336331444, 0.003551058234858, 0.003949032413186, 0.004365258866427, 0.004796800802779, 0.005243658222240, 0.005705831124810, 0.006183319510491, 0.006676123379281, 0.007181044806165, 0.007698083791142, 0.008227240334213, 0.008768514435378 // 0x816
+, 0.009321906094636, 0.009884082841452, 0.010455044675826, 0.011034791597757, 0.011623323607247, 0.012220640704294, 0.012823398182414, 0.013431596041608, 0.014045234281875, 0.014664312903215, 0.015288831905629, 0.015915468441733, 0.016544222511529, 0.017175094115015, 0.017808083252192, 0.018443189923060 // 0x832
+, 0.019077274123665, 0.019710335854007, 0.020342375114087, 0.020973391903905, 0.021603386223459, 0.022229243636851, 0.022850964144079, 0.023468547745144, 0.024081994440046, 0.024691304228784, 0.025293678600555, 0.025889117555357, 0.026477621093192, 0.027059189214059, 0.027633821917959, 0.028198891799763 // 0x848
+, 0.028754398859473, 0.029300343097089, 0.029836724512610, 0.030363543106036, 0.030878625389062, 0.031381971361689, 0.031873581023916, 0.032353454375742, 0.032821591417169, 0.033276122482916, 0.033717047572983, 0.034144366687370, 0.034558079826078, 0.034958186989106, 0.035343265556910, 0.035713315529492 // 0x864
+, 0.036068336906851, 0.036408329688987, 0.036733293875900, 0.037042208426399, 0.037335073340486, 0.037611888618159, 0.037872654259419, 0.038117370264266, 0.038345387911254, 0.038556707200385, 0.038751328131657, 0.038929250705071, 0.039090474920627, 0.039234775342676, 0.039362151971220, 0.039472604806257 // 0x880
+, 0.039566133847788, 0.039642739095813, 0.039702535610612, 0.039745523392186, 0.039771702440535, 0.039781072755659, 0.039773634337557, 0.039749857860879, 0.039709743325625, 0.039653290731793, 0.039580500079386, 0.039491371368401, 0.039386770029147, 0.039266696061624, 0.039131149465831, 0.038980130241768 // 0x896
+, 0.038813638389436, 0.038632742997893, 0.038437444067140, 0.038227741597175, 0.038003635587999, 0.037765126039613, 0.037513653101844, 0.037249216774691, 0.036971817058156, 0.036681453952237, 0.036378127456936, 0.036063302991268, 0.035736980555233, 0.035399160148832, 0.035049841772064, 0.034689025424929 // 0x912
+, 0.034318646615994, 0.033938705345260, 0.033549201612726, 0.033150135418391, 0.032741506762257, 0.032324808472357, 0.031900040548690, 0.031467202991256, 0.031026295800056, 0.030577318975089, 0.030122726017422, 0.029662516927053, 0.029196691703984, 0.028725250348213, 0.028248192859742, 0.027766451556188 // 0x928
+, 0.027280026437551, 0.026788917503831, 0.026293124755029, 0.025792648191143, 0.025291029328712, 0.024788268167735, 0.024284364708213, 0.023779318950145, 0.023273130893532, 0.022764614509295, 0.022253769797434, 0.021740596757950, 0.021225095390842, 0.020707265696110, 0.020194050817745, 0.019685450755747 // 0x944
+, 0.019181465510116, 0.018682095080851, 0.018187339467954, 0.017689422128568, 0.017188343062695, 0.016684102270333, 0.016176699751484, 0.015666135506147, 0.015170262476285, 0.014689080661897, 0.014222590062983, 0.013770790679544, 0.013333682511579, 0.012883362036741, 0.012419829255029, 0.011943084166445 // 0x960
+, 0.011453126770987, 0.010949957068657, 0.010485900007112, 0.010060955586354, 0.009675123806381, 0.009328404667195, 0.009020798168795, 0.008662434012113, 0.008253312197149, 0.007793432723903, 0.007282795592375, 0.006721400802564, 0.006269817536727, 0.005928045794863, 0.005696085576971, 0.005573936883053 // 0x976
+, 0.005561599713107, 0.005376869871928, 0.005019747359515, 0.004490232175868, 0.003788324320987, 0.002914023794873, 0.002098041099717, 0.001340376235519, 0.000641029202280
+};
+static const double __in_flash() __aligned(8) filter_44100_0[601] = {
+  0.980043363308278, 0.979855473172802, 0.979817895145707, 0.979780180987537, 0.979742330698292, 0.979704344277972, 0.979666221726576, 0.979627963044106, 0.979586552226166, 0.979541989272757, 0.979494274183879, 0.979443406959532, 0.979389387599715, 0.979332085498985, 0.979271500657342, 0.979207633074786 // 0x0
+, 0.979140482751316, 0.979070049686933, 0.978996573125103, 0.978920053065826, 0.978840489509102, 0.978757882454930, 0.978672231903312, 0.978584247152131, 0.978493928201388, 0.978401275051083, 0.978306287701216, 0.978208966151786, 0.978110559796174, 0.978011068634378, 0.977910492666399, 0.977808831892237 // 0x16
+, 0.977706086311891, 0.977604077906136, 0.977502806674971, 0.977402272618397, 0.977302475736414, 0.977203416029021, 0.977107464517874, 0.977014621202973, 0.976924886084317, 0.976838259161907, 0.976754740435743, 0.976677168687587, 0.976605543917438, 0.976539866125297, 0.976480135311164, 0.976426351475039 // 0x32
+, 0.976381665026144, 0.976346075964478, 0.976319584290042, 0.976302190002836, 0.976293893102859, 0.976297931236922, 0.976314304405024, 0.976343012607164, 0.976384055843344, 0.976437434113564, 0.976506185394811, 0.976590309687086, 0.976689806990389, 0.976804677304719, 0.976934920630078, 0.977083052848182 // 0x48
+, 0.977249073959031, 0.977432983962626, 0.977634782858966, 0.977854470648052, 0.978093695652295, 0.978352457871695, 0.978630757306252, 0.978928593955967, 0.979245967820840, 0.979583319381075, 0.979940648636674, 0.980317955587636, 0.980715240233961, 0.981132502575649, 0.981568670241593, 0.982023743231793 // 0x64
+, 0.982497721546249, 0.982990605184961, 0.983502394147928, 0.984030292308394, 0.984574299666359, 0.985134416221821, 0.985710641974782, 0.986302976925241, 0.986906803388579, 0.987522121364794, 0.988148930853888, 0.988787231855860, 0.989437024370711, 0.990091904320401, 0.990751871704930, 0.991416926524299 // 0x80
+, 0.992087068778507, 0.992762298467555, 0.993434619729805, 0.994104032565258, 0.994770536973912, 0.995434132955769, 0.996094820510828, 0.996743412362637, 0.997379908511197, 0.998004308956507, 0.998616613698568, 0.999216822737379, 0.999795094849328, 1.000351430034413, 1.000885828292636, 1.001398289623996 // 0x96
+, 1.001888814028493, 1.002347590683634, 1.002774619589420, 1.003169900745851, 1.003533434152925, 1.003865219810645, 1.004156313909802, 1.004406716450397, 1.004616427432429, 1.004785446855900, 1.004913774720808, 1.004994164419583, 1.005026615952223, 1.005011129318728, 1.004947704519100, 1.004836341553337 // 0x112
+, 1.004672380243771, 1.004455820590400, 1.004186662593226, 1.003864906252247, 1.003490551567465, 1.003062284684099, 1.002580105602149, 1.002044014321616, 1.001454010842500, 1.000810095164800, 1.000114931039789, 0.999368518467466, 0.998570857447833, 0.997721947980889, 0.996821790066634, 0.995877406121944 // 0x128
+, 0.994888796146820, 0.993855960141260, 0.992778898105266, 0.991657610038837, 0.990503577256816, 0.989316799759203, 0.988097277545998, 0.986845010617200, 0.985559998972810, 0.984257927555230, 0.982938796364459, 0.981602605400497, 0.980249354663344, 0.978879044153001, 0.977510944724824, 0.976145056378813 // 0x144
+, 0.974781379114969, 0.973419912933290, 0.972060657833778, 0.970725473818079, 0.969414360886193, 0.968127319038120, 0.966864348273860, 0.965625448593413, 0.964433742843231, 0.963289231023315, 0.962191913133664, 0.961141789174278, 0.960138859145158, 0.959205893440531, 0.958342892060396, 0.957549855004753 // 0x160
+, 0.956826782273604, 0.956173673866946, 0.955611141698584, 0.955139185768517, 0.954757806076744, 0.954467002623266, 0.954266775408083, 0.954173688012757, 0.954187740437288, 0.954308932681675, 0.954537264745919, 0.954872736630019, 0.955326029571703, 0.955897143570971, 0.956586078627823, 0.957392834742257 // 0x176
+, 0.958317411914276, 0.959362953591370, 0.960529459773541, 0.961816930460787, 0.963225365653108, 0.964754765350506, 0.966399410390508, 0.968159300773113, 0.970034436498323, 0.972024817566138, 0.974130443976556, 0.976335858056124, 0.978641059804843, 0.981046049222712, 0.983550826309732, 0.986155391065901 // 0x192
+, 0.988834228149538, 0.991587337560642, 0.994414719299213, 0.997316373365252, 1.000292299758758, 1.003307228698915, 1.006361160185725, 1.009454094219186, 1.012586030799299, 1.015756969926063, 1.018922864957736, 1.022083715894315, 1.025239522735803, 1.028390285482198, 1.031536004133500, 1.034625468874969 // 0x208
+, 1.037658679706604, 1.040635636628405, 1.043556339640372, 1.046420788742506, 1.049172830580150, 1.051812465153306, 1.054339692461972, 1.056754512506149, 1.059056925285838, 1.061188547114248, 1.063149377991381, 1.064939417917236, 1.066558666891813, 1.068007124915112, 1.069227236456246, 1.070219001515216 // 0x224
+, 1.070982420092021, 1.071517492186661, 1.071824217799137, 1.071849113533876, 1.071592179390879, 1.071053415370146, 1.070232821471677, 1.069130397695471, 1.067699951244346, 1.065941482118301, 1.063854990317337, 1.061440475841452, 1.058697938690649, 1.055591478805058, 1.052121096184681, 1.048286790829517 // 0x240
+, 1.044088562739567, 1.039526411914830, 1.034577307801024, 1.029241250398148, 1.023518239706202, 1.017408275725187, 1.010911358455102, 1.004019304630686, 0.996732114251941, 0.989049787318864, 0.980972323831458, 0.972499723789721, 0.963639878798641, 0.954392788858219, 0.944758453968454, 0.934736874129346 // 0x256
+, 0.924328049340895, 0.913556329461076, 0.902421714489888, 0.890924204427331, 0.879063799273405, 0.866840499028111, 0.854294586907992, 0.841426062913049, 0.828234927043281, 0.814721179298688, 0.800884819679270, 0.786780653507649, 0.772408680783823, 0.757768901507793, 0.742861315679559, 0.727685923299120 // 0x272
+, 0.712309805215058, 0.696732961427371, 0.680955391936061, 0.664977096741126, 0.648798075842568, 0.632494730712446, 0.616067061350762, 0.599515067757514, 0.582838749932703, 0.566038107876330, 0.549195364135973, 0.532310518711632, 0.515383571603307, 0.498414522810999, 0.481403372334707, 0.464434323542399 // 0x288
+, 0.447507376434075, 0.430622531009734, 0.413779787269376, 0.396979145213003, 0.380302827388192, 0.363750833794945, 0.347323164433260, 0.331019819303139, 0.314840798404580, 0.298862503209646, 0.283084933718335, 0.267508089930649, 0.252131971846586, 0.236956579466148, 0.222048993637913, 0.207409214361883 // 0x304
+, 0.193037241638058, 0.178933075466436, 0.165096715847019, 0.151582968102426, 0.138391832232658, 0.125523308237714, 0.112977396117595, 0.100754095872301, 0.088893690718375, 0.077396180655818, 0.066261565684630, 0.055489845804811, 0.045081021016360, 0.035059441177252, 0.025425106287487, 0.016178016347065 // 0x320
+, 0.007318171355985, -0.001154428685752, -0.009231892173158, -0.016914219106234, -0.024201409484980, -0.031093463309395, -0.037590380579480, -0.043700344560496, -0.049423355252441, -0.054759412655318, -0.059708516769124, -0.064270667593861, -0.068468895683811, -0.072303201038975, -0.075773583659352, -0.078880043544942 // 0x336
+, -0.081622580695746, -0.084037095171630, -0.086123586972595, -0.087882056098640, -0.089312502549765, -0.090414926325970, -0.091235520224440, -0.091774284245173, -0.092031218388170, -0.092006322653430, -0.091699597040955, -0.091164524946315, -0.090401106369510, -0.089409341310540, -0.088189229769406, -0.086740771746106 // 0x352
+, -0.085121522771529, -0.083331482845675, -0.081370651968542, -0.079239030140131, -0.076936617360443, -0.074521797316266, -0.071994570007599, -0.069354935434444, -0.066602893596799, -0.063738444494666, -0.060817741482699, -0.057840784560898, -0.054807573729263, -0.051718108987794, -0.048572390336491, -0.045421627590096 // 0x368
+, -0.042265820748609, -0.039104969812029, -0.035939074780357, -0.032768135653592, -0.029636199073479, -0.026543265040018, -0.023489333553209, -0.020474404613051, -0.017498478219545, -0.014596824153507, -0.011769442414935, -0.009016333003831, -0.006337495920195, -0.003732931164025, -0.001228154077006, 0.001176835340863 // 0x384
+, 0.003482037089582, 0.005687451169151, 0.007793077579569, 0.009783458647383, 0.011658594372593, 0.013418484755199, 0.015063129795201, 0.016592529492598, 0.018000964684920, 0.019288435372166, 0.020454941554336, 0.021500483231430, 0.022425060403449, 0.023231816517884, 0.023920751574735, 0.024491865574003 // 0x400
+, 0.024945158515687, 0.025280630399788, 0.025508962464032, 0.025630154708419, 0.025644207132949, 0.025551119737623, 0.025350892522440, 0.025060089068963, 0.024678709377190, 0.024206753447122, 0.023644221278760, 0.022991112872103, 0.022268040140953, 0.021475003085311, 0.020612001705176, 0.019679036000548 // 0x416
+, 0.018676105971428, 0.017625982012043, 0.016528664122392, 0.015384152302476, 0.014192446552294, 0.012953546871847, 0.011690576107587, 0.010403534259514, 0.009092421327628, 0.007757237311928, 0.006397982212416, 0.005036516030738, 0.003672838766893, 0.002306950420883, 0.000938850992706, -0.000431459517638 // 0x432
+, -0.001784710254790, -0.003120901218752, -0.004440032409523, -0.005742103827104, -0.007027115471493, -0.008279382400291, -0.009498904613496, -0.010685682111110, -0.011839714893131, -0.012961002959560, -0.014038064995554, -0.015070901001113, -0.016059510976238, -0.017003894920927, -0.017904052835183, -0.018752962302127 // 0x448
+, -0.019550623321760, -0.020297035894082, -0.020992200019093, -0.021636115696793, -0.022226119175909, -0.022762210456442, -0.023244389538392, -0.023672656421758, -0.024047011106540, -0.024368767447519, -0.024637925444693, -0.024854485098064, -0.025018446407630, -0.025129809373393, -0.025193234173021, -0.025208720806515 // 0x464
+, -0.025176269273875, -0.025095879575101, -0.024967551710193, -0.024798532286722, -0.024588821304690, -0.024338418764095, -0.024047324664938, -0.023715539007218, -0.023352005600143, -0.022956724443713, -0.022529695537927, -0.022070918882786, -0.021580394478289, -0.021067933146929, -0.020533534888706, -0.019977199703621 // 0x480
+, -0.019398927591672, -0.018798718552861, -0.018186413810800, -0.017562013365490, -0.016925517216930, -0.016276925365120, -0.015616237810061, -0.014952641828205, -0.014286137419550, -0.013616724584098, -0.012944403321848, -0.012269173632800, -0.011599031378592, -0.010933976559223, -0.010274009174694, -0.009619129225004 // 0x496
+, -0.008969336710153, -0.008331035708181, -0.007704226219087, -0.007088908242871, -0.006485081779534, -0.005892746829075, -0.005316521076114, -0.004756404520651, -0.004212397162687, -0.003684499002221, -0.003172710039253, -0.002679826400541, -0.002205848086085, -0.001750775095885, -0.001314607429941, -0.000897345088253 // 0x512
+, -0.000500060441928, -0.000122753490966, 0.000234575764632, 0.000571927324868, 0.000889301189740, 0.001187137839455, 0.001465437274012, 0.001724199493413, 0.001963424497656, 0.002183112286741, 0.002384911183081, 0.002568821186676, 0.002734842297525, 0.002882974515629, 0.003013217840988, 0.003128088155319 // 0x528
+, 0.003227585458621, 0.003311709750896, 0.003380461032143, 0.003433839302363, 0.003474882538543, 0.003503590740684, 0.003519963908785, 0.003524002042848, 0.003515705142871, 0.003498310855665, 0.003471819181229, 0.003436230119563, 0.003391543670668, 0.003337759834543, 0.003278029020410, 0.003212351228269 // 0x544
+, 0.003140726458120, 0.003063154709964, 0.002979635983800, 0.002893009061390, 0.002803273942734, 0.002710430627833, 0.002614479116686, 0.002515419409293, 0.002415622527310, 0.002315088470736, 0.002213817239571, 0.002111808833816, 0.002009063253471, 0.001907402479308, 0.001806826511329, 0.001707335349533 // 0x560
+, 0.001608928993921, 0.001511607444491, 0.001416620094624, 0.001323966944319, 0.001233647993576, 0.001145663242396, 0.001060012690777, 0.000977405636605, 0.000897842079881, 0.000821322020604, 0.000747845458774, 0.000677412394391, 0.000610262070922, 0.000546394488365, 0.000485809646722, 0.000428507545992 // 0x576
+, 0.000374488186175, 0.000323620961828, 0.000275905872950, 0.000231342919541, 0.000189932101601, 0.000151673419131, 0.000113550867736, 0.000075564447415, 0.000037714158170
+};
+static const double __in_flash() __aligned(8) filter_44100_1[801] = {
+  0.990450044180701, 0.990237720367575, 0.990195255604950, 0.990151214366827, 0.990105596653207, 0.990058402464089, 0.990009631799474, 0.989959284659362, 0.989903744771978, 0.989843012137322, 0.989777086755395, 0.989705968626197, 0.989629657749727, 0.989547169025077, 0.989458502452248, 0.989363658031239 // 0x0
+, 0.989262635762051, 0.989155435644682, 0.989041320832341, 0.988920291325027, 0.988792347122739, 0.988657488225479, 0.988515714633245, 0.988366679722638, 0.988210383493657, 0.988046825946302, 0.987876007080573, 0.987697926896471, 0.987512760318059, 0.987320507345337, 0.987121167978307, 0.986914742216967 // 0x16
+, 0.986701230061318, 0.986481441402686, 0.986255376241073, 0.986023034576477, 0.985784416408899, 0.985539521738339, 0.985289861624936, 0.985035436068692, 0.984776245069605, 0.984512288627675, 0.984243566742904, 0.983972302996908, 0.983698497389690, 0.983422149921247, 0.983143260591582, 0.982861829400692 // 0x32
+, 0.982580734032773, 0.982299974487825, 0.982019550765848, 0.981739462866841, 0.981459710790805, 0.981183701915081, 0.980911436239671, 0.980642913764574, 0.980378134489789, 0.980117098415318, 0.979863535270283, 0.979617445054686, 0.979378827768525, 0.979147683411801, 0.978924011984513, 0.978711591310736 // 0x48
+, 0.978510421390468, 0.978320502223710, 0.978141833810462, 0.977974416150724, 0.977821748142742, 0.977683829786517, 0.977560661082048, 0.977452242029335, 0.977358572628379, 0.977282536049469, 0.977224132292607, 0.977183361357791, 0.977160223245023, 0.977154717954301, 0.977168762133411, 0.977202355782351 // 0x64
+, 0.977255498901122, 0.977328191489724, 0.977420433548157, 0.977532862267737, 0.977665477648464, 0.977818279690338, 0.977991268393358, 0.978184443757526, 0.978396927927507, 0.978628720903300, 0.978879822684906, 0.979150233272324, 0.979439952665556, 0.979746476450187, 0.980069804626217, 0.980409937193646 // 0x80
+, 0.980766874152475, 0.981140615502703, 0.981527005830287, 0.981926045135228, 0.982337733417526, 0.982762070677180, 0.983199056914190, 0.983643060622015, 0.984094081800653, 0.984552120450105, 0.985017176570370, 0.985489250161449, 0.985961549503156, 0.986434074595492, 0.986906825438456, 0.987379802032048 // 0x96
+, 0.987853004376269, 0.988318914529791, 0.988777532492615, 0.989228858264741, 0.989672891846169, 0.990109633236898, 0.990531447881395, 0.990938335779658, 0.991330296931689, 0.991707331337487, 0.992069438997052, 0.992409502756203, 0.992727522614942, 0.993023498573267, 0.993297430631179, 0.993549318788677 // 0x112
+, 0.993773276495217, 0.993969303750796, 0.994137400555416, 0.994277566909076, 0.994389802811776, 0.994470095491662, 0.994518444948734, 0.994534851182992, 0.994519314194436, 0.994471833983065, 0.994390844715198, 0.994276346390836, 0.994128339009978, 0.993946822572624, 0.993731797078775, 0.993484538182069 // 0x128
+, 0.993205045882508, 0.992893320180091, 0.992549361074817, 0.992173168566688, 0.991769050301629, 0.991337006279638, 0.990877036500717, 0.990389140964866, 0.989873319672084, 0.989336832045669, 0.988779678085622, 0.988201857791941, 0.987603371164628, 0.986984218203681, 0.986354262727523, 0.985713504736152 // 0x144
+, 0.985061944229569, 0.984399581207775, 0.983726415670768, 0.983054285031779, 0.982383189290809, 0.981713128447857, 0.981044102502924, 0.980376111456009, 0.979722092378380, 0.979082045270036, 0.978455970130979, 0.977843866961207, 0.977245735760722, 0.976674542423954, 0.976130286950903, 0.975612969341570 // 0x160
+, 0.975122589595954, 0.974659147714056, 0.974234465143852, 0.973848541885342, 0.973501377938526, 0.973192973303405, 0.972923327979977, 0.972701919152571, 0.972528746821184, 0.972403810985819, 0.972327111646473, 0.972298648803149, 0.972324455057313, 0.972404530408967, 0.972538874858109, 0.972727488404741 // 0x176
+, 0.972970371048861, 0.973269213470623, 0.973624015670027, 0.974034777647073, 0.974501499401760, 0.975024180934089, 0.975599583893035, 0.976227708278599, 0.976908554090779, 0.977642121329576, 0.978428409994991, 0.979259046351509, 0.980134030399132, 0.981053362137858, 0.982017041567688, 0.983025068688622 // 0x192
+, 0.984064194388302, 0.985134418666727, 0.986235741523898, 0.987368162959815, 0.988531682974477, 0.989708885716924, 0.990899771187155, 0.992104339385170, 0.993322590310970, 0.994554523964554, 0.995779732774795, 0.996998216741691, 0.998209975865243, 0.999415010145452, 1.000613319582316, 1.001783054528985 // 0x208
+, 1.002924214985459, 1.004036800951737, 1.005120812427819, 1.006176249413706, 1.007181658191444, 1.008137038761033, 1.009042391122472, 1.009897715275763, 1.010703011220905, 1.011439206109953, 1.012106299942907, 1.012704292719768, 1.013233184440534, 1.013692975105208, 1.014068934147430, 1.014361061567200 // 0x224
+, 1.014569357364519, 1.014693821539386, 1.014734454091802, 1.014682638748192, 1.014538375508557, 1.014301664372896, 1.013972505341209, 1.013550898413497, 1.013035739514651, 1.012427028644672, 1.011724765803559, 1.010928950991313, 1.010039584207933, 1.009063945764465, 1.008002035660907, 1.006853853897260 // 0x240
+, 1.005619400473524, 1.004298675389698, 1.002907556759571, 1.001446044583143, 0.999914138860413, 0.998311839591381, 0.996639146776048, 0.994920017665707, 0.993154452260359, 0.991342450560003, 0.989484012564640, 0.987579138274268, 0.985658585400518, 0.983722353943387, 0.981770443902877, 0.979802855278987 // 0x256
+, 0.977819588071717, 0.975856198547487, 0.973912686706297, 0.971989052548146, 0.970085296073035, 0.968201417280963, 0.966375153548847, 0.964606504876686, 0.962895471264480, 0.961242052712230, 0.959646249219935, 0.958144904044792, 0.956738017186802, 0.955425588645964, 0.954207618422279, 0.953084106515747 // 0x272
+, 0.952087683112068, 0.951218348211244, 0.950476101813274, 0.949860943918158, 0.949372874525896, 0.949036995455250, 0.948853306706220, 0.948821808278806, 0.948942500173009, 0.949215382388827, 0.949654986406822, 0.950261312226995, 0.951034359849346, 0.951974129273873, 0.953080620500578, 0.954355284030295 // 0x288
+, 0.955798119863026, 0.957409127998769, 0.959188308437525, 0.961135661179294, 0.963237821128260, 0.965494788284423, 0.967906562647784, 0.970473144218342, 0.973194532996098, 0.976041779525913, 0.979014883807788, 0.982113845841723, 0.985338665627718, 0.988689343165773, 0.992121671471594, 0.995635650545182 // 0x304
+, 0.999231280386537, 1.002908560995659, 1.006667492372548, 1.010450090329214, 1.014256354865656, 1.018086285981876, 1.021939883677872, 1.025817147953645, 1.029648907575046, 1.033435162542075, 1.037175912854733, 1.040871158513019, 1.044520899516933, 1.048048369842278, 1.051453569489054, 1.054736498457260 // 0x320
+, 1.057897156746898, 1.060935544357966, 1.063771682398570, 1.066405570868710, 1.068837209768386, 1.071066599097599, 1.073093738856347, 1.074840342744100, 1.076306410760858, 1.077491942906619, 1.078396939181385, 1.079021399585155, 1.079293834798149, 1.079214244820366, 1.078782629651807, 1.077998989292471 // 0x336
+, 1.076863323742359, 1.075315890689925, 1.073356690135168, 1.070985722078090, 1.068202986518689, 1.065008483456966, 1.061358663018180, 1.057253525202331, 1.052693070009418, 1.047677297439442, 1.042206207492402, 1.036256045858815, 1.029826812538682, 1.022918507532000, 1.015531130838772, 1.007664682458996 // 0x352
+, 0.999317694539499, 0.990490167080279, 0.981182100081338, 0.971393493542675, 0.961124347464290, 0.950396640993985, 0.939210374131761, 0.927565546877618, 0.915462159231555, 0.902900211193573, 0.889924850638212, 0.876536077565471, 0.862733891975350, 0.848518293867851, 0.833889283242972, 0.818913435471960 // 0x368
+, 0.803590750554816, 0.787921228491539, 0.771904869282129, 0.755541672926587, 0.738916529379760, 0.722029438641649, 0.704880400712254, 0.687469415591573, 0.669796483279609, 0.651960506732001, 0.633961485948749, 0.615799420929853, 0.597474311675313, 0.578986158185130, 0.560442657520800, 0.541843809682324 // 0x384
+, 0.523189614669701, 0.504480072482932, 0.485715183122017, 0.467005640935248, 0.448351445922626, 0.429752598084149, 0.411209097419820, 0.392720943929636, 0.374395834675096, 0.356233769656201, 0.338234748872949, 0.320398772325340, 0.302725840013376, 0.285314854892696, 0.268165816963300, 0.251278726225189 // 0x400
+, 0.234653582678362, 0.218290386322820, 0.202274027113411, 0.186604505050134, 0.171281820132989, 0.156305972361978, 0.141676961737099, 0.127461363629599, 0.113659178039479, 0.100270404966738, 0.087295044411376, 0.074733096373394, 0.062629708727331, 0.050984881473188, 0.039798614610964, 0.029070908140660 // 0x416
+, 0.018801762062275, 0.009013155523611, -0.000294911475330, -0.009122438934549, -0.017469426854047, -0.025335875233823, -0.032723251927051, -0.039631556933732, -0.046060790253866, -0.052010951887453, -0.057482041834492, -0.062497814404469, -0.067058269597381, -0.071163407413231, -0.074813227852017, -0.078007730913739 // 0x432
+, -0.080790466473140, -0.083161434530218, -0.085120635084975, -0.086668068137409, -0.087803733687521, -0.088587374046857, -0.089018989215416, -0.089098579193199, -0.088826143980205, -0.088201683576435, -0.087296687301669, -0.086111155155908, -0.084645087139150, -0.082898483251397, -0.080871343492649, -0.078641954163436 // 0x448
+, -0.076210315263760, -0.073576426793619, -0.070740288753015, -0.067701901141947, -0.064541242852310, -0.061258313884103, -0.057853114237328, -0.054325643911983, -0.050675902908069, -0.046980657249783, -0.043239906937125, -0.039453651970096, -0.035621892348695, -0.031744628072922, -0.027891030376925, -0.024061099260706 // 0x464
+, -0.020254834724264, -0.016472236767598, -0.012713305390709, -0.009036024781587, -0.005440394940232, -0.001926415866644, 0.001505912439178, 0.004856589977232, 0.008081409763227, 0.011180371797162, 0.014153476079037, 0.017000722608853, 0.019722111386608, 0.022288692957166, 0.024700467320527, 0.026957434476690 // 0x480
+, 0.029059594425656, 0.031006947167425, 0.032786127606181, 0.034397135741924, 0.035839971574655, 0.037114635104372, 0.038221126331077, 0.039160895755605, 0.039933943377955, 0.040540269198128, 0.040979873216123, 0.041252755431942, 0.041373447326144, 0.041341948898730, 0.041158260149700, 0.040822381079055 // 0x496
+, 0.040334311686793, 0.039719153791677, 0.038976907393706, 0.038107572492882, 0.037111149089204, 0.035987637182671, 0.034769666958986, 0.033457238418148, 0.032050351560158, 0.030549006385016, 0.028953202892721, 0.027299784340471, 0.025588750728265, 0.023820102056104, 0.021993838323988, 0.020109959531916 // 0x512
+, 0.018206203056805, 0.016282568898654, 0.014339057057463, 0.012375667533233, 0.010392400325964, 0.008424811702074, 0.006472901661563, 0.004536670204433, 0.002616117330682, 0.000711243040311, -0.001147194955053, -0.002959196655409, -0.004724762060757, -0.006443891171098, -0.008116583986431, -0.009718883255462 // 0x528
+, -0.011250788978192, -0.012712301154621, -0.014103419784748, -0.015424144868573, -0.016658598292309, -0.017806780055956, -0.018868690159514, -0.019844328602983, -0.020733695386363, -0.021529510198609, -0.022231773039721, -0.022840483909700, -0.023355642808546, -0.023777249736259, -0.024106408767945, -0.024343119903607 // 0x544
+, -0.024487383143242, -0.024539198486852, -0.024498565934436, -0.024374101759568, -0.024165805962249, -0.023873678542479, -0.023497719500257, -0.023037928835584, -0.022509037114817, -0.021911044337956, -0.021243950505002, -0.020507755615954, -0.019702459670813, -0.018847135517522, -0.017941783156082, -0.016986402586493 // 0x560
+, -0.015980993808756, -0.014925556822869, -0.013841545346786, -0.012728959380508, -0.011587798924035, -0.010418063977366, -0.009219754540501, -0.008014720260293, -0.006802961136741, -0.005584477169844, -0.004359268359604, -0.003127334706020, -0.001909083780220, -0.000704515582204, 0.000486369888027, 0.001663572630473 // 0x576
+, 0.002827092645136, 0.003959514081052, 0.005060836938223, 0.006131061216648, 0.007170186916328, 0.008178214037262, 0.009141893467092, 0.010061225205818, 0.010936209253441, 0.011766845609959, 0.012553134275374, 0.013286701514171, 0.013967547326352, 0.014595671711915, 0.015171074670861, 0.015693756203190 // 0x592
+, 0.016160477957877, 0.016571239934923, 0.016926042134327, 0.017224884556089, 0.017467767200210, 0.017656380746841, 0.017790725195984, 0.017870800547637, 0.017896606801802, 0.017868143958477, 0.017791444619132, 0.017666508783766, 0.017493336452380, 0.017271927624973, 0.017002282301546, 0.016693877666424 // 0x608
+, 0.016346713719608, 0.015960790461098, 0.015536107890894, 0.015072666008996, 0.014582286263381, 0.014064968654048, 0.013520713180997, 0.012949519844229, 0.012351388643743, 0.011739285473972, 0.011113210334914, 0.010473163226571, 0.009819144148942, 0.009151153102027, 0.008482127157093, 0.007812066314141 // 0x624
+, 0.007140970573171, 0.006468839934183, 0.005795674397176, 0.005133311375381, 0.004481750868798, 0.003840992877428, 0.003211037401269, 0.002591884440323, 0.001993397813009, 0.001415577519329, 0.000858423559281, 0.000321935932866, -0.000193885359916, -0.000681780895767, -0.001141750674688, -0.001573794696678 // 0x640
+, -0.001977912961738, -0.002354105469867, -0.002698064575140, -0.003009790277557, -0.003289282577119, -0.003536541473824, -0.003751566967674, -0.003933083405027, -0.004081090785885, -0.004195589110248, -0.004276578378114, -0.004324058589485, -0.004339595578042, -0.004323189343784, -0.004274839886712, -0.004194547206826 // 0x656
+, -0.004082311304125, -0.003942144950465, -0.003774048145846, -0.003578020890266, -0.003354063183727, -0.003102175026228, -0.002828242968316, -0.002532267009991, -0.002214247151253, -0.001874183392101, -0.001512075732536, -0.001135041326739, -0.000743080174708, -0.000336192276444, 0.000085622368052, 0.000522363758782 // 0x672
+, 0.000966397340210, 0.001417723112335, 0.001876341075160, 0.002342251228682, 0.002815453572902, 0.003288430166495, 0.003761181009459, 0.004233706101794, 0.004706005443502, 0.005178079034581, 0.005643135154846, 0.006101173804298, 0.006552194982936, 0.006996198690760, 0.007433184927771, 0.007857522187425 // 0x688
+, 0.008269210469722, 0.008668249774663, 0.009054640102248, 0.009428381452476, 0.009785318411304, 0.010125450978734, 0.010448779154764, 0.010755302939394, 0.011045022332626, 0.011315432920045, 0.011566534701651, 0.011798327677444, 0.012010811847424, 0.012203987211592, 0.012376975914612, 0.012529777956486 // 0x704
+, 0.012662393337213, 0.012774822056793, 0.012867064115226, 0.012939756703828, 0.012992899822599, 0.013026493471540, 0.013040537650649, 0.013035032359928, 0.013011894247159, 0.012971123312344, 0.012912719555481, 0.012836682976572, 0.012743013575615, 0.012634594522903, 0.012511425818433, 0.012373507462208 // 0x720
+, 0.012220839454226, 0.012053421794488, 0.011874753381240, 0.011684834214482, 0.011483664294214, 0.011271243620437, 0.011047572193150, 0.010816427836426, 0.010577810550265, 0.010331720334667, 0.010078157189632, 0.009817121115161, 0.009552341840377, 0.009283819365279, 0.009011553689869, 0.008735544814146 // 0x736
+, 0.008455792738110, 0.008175704839103, 0.007895281117125, 0.007614521572177, 0.007333426204258, 0.007051995013369, 0.006773105683703, 0.006496758215261, 0.006222952608042, 0.005951688862047, 0.005682966977275, 0.005419010535346, 0.005159819536259, 0.004905393980014, 0.004655733866611, 0.004410839196051 // 0x752
+, 0.004172221028473, 0.003939879363878, 0.003713814202264, 0.003494025543633, 0.003280513387983, 0.003074087626644, 0.002874748259613, 0.002682495286892, 0.002497328708480, 0.002319248524377, 0.002148429658648, 0.001984872111293, 0.001828575882312, 0.001679540971705, 0.001537767379471, 0.001402908482211 // 0x768
+, 0.001274964279923, 0.001153934772609, 0.001039819960268, 0.000932619842899, 0.000831597573711, 0.000736753152702, 0.000648086579873, 0.000565597855223, 0.000489286978753, 0.000418168849555, 0.000352243467628, 0.000291510832972, 0.000235970945588, 0.000185623805476, 0.000136853140861, 0.000089658951743 // 0x784
+, 0.000044041238123
+};
+static const double __in_flash() __aligned(8) filter_44100_2[1001] = {
+  1.026398402522458, 1.026506793541207, 1.026528471744957, 1.026541958809050, 1.026547254733486, 1.026544359518266, 1.026533273163390, 1.026513995668856, 1.026492223043785, 1.026467955288175, 1.026441192402027, 1.026411934385341, 1.026380181238116, 1.026344188819984, 1.026303957130945, 1.026259486170999 // 0x0
+, 1.026210775940145, 1.026157826438384, 1.026099123349675, 1.026034666674017, 1.025964456411411, 1.025888492561857, 1.025806775125354, 1.025717985167308, 1.025622122687719, 1.025519187686587, 1.025409180163911, 1.025292100119692, 1.025166907021026, 1.025033600867912, 1.024892181660350, 1.024742649398341 // 0x16
+, 1.024585004081884, 1.024418608855850, 1.024243463720239, 1.024059568675051, 1.023866923720287, 1.023665528855945, 1.023455287600849, 1.023236199954999, 1.023008265918395, 1.022771485491037, 1.022525858672924, 1.022271944004212, 1.022009741484899, 1.021739251114986, 1.021460472894473, 1.021173406823359 // 0x32
+, 1.020879345258177, 1.020578288198927, 1.020270235645608, 1.019955187598222, 1.019633144056767, 1.019306150470015, 1.018974206837964, 1.018637313160615, 1.018295469437968, 1.017948675670023, 1.017599683973071, 1.017248494347112, 1.016895106792147, 1.016539521308174, 1.016181737895195, 1.015825090106559 // 0x48
+, 1.015469577942265, 1.015115201402315, 1.014761960486708, 1.014409855195443, 1.014062603786078, 1.013720206258611, 1.013382662613042, 1.013049972849372, 1.012722136967601, 1.012402991696814, 1.012092537037013, 1.011790772988196, 1.011497699550364, 1.011213316723516, 1.010941266871173, 1.010681549993335 // 0x64
+, 1.010434166090000, 1.010199115161170, 1.009976397206844, 1.009769121042003, 1.009577286666647, 1.009400894080776, 1.009239943284391, 1.009094434277490, 1.008966612379739, 1.008856477591137, 1.008764029911685, 1.008689269341383, 1.008632195880230, 1.008593895805282, 1.008574369116540, 1.008573615814004 // 0x80
+, 1.008591635897672, 1.008628429367546, 1.008683705974730, 1.008757465719222, 1.008849708601023, 1.008960434620133, 1.009089643776552, 1.009235550054262, 1.009398153453264, 1.009577453973558, 1.009773451615144, 1.009986146378021, 1.010212266468257, 1.010451811885853, 1.010704782630807, 1.010971178703121 // 0x96
+, 1.011251000102794, 1.011539635951942, 1.011837086250566, 1.012143350998665, 1.012458430196240, 1.012782323843290, 1.013109376309091, 1.013439587593644, 1.013772957696947, 1.014109486619001, 1.014449174359807, 1.014785734243742, 1.015119166270808, 1.015449470441003, 1.015776646754328, 1.016100695210784 // 0x112
+, 1.016415220896811, 1.016720223812410, 1.017015703957582, 1.017301661332325, 1.017578095936640, 1.017839076106662, 1.018084601842391, 1.018314673143826, 1.018529290010967, 1.018728452443815, 1.018907281745795, 1.019065777916907, 1.019203940957152, 1.019321770866528, 1.019419267645036, 1.019493136698179 // 0x128
+, 1.019543378025955, 1.019569991628366, 1.019572977505412, 1.019552335657091, 1.019506797457641, 1.019436362907061, 1.019341032005350, 1.019220804752510, 1.019075681148540, 1.018906690338904, 1.018713832323601, 1.018497107102631, 1.018256514675995, 1.017992055043693, 1.017707144871326, 1.017401784158894 // 0x144
+, 1.017075972906397, 1.016729711113836, 1.016362998781210, 1.015981482265804, 1.015585161567617, 1.015174036686651, 1.014748107622903, 1.014307374376376, 1.013859351217292, 1.013404038145651, 1.012941435161453, 1.012471542264698, 1.011994359455387, 1.011518663858872, 1.011044455475154, 1.010571734304232 // 0x160
+, 1.010100500346107, 1.009630753600779, 1.009171814293133, 1.008723682423168, 1.008286357990885, 1.007859840996285, 1.007444131439366, 1.007048196922289, 1.006672037445053, 1.006315653007659, 1.005979043610106, 1.005662209252395, 1.005372845713423, 1.005110952993188, 1.004876531091692, 1.004669580008933 // 0x176
+, 1.004490099744913, 1.004343703395567, 1.004230390960894, 1.004150162440895, 1.004103017835570, 1.004088957144918, 1.004110756321097, 1.004168415364107, 1.004261934273948, 1.004391313050619, 1.004556551694122, 1.004757120546151, 1.004993019606708, 1.005264248875792, 1.005570808353404, 1.005912698039542 // 0x192
+, 1.006285863941709, 1.006690306059906, 1.007126024394130, 1.007593018944384, 1.008091289710666, 1.008613396874343, 1.009159340435415, 1.009729120393881, 1.010322736749742, 1.010940189502998, 1.011571114729846, 1.012215512430284, 1.012873382604314, 1.013544725251936, 1.014229540373148, 1.014915346506424 // 0x208
+, 1.015602143651762, 1.016289931809163, 1.016978710978627, 1.017668481160154, 1.018345705037839, 1.019010382611684, 1.019662513881687, 1.020302098847848, 1.020929137510168, 1.021530300507790, 1.022105587840712, 1.022654999508935, 1.023178535512459, 1.023676195851284, 1.024136186530487, 1.024558507550068 // 0x224
+, 1.024943158910026, 1.025290140610362, 1.025599452651076, 1.025862126768081, 1.026078162961377, 1.026247561230965, 1.026370321576843, 1.026446443999012, 1.026470884343283, 1.026443642609656, 1.026364718798131, 1.026234112908708, 1.026051824941387, 1.025817540921627, 1.025531260849429, 1.025192984724792 // 0x240
+, 1.024802712547717, 1.024360444318204, 1.023870986372272, 1.023334338709921, 1.022750501331152, 1.022119474235964, 1.021441257424358, 1.020725700423943, 1.019972803234718, 1.019182565856685, 1.018354988289843, 1.017490070534191, 1.016602116170214, 1.015691125197910, 1.014757097617281, 1.013800033428325 // 0x256
+, 1.012819932631042, 1.011834486617364, 1.010843695387290, 1.009847558940819, 1.008846077277952, 1.007839250398690, 1.006846665369094, 1.005868322189166, 1.004904220858905, 1.003954361378311, 1.003018743747385, 1.002117065694726, 1.001249327220336, 1.000415528324214, 0.999615669006361, 0.998849749266775 // 0x272
+, 0.998135638623308, 0.997473337075959, 0.996862844624728, 0.996304161269615, 0.995797287010620, 0.995356355891864, 0.994981367913345, 0.994672323075065, 0.994429221377022, 0.994252062819218, 0.994149557403343, 0.994121705129397, 0.994168505997381, 0.994289960007294, 0.994486067159136, 0.994758827956711 // 0x288
+, 0.995108242400019, 0.995534310489060, 0.996037032223834, 0.996616407604340, 0.997266994351900, 0.997988792466513, 0.998781801948179, 0.999646022796899, 1.000581455012671, 1.001575157207201, 1.002627129380487, 1.003737371532531, 1.004905883663331, 1.006132665772889, 1.007397945184562, 1.008701721898352 // 0x304
+, 1.010043995914259, 1.011424767232281, 1.012844035852420, 1.014276590139267, 1.015722430092823, 1.017181555713087, 1.018653967000059, 1.020139663953739, 1.021610022595827, 1.023065042926321, 1.024504724945224, 1.025929068652533, 1.027338074048250, 1.028702232316919, 1.030021543458539, 1.031296007473112 // 0x320
+, 1.032525624360637, 1.033710394121114, 1.034822737208143, 1.035862653621723, 1.036830143361854, 1.037725206428537, 1.038547842821771, 1.039275269229634, 1.039907485652125, 1.040444492089245, 1.040886288540993, 1.041232875007370, 1.041468899138676, 1.041594360934912, 1.041609260396077, 1.041513597522172 // 0x336
+, 1.041307372313197, 1.040984812790656, 1.040545918954547, 1.039990690804873, 1.039319128341631, 1.038531231564823, 1.037632211823185, 1.036622069116717, 1.035500803445419, 1.034268414809290, 1.032924903208331, 1.031486968707609, 1.029954611307124, 1.028327831006875, 1.026606627806863, 1.024791001707087 // 0x352
+, 1.022908567868297, 1.020959326290492, 1.018943276973673, 1.016860419917840, 1.014710755122992, 1.012531185125074, 1.010321709924086, 1.008082329520028, 1.005813043912901, 1.003513853102703, 1.001228293456694, 0.998956364974874, 0.996698067657242, 0.994453401503798, 0.992222366514542, 0.990051619948200 // 0x368
+, 0.987941161804770, 0.985890992084254, 0.983901110786650, 0.981971517911960, 0.980147864367324, 0.978430150152742, 0.976818375268214, 0.975312539713741, 0.973912643489322, 0.972658906140002, 0.971551327665783, 0.970589908066663, 0.969774647342643, 0.969105545493722, 0.968613026258017, 0.968297089635527 // 0x384
+, 0.968157735626251, 0.968194964230191, 0.968408775447346, 0.968815878102148, 0.969416272194597, 0.970209957724694, 0.971196934692437, 0.972377203097827, 0.973750645242310, 0.975317261125884, 0.977077050748550, 0.979030014110308, 0.981176151211158, 0.983496536117537, 0.985991168829445, 0.988660049346881 // 0x400
+, 0.991503177669847, 0.994520553798341, 0.997673830990786, 1.000963009247183, 1.004388088567530, 1.007949068951830, 1.011645950400080, 1.015421867198589, 1.019276819347357, 1.023210806846384, 1.027223829695670, 1.031315887895214, 1.035414033570967, 1.039518266722927, 1.043628587351095, 1.047744995455470 // 0x416
+, 1.051867491036054, 1.055910917669549, 1.059875275355957, 1.063760564095278, 1.067566783887511, 1.071293934732656, 1.074849737212655, 1.078234191327506, 1.081447297077211, 1.084489054461769, 1.087359463481181, 1.089965089236980, 1.092305931729169, 1.094381990957746, 1.096193266922712, 1.097739759624066 // 0x432
+, 1.098933309975548, 1.099773917977158, 1.100261583628894, 1.100396306930759, 1.100178087882751, 1.099530470847658, 1.098453455825480, 1.096947042816217, 1.095011231819869, 1.092646022836436, 1.089792601136249, 1.086450966719308, 1.082621119585612, 1.078303059735162, 1.073496787167958, 1.068166102077716 // 0x448
+, 1.062311004464435, 1.055931494328116, 1.049027571668758, 1.041599236486362, 1.033636521835392, 1.025139427715848, 1.016107954127730, 1.006542101071037, 0.996441868545771, 0.985825464658445, 0.974692889409060, 0.963044142797617, 0.950879224824115, 0.938198135488554, 0.925047329942657, 0.911426808186426 // 0x464
+, 0.897336570219859, 0.882776616042956, 0.867746945655719, 0.852320427948185, 0.836497062920356, 0.820276850572232, 0.803659790903811, 0.786645883915095, 0.769330749438961, 0.751714387475408, 0.733796798024436, 0.715577981086045, 0.697057936660236, 0.678349790008635, 0.659453541131243, 0.640369190028059 // 0x480
+, 0.621096736699084, 0.601636181144318, 0.582111669967520, 0.562523203168691, 0.542870780747831, 0.523154402704939, 0.503374069040016, 0.483657690997125, 0.464005268576265, 0.444416801777436, 0.424892290600638, 0.405431735045871, 0.386159281716896, 0.367074930613713, 0.348178681736320, 0.329470535084720 // 0x496
+, 0.310950490658910, 0.292731673720520, 0.274814084269548, 0.257197722305995, 0.239882587829860, 0.222868680841144, 0.206251621172724, 0.190031408824599, 0.174208043796770, 0.158781526089237, 0.143751855701999, 0.129191901525097, 0.115101663558530, 0.101481141802298, 0.088330336256402, 0.075649246920841 // 0x512
+, 0.063484328947338, 0.051835582335895, 0.040703007086511, 0.030086603199185, 0.019986370673918, 0.010420517617225, 0.001389044029107, -0.007108050090437, -0.015070764741407, -0.022499099923803, -0.029403022583160, -0.035782532719479, -0.041637630332760, -0.046968315423002, -0.051774587990207, -0.056092647840656 // 0x528
+, -0.059922494974352, -0.063264129391293, -0.066117551091481, -0.068482760074913, -0.070418571071261, -0.071924984080524, -0.073001999102702, -0.073649616137795, -0.073867835185803, -0.073733111883939, -0.073245446232202, -0.072404838230592, -0.071211287879110, -0.069664795177756, -0.067853519212790, -0.065777459984213 // 0x544
+, -0.063436617492025, -0.060830991736225, -0.057960582716813, -0.054918825332255, -0.051705719582550, -0.048321265467699, -0.044765462987700, -0.041038312142555, -0.037232092350322, -0.033346803611002, -0.029382445924594, -0.025339019291098, -0.021216523710514, -0.017100115606139, -0.012989794977971, -0.008885561826011 // 0x560
+, -0.004787416150259, -0.000695357950714, 0.003317664898572, 0.007251652397599, 0.011106604546367, 0.014882521344876, 0.018579402793126, 0.022140383177426, 0.025565462497773, 0.028854640754170, 0.032007917946615, 0.035025294075109, 0.037868422398075, 0.040537302915511, 0.043031935627419, 0.045352320533798 // 0x576
+, 0.047498457634648, 0.049451420996406, 0.051211210619072, 0.052777826502646, 0.054151268647129, 0.055331537052519, 0.056318514020262, 0.057112199550359, 0.057712593642808, 0.058119696297610, 0.058333507514765, 0.058370736118705, 0.058231382109429, 0.057915445486939, 0.057422926251234, 0.056753824402313 // 0x592
+, 0.055938563678293, 0.054977144079173, 0.053869565604953, 0.052615828255634, 0.051215932031215, 0.049710096476742, 0.048098321592214, 0.046380607377632, 0.044556953832996, 0.042627360958305, 0.040637479660702, 0.038587309940185, 0.036476851796756, 0.034306105230414, 0.032075070241158, 0.029830404087714 // 0x608
+, 0.027572106770082, 0.025300178288262, 0.023014618642253, 0.020715427832055, 0.018446142224928, 0.016206761820870, 0.013997286619882, 0.011817716621964, 0.009668051827116, 0.007585194771283, 0.005569145454464, 0.003619903876659, 0.001737470037869, -0.000078156061907, -0.001799359261919, -0.003426139562168 // 0x624
+, -0.004958496962653, -0.006396431463375, -0.007739943064334, -0.008972331700463, -0.010093597371761, -0.011103740078229, -0.012002759819867, -0.012790656596675, -0.013462219059917, -0.014017447209592, -0.014456341045700, -0.014778900568241, -0.014985125777217, -0.015080788651121, -0.015065889189956, -0.014940427393720 // 0x640
+, -0.014704403262414, -0.014357816796037, -0.013916020344289, -0.013379013907170, -0.012746797484678, -0.012019371076816, -0.011196734683581, -0.010301671616898, -0.009334181876767, -0.008294265463187, -0.007181922376158, -0.005997152615682, -0.004767535728157, -0.003493071713584, -0.002173760571963, -0.000809602303294 // 0x656
+, 0.000599403092423, 0.002023746799732, 0.003463428818634, 0.004918449149129, 0.006388807791217, 0.007874504744897, 0.009346916031869, 0.010806041652133, 0.012251881605688, 0.013684435892535, 0.015103704512674, 0.016484475830697, 0.017826749846603, 0.019130526560393, 0.020395805972067, 0.021622588081624 // 0x672
+, 0.022791100212425, 0.023901342364468, 0.024953314537755, 0.025947016732284, 0.026882448948057, 0.027746669796776, 0.028539679278443, 0.029261477393056, 0.029912064140616, 0.030491439521122, 0.030994161255896, 0.031420229344937, 0.031769643788245, 0.032042404585820, 0.032238511737662, 0.032359965747575 // 0x688
+, 0.032406766615559, 0.032378914341613, 0.032276408925738, 0.032099250367933, 0.031856148669891, 0.031547103831610, 0.031172115853092, 0.030731184734335, 0.030224310475341, 0.029665627120228, 0.029055134668997, 0.028392833121648, 0.027678722478181, 0.026912802738595, 0.026112943420741, 0.025279144524619 // 0x704
+, 0.024411406050229, 0.023509727997571, 0.022574110366644, 0.021624250886051, 0.020660149555790, 0.019681806375861, 0.018689221346266, 0.017682394467003, 0.016680912804137, 0.015684776357666, 0.014693985127592, 0.013708539113913, 0.012728438316631, 0.011771374127675, 0.010837346547045, 0.009926355574742 // 0x720
+, 0.009038401210764, 0.008173483455113, 0.007345905888271, 0.006555668510238, 0.005802771321013, 0.005087214320598, 0.004408997508992, 0.003777970413804, 0.003194133035035, 0.002657485372684, 0.002168027426752, 0.001725759197239, 0.001335487020164, 0.000997210895527, 0.000710930823329, 0.000476646803569 // 0x736
+, 0.000294358836248, 0.000163752946825, 0.000084829135300, 0.000057587401673, 0.000082027745944, 0.000158150168113, 0.000280910513992, 0.000450308783579, 0.000666344976875, 0.000929019093880, 0.001238331134594, 0.001585312834930, 0.001969964194888, 0.002392285214469, 0.002852275893672, 0.003349936232497 // 0x752
+, 0.003873472236021, 0.004422883904244, 0.004998171237167, 0.005599334234788, 0.006226372897108, 0.006865957863270, 0.007518089133273, 0.008182766707117, 0.008859990584802, 0.009549760766329, 0.010238539935793, 0.010926328093194, 0.011613125238532, 0.012298931371808, 0.012983746493020, 0.013655089140642 // 0x768
+, 0.014312959314672, 0.014957357015110, 0.015588282241958, 0.016205734995214, 0.016799351351075, 0.017369131309541, 0.017915074870613, 0.018437182034290, 0.018935452800572, 0.019402447350826, 0.019838165685051, 0.020242607803247, 0.020615773705414, 0.020957663391553, 0.021264222869164, 0.021535452138248 // 0x784
+, 0.021771351198805, 0.021971920050835, 0.022137158694337, 0.022266537471009, 0.022360056380850, 0.022417715423860, 0.022439514600039, 0.022425453909387, 0.022378309304062, 0.022298080784063, 0.022184768349390, 0.022038372000043, 0.021858891736023, 0.021651940653265, 0.021417518751769, 0.021155626031534 // 0x800
+, 0.020866262492561, 0.020549428134850, 0.020212818737298, 0.019856434299904, 0.019480274822668, 0.019084340305591, 0.018668630748672, 0.018242113754071, 0.017804789321788, 0.017356657451824, 0.016897718144178, 0.016427971398849, 0.015956737440724, 0.015484016269803, 0.015009807886085, 0.014534112289570 // 0x816
+, 0.014056929480258, 0.013587036583503, 0.013124433599306, 0.012669120527664, 0.012221097368580, 0.011780364122053, 0.011354435058306, 0.010943310177339, 0.010546989479153, 0.010165472963747, 0.009798760631121, 0.009452498838560, 0.009126687586063, 0.008821326873631, 0.008536416701264, 0.008271957068961 // 0x832
+, 0.008031364642325, 0.007814639421356, 0.007621781406053, 0.007452790596416, 0.007307666992446, 0.007187439739606, 0.007092108837896, 0.007021674287315, 0.006976136087865, 0.006955494239545, 0.006958480116590, 0.006985093719001, 0.007035335046778, 0.007109204099920, 0.007206700878428, 0.007324530787805 // 0x848
+, 0.007462693828049, 0.007621189999161, 0.007800019301141, 0.007999181733989, 0.008213798601131, 0.008443869902566, 0.008689395638294, 0.008950375808316, 0.009226810412632, 0.009512767787375, 0.009808247932546, 0.010113250848146, 0.010427776534173, 0.010751824990628, 0.011079001303953, 0.011409305474149 // 0x864
+, 0.011742737501214, 0.012079297385150, 0.012418985125955, 0.012755514048009, 0.013088884151313, 0.013419095435865, 0.013746147901666, 0.014070041548716, 0.014385120746291, 0.014691385494390, 0.014988835793014, 0.015277471642163, 0.015557293041835, 0.015823689114149, 0.016076659859104, 0.016316205276699 // 0x880
+, 0.016542325366936, 0.016755020129813, 0.016951017771398, 0.017130318291692, 0.017292921690695, 0.017438827968405, 0.017568037124824, 0.017678763143934, 0.017771006025735, 0.017844765770227, 0.017900042377410, 0.017936835847285, 0.017954855930953, 0.017954102628417, 0.017934575939675, 0.017896275864727 // 0x896
+, 0.017839202403574, 0.017764441833272, 0.017671994153820, 0.017561859365218, 0.017434037467467, 0.017288528460566, 0.017127577664180, 0.016951185078310, 0.016759350702954, 0.016552074538113, 0.016329356583787, 0.016094305654957, 0.015846921751622, 0.015587204873783, 0.015315155021440, 0.015030772194593 // 0x912
+, 0.014737698756761, 0.014435934707944, 0.014125480048142, 0.013806334777356, 0.013478498895585, 0.013145809131915, 0.012808265486346, 0.012465867958879, 0.012118616549513, 0.011766511258249, 0.011413270342642, 0.011058893802691, 0.010703381638398, 0.010346733849762, 0.009988950436783, 0.009633364952810 // 0x928
+, 0.009279977397845, 0.008928787771886, 0.008579796074934, 0.008233002306989, 0.007891158584342, 0.007554264906993, 0.007222321274942, 0.006895327688189, 0.006573284146735, 0.006258236099348, 0.005950183546030, 0.005649126486780, 0.005355064921598, 0.005067998850484, 0.004789220629971, 0.004518730260058 // 0x944
+, 0.004256527740745, 0.004002613072032, 0.003756986253920, 0.003520205826562, 0.003292271789958, 0.003073184144108, 0.002862942889012, 0.002661548024670, 0.002468903069905, 0.002285008024717, 0.002109862889107, 0.001943467663073, 0.001785822346616, 0.001636290084607, 0.001494870877045, 0.001361564723931 // 0x960
+, 0.001236371625264, 0.001119291581045, 0.001009284058370, 0.000906349057237, 0.000810486577648, 0.000721696619602, 0.000639979183100, 0.000564015333545, 0.000493805070940, 0.000429348395282, 0.000370645306573, 0.000317695804812, 0.000268985573958, 0.000224514614012, 0.000184282924972, 0.000148290506841 // 0x976
+, 0.000116537359616, 0.000087279342930, 0.000060516456782, 0.000036248701172, 0.000014476076100, -0.000004801418433, -0.000015887773310, -0.000018782988530, -0.000013487064093
+};
+static const double __in_flash() __aligned(8) filter_48000_0[601] = {
+  1.019862018873144, 1.020010340024943, 1.020040004255303, 1.020066806344194, 1.020090746291618, 1.020111824097574, 1.020130039762061, 1.020145393285081, 1.020160288061377, 1.020174724090949, 1.020188701373798, 1.020202219909923, 1.020215279699324, 1.020226552681953, 1.020236038857808, 1.020243738226890 // 0x0
+, 1.020249650789199, 1.020253776544735, 1.020254357515227, 1.020251393700674, 1.020244885101078, 1.020234831716437, 1.020221233546752, 1.020201978631126, 1.020177066969559, 1.020146498562051, 1.020110273408603, 1.020068391509213, 1.020018543646228, 1.019960729819648, 1.019894950029473, 1.019821204275703 // 0x16
+, 1.019739492558338, 1.019647539311575, 1.019545344535414, 1.019432908229856, 1.019310230394900, 1.019177311030547, 1.019032209024629, 1.018874924377146, 1.018705457088098, 1.018523807157486, 1.018329974585308, 1.018122690909479, 1.017901956129999, 1.017667770246866, 1.017420133260082, 1.017159045169646 // 0x32
+, 1.016884255416379, 1.016595764000280, 1.016293570921350, 1.015977676179588, 1.015648079774995, 1.015305853524723, 1.014950997428772, 1.014583511487142, 1.014203395699832, 1.013810650066844, 1.013407894653034, 1.012995129458401, 1.012572354482945, 1.012139569726667, 1.011696775189567, 1.011248228128442 // 0x48
+, 1.010793928543294, 1.010333876434121, 1.009868071800925, 1.009396514643705, 1.008925023122665, 1.008453597237805, 1.007982236989127, 1.007510942376629, 1.007039713400311, 1.006575645625771, 1.006118739053006, 1.005668993682019, 1.005226409512808, 1.004790986545374, 1.004370615101231, 1.003965295180381 // 0x64
+, 1.003575026782822, 1.003199809908554, 1.002839644557579, 1.002502541265828, 1.002188500033303, 1.001897520860002, 1.001629603745926, 1.001384748691075, 1.001170272482984, 1.000986175121653, 1.000832456607081, 1.000709116939269, 1.000616156118216, 1.000559298493307, 1.000538544064540, 1.000553892831916 // 0x80
+, 1.000605344795435, 1.000692899955097, 1.000819797715263, 1.000986038075933, 1.001191621037107, 1.001436546598784, 1.001720814760966, 1.002044391999896, 1.002407278315575, 1.002809473708003, 1.003250978177179, 1.003731791723103, 1.004248055594853, 1.004799769792430, 1.005386934315833, 1.006009549165061 // 0x96
+, 1.006667614340116, 1.007353197434081, 1.008066298446956, 1.008806917378741, 1.009575054229437, 1.010370708999042, 1.011182019354487, 1.012008985295771, 1.012851606822893, 1.013709883935855, 1.014583816634656, 1.015458188119508, 1.016332998390412, 1.017208247447367, 1.018083935290374, 1.018960061919433 // 0x112
+, 1.019819124286201, 1.020661122390678, 1.021486056232864, 1.022293925812760, 1.023084731130364, 1.023840085772727, 1.024559989739847, 1.025244443031724, 1.025893445648359, 1.026506997589752, 1.027067597468763, 1.027575245285394, 1.028029941039643, 1.028431684731512, 1.028780476360999, 1.029061626190662 // 0x128
+, 1.029275134220500, 1.029421000450514, 1.029499224880703, 1.029509807511068, 1.029442768855663, 1.029298108914488, 1.029075827687544, 1.028775925174831, 1.028398401376347, 1.027939714184510, 1.027399863599320, 1.026778849620776, 1.026076672248879, 1.025293331483627, 1.024433004332318, 1.023495690794949 // 0x144
+, 1.022481390871521, 1.021390104562035, 1.020221831866490, 1.018989174833980, 1.017692133464506, 1.016330707758068, 1.014904897714665, 1.013414703334298, 1.011881079976634, 1.010304027641675, 1.008683546329419, 1.007019636039868, 1.005312296773020, 1.003589933707989, 1.001852546844774, 1.000100136183376 // 0x160
+, 0.998332701723795, 0.996550243466031, 0.994786826633161, 0.993042451225185, 0.991317117242105, 0.989610824683919, 0.987923573550627, 0.986292505369212, 0.984717620139673, 0.983198917862010, 0.981736398536223, 0.980330062162312, 0.979016873988925, 0.977796834016063, 0.976669942243724, 0.975636198671909 // 0x176
+, 0.974695603300618, 0.973881273289363, 0.973193208638146, 0.972631409346966, 0.972195875415823, 0.971886606844717, 0.971729054598031, 0.971723218675767, 0.971869099077924, 0.972166695804502, 0.972616008855501, 0.973231219831647, 0.974012328732938, 0.974959335559375, 0.976072240310957, 0.977351042987686 // 0x192
+, 0.978795594004920, 0.980405893362657, 0.982181941060900, 0.984123737099647, 0.986231281478898, 0.988487932685552, 0.990893690719609, 0.993448555581068, 0.996152527269931, 0.999005605786196, 1.001973645163257, 1.005056645401115, 1.008254606499769, 1.011567528459219, 1.014995411279465, 1.018486976413303 // 0x208
+, 1.022042223860731, 1.025661153621750, 1.029343765696360, 1.033090060084560, 1.036833445049862, 1.040573920592264, 1.044311486711766, 1.048046143408369, 1.051777890682073, 1.055428076334570, 1.058996700365860, 1.062483762775944, 1.065889263564822, 1.069213202732494, 1.072369384301439, 1.075357808271657 // 0x224
+, 1.078178474643149, 1.080831383415914, 1.083316534589953, 1.085545707986155, 1.087518903604520, 1.089236121445049, 1.090697361507740, 1.091902623792595, 1.092767778482205, 1.093292825576569, 1.093477765075688, 1.093322596979561, 1.092827321288189, 1.091918169593480, 1.090595141895434, 1.088858238194051 // 0x240
+, 1.086707458489331, 1.084142802781274, 1.081106792739677, 1.077599428364540, 1.073620709655864, 1.069170636613648, 1.064249209237893, 1.058820336159297, 1.052884017377862, 1.046440252893586, 1.039489042706470, 1.032030386816514, 1.024053389072721, 1.015558049475092, 1.006544368023627, 0.997012344718325 // 0x256
+, 0.986961979559186, 0.976409774399037, 0.965355729237877, 0.953799844075706, 0.941742118912524, 0.929182553748331, 0.916165363372945, 0.902690547786366, 0.888758106988593, 0.874368040979628, 0.859520349759469, 0.844285353454723, 0.828663052065389, 0.812653445591468, 0.796256534032959, 0.779472317389863 // 0x272
+, 0.762393717803711, 0.745020735274504, 0.727353369802241, 0.709391621386923, 0.691135490028550, 0.672695362048552, 0.654071237446929, 0.635263116223682, 0.616270998378810, 0.597094883912313, 0.577856180110982, 0.558554886974817, 0.539191004503818, 0.519764532697985, 0.500275471557317, 0.480848999751484 // 0x288
+, 0.461485117280485, 0.442183824144320, 0.422945120342989, 0.403769005876493, 0.384776888031621, 0.365968766808373, 0.347344642206751, 0.328904514226753, 0.310648382868379, 0.292686634453061, 0.275019268980799, 0.257646286451592, 0.240567686865440, 0.223783470222343, 0.207386558663835, 0.191376952189913 // 0x304
+, 0.175754650800580, 0.160519654495833, 0.145671963275674, 0.131281897266709, 0.117349456468937, 0.103874640882358, 0.090857450506972, 0.078297885342779, 0.066240160179597, 0.054684275017426, 0.043630229856266, 0.033078024696116, 0.023027659536978, 0.013495636231676, 0.004481954780210, -0.004013384817419 // 0x320
+, -0.011990382561211, -0.019449038451167, -0.026400248638283, -0.032844013122559, -0.038780331903994, -0.044209204982590, -0.049130632358346, -0.053580705400562, -0.057559424109238, -0.061066788484374, -0.064102798525971, -0.066667454234028, -0.068818233938748, -0.070555137640131, -0.071878165338177, -0.072787317032886 // 0x336
+, -0.073282592724259, -0.073437760820385, -0.073252821321267, -0.072727774226903, -0.071862619537293, -0.070657357252438, -0.069196117189746, -0.067478899349218, -0.065505703730853, -0.063276530334651, -0.060791379160612, -0.058138470387847, -0.055317804016355, -0.052329380046136, -0.049173198477191, -0.045849259309520 // 0x352
+, -0.042443758520642, -0.038956696110558, -0.035388072079267, -0.031737886426770, -0.028006139153066, -0.024271482456463, -0.020533916336961, -0.016793440794559, -0.013050055829258, -0.009303761441057, -0.005621149366447, -0.002002219605428, 0.001553027842000, 0.005044592975838, 0.008472475796084, 0.011785397755534 // 0x368
+, 0.014983358854188, 0.018066359092046, 0.021034398469107, 0.023887476985372, 0.026591448674234, 0.029146313535694, 0.031552071569751, 0.033808722776405, 0.035916267155656, 0.037858063194403, 0.039634110892645, 0.041244410250383, 0.042688961267617, 0.043967763944345, 0.045080668695928, 0.046027675522365 // 0x384
+, 0.046808784423656, 0.047423995399801, 0.047873308450801, 0.048170905177379, 0.048316785579536, 0.048310949657272, 0.048153397410586, 0.047844128839480, 0.047408594908337, 0.046846795617157, 0.046158730965939, 0.045344400954685, 0.044403805583394, 0.043370062011579, 0.042243170239240, 0.041023130266377 // 0x400
+, 0.039709942092990, 0.038303605719080, 0.036841086393293, 0.035322384115630, 0.033747498886091, 0.032116430704675, 0.030429179571384, 0.028722887013198, 0.026997553030118, 0.025253177622142, 0.023489760789272, 0.021707302531508, 0.019939868071926, 0.018187457410529, 0.016450070547314, 0.014727707482283 // 0x416
+, 0.013020368215435, 0.011356457925884, 0.009735976613628, 0.008158924278669, 0.006625300921005, 0.005135106540638, 0.003709296497235, 0.002347870790797, 0.001050829421323, -0.000181827611187, -0.001350100306732, -0.002441386616219, -0.003455686539646, -0.004393000077015, -0.005253327228325, -0.006036667993576 // 0x432
+, -0.006738845365473, -0.007359859344017, -0.007899709929208, -0.008358397121044, -0.008735920919528, -0.009035823432241, -0.009258104659185, -0.009402764600360, -0.009469803255765, -0.009459220625400, -0.009380996195211, -0.009235129965197, -0.009021621935359, -0.008740472105696, -0.008391680476209, -0.007989936784340 // 0x448
+, -0.007535241030091, -0.007027593213460, -0.006466993334449, -0.005853441393056, -0.005204438776421, -0.004519985484544, -0.003800081517424, -0.003044726875062, -0.002253921557457, -0.001446051977561, -0.000621118135375, 0.000220879969102, 0.001079942335870, 0.001956068964928, 0.002831756807936, 0.003707005864891 // 0x464
+, 0.004581816135795, 0.005456187620647, 0.006330120319447, 0.007188397432409, 0.008031018959532, 0.008857984900815, 0.009669295256260, 0.010464950025866, 0.011233086876562, 0.011973705808347, 0.012686806821222, 0.013372389915187, 0.014030455090241, 0.014653069939470, 0.015240234462873, 0.015791948660449 // 0x480
+, 0.016308212532200, 0.016789026078124, 0.017230530547300, 0.017632725939727, 0.017995612255406, 0.018319189494337, 0.018603457656518, 0.018848383218196, 0.019053966179370, 0.019220206540040, 0.019347104300205, 0.019434659459867, 0.019486111423386, 0.019501460190763, 0.019480705761996, 0.019423848137086 // 0x496
+, 0.019330887316034, 0.019207547648222, 0.019053829133650, 0.018869731772319, 0.018655255564227, 0.018410400509376, 0.018142483395301, 0.017851504222000, 0.017537462989474, 0.017200359697724, 0.016840194346748, 0.016464977472481, 0.016074709074922, 0.015669389154071, 0.015249017709929, 0.014813594742495 // 0x512
+, 0.014371010573284, 0.013921265202296, 0.013464358629532, 0.013000290854991, 0.012529061878674, 0.012057767266176, 0.011586407017497, 0.011114981132638, 0.010643489611598, 0.010171932454378, 0.009706127821181, 0.009246075712009, 0.008791776126860, 0.008343229065736, 0.007900434528636, 0.007467649772358 // 0x528
+, 0.007044874796902, 0.006632109602269, 0.006229354188458, 0.005836608555470, 0.005456492768161, 0.005089006826531, 0.004734150730580, 0.004391924480307, 0.004062328075714, 0.003746433333953, 0.003444240255023, 0.003155748838924, 0.002880959085657, 0.002619870995221, 0.002372234008437, 0.002138048125304 // 0x544
+, 0.001917313345823, 0.001710029669994, 0.001516197097817, 0.001334547167205, 0.001165079878157, 0.001007795230674, 0.000862693224756, 0.000729773860403, 0.000607096025447, 0.000494659719889, 0.000392464943728, 0.000300511696965, 0.000218799979600, 0.000145054225829, 0.000079274435654, 0.000021460609074 // 0x560
+, -0.000028387253910, -0.000070269153300, -0.000106494306749, -0.000137062714256, -0.000161974375823, -0.000181229291449, -0.000194827461134, -0.000204880845775, -0.000211389445372, -0.000214353259924, -0.000213772289432, -0.000209646533896, -0.000203733971587, -0.000196034602505, -0.000186548426650, -0.000175275444021 // 0x576
+, -0.000162215654620, -0.000148697118495, -0.000134719835647, -0.000120283806074, -0.000105389029778, -0.000090035506759, -0.000071819842271, -0.000050742036315, -0.000026802088892
+};
+static const double __in_flash() __aligned(8) filter_48000_1[801] = {
+  1.020973167346470, 1.021194636447881, 1.021238930268164, 1.021285346360512, 1.021333884724926, 1.021384545361406, 1.021437328269951, 1.021492233450563, 1.021552867425367, 1.021619230194363, 1.021691321757551, 1.021769142114932, 1.021852691266504, 1.021942841108072, 1.022039591639634, 1.022142942861190 // 0x0
+, 1.022252894772741, 1.022369447374287, 1.022492998810058, 1.022623549080055, 1.022761098184276, 1.022905646122723, 1.023057192895396, 1.023215474761218, 1.023380491720191, 1.023552243772314, 1.023730730917588, 1.023915953156012, 1.024106835007884, 1.024303376473206, 1.024505577551976, 1.024713438244195 // 0x16
+, 1.024926958549863, 1.025144164827970, 1.025365057078516, 1.025589635301501, 1.025817899496924, 1.026049849664786, 1.026282627089330, 1.026516231770555, 1.026750663708461, 1.026985922903048, 1.027222009354317, 1.027455305757984, 1.027685812114048, 1.027913528422509, 1.028138454683368, 1.028360590896625 // 0x32
+, 1.028575807760998, 1.028784105276487, 1.028985483443093, 1.029179942260815, 1.029367481729653, 1.029543808549998, 1.029708922721850, 1.029862824245209, 1.030005513120074, 1.030136989346446, 1.030253239922720, 1.030354264848896, 1.030440064124973, 1.030510637750952, 1.030565985726832, 1.030602866864166 // 0x48
+, 1.030621281162954, 1.030621228623195, 1.030602709244890, 1.030565723028038, 1.030508284352626, 1.030430393218653, 1.030332049626119, 1.030213253575024, 1.030074005065368, 1.029913979718732, 1.029733177535116, 1.029531598514521, 1.029309242656945, 1.029066109962389, 1.028803836265722, 1.028522421566943 // 0x64
+, 1.028221865866052, 1.027902169163051, 1.027563331457937, 1.027209062903179, 1.026839363498776, 1.026454233244728, 1.026053672141035, 1.025637680187697, 1.025211918797714, 1.024776387971085, 1.024331087707811, 1.023876018007892, 1.023411178871327, 1.022943822201372, 1.022473947998025, 1.022001556261289 // 0x80
+, 1.021526646991161, 1.021049220187643, 1.020577560181988, 1.020111666974197, 1.019651540564269, 1.019197180952205, 1.018748588138005, 1.018314254955021, 1.017894181403254, 1.017488367482704, 1.017096813193370, 1.016719518535253, 1.016364311361955, 1.016031191673476, 1.015720159469815, 1.015431214750974 // 0x96
+, 1.015164357516951, 1.014925788539089, 1.014715507817387, 1.014533515351846, 1.014379811142465, 1.014254395189246, 1.014160972631549, 1.014099543469376, 1.014070107702727, 1.014072665331600, 1.014107216355997, 1.014174285903323, 1.014273873973577, 1.014405980566760, 1.014570605682872, 1.014767749321912 // 0x112
+, 1.014994346408314, 1.015250396942079, 1.015535900923205, 1.015850858351695, 1.016195269227546, 1.016562455840397, 1.016952418190246, 1.017365156277094, 1.017800670100942, 1.018258959661788, 1.018730108742723, 1.019214117343746, 1.019710985464857, 1.020220713106056, 1.020743300267344, 1.021266398277057 // 0x128
+, 1.021790007135197, 1.022314126841762, 1.022838757396753, 1.023363898800170, 1.023875937189946, 1.024374872566082, 1.024860704928578, 1.025333434277433, 1.025793060612648, 1.026226152755521, 1.026632710706052, 1.027012734464241, 1.027366224030087, 1.027693179403592, 1.027981920760659, 1.028232448101288 // 0x144
+, 1.028444761425480, 1.028618860733234, 1.028754746024551, 1.028844028416270, 1.028886707908391, 1.028882784500914, 1.028832258193839, 1.028735128987166, 1.028587608587614, 1.028389696995182, 1.028141394209870, 1.027842700231679, 1.027493615060608, 1.027095860710416, 1.026649437181105, 1.026154344472672 // 0x160
+, 1.025610582585120, 1.025018151518447, 1.024384637984919, 1.023710041984535, 1.022994363517295, 1.022237602583200, 1.021439759182249, 1.020614001660646, 1.019760330018389, 1.018878744255479, 1.017969244371915, 1.017031830367699, 1.016084274047488, 1.015126575411283, 1.014158734459085, 1.013180751190893 // 0x176
+, 1.012192625606706, 1.011215126272727, 1.010248253188954, 1.009292006355389, 1.008346385772030, 1.007411391438878, 1.006508672608958, 1.005638229282271, 1.004800061458815, 1.003994169138592, 1.003220552321600, 1.002499301955681, 1.001830418040834, 1.001213900577060, 1.000649749564358, 1.000137965002728 // 0x192
+, 0.999694587432797, 0.999319616854563, 0.999013053268028, 0.998774896673191, 0.998605147070052, 0.998513521849946, 0.998500021012875, 0.998564644558838, 0.998707392487834, 0.998928264799865, 0.999228889335553, 0.999609266094900, 1.000069395077904, 1.000609276284567, 1.001228909714888, 1.001920839811185 // 0x208
+, 1.002685066573459, 1.003521590001708, 1.004430410095934, 1.005411526856136, 1.006448344649449, 1.007540863475872, 1.008689083335407, 1.009893004228052, 1.011152626153808, 1.012443225443442, 1.013764802096952, 1.015117356114340, 1.016500887495605, 1.017915396240747, 1.019330064661187, 1.020744892756925 // 0x224
+, 1.022159880527962, 1.023575027974296, 1.024990335095928, 1.026371840779827, 1.027719545025992, 1.029033447834423, 1.030313549205121, 1.031559849138084, 1.032738838820253, 1.033850518251628, 1.034894887432209, 1.035871946361994, 1.036781695040986, 1.037594993835482, 1.038311842745485, 1.038932241770992 // 0x240
+, 1.039456190912005, 1.039883690168524, 1.040193771379519, 1.040386434544991, 1.040461679664939, 1.040419506739363, 1.040259915768264, 1.039973379830759, 1.039559898926847, 1.039019473056529, 1.038352102219805, 1.037557786416675, 1.036640742282359, 1.035600969816857, 1.034438469020169, 1.033153239892295 // 0x256
+, 1.031745282433235, 1.030233556906134, 1.028618063310992, 1.026898801647807, 1.025075771916582, 1.023148974117315, 1.021151553917993, 1.019083511318619, 1.016944846319190, 1.014735558919707, 1.012455649120170, 1.010150264993720, 1.007819406540356, 1.005463073760078, 1.003081266652887, 1.000673985218781 // 0x272
+, 0.998294623576093, 0.995943181724823, 0.993619659664970, 0.991324057396534, 0.989056374919515, 0.986873196388685, 0.984774521804043, 0.982760351165589, 0.980830684473323, 0.978985521727245, 0.977278672997251, 0.975710138283339, 0.974279917585512, 0.972988010903767, 0.971834418238106, 0.970863851751803 // 0x288
+, 0.970076311444857, 0.969471797317269, 0.969050309369039, 0.968811847600166, 0.968785950988860, 0.968972619535121, 0.969371853238949, 0.969983652100344, 0.970808016119306, 0.971854128407592, 0.973121988965204, 0.974611597792140, 0.976322954888401, 0.978256060253988, 0.980396033773098, 0.982742875445731 // 0x304
+, 0.985296585271887, 0.988057163251568, 0.991024609384771, 0.994158253960740, 0.997458096979474, 1.000924138440973, 1.004556378345237, 1.008354816692267, 1.012253545375218, 1.016252564394093, 1.020351873748889, 1.024551473439608, 1.028851363466249, 1.033163376044347, 1.037487511173900, 1.041823768854909 // 0x320
+, 1.046172149087374, 1.050532651871295, 1.054800118512880, 1.058974549012130, 1.063055943369045, 1.067044301583625, 1.070939623655869, 1.074627007624346, 1.078106453489056, 1.081377961249999, 1.084441530907174, 1.087297162460582, 1.089828870218691, 1.092036654181501, 1.093920514349012, 1.095480450721224 // 0x336
+, 1.096716463298137, 1.097520871316758, 1.097893674777087, 1.097834873679123, 1.097344468022868, 1.096422457808320, 1.094978757165215, 1.093013366093552, 1.090526284593331, 1.087517512664552, 1.083987050307216, 1.079870784197839, 1.075168714336419, 1.069880840722959, 1.064007163357456, 1.057547682239912 // 0x352
+, 1.050470922936730, 1.042776885447910, 1.034465569773452, 1.025536975913356, 1.015991103867622, 1.005833441870575, 0.995063989922215, 0.983682748022543, 0.971689716171557, 0.959084894369259, 0.945912234448776, 0.932171736410106, 0.917863400253251, 0.902987225978210, 0.887543213584983, 0.871612267193943 // 0x368
+, 0.855194386805090, 0.838289572418423, 0.820897824033944, 0.803019141651651, 0.784766884374299, 0.766141052201887, 0.747141645134417, 0.727768663171886, 0.708022106314297, 0.688040652574512, 0.667824301952533, 0.647373054448360, 0.626686910061991, 0.605765868793428, 0.584764690088800, 0.563683373948107 // 0x384
+, 0.542521920371348, 0.521280329358525, 0.499958600909637, 0.478717009896814, 0.457555556320056, 0.436474240179363, 0.415473061474735, 0.394552020206172, 0.373865875819803, 0.353414628315630, 0.333198277693651, 0.313216823953866, 0.293470267096277, 0.274097285133746, 0.255097878066275, 0.236472045893864 // 0x400
+, 0.218219788616512, 0.200341106234219, 0.182949357849740, 0.166044543463073, 0.149626663074220, 0.133695716683180, 0.118251704289953, 0.103375530014912, 0.089067193858057, 0.075326695819387, 0.062154035898903, 0.049549214096605, 0.037556182245620, 0.026174940345948, 0.015405488397588, 0.005247826400541 // 0x416
+, -0.004298045645193, -0.013226639505289, -0.021537955179747, -0.029231992668568, -0.036308751971749, -0.042768233089293, -0.048641910454796, -0.053929784068257, -0.058631853929676, -0.062748120039054, -0.066278582396390, -0.069287354325168, -0.071774435825389, -0.073739826897052, -0.075183527540158, -0.076105537754705 // 0x432
+, -0.076595943410961, -0.076654744508924, -0.076281941048595, -0.075477533029974, -0.074241520453061, -0.072681584080849, -0.070797723913338, -0.068589939950528, -0.066058232192419, -0.063202600639011, -0.060139030981836, -0.056867523220894, -0.053388077356184, -0.049700693387707, -0.045805371315462, -0.041817013100882 // 0x448
+, -0.037735618743968, -0.033561188244717, -0.029293721603132, -0.024933218819211, -0.020584838586746, -0.016248580905737, -0.011924445776184, -0.007612433198087, -0.003312543171445, 0.000887056519274, 0.004986365874070, 0.008985384892945, 0.012884113575896, 0.016682551922926, 0.020314791827190, 0.023780833288689 // 0x464
+, 0.027080676307423, 0.030214320883392, 0.033181767016595, 0.035942344996275, 0.038496054822432, 0.040842896495065, 0.042982870014175, 0.044915975379762, 0.046627332476023, 0.048116941302959, 0.049384801860571, 0.050430914148858, 0.051255278167819, 0.051867077029214, 0.052266310733042, 0.052452979279303 // 0x480
+, 0.052427082667997, 0.052188620899124, 0.051767132950894, 0.051162618823306, 0.050375078516360, 0.049404512030057, 0.048250919364396, 0.046959012682651, 0.045528791984824, 0.043960257270912, 0.042253408540918, 0.040408245794840, 0.038478579102574, 0.036464408464120, 0.034365733879478, 0.032182555348648 // 0x496
+, 0.029914872871629, 0.027619270603193, 0.025295748543340, 0.022944306692070, 0.020564945049382, 0.018157663615277, 0.015775856508085, 0.013419523727807, 0.011088665274443, 0.008783281147993, 0.006503371348456, 0.004294083948974, 0.002155418949545, 0.000087376350170, -0.001910043849151, -0.003836841648418 // 0x512
+, -0.005659871379644, -0.007379133042828, -0.008994626637971, -0.010506352165072, -0.011914309624132, -0.013199538752006, -0.014362039548694, -0.015401812014196, -0.016318856148512, -0.017113171951642, -0.017780542788366, -0.018320968658684, -0.018734449562595, -0.019020985500101, -0.019180576471200, -0.019222749396775 // 0x528
+, -0.019147504276827, -0.018954841111356, -0.018644759900361, -0.018217260643842, -0.017693311502829, -0.017072912477321, -0.016356063567319, -0.015542764772822, -0.014633016093831, -0.013655957164045, -0.012611587983465, -0.011499908552090, -0.010320918869921, -0.009074618936957, -0.007794517566260, -0.006480614757829 // 0x544
+, -0.005132910511664, -0.003751404827765, -0.002336097706133, -0.000920950259798, 0.000494037511238, 0.001908865606976, 0.003323534027416, 0.004738042772558, 0.006121574153823, 0.007474128171211, 0.008795704824722, 0.010086304114355, 0.011345926040111, 0.012549846932756, 0.013698066792291, 0.014790585618715 // 0x560
+, 0.015827403412027, 0.016808520172229, 0.017717340266455, 0.018553863694705, 0.019318090456978, 0.020010020553275, 0.020629653983596, 0.021169535190259, 0.021629664173264, 0.022010040932610, 0.022310665468299, 0.022531537780329, 0.022674285709326, 0.022738909255288, 0.022725408418217, 0.022633783198112 // 0x576
+, 0.022464033594972, 0.022225877000135, 0.021919313413600, 0.021544342835366, 0.021100965265435, 0.020589180703805, 0.020025029691103, 0.019408512227329, 0.018739628312482, 0.018018377946563, 0.017244761129571, 0.016438868809348, 0.015600700985892, 0.014730257659205, 0.013827538829285, 0.012892544496133 // 0x592
+, 0.011946923912775, 0.010990677079209, 0.010023803995436, 0.009046304661457, 0.008058179077271, 0.007080195809078, 0.006112354856880, 0.005154656220675, 0.004207099900465, 0.003269685896248, 0.002360186012685, 0.001478600249774, 0.000624928607517, -0.000200828914086, -0.000998672315037, -0.001755433249132 // 0x608
+, -0.002471111716372, -0.003145707716755, -0.003779221250284, -0.004371652316957, -0.004915414204509, -0.005410506912941, -0.005856930442253, -0.006254684792445, -0.006603769963516, -0.006902463941707, -0.007150766727019, -0.007348678319451, -0.007496198719003, -0.007593327925675, -0.007643854232750, -0.007647777640227 // 0x624
+, -0.007605098148106, -0.007515815756387, -0.007379930465071, -0.007205831157316, -0.006993517833125, -0.006742990492495, -0.006454249135428, -0.006127293761924, -0.005773804196077, -0.005393780437888, -0.004987222487357, -0.004554130344485, -0.004094504009270, -0.003621774660414, -0.003135942297919, -0.002637006921783 // 0x640
+, -0.002124968532006, -0.001599827128589, -0.001075196573598, -0.000551076867033, -0.000027468008894, 0.000495630000820, 0.001018217162107, 0.001527944803307, 0.002024812924418, 0.002508821525441, 0.002979970606375, 0.003438260167222, 0.003873773991069, 0.004286512077918, 0.004676474427767, 0.005043661040618 // 0x656
+, 0.005388071916469, 0.005703029344958, 0.005988533326085, 0.006244583859850, 0.006471180946252, 0.006668324585292, 0.006832949701403, 0.006965056294586, 0.007064644364840, 0.007131713912166, 0.007166264936563, 0.007168822565437, 0.007139386798787, 0.007077957636614, 0.006984535078918, 0.006859119125698 // 0x672
+, 0.006705414916318, 0.006523422450777, 0.006313141729075, 0.006074572751213, 0.005807715517190, 0.005518770798348, 0.005207738594688, 0.004874618906209, 0.004519411732910, 0.004142117074794, 0.003750562785460, 0.003344748864910, 0.002924675313143, 0.002490342130159, 0.002041749315958, 0.001587389703894 // 0x688
+, 0.001127263293967, 0.000661370086176, 0.000189710080521, -0.000287716722997, -0.000762625993125, -0.001235017729862, -0.001704891933208, -0.002172248603163, -0.002637087739728, -0.003092157439647, -0.003537457702921, -0.003972988529550, -0.004398749919533, -0.004814741872871, -0.005215302976564, -0.005600433230612 // 0x704
+, -0.005970132635015, -0.006324401189774, -0.006663238894887, -0.006982935597889, -0.007283491298779, -0.007564905997558, -0.007827179694226, -0.008070312388781, -0.008292668246357, -0.008494247266953, -0.008675049450569, -0.008835074797204, -0.008974323306860, -0.009093119357955, -0.009191462950489, -0.009269354084462 // 0x720
+, -0.009326792759875, -0.009363778976726, -0.009382298355031, -0.009382350894790, -0.009363936596003, -0.009327055458669, -0.009271707482788, -0.009201133856810, -0.009115334580732, -0.009014309654557, -0.008898059078283, -0.008766582851911, -0.008623893977045, -0.008469992453686, -0.008304878281834, -0.008128551461489 // 0x736
+, -0.007941011992651, -0.007746553174929, -0.007545175008324, -0.007336877492834, -0.007121660628461, -0.006899524415205, -0.006674598154346, -0.006446881845884, -0.006216375489820, -0.005983079086154, -0.005746992634885, -0.005511733440297, -0.005277301502391, -0.005043696821166, -0.004810919396623, -0.004578969228761 // 0x752
+, -0.004350705033337, -0.004126126810352, -0.003905234559807, -0.003688028281700, -0.003474507976032, -0.003266647283813, -0.003064446205042, -0.002867904739721, -0.002677022887848, -0.002491800649425, -0.002313313504151, -0.002141561452028, -0.001976544493055, -0.001818262627232, -0.001666715854560, -0.001522167916113 // 0x768
+, -0.001384618811891, -0.001254068541895, -0.001130517106123, -0.001013964504578, -0.000904012593027, -0.000800661371470, -0.000703910839908, -0.000613760998341, -0.000530211846768, -0.000452391489388, -0.000380299926199, -0.000313937157203, -0.000253303182399, -0.000198398001788, -0.000145615093242, -0.000094954456762 // 0x784
+, -0.000046416092348
+};
+static const double __in_flash() __aligned(8) filter_48000_2[1001] = {
+  0.972990380418290, 0.972805187586607, 0.972768149020271, 0.972735933448122, 0.972708540870160, 0.972685971286385, 0.972668224696798, 0.972655301101398, 0.972643453266905, 0.972632681193319, 0.972622984880641, 0.972614364328869, 0.972606819538005, 0.972601838525463, 0.972599421291242, 0.972599567835344 // 0x0
+, 0.972602278157767, 0.972607552258512, 0.972617176253364, 0.972631150142322, 0.972649473925387, 0.972672147602559, 0.972699171173837, 0.972732497289961, 0.972772125950928, 0.972818057156741, 0.972870290907398, 0.972928827202899, 0.972995597135947, 0.973070600706540, 0.973153837914679, 0.973245308760364 // 0x16
+, 0.973345013243594, 0.973454619699315, 0.973574128127525, 0.973703538528225, 0.973842850901415, 0.973992065247095, 0.974152325209809, 0.974323630789557, 0.974505981986338, 0.974699378800153, 0.974903821231002, 0.975119668990453, 0.975346922078506, 0.975585580495161, 0.975835644240417, 0.976097113314275 // 0x32
+, 0.976369352690781, 0.976652362369936, 0.976946142351738, 0.977250692636189, 0.977566013223288, 0.977890339404258, 0.978223671179099, 0.978566008547812, 0.978917351510396, 0.979277700066852, 0.979644140878588, 0.980016673945606, 0.980395299267904, 0.980780016845484, 0.981170826678344, 0.981563774051203 // 0x48
+, 0.981958858964062, 0.982356081416919, 0.982755441409776, 0.983156938942631, 0.983555830328327, 0.983952115566864, 0.984345794658242, 0.984736867602460, 0.985125334399519, 0.985506043285327, 0.985878994259882, 0.986244187323186, 0.986601622475238, 0.986951299716038, 0.987288150398246, 0.987612174521862 // 0x64
+, 0.987923372086886, 0.988221743093318, 0.988507287541157, 0.988775567868783, 0.989026584076195, 0.989260336163394, 0.989476824130379, 0.989676047977149, 0.989854752417850, 0.990012937452480, 0.990150603081039, 0.990267749303528, 0.990364376119946, 0.990438887675476, 0.990491283970119, 0.990521565003875 // 0x80
+, 0.990529730776743, 0.990515781288723, 0.990480128807372, 0.990422773332689, 0.990343714864675, 0.990242953403329, 0.990120488948652, 0.989978900922158, 0.989818189323849, 0.989638354153724, 0.989439395411784, 0.989221313098027, 0.988988785262458, 0.988741811905075, 0.988480393025880, 0.988204528624872 // 0x96
+, 0.987914218702050, 0.987615911150815, 0.987309605971165, 0.986995303163101, 0.986673002726623, 0.986342704661730, 0.986012052903951, 0.985681047453286, 0.985349688309735, 0.985017975473298, 0.984685908943975, 0.984361566570519, 0.984044948352930, 0.983736054291209, 0.983434884385355, 0.983141438635368 // 0x112
+, 0.982863358238037, 0.982600643193363, 0.982353293501344, 0.982121309161982, 0.981904690175276, 0.981709724117639, 0.981536410989072, 0.981384750789574, 0.981254743519146, 0.981146389177788, 0.981063758350694, 0.981006851037867, 0.980975667239304, 0.980970206955007, 0.980990470184976, 0.981037722009150 // 0x128
+, 0.981111962427529, 0.981213191440115, 0.981341409046906, 0.981496615247902, 0.981676861818449, 0.981882148758545, 0.982112476068192, 0.982367843747388, 0.982648251796134, 0.982948561372225, 0.983268772475662, 0.983608885106445, 0.983968899264573, 0.984348814950046, 0.984740681753618, 0.985144499675286 // 0x144
+, 0.985560268715053, 0.985987988872917, 0.986427660148879, 0.986869275140711, 0.987312833848415, 0.987758336271990, 0.988205782411436, 0.988655172266754, 0.989095518456674, 0.989526820981196, 0.989949079840322, 0.990362295034050, 0.990766466562381, 0.991150897859301, 0.991515588924809, 0.991860539758906 // 0x160
+, 0.992185750361592, 0.992491220732867, 0.992767892645908, 0.993015766100718, 0.993234841097294, 0.993425117635638, 0.993586595715749, 0.993713097752226, 0.993804623745069, 0.993861173694278, 0.993882747599853, 0.993869345461794, 0.993818664202139, 0.993730703820889, 0.993605464318044, 0.993442945693603 // 0x176
+, 0.993243147947567, 0.993008222908723, 0.992738170577071, 0.992432990952611, 0.992092684035343, 0.991717249825267, 0.991313376292000, 0.990881063435544, 0.990420311255896, 0.989931119753058, 0.989413488927030, 0.988878154701533, 0.988325117076569, 0.987754376052136, 0.987165931628234, 0.986559783804865 // 0x192
+, 0.985949695534714, 0.985335666817781, 0.984717697654067, 0.984095788043570, 0.983469937986292, 0.982855451549422, 0.982252328732959, 0.981660569536903, 0.981080173961255, 0.980511142006015, 0.979968531272520, 0.979452341760770, 0.978962573470767, 0.978499226402508, 0.978062300555995, 0.977664701704324 // 0x208
+, 0.977306429847495, 0.976987484985508, 0.976707867118364, 0.976467576246061, 0.976275592295631, 0.976131915267074, 0.976036545160389, 0.975989481975577, 0.975990725712638, 0.976043903035549, 0.976149013944310, 0.976306058438921, 0.976515036519382, 0.976775948185693, 0.977086205322077, 0.977445807928532 // 0x224
+, 0.977854756005060, 0.978313049551661, 0.978820688568333, 0.979368710542751, 0.979957115474914, 0.980585903364823, 0.981255074212476, 0.981964628017875, 0.982699863663222, 0.983460781148516, 0.984247380473758, 0.985059661638948, 0.985897624644085, 0.986742228035862, 0.987593471814278, 0.988451355979333 // 0x240
+, 0.989315880531027, 0.990187045469361, 0.991043520473012, 0.991885305541982, 0.992712400676270, 0.993524805875877, 0.994322521140801, 0.995084414885455, 0.995810487109839, 0.996500737813953, 0.997155166997796, 0.997773774661368, 0.998338296772728, 0.998848733331876, 0.999305084338811, 0.999707349793533 // 0x256
+, 1.000055529696043, 1.000336734105991, 1.000550963023378, 1.000698216448202, 1.000778494380465, 1.000791796820166, 1.000732630966186, 1.000600996818526, 1.000396894377185, 1.000120323642164, 0.999771284613463, 0.999352952942557, 0.998865328629446, 0.998308411674132, 0.997682202076613, 0.996986699836889 // 0x272
+, 0.996234019979887, 0.995424162505606, 0.994557127414046, 0.993632914705208, 0.992651524379091, 0.991633195993350, 0.990577929547984, 0.989485725042994, 0.988356582478379, 0.987190501854140, 0.986013957553037, 0.984826949575071, 0.983629477920240, 0.982421542588546, 0.981203143579988, 0.980004167649884 // 0x288
+, 0.978824614798235, 0.977664485025040, 0.976523778330299, 0.975402494714013, 0.974330473940419, 0.973307716009517, 0.972334220921308, 0.971409988675791, 0.970535019272966, 0.969735368956590, 0.969011037726661, 0.968362025583179, 0.967788332526146, 0.967289958555560, 0.966885621652021, 0.966575321815529 // 0x304
+, 0.966359059046083, 0.966236833343684, 0.966208644708331, 0.966282934912267, 0.966459703955493, 0.966738951838006, 0.967120678559809, 0.967604884120900, 0.968187840388392, 0.968869547362284, 0.969650005042577, 0.970529213429271, 0.971507172522365, 0.972567431324918, 0.973709989836930, 0.974934848058401 // 0x320
+, 0.976242005989331, 0.977631463629720, 0.979075031010579, 0.980572708131907, 0.982124494993704, 0.983730391595971, 0.985390397938707, 0.987067086237491, 0.988760456492322, 0.990470508703201, 0.992197242870127, 0.993940658993101, 0.995657946680848, 0.997349105933368, 0.999014136750661, 1.000653039132727 // 0x336
+, 1.002265813079567, 1.003809101442769, 1.005282904222333, 1.006687221418259, 1.008022053030547, 1.009287399059197, 1.010444684440769, 1.011493909175262, 1.012435073262677, 1.013268176703014, 1.013993219496272, 1.014581609938243, 1.015033348028928, 1.015348433768327, 1.015526867156439, 1.015568648193264 // 0x352
+, 1.015459627463980, 1.015199804968588, 1.014789180707087, 1.014227754679477, 1.013515526885759, 1.012655895911801, 1.011648861757602, 1.010494424423164, 1.009192583908486, 1.007743340213567, 1.006168926408435, 1.004469342493089, 1.002644588467529, 1.000694664331755, 0.998619570085767, 0.996459512568849 // 0x368
+, 0.994214491781002, 0.991884507722223, 0.989469560392515, 0.986969649791877, 0.984439880635367, 0.981880252922985, 0.979290766654730, 0.976671421830604, 0.974022218450605, 0.971408014971192, 0.968828811392364, 0.966284607714123, 0.963775403936467, 0.961301200059397, 0.958929814662112, 0.956661247744614 // 0x384
+, 0.954495499306902, 0.952432569348975, 0.950472457870835, 0.948678102969418, 0.947049504644726, 0.945586662896758, 0.944289577725513, 0.943158249130993, 0.942242649908889, 0.941542780059200, 0.941058639581928, 0.940790228477072, 0.940737546744632, 0.940930114901692, 0.941367932948251, 0.942051000884311 // 0x400
+, 0.942979318709870, 0.944152886424930, 0.945574748837077, 0.947244905946313, 0.949163357752636, 0.951330104256049, 0.953745145456549, 0.956381243959035, 0.959238399763507, 0.962316612869965, 0.965615883278409, 0.969136210988839, 0.972819052876724, 0.976664408942064, 0.980672279184859, 0.984842663605110 // 0x416
+, 0.989175562202815, 0.993583188580410, 0.998065542737894, 1.002622624675267, 1.007254434392529, 1.011960971889681, 1.016630371926077, 1.021262634501717, 1.025857759616602, 1.030415747270732, 1.034936597464106, 1.039292301031250, 1.043482857972162, 1.047508268286844, 1.051368531975295, 1.055063649037516 // 0x432
+, 1.058459572614864, 1.061556302707341, 1.064353839314945, 1.066852182437676, 1.069051332075536, 1.070822601097179, 1.072165989502606, 1.073081497291817, 1.073569124464812, 1.073628871021591, 1.073149076564756, 1.072129741094308, 1.070570864610246, 1.068472447112571, 1.065834488601282, 1.062573177587782 // 0x448
+, 1.058688514072071, 1.054180498054147, 1.049049129534012, 1.043294408511666, 1.036869301003365, 1.029773807009109, 1.022007926528899, 1.013571659562734, 1.004465006110615, 0.994683812952277, 0.984228080087719, 0.973097807516942, 0.961292995239946, 0.948813643256731, 0.935701114067061, 0.921955407670938 // 0x464
+, 0.907576524068362, 0.892564463259331, 0.876919225243846, 0.860726487421364, 0.843986249791884, 0.826698512355405, 0.808863275111929, 0.790480538061455, 0.771675286064072, 0.752447519119780, 0.732797237228579, 0.712724440390469, 0.692229128605451, 0.671467142697268, 0.650438482665921, 0.629143148511410 // 0x480
+, 0.607581140233735, 0.585752457832896, 0.563832630430538, 0.541821658026662, 0.519719540621266, 0.497526278214352, 0.475241870805919, 0.453048608399005, 0.430946490993609, 0.408935518589733, 0.387015691187375, 0.365187008786536, 0.343625000508861, 0.322329666354350, 0.301301006323003, 0.280539020414820 // 0x496
+, 0.260043708629802, 0.239970911791692, 0.220320629900491, 0.201092862956199, 0.182287610958816, 0.163904873908342, 0.146069636664866, 0.128781899228387, 0.112041661598907, 0.095848923776424, 0.080203685760940, 0.065191624951909, 0.050812741349332, 0.037067034953209, 0.023954505763540, 0.011475153780325 // 0x512
+, -0.000329658496671, -0.011459931067448, -0.021915663932006, -0.031696857090344, -0.040803510542464, -0.049239777508628, -0.057005657988838, -0.064101151983094, -0.070526259491395, -0.076280980513742, -0.081412349033876, -0.085920365051800, -0.089805028567511, -0.093066339581012, -0.095704298092300, -0.097802715589975 // 0x528
+, -0.099361592074037, -0.100380927544485, -0.100860722001320, -0.100800975444541, -0.100313348271547, -0.099397840482336, -0.098054452076908, -0.096283183055265, -0.094084033417405, -0.091585690294674, -0.088788153687070, -0.085691423594593, -0.082295500017245, -0.078600382955025, -0.074740119266573, -0.070714708951891 // 0x544
+, -0.066524152010979, -0.062168448443835, -0.057647598250461, -0.053089610596331, -0.048494485481446, -0.043862222905806, -0.039192822869410, -0.034486285372259, -0.029854475654996, -0.025297393717623, -0.020815039560139, -0.016407413182545, -0.012074514584839, -0.007904130164588, -0.003896259921793, -0.000050903856453 // 0x560
+, 0.003631938031432, 0.007152265741862, 0.010451536150306, 0.013529749256764, 0.016386905061236, 0.019023003563722, 0.021438044764222, 0.023604791267634, 0.025523243073958, 0.027193400183194, 0.028615262595341, 0.029788830310400, 0.030717148135960, 0.031400216072019, 0.031838034118579, 0.032030602275639 // 0x576
+, 0.031977920543199, 0.031709509438342, 0.031225368961070, 0.030525499111382, 0.029609899889278, 0.028478571294757, 0.027181486123513, 0.025718644375545, 0.024090046050852, 0.022295691149436, 0.020335579671295, 0.018272649713369, 0.016106901275657, 0.013838334358158, 0.011466948960874, 0.008992745083804 // 0x592
+, 0.006483541306148, 0.003939337627906, 0.001360134049079, -0.001254069430334, -0.003903272810333, -0.006522617634460, -0.009112103902714, -0.011671731615097, -0.014201500771607, -0.016701411372245, -0.019116358701953, -0.021446342760731, -0.023691363548579, -0.025851421065497, -0.027926515311485, -0.029876439447259 // 0x608
+, -0.031701193472819, -0.033400777388165, -0.034975191193297, -0.036424434888215, -0.037726275402893, -0.038880712737332, -0.039887746891530, -0.040747377865488, -0.041459605659207, -0.042021031686816, -0.042431655948317, -0.042691478443710, -0.042800499172993, -0.042758718136168, -0.042580284748056, -0.042265199008658 // 0x624
+, -0.041813460917973, -0.041225070476001, -0.040500027682743, -0.039666924242407, -0.038725760154992, -0.037676535420498, -0.036519250038926, -0.035253904010276, -0.033919072397988, -0.032514755202062, -0.031040952422498, -0.029497664059296, -0.027884890112457, -0.026245987730390, -0.024580956913097, -0.022889797660577 // 0x640
+, -0.021172509972830, -0.019429093849856, -0.017702359682930, -0.015992307472051, -0.014298937217220, -0.012622248918436, -0.010962242575700, -0.009356345973433, -0.007804559111636, -0.006306881990308, -0.004863314609449, -0.003473856969060, -0.002166699038130, -0.000941840816659, 0.000200717695353, 0.001260976497906 // 0x656
+, 0.002238935591000, 0.003118143977693, 0.003898601657986, 0.004580308631879, 0.005163264899370, 0.005647470460462, 0.006029197182264, 0.006308445064778, 0.006485214108003, 0.006559504311939, 0.006531315676587, 0.006409089974188, 0.006192827204742, 0.005882527368249, 0.005478190464710, 0.004979816494125 // 0x672
+, 0.004406123437091, 0.003757111293610, 0.003032780063681, 0.002233129747304, 0.001358160344480, 0.000433928098963, -0.000539566989247, -0.001562324920148, -0.002634345693742, -0.003755629310028, -0.004896336004769, -0.006056465777964, -0.007236018629613, -0.008434994559717, -0.009653393568275, -0.010861328899969 // 0x688
+, -0.012058800554800, -0.013245808532767, -0.014422352833869, -0.015588433458108, -0.016717576022723, -0.017809780527713, -0.018865046973079, -0.019883375358820, -0.020864765684937, -0.021788978393775, -0.022656013485335, -0.023465870959616, -0.024218550816618, -0.024914053056342, -0.025540262653861, -0.026097179609176 // 0x704
+, -0.026584803922286, -0.027003135593192, -0.027352174621893, -0.027628745356914, -0.027832847798255, -0.027964481945915, -0.028023647799895, -0.028010345360194, -0.027930067427931, -0.027782814003107, -0.027568585085720, -0.027287380675772, -0.026939200773262, -0.026536935318540, -0.026080584311605, -0.025570147752457 // 0x720
+, -0.025005625641097, -0.024387017977525, -0.023732588793682, -0.023042338089568, -0.022316265865184, -0.021554372120530, -0.020756656855606, -0.019944251655999, -0.019117156521711, -0.018275371452741, -0.017418896449089, -0.016547731510756, -0.015683206959061, -0.014825322794006, -0.013974079015591, -0.013129475623814 // 0x736
+, -0.012291512618677, -0.011479231453487, -0.010692632128245, -0.009931714642951, -0.009196478997604, -0.008486925192205, -0.007817754344551, -0.007188966454643, -0.006600561522480, -0.006052539548062, -0.005544900531389, -0.005086606984789, -0.004677658908261, -0.004318056301806, -0.004007799165422, -0.003746887499111 // 0x752
+, -0.003537909418650, -0.003380864924039, -0.003275754015278, -0.003222576692367, -0.003221332955306, -0.003268396140118, -0.003363766246803, -0.003507443275360, -0.003699427225790, -0.003939718098093, -0.004219335965237, -0.004538280827224, -0.004896552684053, -0.005294151535724, -0.005731077382237, -0.006194424450495 // 0x768
+, -0.006684192740499, -0.007200382252249, -0.007742992985744, -0.008312024940984, -0.008892420516632, -0.009484179712687, -0.010087302529150, -0.010701788966021, -0.011327639023299, -0.011949548633795, -0.012567517797510, -0.013181546514443, -0.013791634784594, -0.014397782607963, -0.014986227031865, -0.015556968056298 // 0x784
+, -0.016110005681262, -0.016645339906759, -0.017162970732787, -0.017652162235625, -0.018112914415273, -0.018545227271730, -0.018949100804996, -0.019324535015072, -0.019664841932340, -0.019970021556800, -0.020240073888452, -0.020474998927296, -0.020674796673332, -0.020837315297773, -0.020962554800618, -0.021050515181868 // 0x800
+, -0.021101196441523, -0.021114598579582, -0.021093024674007, -0.021036474724798, -0.020944948731955, -0.020818446695478, -0.020656968615367, -0.020466692077023, -0.020247617080447, -0.019999743625637, -0.019723071712596, -0.019417601341321, -0.019092390738635, -0.018747439904538, -0.018382748839030, -0.017998317542110 // 0x816
+, -0.017594146013779, -0.017180930820051, -0.016758671960925, -0.016327369436402, -0.015887023246482, -0.015437633391165, -0.014990187251719, -0.014544684828144, -0.014101126120440, -0.013659511128607, -0.013219839852646, -0.012792119694782, -0.012376350655015, -0.011972532733346, -0.011580665929775, -0.011200750244302 // 0x832
+, -0.010840736086174, -0.010500623455391, -0.010180412351954, -0.009880102775863, -0.009599694727117, -0.009344327047920, -0.009113999738274, -0.008908712798178, -0.008728466227631, -0.008573260026634, -0.008445042419843, -0.008343813407258, -0.008269572988878, -0.008222321164704, -0.008202057934736, -0.008207518219033 // 0x848
+, -0.008238702017595, -0.008295609330423, -0.008378240157516, -0.008486594498875, -0.008616601769303, -0.008768261968800, -0.008941575097368, -0.009136541155004, -0.009353160141711, -0.009585144481073, -0.009832494173091, -0.010095209217766, -0.010373289615097, -0.010666735365083, -0.010967905270937, -0.011276799332659 // 0x864
+, -0.011593417550248, -0.011917759923704, -0.012249826453027, -0.012581539289464, -0.012912898433015, -0.013243903883680, -0.013574555641459, -0.013904853706351, -0.014227154142830, -0.014541456950894, -0.014847762130543, -0.015146069681779, -0.015436379604600, -0.015712244005609, -0.015973662884804, -0.016220636242187 // 0x880
+, -0.016453164077756, -0.016671246391513, -0.016870205133453, -0.017050040303578, -0.017210751901887, -0.017352339928380, -0.017474804383058, -0.017575565844404, -0.017654624312418, -0.017711979787101, -0.017747632268452, -0.017761581756472, -0.017753415983604, -0.017723134949848, -0.017670738655205, -0.017596227099675 // 0x896
+, -0.017499600283256, -0.017382454060768, -0.017244788432209, -0.017086603397579, -0.016907898956878, -0.016708675110107, -0.016492187143123, -0.016258435055924, -0.016007418848512, -0.015739138520886, -0.015453594073047, -0.015155223066615, -0.014844025501591, -0.014520001377975, -0.014183150695767, -0.013833473454967 // 0x912
+, -0.013476038302915, -0.013110845239611, -0.012737894265055, -0.012357185379248, -0.011968718582189, -0.011577645637971, -0.011183966546593, -0.010787681308056, -0.010388789922360, -0.009987292389505, -0.009587932396648, -0.009190709943791, -0.008795625030932, -0.008402677658073, -0.008011867825213, -0.007627150247633 // 0x928
+, -0.007248524925335, -0.006875991858317, -0.006509551046581, -0.006149202490125, -0.005797859527541, -0.005455522158828, -0.005122190383987, -0.004797864203017, -0.004482543615918, -0.004177993331467, -0.003884213349665, -0.003601203670510, -0.003328964294004, -0.003067495220146, -0.002817431474890, -0.002578773058235 // 0x944
+, -0.002351519970182, -0.002135672210732, -0.001931229779882, -0.001737832966067, -0.001555481769286, -0.001384176189538, -0.001223916226824, -0.001074701881144, -0.000935389507954, -0.000805979107254, -0.000686470679044, -0.000576864223323, -0.000477159740093, -0.000385688894408, -0.000302451686269, -0.000227448115676 // 0x960
+, -0.000160678182628, -0.000102141887127, -0.000049908136470, -0.000003976930657, 0.000035651730310, 0.000068977846433, 0.000096001417712, 0.000118675094884, 0.000136998877949, 0.000150972766907, 0.000160596761759, 0.000165870862504, 0.000168581184927, 0.000168727729029, 0.000166310494808, 0.000161329482266 // 0x976
+, 0.000153784691402, 0.000145164139630, 0.000135467826952, 0.000124695753366, 0.000112847918873, 0.000099924323473, 0.000082177733886, 0.000059608150111, 0.000032215572149
+};
+static const filter_table_t __in_flash() __aligned(4) filter_tables[] = {
+    { 8192, 0, 1201, filter_8192_0 },
+    { 8192, 1, 1201, filter_8192_0 },
+    { 8192, 2, 1201, filter_8192_0 },
+    { 11025, 0, 1201, filter_11025_0 },
+    { 11025, 1, 1201, filter_11025_0 },
+    { 11025, 2, 1201, filter_11025_0 },
+    { 22050, 0, 1001, filter_22050_0 },
+    { 22050, 1, 1001, filter_22050_1 },
+    { 22050, 2, 1001, filter_22050_2 },
+    { 44100, 0, 601, filter_44100_0 },
+    { 44100, 1, 801, filter_44100_1 },
+    { 44100, 2, 1001, filter_44100_2 },
+    { 48000, 0, 601, filter_48000_0 },
+    { 48000, 1, 801, filter_48000_1 },
+    { 48000, 2, 1001, filter_48000_2 },
+};
@@ -23,6 +23,7 @@
 */
 
 #include "config.h"
+#include <stddef.h>
 #include <string.h>
 
 #include "antic.h"
@@ -36,6 +37,7 @@
 #endif
 #include "pokeysnd.h"
 #include "screen.h"
+#include "sramtab.h"
 
 /* GTIA Registers ---------------------------------------------------------- */
 
@@ -128,14 +130,6 @@ int collision_curpos;
  * only be generated from this point on, otherwise it is 0
  */
 int hitclr_pos;
-#else
-#define P1PL_T GTIA_P1PL
-#define P2PL_T GTIA_P2PL
-#define P3PL_T GTIA_P3PL
-#define M0PL_T GTIA_M0PL
-#define M1PL_T GTIA_M1PL
-#define M2PL_T GTIA_M2PL
-#define M3PL_T GTIA_M3PL
 #endif /* NEW_CYCLE_EXACT */
 
 static UBYTE *hposp_ptr[4];
@@ -283,6 +277,8 @@ static ULONG __in_flash() __aligned(4096) grafp_lookup[4][256] =
     0x000FFFFF, 0xF00FFFFF, 0x0F0FFFFF, 0xFF0FFFFF, 0x00FFFFFF, 0xF0FFFFFF, 0x0FFFFFFF, 0xFFFFFFFF
  }
 };
+/* grafp_lookup, or its copy in SRAM */
+static ULONG (*grafp_table)[256] = grafp_lookup;
 
 static ULONG *grafp_ptr[4];
 static int global_sizem[4];
@@ -414,6 +410,7 @@ int GTIA_Initialise(int *argc, char *argv[])
 	sprintf(tmp, "};\n"); f_write(&f, tmp, strlen(tmp), &bw);
 	f_close(&f);
 **/
+	grafp_table = (ULONG (*)[256]) SRAMTAB_Place(SRAMTAB_GRAFP, grafp_lookup, sizeof(grafp_lookup));
 	memset(ANTIC_cl, GTIA_COLOUR_BLACK, sizeof(ANTIC_cl));
 	for (i = 0; i < 32; i++)
 		GTIA_PutByte((UWORD) i, 0);
@@ -492,8 +489,134 @@ void GTIA_UpdatePmplColls(void)
 	hitclr_pos = 0;
 }
 
+#elif !defined(BASIC) && !defined(CURSES_BASIC)
+
+/* Lazy pm->pl collisions.  Most programs never read M0PL..P3PL, so
+ * GTIA_NewPmScanline only draws the objects and, for lines on which two
+ * objects could observably overlap, records the few values the line was
+ * drawn from.  The collision bits are replayed from these records when the
+ * CPU reads a pm->pl register or the state is saved, and thrown away on
+ * HITCLR.  Lines holding a single object only set the object's own bit
+ * (or missile/missile bits), which the read masks hide anyway.
+ * Playfield collisions are still merged eagerly in antic.c, as the playfield
+ * pixels of a line are not kept after it is drawn. */
+
+typedef struct {
+	ULONG grafp[4];		/* player bits, already clipped by hposp_mask */
+	SWORD hposp[4];		/* offsets of hposp_ptr within GTIA_pm_scanline */
+	SWORD hposm[4];		/* offsets of hposm_ptr within GTIA_pm_scanline */
+	UBYTE sizem[4];
+	UBYTE grafm;
+} pmpl_line_t;
+
+#define PMPL_PENDING_MAX 16
+static pmpl_line_t pmpl_pending[PMPL_PENDING_MAX];
+static int pmpl_pending_n = 0;
+
+ULONG GTIA_pmpl_lines_recorded = 0;
+ULONG GTIA_pmpl_lines_resolved = 0;
+ULONG GTIA_pmpl_lines_avoided = 0;
+
+/* Replays one recorded line exactly as the eager drawing code would. */
+static void resolve_pmpl_line(const pmpl_line_t *l)
+{
+	static UBYTE scanline[Screen_WIDTH / 2 + 8];
+	UBYTE *const pl[4] = { &GTIA_P0PL, &GTIA_P1PL, &GTIA_P2PL, &GTIA_P3PL };
+	UBYTE *const ml[4] = { &GTIA_M0PL, &GTIA_M1PL, &GTIA_M2PL, &GTIA_M3PL };
+	int n;
+
+	memset(scanline, 0, Screen_WIDTH / 2);
+	for (n = 0; n < 4; n++) {
+		ULONG grafp = l->grafp[n];
+		UBYTE *ptr = scanline + l->hposp[n];
+		UBYTE colls = 0;
+		while (grafp) {
+			if (grafp & 1)
+				colls |= *ptr |= 1 << n;
+			ptr++;
+			grafp >>= 1;
+		}
+		if (n != 0) /* P0PL is never updated */
+			*pl[n] |= colls;
+	}
+	for (n = 3; n >= 0; n--) {
+		int j = l->sizem[n];
+		UBYTE *ptr = scanline + l->hposm[n];
+		UBYTE colls = 0;
+		if (!(l->grafm & (3 << (n * 2))))
+			continue;
+		if (l->grafm & (2 << (n * 2))) {
+			if (l->grafm & (1 << (n * 2)))
+				j <<= 1;
+		}
+		else
+			ptr += j;
+		if (ptr < scanline + 2) {
+			j += ptr - scanline - 2;
+			ptr = scanline + 2;
+		}
+		else if (ptr + j > scanline + Screen_WIDTH / 2 - 2)
+			j = scanline + Screen_WIDTH / 2 - 2 - ptr;
+		for (; j > 0; j--)
+			colls |= *ptr++ |= 0x10 << n;
+		*ml[n] |= colls;
+	}
+	GTIA_pmpl_lines_resolved++;
+}
+
+static void update_partial_pmpl_colls(void)
+{
+	int i;
+	for (i = 0; i < pmpl_pending_n; i++)
+		resolve_pmpl_line(&pmpl_pending[i]);
+	pmpl_pending_n = 0;
+}
+
+/* Called from GTIA_NewPmScanline with the players that were drawn
+ * (bit n = player n) and whether any missile was drawn. */
+static void record_pmpl_line(int players, int missiles)
+{
+	pmpl_line_t *l;
+	int n;
+
+	/* nothing observable unless two players, or a player and a missile */
+	if (!(players & (players - 1)) && !(players && missiles)) {
+		GTIA_pmpl_lines_avoided++;
+		return;
+	}
+	if (pmpl_pending_n == PMPL_PENDING_MAX)
+		update_partial_pmpl_colls();
+	l = &pmpl_pending[pmpl_pending_n];
+	SRAMTAB_COUNT(SRAMTAB_GRAFP);
+	l->grafp[0] = (players & 1) ? grafp_ptr[0][GTIA_GRAFP0] & hposp_mask[0] : 0;
+	l->grafp[1] = (players & 2) ? grafp_ptr[1][GTIA_GRAFP1] & hposp_mask[1] : 0;
+	l->grafp[2] = (players & 4) ? grafp_ptr[2][GTIA_GRAFP2] & hposp_mask[2] : 0;
+	l->grafp[3] = (players & 8) ? grafp_ptr[3][GTIA_GRAFP3] & hposp_mask[3] : 0;
+	for (n = 0; n < 4; n++) {
+		l->hposp[n] = (SWORD) (hposp_ptr[n] - GTIA_pm_scanline);
+		l->hposm[n] = (SWORD) (hposm_ptr[n] - GTIA_pm_scanline);
+		l->sizem[n] = (UBYTE) global_sizem[n];
+	}
+	l->grafm = GTIA_GRAFM;
+	/* collisions are ORed in, so repeating the previous line adds nothing */
+	if (pmpl_pending_n > 0 && memcmp(l, l - 1, offsetof(pmpl_line_t, grafm) + 1) == 0) {
+		GTIA_pmpl_lines_avoided++;
+		return;
+	}
+	pmpl_pending_n++;
+	GTIA_pmpl_lines_recorded++;
+}
+
+/* Drops pending lines, e.g. on HITCLR, whose collisions are never needed. */
+static void discard_pmpl_colls(void)
+{
+	GTIA_pmpl_lines_avoided += pmpl_pending_n;
+	pmpl_pending_n = 0;
+}
+
 #else
 #define update_partial_pmpl_colls()
+#define discard_pmpl_colls()
 #endif /* NEW_CYCLE_EXACT */
 
 /* Prepare PMG scanline ---------------------------------------------------- */
@@ -506,6 +629,13 @@ void GTIA_NewPmScanline(void)
 /* reset temporary pm->pl collisions */
 	P1PL_T = P2PL_T = P3PL_T = 0;
 	M0PL_T = M1PL_T = M2PL_T = M3PL_T = 0;
+#define PMPL_COLL(reg) reg |=
+#define PMPL_DRAWN(n)
+#else
+/* pm->pl collisions are recorded for later, see record_pmpl_line() */
+	int players = 0;
+#define PMPL_COLL(reg)
+#define PMPL_DRAWN(n) players |= 1 << n;
 #endif /* NEW_CYCLE_EXACT */
 /* Clear if necessary */
 	if (GTIA_pm_dirty) {
@@ -517,12 +647,14 @@ void GTIA_NewPmScanline(void)
 
 #define DO_PLAYER(n)	if (GTIA_GRAFP##n) {						\
 	ULONG grafp = grafp_ptr[n][GTIA_GRAFP##n] & hposp_mask[n];	\
+	SRAMTAB_COUNT(SRAMTAB_GRAFP);							\
 	if (grafp) {											\
 		UBYTE *ptr = hposp_ptr[n];							\
 		GTIA_pm_dirty = TRUE;									\
+		PMPL_DRAWN(n)										\
 		do {												\
 			if (grafp & 1)									\
-				P##n##PL_T |= *ptr |= 1 << n;					\
+				PMPL_COLL(P##n##PL_T) *ptr |= 1 << n;			\
 			ptr++;											\
 			grafp >>= 1;									\
 		} while (grafp);									\
@@ -532,9 +664,11 @@ void GTIA_NewPmScanline(void)
 	/* optimized DO_PLAYER(0): GTIA_pm_scanline is clear and P0PL is unused */
 	if (GTIA_GRAFP0) {
 		ULONG grafp = grafp_ptr[0][GTIA_GRAFP0] & hposp_mask[0];
+		SRAMTAB_COUNT(SRAMTAB_GRAFP);
 		if (grafp) {
 			UBYTE *ptr = hposp_ptr[0];
 			GTIA_pm_dirty = TRUE;
+			PMPL_DRAWN(0)
 			do {
 				if (grafp & 1)
 					*ptr = 1;
@@ -567,7 +701,7 @@ void GTIA_NewPmScanline(void)
 		j = GTIA_pm_scanline + Screen_WIDTH / 2 - 2 - ptr;		\
 	if (j > 0)										\
 		do											\
-			M##n##PL_T |= *ptr++ |= p;				\
+			PMPL_COLL(M##n##PL_T) *ptr++ |= p;		\
 		while (--j);								\
 }
 
@@ -578,6 +712,10 @@ void GTIA_NewPmScanline(void)
 		DO_MISSILE(1, 0x20, 0x0c, 0x08, 0x04)
 		DO_MISSILE(0, 0x10, 0x03, 0x02, 0x01)
 	}
+#ifndef NEW_CYCLE_EXACT
+	if (players != 0 || GTIA_GRAFM)
+		record_pmpl_line(players, GTIA_GRAFM);
+#endif
 }
 
 #endif /* !defined(BASIC) && !defined(CURSES_BASIC) */
@@ -1223,6 +1361,7 @@ void GTIA_PutByte(UWORD addr, UBYTE byte)
 	DO_GRAFP(3)
 
 	case GTIA_OFFSET_HITCLR:
+		discard_pmpl_colls();
 		GTIA_M0PL = GTIA_M1PL = GTIA_M2PL = GTIA_M3PL = 0;
 		GTIA_P0PL = GTIA_P1PL = GTIA_P2PL = GTIA_P3PL = 0;
 		PF0PM = PF1PM = PF2PM = PF3PM = 0;
@@ -1323,22 +1462,22 @@ void GTIA_PutByte(UWORD addr, UBYTE byte)
 		break;
 	case GTIA_OFFSET_SIZEP0:
 		GTIA_SIZEP0 = byte;
-		grafp_ptr[0] = grafp_lookup[byte & 3];
+		grafp_ptr[0] = grafp_table[byte & 3];
 		UPDATE_PM_CYCLE_EXACT
 		break;
 	case GTIA_OFFSET_SIZEP1:
 		GTIA_SIZEP1 = byte;
-		grafp_ptr[1] = grafp_lookup[byte & 3];
+		grafp_ptr[1] = grafp_table[byte & 3];
 		UPDATE_PM_CYCLE_EXACT
 		break;
 	case GTIA_OFFSET_SIZEP2:
 		GTIA_SIZEP2 = byte;
-		grafp_ptr[2] = grafp_lookup[byte & 3];
+		grafp_ptr[2] = grafp_table[byte & 3];
 		UPDATE_PM_CYCLE_EXACT
 		break;
 	case GTIA_OFFSET_SIZEP3:
 		GTIA_SIZEP3 = byte;
-		grafp_ptr[3] = grafp_lookup[byte & 3];
+		grafp_ptr[3] = grafp_table[byte & 3];
 		UPDATE_PM_CYCLE_EXACT
 		break;
 	case GTIA_OFFSET_PRIOR:
@@ -1373,6 +1512,7 @@ void GTIA_StateSave(void)
 	int next_console_value = 7;
 
 	STATESAV_TAG(gtia);
+	update_partial_pmpl_colls();
 	StateSav_SaveUBYTE(&GTIA_HPOSP0, 1);
 	StateSav_SaveUBYTE(&GTIA_HPOSP1, 1);
 	StateSav_SaveUBYTE(&GTIA_HPOSP2, 1);
@@ -1426,6 +1566,7 @@ void GTIA_StateRead(UBYTE version)
 {
 	int next_console_value;	/* ignored */
 
+	discard_pmpl_colls();
 	StateSav_ReadUBYTE(&GTIA_HPOSP0, 1);
 	StateSav_ReadUBYTE(&GTIA_HPOSP1, 1);
 	StateSav_ReadUBYTE(&GTIA_HPOSP2, 1);
@@ -118,6 +118,14 @@ extern UBYTE GTIA_collisions_mask_player_playfield;
 extern UBYTE GTIA_collisions_mask_missile_player;
 extern UBYTE GTIA_collisions_mask_player_player;
 
+#ifndef NEW_CYCLE_EXACT
+/* Lazy pm->pl collision statistics: lines whose collisions were queued,
+   replayed on a read of M0PL..P3PL, and never computed at all. */
+extern ULONG GTIA_pmpl_lines_recorded;
+extern ULONG GTIA_pmpl_lines_resolved;
+extern ULONG GTIA_pmpl_lines_avoided;
+#endif
+
 extern UBYTE GTIA_TRIG[4];
 extern UBYTE GTIA_TRIG_latch[4];
 
@@ -56,6 +56,7 @@
 
 #endif
 #include "ide.h"
+#include "blkcache.h"
 #include "atari.h"
 #include "log.h"
 #include "util.h"
@@ -91,6 +92,12 @@
 int IDE_enabled = 0, IDE_debug = 0;
 
 struct ide_device device;
+/* Sectors go through the block cache that SIO, PBI SCSI and H: share. Its
+   blocks are the size of a sector and it has the write-back, read-ahead
+   and flushes the sector cache of this file had, so that cache is gone:
+   keeping it would hold every sector twice and take SRAM from the other
+   devices. Note the emulation is only reached with IDE defined. */
+static BLKCACHE_dev_t ide_blk = { "IDE" };
 
 static int count = 0;     /* for debug stuff */
 
@@ -149,6 +156,13 @@ static void ide_identify(struct ide_device *s) {
     LE16(p, 60, s->nb_sectors);     /* total number of LBA sectors */
     LE16(p, 61, s->nb_sectors >> 16);
 
+    LE16(p, 82, 0x0020);            /* write cache supported */
+    LE16(p, 83, 0x5000);            /* FLUSH CACHE supported */
+    LE16(p, 84, 0x4000);
+    LE16(p, 85, ide_blk.write_through ? 0 : 0x0020);
+    LE16(p, 86, 0x1000);
+    LE16(p, 87, 0x4000);
+
     if (s->is_cf) {
         LE16(p, 0, 0x848a);         /* CF Storage Card signature */
         padstr(p+27*2, "ATARI800 MICRODRIVE", 40);
@@ -208,10 +222,12 @@ static void ide_reset(struct ide_device *s) {
 }
 
 static int ide_init_drive(struct ide_device *s, char *filename) {
-    if (f_open(&s->file, filename, FA_READ) != FR_OK) {
+    s->read_only = f_open(&s->file, filename, FA_READ | FA_WRITE) != FR_OK;
+    if (s->read_only && f_open(&s->file, filename, FA_READ) != FR_OK) {
         Log_print("%s: %s", filename, strerror(errno));
         return FALSE;
     }
+    BLKCACHE_Map(&s->file);
     s->blocksize = SECTOR_SIZE;
     s->filesize = f_size(&s->file);
 
@@ -222,6 +238,7 @@ static int ide_init_drive(struct ide_device *s, char *filename) {
         s->io_buffer_size = SECTOR_SIZE * MAX_MULT_SECTORS;
         s->io_buffer      = Util_malloc(s->io_buffer_size, "ide_init_drive");
     }
+    ide_blk.write_through = FALSE;
 
     s->nb_sectors = s->filesize / SECTOR_SIZE;
 
@@ -375,6 +392,27 @@ static void ide_set_sector(struct ide_device *s, int64_t sector_num) {
     }
 }
 
+/* Copies N sectors from SECTOR on to io_buffer. */
+static int ide_cache_read(struct ide_device *s, int64_t sector, int n) {
+    UINT br;
+
+    return sector + n <= s->nb_sectors
+        && BLKCACHE_Read(&ide_blk, &s->file, sector * SECTOR_SIZE,
+                         s->io_buffer, n * SECTOR_SIZE, &br)
+        && br == (UINT)n * SECTOR_SIZE;
+}
+
+/* Stores N sectors from io_buffer at SECTOR. Unless the write cache has
+   been turned off, they reach the image later. */
+static int ide_cache_write(struct ide_device *s, int64_t sector, int n) {
+    UINT bw;
+
+    return !s->read_only && sector + n <= s->nb_sectors
+        && BLKCACHE_Write(&ide_blk, &s->file, sector * SECTOR_SIZE,
+                          s->io_buffer, n * SECTOR_SIZE, &bw)
+        && bw == (UINT)n * SECTOR_SIZE;
+}
+
 static void ide_sector_read(struct ide_device *s) {
     int64_t sector_num;
     int n;
@@ -393,10 +431,7 @@ static void ide_sector_read(struct ide_device *s) {
         if (n > s->req_nb_sectors)
             n = s->req_nb_sectors;
 
-        if (f_lseek(&s->file, sector_num * SECTOR_SIZE) != FR_OK)
-            goto fail;
-        UINT br;
-        if (f_read(&s->file, s->io_buffer, n * SECTOR_SIZE, &br) != FR_OK)
+        if (!ide_cache_read(s, sector_num, n))
             goto fail;
 
         if (IDE_debug) fprintf(stderr, "sector read OK\n");
@@ -426,16 +461,10 @@ static void ide_sector_write(struct ide_device *s) {
     if (n > s->req_nb_sectors)
         n = s->req_nb_sectors;
 
-    if (f_lseek(&s->file, sector_num * SECTOR_SIZE) != FR_OK) {
-        fprintf(stderr, "FSEEKO FAILED\n");
+    if (!ide_cache_write(s, sector_num, n)) {
+        if (IDE_debug) fprintf(stderr, "sector write FAILED\n");
         goto fail;
     }
-    UINT bw;
-    if (f_write(&s->file, s->io_buffer, n * SECTOR_SIZE, &bw) != FR_OK) {
-        fprintf(stderr, "FWRITE FAILED\n");
-        goto fail;
-    }
-    ///f_flush(&s->file);
 
     s->nsector -= n;
     if (s->nsector == 0) {
@@ -570,8 +599,6 @@ static void ide_command(struct ide_device *s, uint8_t val) {
         switch(s->feature) {
         case FEAT_ENABLE_REVERTING_TO_DEFAULTS:
         case FEAT_DISABLE_REVERTING_TO_DEFAULTS:
-        case FEAT_ENABLE_WRITE_CACHE:
-        case FEAT_DISABLE_WRITE_CACHE:
         case FEAT_ENABLE_READ_LOOKAHEAD:
         case FEAT_DISABLE_READ_LOOKAHEAD:
         case FEAT_ENABLE_ADVANCED_PM:
@@ -580,6 +607,15 @@ static void ide_command(struct ide_device *s, uint8_t val) {
         case FEAT_DISABLE_AUTO_ACOUSTIC_MNGMNT:
             s->status = READY_STAT | SEEK_STAT;
             break;
+        case FEAT_ENABLE_WRITE_CACHE:
+            ide_blk.write_through = FALSE;
+            s->status = READY_STAT | SEEK_STAT;
+            break;
+        case FEAT_DISABLE_WRITE_CACHE:
+            if (!BLKCACHE_Flush(&s->file)) goto abort_cmd;
+            ide_blk.write_through = TRUE;
+            s->status = READY_STAT | SEEK_STAT;
+            break;
         case FEAT_SET_TRANSFER_MODE:
             if ( (s->nsector >> 3) <= 1) { /* 0: pio default, 1: pio mode */
                 /* set identify_data accordingly */
@@ -607,7 +643,8 @@ static void ide_command(struct ide_device *s, uint8_t val) {
 
     case WIN_FLUSH_CACHE:
     case WIN_FLUSH_CACHE_EXT:
-    ///    f_flush(&s->file);
+        if (!BLKCACHE_Flush(&s->file)) goto abort_cmd;
+        s->status = READY_STAT | SEEK_STAT;
         break;
 
     case WIN_STANDBY:
@@ -894,7 +931,7 @@ int IDE_Initialise(int *argc, char *argv[]) {
 
     if (filename) {
         IDE_enabled = ret = ide_init_drive(&device, filename);
-        free(filename);
+        Util_free(filename);
     }
 
     return ret;
@@ -903,6 +940,7 @@ int IDE_Initialise(int *argc, char *argv[]) {
 void IDE_Exit(void)
 {
 	if (IDE_enabled) {
+		BLKCACHE_Release(&device.file);
 		f_close(&device.file);
 		IDE_enabled = FALSE;
 	}
@@ -66,6 +66,8 @@ struct ide_device {
     uint8_t *mdata_storage;
     int media_changed;
 
+    int read_only;
+
     /* 8-bit mode (ATA-1 devices and CF devices) */
     int cycle;
     int do_8bit;
@@ -417,6 +419,7 @@ struct ide_device {
 
 #define MAX_MULT_SECTORS 16
 
+
 #define ASC_ILLEGAL_OPCODE                   0x20
 #define ASC_LOGICAL_BLOCK_OOR                0x21
 #define ASC_INV_FIELD_IN_CMD_PACKET          0x24
@@ -97,6 +97,11 @@ int IMG_TAPE_FileSupported(UBYTE const start_bytes[4])
 	    && start_bytes[2] == 'J' && start_bytes[3] == 'I';
 }
 
+size_t IMG_TAPE_HeapSize(void)
+{
+	return sizeof(IMG_TAPE_t) + DEFAULT_BUFFER_SIZE;
+}
+
 /* Write contents of the file's block buffer to file, as a separate record;
    then empty the buffer.
    Returns TRUE on success or FALSE on write error. */
@@ -156,10 +161,12 @@ IMG_TAPE_t *IMG_TAPE_Open(char const *filename, int *writable, char const **desc
 	if (fr != FR_OK)
 		fr = f_open(&img->file, filename, FA_READ);
 	if (fr != FR_OK) {
-		free(img);
+		Util_free(img);
 		return NULL;
 	}
 	img->description[0] = '\0';
+	/* FA_OPEN_APPEND leaves the file pointer at the end. */
+	f_lseek(&img->file, 0);
 	UINT rb;
 	if (f_read(&img->file, &header, 6, &rb) == FR_OK
 		&& header.identifier[0] == 'F'
@@ -183,7 +190,7 @@ IMG_TAPE_t *IMG_TAPE_Open(char const *filename, int *writable, char const **desc
 			skip -= CASSETTE_DESCRIPTION_MAX - 1;
 		if (f_read(&img->file, img->description, length - skip, &rb) != FR_OK || rb < (length - skip)) {
 			f_close(&img->file);
-			free(img);
+			Util_free(img);
 			return NULL;
 		}
 		img->description[length - skip] = '\0';
@@ -249,8 +256,8 @@ void IMG_TAPE_Close(IMG_TAPE_t *file)
 	if (file->was_writing)
 		CassetteFlush(file);
 	f_close(&file->file);
-	free(file->buffer);
-	free(file);
+	Util_free(file->buffer);
+	Util_free(file);
 }
 
 IMG_TAPE_t *IMG_TAPE_Create(char const *filename, char const *description)
@@ -530,6 +537,17 @@ int IMG_TAPE_SerinStatus(IMG_TAPE_t *file, int event_time_left)
 	}
 }
 
+int IMG_TAPE_StandardRecord(IMG_TAPE_t *file)
+{
+	return !file->was_writing && file->block_length >= 3 && !file->block_is_fsk
+	       && file->buffer[0] == 0x55 && file->buffer[1] == 0x55;
+}
+
+int IMG_TAPE_GetRecordPosition(IMG_TAPE_t *file)
+{
+	return file->next_blockbyte;
+}
+
 int IMG_TAPE_SkipToData(IMG_TAPE_t *file, int ms)
 {
 	if (file->was_writing) {
@@ -32,6 +32,10 @@ typedef struct IMG_TAPE_t IMG_TAPE_t;
    stored in HEADER. */
 int IMG_TAPE_FileSupported(UBYTE const start_bytes[4]);
 
+/* Returns the heap an open image takes with records of the standard
+   length. */
+size_t IMG_TAPE_HeapSize(void);
+
 /* Opens a cassette image pointed to by FILENAME.
    Stores a boolean in *WRITABLE, indicating if the file is writable.
    For CAS files, stores in *DESCRIPTION a pointer to the file's description.
@@ -80,6 +84,13 @@ void IMG_TAPE_Seek(IMG_TAPE_t *file, unsigned int position);
    currently being read. */
 int IMG_TAPE_SerinStatus(IMG_TAPE_t *file, int event_time_left);
 
+/* Returns TRUE if the record currently held, which is the one following
+   the gap during an IRG, is a standard one: a "data" record that starts
+   with the two $55 bytes the OS measures the baud rate on. */
+int IMG_TAPE_StandardRecord(IMG_TAPE_t *file);
+/* Returns the number of bytes of the current record read so far. */
+int IMG_TAPE_GetRecordPosition(IMG_TAPE_t *file);
+
 /* --- Functions used by patched SIO --- */
 
 /* Forwards the tape past a given amount of milliseconds.
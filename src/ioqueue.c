@@ -0,0 +1,115 @@
+/*
+ * ioqueue.c - Storage requests run off the emulation loop
+ *
+ * Copyright (C) 2026 Atari800 development team (see DOC/CREDITS)
+ *
+ * This file is part of the Atari800 emulator project which emulates
+ * the Atari 400, 800, 800XL, 130XE, and 5200 8-bit computers.
+ *
+ * Atari800 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Atari800 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Atari800; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "config.h"
+#include <pico/time.h>
+#include "atari.h"
+#include "ioqueue.h"
+
+IOQUEUE_stats_t IOQUEUE_stats;
+
+/* ring[polled] to ring[worked - 1] wait for IOQUEUE_Poll, ring[worked] to
+   ring[submitted - 1] for the worker.  Each counter has one writer. */
+static IOQUEUE_req_t *volatile ring[IOQUEUE_SIZE];
+static volatile ULONG submitted;
+static volatile ULONG worked;
+static ULONG polled;
+static int worker = FALSE;
+static int polling = FALSE;
+
+void IOQUEUE_UseWorker(void)
+{
+	worker = TRUE;
+}
+
+int IOQUEUE_HaveWorker(void)
+{
+	return worker;
+}
+
+int IOQUEUE_Submit(IOQUEUE_req_t *req)
+{
+	ULONG depth;
+	if (submitted - polled >= IOQUEUE_SIZE) {
+		IOQUEUE_Poll();
+		if (submitted - polled >= IOQUEUE_SIZE)
+			return FALSE;
+	}
+	req->state = IOQUEUE_QUEUED;
+	ring[submitted % IOQUEUE_SIZE] = req;
+	/* the request is complete before the worker sees it */
+	__sync_synchronize();
+	submitted++;
+	IOQUEUE_stats.submitted++;
+	depth = submitted - worked;
+	if (depth > IOQUEUE_stats.max_depth)
+		IOQUEUE_stats.max_depth = depth;
+	if (!worker) {
+		IOQUEUE_Work();
+		IOQUEUE_Poll();
+	}
+	return TRUE;
+}
+
+void IOQUEUE_Work(void)
+{
+	while (worked != submitted) {
+		IOQUEUE_req_t *req;
+		__sync_synchronize();
+		req = ring[worked % IOQUEUE_SIZE];
+		req->work(req);
+		/* the results are complete before the emulation sees them */
+		__sync_synchronize();
+		req->state = IOQUEUE_WORKED;
+		worked++;
+	}
+}
+
+void IOQUEUE_Poll(void)
+{
+	if (polling)
+		return;
+	polling = TRUE;
+	while (polled != worked) {
+		IOQUEUE_req_t *req;
+		__sync_synchronize();
+		req = ring[polled % IOQUEUE_SIZE];
+		polled++;
+		if (req->done != NULL)
+			req->done(req);
+		req->state = IOQUEUE_IDLE;
+	}
+	polling = FALSE;
+}
+
+void IOQUEUE_Wait(IOQUEUE_req_t *req)
+{
+	if (req->state == IOQUEUE_QUEUED) {
+		ULONG start = time_us_32();
+		/* without a worker it has run already */
+		while (req->state == IOQUEUE_QUEUED)
+			__sync_synchronize();
+		IOQUEUE_stats.waits++;
+		IOQUEUE_stats.wait_us += time_us_32() - start;
+	}
+}
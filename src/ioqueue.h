@@ -0,0 +1,51 @@
+#ifndef IOQUEUE_H_
+#define IOQUEUE_H_
+
+#include "config.h"
+#include "atari.h"
+
+/* Queue of storage requests run off the emulation loop.  The emulation
+   submits requests and gets their completion callbacks from IOQUEUE_Poll,
+   in the order of submission; a worker - core1 on the device - runs them
+   with IOQUEUE_Work meanwhile.  Without a worker, requests run as they are
+   submitted.  One side submits and polls, the other works. */
+
+/* Most requests submitted and not yet polled. */
+#define IOQUEUE_SIZE 8
+
+/* States of a request */
+#define IOQUEUE_IDLE	0
+#define IOQUEUE_QUEUED	1	/* submitted, not worked yet */
+#define IOQUEUE_WORKED	2	/* done not called yet */
+
+typedef struct IOQUEUE_req_t {
+	void (*work)(struct IOQUEUE_req_t *req);	/* run by the worker */
+	void (*done)(struct IOQUEUE_req_t *req);	/* run by IOQUEUE_Poll, or NULL */
+	volatile int state;
+} IOQUEUE_req_t;
+
+typedef struct IOQUEUE_stats_t {
+	ULONG submitted;
+	ULONG max_depth;	/* most requests waiting for the worker */
+	ULONG waits;		/* IOQUEUE_Wait calls that had to wait */
+	ULONG wait_us;		/* and how long they waited */
+} IOQUEUE_stats_t;
+
+extern IOQUEUE_stats_t IOQUEUE_stats;
+
+/* From now on a worker runs the requests; to be called before the worker
+   starts calling IOQUEUE_Work, while nothing is queued. */
+void IOQUEUE_UseWorker(void);
+/* Returns TRUE if a worker runs the requests. */
+int IOQUEUE_HaveWorker(void);
+
+/* Queues REQ and returns TRUE, or returns FALSE if the queue is full. */
+int IOQUEUE_Submit(IOQUEUE_req_t *req);
+/* Runs the requests submitted so far; called by the worker. */
+void IOQUEUE_Work(void);
+/* Runs the completion callbacks of the requests that have been worked. */
+void IOQUEUE_Poll(void);
+/* Waits until the worker has finished REQ, without running callbacks. */
+void IOQUEUE_Wait(IOQUEUE_req_t *req);
+
+#endif /* IOQUEUE_H_ */
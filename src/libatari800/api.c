@@ -36,10 +36,12 @@
 #include "antic.h"
 #include "cpu.h"
 #include "platform.h"
+#include "region.h"
 #include "memory.h"
 #include "screen.h"
 #include "sio.h"
 #include "../sound.h"
+#include "telemetry.h"
 #include "util.h"
 #include "libatari800/main.h"
 #include "libatari800/cpu_crash.h"
@@ -121,7 +123,7 @@ int libatari800_init(int argc, char **argv) {
 		Log_flushlog();
 	}
 	if (argv_alloced) {
-		free(argv_ptr);
+		Util_free(argv_ptr);
 	}
 	return status;
 }
@@ -235,8 +237,10 @@ int libatari800_next_frame(input_template_t *input)
 			printf("LIBATARI800_DLIST_ERROR");
 		}
 	}
+	TELEMETRY_Switch(TELEMETRY_PRESENT);
 	PLATFORM_DisplayScreen();
 	//printf("PLATFORM_DisplayScreen PASSED");
+	TELEMETRY_EndFrame();
 	return !libatari800_error_code;
 }
 
@@ -430,6 +434,91 @@ int libatari800_get_frame_number() {
 }
 
 
+/** Return the time breakdown of the most recent frames
+ *
+ * Each call to \a libatari800_next_frame records how many microseconds were
+ * spent in the CPU, ANTIC, GTIA, sound, SIO and device patches, presenting
+ * the frame, waiting for the frame rate throttle, and everything else, and
+ * how many 6502 cycles of busy-waiting the CPU skipped. The last \a
+ * LIBATARI800_TELEMETRY_FRAMES frames are kept.
+ *
+ * @param frames pointer to an array of at least \a max entries
+ * @param max maximum number of frames to return
+ *
+ * @returns number of frames copied, oldest first; zero if telemetry is not
+ * compiled in or no frame has been run yet
+ */
+int libatari800_get_frame_telemetry(frame_telemetry_t *frames, int max) {
+#ifdef TELEMETRY
+	int i;
+	int n = TELEMETRY_NumFrames();
+	if (n > max)
+		n = max;
+	for (i = 0; i < n; i++) {
+		const TELEMETRY_frame_t *f = TELEMETRY_GetFrame(n - 1 - i);
+		frames[i].frame = f->frame;
+		frames[i].cpu_us = f->us[TELEMETRY_CPU];
+		frames[i].antic_us = f->us[TELEMETRY_ANTIC];
+		frames[i].gtia_us = f->us[TELEMETRY_GTIA];
+		frames[i].sound_us = f->us[TELEMETRY_SOUND];
+		frames[i].sio_us = f->us[TELEMETRY_SIO];
+		frames[i].present_us = f->us[TELEMETRY_PRESENT];
+		frames[i].idle_us = f->us[TELEMETRY_IDLE];
+		frames[i].other_us = f->us[TELEMETRY_OTHER];
+		frames[i].cpu_skipped_cycles = f->cpu_skipped;
+	}
+	return n;
+#else
+	return 0;
+#endif
+}
+
+
+/** Return the heap usage of the emulator
+ *
+ * Every block the emulator allocates is accounted under a tag naming the
+ * code that allocated it. This fills in the totals and, for up to \a max
+ * tags, how many bytes and blocks are allocated under each now and how
+ * many bytes were at most.
+ *
+ * @param usage pointer to the totals to fill in
+ * @param tags pointer to an array of at least \a max entries, may be NULL
+ *             if \a max is zero
+ * @param max maximum number of tags to return
+ *
+ * @returns number of tags copied, in the order they were first used; zero
+ * if heap accounting is not compiled in
+ */
+int libatari800_get_heap_usage(heap_usage_t *usage, heap_tag_usage_t *tags, int max) {
+#ifdef HEAP_STATS
+	Util_heap_t heap;
+	const Util_heap_tag_t *t;
+	int n;
+	Util_HeapStats(&heap);
+	usage->live_bytes = heap.live;
+	usage->peak_bytes = heap.peak;
+	usage->blocks = heap.count;
+	usage->untracked_blocks = heap.untracked;
+	usage->free_bytes = heap.free;
+	usage->top_free_bytes = heap.top_free;
+	usage->fatfs_live_bytes = heap.fatfs_live;
+	usage->fatfs_peak_bytes = heap.fatfs_peak;
+	usage->region_bytes = REGION_stats.arena;
+	usage->budget_bytes = REGION_stats.reserve;
+	for (n = 0; n < max && (t = Util_HeapTag(n)) != NULL; n++) {
+		tags[n].tag = t->tag;
+		tags[n].live_bytes = t->live;
+		tags[n].peak_bytes = t->peak;
+		tags[n].blocks = t->count;
+	}
+	return n;
+#else
+	memset(usage, 0, sizeof(*usage));
+	return 0;
+#endif
+}
+
+
 /** Save the state of the emulator
  *
  * Save the state of the emulator into a data structure that can later be used
@@ -120,7 +120,11 @@ typedef struct {
 } input_template_t;
 
 
-#define STATESAV_MAX_SIZE 1
+/* Largest state this build saves: base RAM and its attributes (64K each),
+   RAM under the OS and BASIC ROMs (24K), the XE banks of a 130XE (80K) and
+   up to 8K of chip registers and file names. Larger machines (320K and up)
+   cannot be saved. */
+#define STATESAV_MAX_SIZE (0x10000 * 2 + 0x6000 + 0x14000 + 0x2000)
 
 /* byte offsets into output_template.state array of groups of data
    to prevent the need for a full parsing of the save state data to
@@ -258,6 +262,54 @@ typedef struct {
     int Base_mult[4];
 } pokey_state_t;
 
+/* Wall time of one emulated frame, split by subsystem. Times are in
+   microseconds and saturate at 65535. cpu_skipped_cycles counts the 6502
+   cycles of busy-waiting and idle loops the CPU skipped rather than ran. */
+typedef struct {
+    ULONG frame;
+    UWORD cpu_us;
+    UWORD antic_us;
+    UWORD gtia_us;
+    UWORD sound_us;
+    UWORD sio_us;
+    UWORD present_us;
+    UWORD idle_us;
+    UWORD other_us;
+    UWORD cpu_skipped_cycles;
+} frame_telemetry_t;
+
+/* Number of frames libatari800_get_frame_telemetry can return at most. */
+#define LIBATARI800_TELEMETRY_FRAMES 64
+
+/* Heap memory allocated under one tag, which names the code that asked
+   for it. Sizes are in bytes. */
+typedef struct {
+    const char *tag;
+    ULONG live_bytes;
+    ULONG peak_bytes;
+    ULONG blocks;
+} heap_tag_usage_t;
+
+/* Heap memory allocated under all tags, and what is left of the heap.
+   untracked_blocks counts the blocks allocated while too many were live
+   to account for them. top_free_bytes are the free bytes at the top of the
+   heap, which one allocation can get at least. The FatFS name buffers do
+   not have a tag and are counted in fatfs_live_bytes/fatfs_peak_bytes.
+   region_bytes of live_bytes are the arena of the memory regions, taken
+   at start; budget_bytes is what the arena leaves to the rest. */
+typedef struct {
+    ULONG live_bytes;
+    ULONG peak_bytes;
+    ULONG blocks;
+    ULONG untracked_blocks;
+    ULONG free_bytes;
+    ULONG top_free_bytes;
+    ULONG fatfs_live_bytes;
+    ULONG fatfs_peak_bytes;
+    ULONG region_bytes;
+    ULONG budget_bytes;
+} heap_usage_t;
+
 extern int libatari800_error_code;
 #define LIBATARI800_UNIDENTIFIED_CART_TYPE 1
 #define LIBATARI800_CPU_CRASH 2
@@ -305,6 +357,10 @@ float libatari800_get_fps();
 
 int libatari800_get_frame_number();
 
+int libatari800_get_frame_telemetry(frame_telemetry_t *frames, int max);
+
+int libatari800_get_heap_usage(heap_usage_t *usage, heap_tag_usage_t *tags, int max);
+
 void libatari800_get_current_state(emulator_state_t *state);
 
 void libatari800_restore_state(emulator_state_t *state);
@@ -140,6 +140,40 @@ int wavWrite()
 	return 0;
 }
 
+/* Boots each of FILES in turn, runs it for a while, and checks that the
+   peak of the heap, with the FatFS name buffers, stays within what the
+   memory regions leave to the rest. Returns FALSE if it does not. */
+static int heap_budget_test(char **files, int count)
+{
+	heap_usage_t usage;
+	ULONG peak;
+	int i;
+
+	for (i = 0; i < count; i++) {
+		input_template_t input;
+		int frame;
+
+		if (!libatari800_reboot_with_file(files[i])) {
+			printf("%s: cannot be booted\n", files[i]);
+			return FALSE;
+		}
+		libatari800_clear_input_array(&input);
+		for (frame = 0; frame < 300; frame++)
+			libatari800_next_frame(&input);
+		libatari800_get_heap_usage(&usage, NULL, 0);
+		printf("%s: heap %lu bytes, peak %lu, FatFS peak %lu\n", files[i],
+		       (unsigned long) (usage.live_bytes - usage.region_bytes),
+		       (unsigned long) (usage.peak_bytes - usage.region_bytes),
+		       (unsigned long) usage.fatfs_peak_bytes);
+	}
+	/* the regions are taken at start and never freed, so the peaks, kept
+	   from the start, have them all through */
+	peak = usage.peak_bytes - usage.region_bytes + usage.fatfs_peak_bytes;
+	printf("heap peak %lu bytes, budget %lu\n", (unsigned long) peak,
+	       (unsigned long) usage.budget_bytes);
+	return peak <= usage.budget_bytes;
+}
+
 int main_TODO3(int argc, char **argv) {
 	input_template_t input;
 	int i;
@@ -151,6 +185,17 @@ int main_TODO3(int argc, char **argv) {
 			save_wav = TRUE;
 			show_screen = FALSE;
 		}
+		/* -heap <file>...: the heap budget check on the given media */
+		else if (strcmp(argv[i], "-heap") == 0) {
+			char *heap_args[] = {
+				"-xl",
+				NULL,
+			};
+			libatari800_init(-1, heap_args);
+			i = heap_budget_test(argv + i + 1, argc - i - 1);
+			libatari800_exit();
+			return i ? 0 : 1;
+		}
 	}
 
 	/* force the 400/800 OS to get the Memo Pad */
@@ -32,6 +32,7 @@
 #include "log.h"
 #include "platform.h"
 #include "init.h"
+#include "region.h"
 #include "sound.h"
 #include "util.h"
 
@@ -58,7 +59,11 @@ int PLATFORM_SoundSetup(Sound_setup_t *setup)
 	if (sound_hw_buffer_size == 0)
 	        return FALSE;
 
-	LIBATARI800_Sound_array = Util_malloc(sound_hw_buffer_size, "PLATFORM_SoundSetup");
+	/* the size changes with the sample rate and TV mode */
+	REGION_Release(LIBATARI800_Sound_array);
+	LIBATARI800_Sound_array = REGION_Alloc(REGION_SOUND, NULL, sound_hw_buffer_size, "PLATFORM_SoundSetup");
+	if (LIBATARI800_Sound_array == NULL)
+		return FALSE;
 
 	sample_diff = (double)setup->buffer_frames - samples_per_video_frame;
 	sample_residual = 0;
@@ -68,7 +73,8 @@ int PLATFORM_SoundSetup(Sound_setup_t *setup)
 
 void PLATFORM_SoundExit(void)
 {
-	free(LIBATARI800_Sound_array);
+	REGION_Release(LIBATARI800_Sound_array);
+	LIBATARI800_Sound_array = NULL;
 }
 
 void PLATFORM_SoundPause(void)
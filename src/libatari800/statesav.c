@@ -31,6 +31,9 @@
 
 UBYTE *LIBATARI800_StateSav_buffer = NULL;
 statesav_tags_t *LIBATARI800_StateSav_tags = NULL;
+ULONG LIBATARI800_StateSav_psram = LIBATARI800_STATESAV_NO_PSRAM;
+void (*LIBATARI800_StateSav_update)(ULONG addr, const UBYTE *data, size_t len) = NULL;
+int (*LIBATARI800_StateSav_changed)(ULONG addr, size_t len) = NULL;
 
 
 void LIBATARI800_StateSave(UBYTE *buffer, statesav_tags_t *tags) {
@@ -45,3 +48,73 @@ void LIBATARI800_StateLoad(UBYTE *buffer) {
     LIBATARI800_StateSav_buffer = buffer;
 	StateSav_ReadAtariState(NULL, NULL);
 }
+
+/* Saves the state straight to PSRAM at ADDR, which must have room for
+   STATESAV_MAX_SIZE bytes; used by the rewind ring. */
+int LIBATARI800_StateSavePSRAM(ULONG addr, statesav_tags_t *tags) {
+	int result;
+	LIBATARI800_StateSav_buffer = NULL;
+	LIBATARI800_StateSav_psram = addr;
+	LIBATARI800_StateSav_tags = tags;
+	result = StateSav_SaveAtariState(NULL, NULL, 0);
+	LIBATARI800_StateSav_psram = LIBATARI800_STATESAV_NO_PSRAM;
+	return result;
+}
+
+/* Brings the state saved at ADDR up to date. Memory pages that have not
+   been dirtied since it was saved there are skipped (see MEMORY_dirty),
+   everything else is passed to UPDATE, which does the writing and may
+   first keep what it overwrites. Pages are skipped by position, so the
+   caller must check that TAGS match those of the state being updated. */
+int LIBATARI800_StateUpdatePSRAM(ULONG addr, statesav_tags_t *tags,
+                                 void (*update)(ULONG addr, const UBYTE *data, size_t len)) {
+	int result;
+	LIBATARI800_StateSav_update = update;
+	result = LIBATARI800_StateSavePSRAM(addr, tags);
+	LIBATARI800_StateSav_update = NULL;
+	return result;
+}
+
+int LIBATARI800_StateLoadPSRAM(ULONG addr) {
+	int result;
+	LIBATARI800_StateSav_buffer = NULL;
+	LIBATARI800_StateSav_psram = addr;
+	result = StateSav_ReadAtariState(NULL, NULL);
+	LIBATARI800_StateSav_psram = LIBATARI800_STATESAV_NO_PSRAM;
+	return result;
+}
+
+/* Reads the state at ADDR back into the machine that last saved or updated
+   it there, since when only the bytes for which CHANGED returns TRUE were
+   rewritten. Memory pages not dirtied since that save are kept as they
+   are, unless CHANGED reports their bytes of the state rewritten (see
+   StateSav_KeepUBYTE), so a restore costs what changed rather than the
+   size of the machine. */
+int LIBATARI800_StateRestorePSRAM(ULONG addr, int (*changed)(ULONG addr, size_t len)) {
+	int result;
+	LIBATARI800_StateSav_changed = changed;
+	result = LIBATARI800_StateLoadPSRAM(addr);
+	LIBATARI800_StateSav_changed = NULL;
+	return result;
+}
+
+/* Saves the chips, the CPU and memory to PSRAM at ADDR, see
+   StateSav_SaveMachineState. */
+int LIBATARI800_MachineSavePSRAM(ULONG addr, statesav_tags_t *tags) {
+	int result;
+	LIBATARI800_StateSav_buffer = NULL;
+	LIBATARI800_StateSav_psram = addr;
+	LIBATARI800_StateSav_tags = tags;
+	result = StateSav_SaveMachineState();
+	LIBATARI800_StateSav_psram = LIBATARI800_STATESAV_NO_PSRAM;
+	return result;
+}
+
+int LIBATARI800_MachineLoadPSRAM(ULONG addr) {
+	int result;
+	LIBATARI800_StateSav_buffer = NULL;
+	LIBATARI800_StateSav_psram = addr;
+	result = StateSav_ReadMachineState();
+	LIBATARI800_StateSav_psram = LIBATARI800_STATESAV_NO_PSRAM;
+	return result;
+}
@@ -1,6 +1,7 @@
 #ifndef LIBATARI800_STATESAV_H_
 #define LIBATARI800_STATESAV_H_
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include "config.h"
@@ -11,7 +12,24 @@
 extern UBYTE *LIBATARI800_StateSav_buffer;
 extern statesav_tags_t *LIBATARI800_StateSav_tags;
 
+/* PSRAM address of the state while LIBATARI800_StateSav_buffer is NULL */
+#define LIBATARI800_STATESAV_NO_PSRAM 0xffffffff
+extern ULONG LIBATARI800_StateSav_psram;
+/* Set while LIBATARI800_StateUpdatePSRAM runs; writes LEN bytes at PSRAM
+   address ADDR in place of writepsram. */
+extern void (*LIBATARI800_StateSav_update)(ULONG addr, const UBYTE *data, size_t len);
+/* Set while LIBATARI800_StateRestorePSRAM runs; returns TRUE if any of the
+   LEN bytes at PSRAM address ADDR changed since the machine saved them. */
+extern int (*LIBATARI800_StateSav_changed)(ULONG addr, size_t len);
+
 void LIBATARI800_StateSave(UBYTE *buffer, statesav_tags_t *tags);
 void LIBATARI800_StateLoad(UBYTE *buffer);
+int LIBATARI800_StateSavePSRAM(ULONG addr, statesav_tags_t *tags);
+int LIBATARI800_StateUpdatePSRAM(ULONG addr, statesav_tags_t *tags,
+                                 void (*update)(ULONG addr, const UBYTE *data, size_t len));
+int LIBATARI800_StateLoadPSRAM(ULONG addr);
+int LIBATARI800_StateRestorePSRAM(ULONG addr, int (*changed)(ULONG addr, size_t len));
+int LIBATARI800_MachineSavePSRAM(ULONG addr, statesav_tags_t *tags);
+int LIBATARI800_MachineLoadPSRAM(ULONG addr);
 
 #endif /* LIBATARI800_STATESAV_H_ */
@@ -24,12 +24,21 @@ extern "C" {
 #include "sound.h"
 #include "util.h"
 #include "input.h"
+#include "atari.h"
+#include "pacing.h"
+#include "telemetry.h"
+#include "rewind.h"
+#include "cartcache.h"
+#include "blkcache.h"
+#include "ioqueue.h"
 }
 
 static FATFS fs;
 semaphore vga_start_semaphore;
 #define DISP_WIDTH (320)
 #define DISP_HEIGHT (240)
+// пока F11 нажата, раз в REWIND_STEP кадров отступаем на один снимок назад
+#define REWIND_STEP (5)
 extern "C" UBYTE __aligned(4) __screen[Screen_HEIGHT * Screen_WIDTH];
 ///uint16_t SCREEN[TEXTMODE_ROWS][TEXTMODE_COLS];
 
@@ -69,6 +78,7 @@ static bool f1Pressed = false;
 static bool f2Pressed = false;
 static bool f3Pressed = false;
 static bool f4Pressed = false;
+static bool f11Pressed = false;
 
 extern "C" {
 bool __time_critical_func(handleScancode)(const uint32_t ps2scancode) {
@@ -119,6 +129,7 @@ bool __time_critical_func(handleScancode)(const uint32_t ps2scancode) {
                     f4Pressed = false;
                     break;
                 } // F4 Start
+                case 0xd7: f11Pressed = false; break; // F11 Rewind
                 case 0xc8: { // Up
                     input_map.keychar = 0;
                     input_map.joy1 &= INPUT_STICK_FORWARD;
@@ -342,6 +353,7 @@ bool __time_critical_func(handleScancode)(const uint32_t ps2scancode) {
                 break;
             } // F4 Start
             case 0x3f: input_map.keychar = 250; break; // F5 Help
+            case 0x57: f11Pressed = true; break; // F11 Rewind
             case 0x48: { // Up
                 input_map.keychar = 254;
                 input_map.joy1 |= ~INPUT_STICK_FORWARD;
@@ -492,6 +504,7 @@ void __time_critical_func(render_core)() {
 #ifdef TFT
         if (tick >= last_renderer_tick + frame_tick) {
             refresh_lcd();
+            graphics_vsync_tick();
             last_renderer_tick = tick;
         }
 #endif
@@ -501,49 +514,80 @@ void __time_critical_func(render_core)() {
             last_input_tick = tick;
             nespad_update();
         }
+        // Обращения к SD-карте из очереди ввода-вывода, чтобы эмуляция на core0 их не ждала
+        IOQUEUE_Work();
         tick = time_us_64();
         tight_loop_contents();
     }
     __unreachable();
 }
 
-static UINT sound_array_idx = 0;
-static UINT sound_array_fill = 0;
+// Кольцевой буфер звука: кадры эмулятора дописываются в голову,
+// таймер забирает сэмплы из хвоста. Заполненность буфера - вход для PACING.
+#define SOUND_RING_SIZE 8192
+static UBYTE sound_ring[SOUND_RING_SIZE];
+static volatile UINT sound_ring_head = 0;
+static volatile UINT sound_ring_tail = 0;
 extern "C" UBYTE *LIBATARI800_Sound_array = 0;
 extern "C" void PLATFORM_SoundWrite(UBYTE const *buffer, unsigned int size)
 {
-    if (LIBATARI800_Sound_array) free(LIBATARI800_Sound_array);
-    LIBATARI800_Sound_array = (UBYTE *) Util_malloc(size, "PLATFORM_SoundWrite");
-	memcpy(LIBATARI800_Sound_array, buffer, size);
-	sound_array_idx = 0;
-	sound_array_fill = size;
+    UINT head = sound_ring_head;
+    UINT space = SOUND_RING_SIZE - (head - sound_ring_tail);
+    if (size > space) {
+        PACING_stats.audio_overruns++;
+        size = space;
+    }
+    UINT pos = head & (SOUND_RING_SIZE - 1);
+    UINT part = SOUND_RING_SIZE - pos;
+    if (part > size) part = size;
+    memcpy(sound_ring + pos, buffer, part);
+    memcpy(sound_ring, buffer + part, size - part);
+    sound_ring_head = head + size;
+}
+
+static inline int sound_ring_fill() {
+    return (int)(sound_ring_head - sound_ring_tail);
 }
 
 #ifdef SOUND
 static repeating_timer_t timer;
 static int snd_channels = 2;
 static int snd_bits = 16;
+// Таймер тикает с целым периодом в мкс, т.е. чаще частоты звука;
+// лишние тики пропускаются, чтобы в среднем забирать ровно snd_hz сэмплов.
+static uint32_t snd_hz = 44100;
+static uint32_t snd_tick_hz = 44100;
+static uint32_t snd_phase = 0;
 static bool __not_in_flash_func(AY_timer_callback)(repeating_timer_t *rt) {
     static uint16_t outL = 0;  
     static uint16_t outR = 0;
-    register uint16_t idx = sound_array_idx;
-    if (idx >= sound_array_fill) {
+    static bool starved = false;
+    snd_phase += snd_hz;
+    if (snd_phase < snd_tick_hz) {
         return true;
     }
+    snd_phase -= snd_tick_hz;
+    register UINT tail = sound_ring_tail;
+    if (tail == sound_ring_head) {
+        if (!starved && Sound_enabled && !paused) PACING_stats.audio_underruns++;
+        starved = true;
+        return true;
+    }
+    starved = false;
     pwm_set_gpio_level(PWM_PIN0, outR); // Право
     pwm_set_gpio_level(PWM_PIN1, outL); // Лево
     outL = outR = 0;
     if (!Sound_enabled || paused) {
+        sound_ring_tail = sound_ring_head;
         return true;
     }
-    register UBYTE* uba = LIBATARI800_Sound_array;
     if (snd_channels == 2) {
-        outL = ((uint16_t)uba[idx]) << (11 - 8);
-        outR = ((uint16_t)uba[idx + 1]) << (11 - 8);
-        sound_array_idx += 2;
+        outL = ((uint16_t)sound_ring[tail & (SOUND_RING_SIZE - 1)]) << (11 - 8);
+        outR = ((uint16_t)sound_ring[(tail + 1) & (SOUND_RING_SIZE - 1)]) << (11 - 8);
+        sound_ring_tail = tail + 2;
     } else {
-        outL = outR = ((uint16_t)uba[idx]) << (11 - 8);
-        sound_array_idx++;
+        outL = outR = ((uint16_t)sound_ring[tail & (SOUND_RING_SIZE - 1)]) << (11 - 8);
+        sound_ring_tail = tail + 1;
     }
     ///pwm_set_gpio_level(BEEPER_PIN, 0);
     return true;
@@ -590,6 +634,7 @@ int main() {
     };
 
     sem_init(&vga_start_semaphore, 0, 1);
+    IOQUEUE_UseWorker();
     multicore_launch_core1(render_core);
     sem_release(&vga_start_semaphore);
     printf("libatari800_init");
@@ -625,17 +670,49 @@ int main() {
 	int hz = libatari800_get_sound_frequency(); ///44100;	//44000 //44100 //96000 //22050
     snd_channels = libatari800_get_num_sound_channels();
     snd_bits = libatari800_get_sound_sample_size();
+    snd_hz = hz;
+    snd_tick_hz = 1000000 / (1000000 / hz);
 	// negative timeout means exact delay (rather than delay between callbacks)
 	if (!add_repeating_timer_us(-1000000 / hz, AY_timer_callback, NULL, &timer)) {
 		printf("Failed to add timer");
 	}
 #endif
 
+    int tv_mode = -1;
+    int rewind_frames = 0;
     while(true) {
+        if (tv_mode != Atari800_tv_mode) {
+            tv_mode = Atari800_tv_mode;
+            PACING_Init((ULONG)(libatari800_get_fps() * 1000), libatari800_get_sound_buffer_allocated_size());
+            PACING_Reset(time_us_64());
+        }
         libatari800_next_frame(&input_map);
-        sleep_us(5);
-
-        tight_loop_contents();
+        if (f11Pressed) {
+            if (++rewind_frames >= REWIND_STEP) {
+                rewind_frames = 0;
+                REWIND_Restore(REWIND_Count() > 1 ? 1 : 0);
+            }
+        } else {
+            rewind_frames = 0;
+            REWIND_Frame();
+        }
+        // подгружаем следующий банк большого картриджа, пока ждём кадра
+        CARTCACHE_Frame();
+        // дописываем на карту блоки дисков, когда запись затихла
+        BLKCACHE_Frame();
+        if (Atari800_turbo) {
+            PACING_Reset(time_us_64());
+            continue;
+        }
+        uint32_t vsync_count, vsync_time;
+        do {
+            vsync_count = graphics_vsync_count;
+            vsync_time = graphics_vsync_time;
+        } while (vsync_count != graphics_vsync_count);
+        uint64_t next = PACING_EndFrame(time_us_64(), vsync_count, vsync_time, Sound_enabled ? sound_ring_fill() : -1);
+        TELEMETRY_Switch(TELEMETRY_IDLE);
+        sleep_until(from_us_since_boot(next));
+        TELEMETRY_Switch(TELEMETRY_OTHER);
     }
 
     __unreachable();
@@ -38,6 +38,7 @@
 #include "pbi.h"
 #include "pia.h"
 #include "pokey.h"
+#include "region.h"
 #include "util.h"
 #ifndef BASIC
 #include "statesav.h"
@@ -71,8 +72,57 @@ map_save save_map[2] = {
 	{1, NULL, MEMORY_ROM_PutByte}    /* ROM */
 };
 
+/* What a state save writes as the attributes of page I: MEMORY_RAM,
+   MEMORY_ROM, MEMORY_HARDWARE or ATTRIB_BOUNTY_BOB. */
+#define ATTRIB_BOUNTY_BOB 3
+static int attrib_kind(int i)
+{
+	if (MEMORY_writemap[i] == NULL)
+		return MEMORY_RAM;
+	if (MEMORY_writemap[i] == MEMORY_ROM_PutByte)
+		return MEMORY_ROM;
+	if (i == 0x4f || i == 0x5f || i == 0x8f || i == 0x9f)
+		return ATTRIB_BOUNTY_BOB;
+	return MEMORY_HARDWARE;
+}
+
 #endif /* PAGED_ATTRIB */
 
+#ifdef DIRTY_PAGES
+UBYTE MEMORY_dirty[256];
+#ifdef PAGED_ATTRIB
+/* attrib_kind() of every page as of the last MEMORY_ClearDirty() */
+static UBYTE attrib_clean[256];
+#endif
+/* set when the RAM under the ROMs, kept in PSRAM, is written */
+static int under_rom_dirty = TRUE;
+#define SetUnderROMDirty() (under_rom_dirty = TRUE)
+
+void MEMORY_ClearDirty(void)
+{
+	memset(MEMORY_dirty, 0, sizeof(MEMORY_dirty));
+	under_rom_dirty = FALSE;
+#ifdef PAGED_ATTRIB
+	{
+		int i;
+		for (i = 0; i < 256; i++)
+			attrib_clean[i] = (UBYTE) attrib_kind(i);
+	}
+#endif
+}
+
+void MEMORY_SetAllDirty(void)
+{
+	memset(MEMORY_dirty, 1, sizeof(MEMORY_dirty));
+	under_rom_dirty = TRUE;
+#ifdef PAGED_ATTRIB
+	memset(attrib_clean, 0xff, sizeof(attrib_clean));
+#endif
+}
+#else
+#define SetUnderROMDirty()
+#endif /* DIRTY_PAGES */
+
 #include "roms/ATARIBAS_ROM.h"
 #include "roms/ATARIOSB_ROM.h"
 #include "roms/ATARIXL_ROM.h"
@@ -126,17 +176,44 @@ int MEMORY_enable_mapram = FALSE;
 /* Buffer for storing of MapRAM memory. */
 static UBYTE *mapram_memory = NULL;
 
+/* Allocates SIZE bytes of extended RAM in place of OLD. */
+static UBYTE *AllocMachineRAM(UBYTE *old, ULONG size, const char *from)
+{
+	UBYTE *ptr;
+	REGION_Release(old);
+	ptr = (UBYTE *) REGION_Alloc(REGION_MACHINE, NULL, size, from);
+	if (ptr == NULL) {
+		Log_print("Fatal error: out of memory");
+		Atari800_ErrExit();
+		exit(1);
+	}
+	return ptr;
+}
+
+/* Frees all extended RAM, when the machine is configured anew. */
+static void FreeMachineRAM(void)
+{
+	REGION_Free(REGION_MACHINE);
+	atarixe_memory = NULL;
+	atarixe_memory_size = 0;
+	axlon_ram = NULL;
+	axlon_current_bankmask = 0;
+	mosaic_ram = NULL;
+	mosaic_current_num_banks = 0;
+	mapram_memory = NULL;
+}
+
 static void alloc_axlon_memory(void){
 	if (MEMORY_axlon_num_banks > 0 && Atari800_machine_type == Atari800_MACHINE_800) {
 		int size = MEMORY_axlon_num_banks * 0x4000;
 		if (axlon_ram == NULL || axlon_current_bankmask != MEMORY_axlon_num_banks - 1) {
 			axlon_current_bankmask = MEMORY_axlon_num_banks - 1;
-			axlon_ram = (UBYTE *)Util_realloc(axlon_ram, size, "alloc_axlon_memory axlon_ram (realloc)");
+			axlon_ram = AllocMachineRAM(axlon_ram, size, "alloc_axlon_memory axlon_ram");
 		}
 		memset(axlon_ram, 0, size);
 	} else {
 		if (axlon_ram != NULL) {
-			free(axlon_ram);
+			REGION_Release(axlon_ram);
 			axlon_ram = NULL;
 			axlon_current_bankmask = 0;
 		}
@@ -148,12 +225,12 @@ static void alloc_mosaic_memory(void){
 		int size = MEMORY_mosaic_num_banks * 0x1000;
 		if (mosaic_ram == NULL || mosaic_current_num_banks != MEMORY_mosaic_num_banks) {
 			mosaic_current_num_banks = MEMORY_mosaic_num_banks;
-			mosaic_ram = (UBYTE *)Util_realloc(mosaic_ram, size, "alloc_mosaic_memory mosaic_ram (realloc)");
+			mosaic_ram = AllocMachineRAM(mosaic_ram, size, "alloc_mosaic_memory mosaic_ram");
 		}
 		memset(mosaic_ram, 0, size);
 	} else {
 		if (mosaic_ram != NULL) {
-			free(mosaic_ram);
+			REGION_Release(mosaic_ram);
 			mosaic_ram = NULL;
 			mosaic_current_num_banks = 0;
 		}
@@ -167,16 +244,14 @@ static void AllocXEMemory(void)
 		/* count number of 16 KB banks, add 1 for saving base memory 0x4000-0x7fff */
 		ULONG size = (1 + (MEMORY_ram_size - 64) / 16) * 16384;
 		if (size != atarixe_memory_size) {
-			if (atarixe_memory != NULL)
-				free(atarixe_memory);
-			atarixe_memory = (UBYTE *) Util_malloc(size, "AllocXEMemory");
+			atarixe_memory = AllocMachineRAM(atarixe_memory, size, "AllocXEMemory");
 			atarixe_memory_size = size;
 			memset(atarixe_memory, 0, size);
 		}
 	}
 	/* atarixe_memory not needed, free it */
 	else if (atarixe_memory != NULL) {
-		free(atarixe_memory);
+		REGION_Release(atarixe_memory);
 		atarixe_memory = NULL;
 		atarixe_memory_size = 0;
 	}
@@ -187,10 +262,10 @@ static void AllocMapRAM(void)
 	if (MEMORY_enable_mapram && Atari800_machine_type == Atari800_MACHINE_XLXE
 	    && MEMORY_ram_size > 20) {
 		if (mapram_memory == NULL)
-			mapram_memory = (UBYTE *)Util_malloc(0x800, "AllocMapRAM");
+			mapram_memory = AllocMachineRAM(NULL, 0x800, "AllocMapRAM");
 	}
 	else if (mapram_memory != NULL) {
-		free(mapram_memory);
+		REGION_Release(mapram_memory);
 		mapram_memory = NULL;
 	}
 }
@@ -217,7 +292,7 @@ void MEMORY_InitialiseMachine(void)
 		if (GTIA_GRACTL & 4)
 			GTIA_TRIG_latch[3] = 0;
 	}
-	memcpy(MEMORY_mem + os_rom_start, MEMORY_os, os_size);
+	MEMORY_dCopyToMem(MEMORY_os, os_rom_start, os_size);
 	switch (Atari800_machine_type) {
 	case Atari800_MACHINE_5200:
 		MEMORY_dFillMem(0x0000, 0x00, 0xf800);
@@ -337,6 +412,7 @@ void MEMORY_InitialiseMachine(void)
 		}
 		break;
 	}
+	FreeMachineRAM();
 	AllocXEMemory();
 	alloc_axlon_memory();
 	alloc_mosaic_memory();
@@ -372,7 +448,20 @@ void MEMORY_StateSave(UBYTE SaveVerbose)
 	temp = MEMORY_ram_size > 64 ? 64 : MEMORY_ram_size;
 	StateSav_SaveINT(&temp, 1);
 	STATESAV_TAG(base_ram);
+#ifdef DIRTY_PAGES
+	{
+		/* clean pages are skipped when only updating an earlier state */
+		int i, j;
+		for (i = 0; i < 256; i = j) {
+			UBYTE dirty = MEMORY_dirty[i];
+			for (j = i + 1; j < 256 && MEMORY_dirty[j] == dirty; j++);
+			if (dirty || !StateSav_SkipUBYTE((j - i) << 8))
+				StateSav_SaveUBYTE(&MEMORY_mem[i << 8], (j - i) << 8);
+		}
+	}
+#else
 	StateSav_SaveUBYTE(&MEMORY_mem[0], 65536);
+#endif
 	STATESAV_TAG(base_ram_attrib);
 #ifndef PAGED_ATTRIB
 	StateSav_SaveUBYTE(&MEMORY_attrib[0], 65536);
@@ -384,11 +473,12 @@ void MEMORY_StateSave(UBYTE SaveVerbose)
 		UBYTE attrib_page[256];
 		int i;
 		for (i = 0; i < 256; i++) {
-			if (MEMORY_writemap[i] == NULL)
-				memset(attrib_page, MEMORY_RAM, 256);
-			else if (MEMORY_writemap[i] == MEMORY_ROM_PutByte)
-				memset(attrib_page, MEMORY_ROM, 256);
-			else if (i == 0x4f || i == 0x5f || i == 0x8f || i == 0x9f) {
+			int kind = attrib_kind(i);
+#ifdef DIRTY_PAGES
+			if (kind == attrib_clean[i] && StateSav_SkipUBYTE(256))
+				continue;
+#endif
+			if (kind == ATTRIB_BOUNTY_BOB) {
 				/* special case: Bounty Bob bank switching registers */
 				memset(attrib_page, MEMORY_ROM, 256);
 				attrib_page[0xf6] = MEMORY_HARDWARE;
@@ -396,9 +486,8 @@ void MEMORY_StateSave(UBYTE SaveVerbose)
 				attrib_page[0xf8] = MEMORY_HARDWARE;
 				attrib_page[0xf9] = MEMORY_HARDWARE;
 			}
-			else {
-				memset(attrib_page, MEMORY_HARDWARE, 256);
-			}
+			else
+				memset(attrib_page, kind, 256);
 			StateSav_SaveUBYTE(&attrib_page[0], 256);
 		}
 	}
@@ -407,10 +496,15 @@ void MEMORY_StateSave(UBYTE SaveVerbose)
 	if (Atari800_machine_type == Atari800_MACHINE_XLXE) {
 	///	if (SaveVerbose != 0)
 	///		StateSav_SaveUBYTE(&MEMORY_basic[0], 8192);
-		StateSav_Save2PSRAM(under_cartA0BF_base, under_cartA0BF_size);
 	///	if (SaveVerbose != 0)
 	///		StateSav_SaveUBYTE(&MEMORY_os[0], 16384);
-		StateSav_Save2PSRAM(under_atarixl_os_base, under_atarixl_os_size);
+#ifdef DIRTY_PAGES
+		if (under_rom_dirty || !StateSav_SkipUBYTE(under_cartA0BF_size + under_atarixl_os_size))
+#endif
+		{
+			StateSav_Save2PSRAM(under_cartA0BF_base, under_cartA0BF_size);
+			StateSav_Save2PSRAM(under_atarixl_os_base, under_atarixl_os_size);
+		}
 	///	if (SaveVerbose != 0)
 	///		StateSav_SaveUBYTE(MEMORY_xegame, 0x2000);
 	}
@@ -488,7 +582,17 @@ void MEMORY_StateRead(UBYTE SaveVerbose, UBYTE StateVersion)
 	if (StateVersion >= 7)
 		/* Read amount of base RAM in kilobytes. */
 		StateSav_ReadINT(&base_ram_kb, 1);
+#ifdef DIRTY_PAGES
+	{
+		/* clean pages are kept when only going back to an earlier state */
+		int i;
+		for (i = 0; i < 256; i++)
+			if (MEMORY_dirty[i] || !StateSav_KeepUBYTE(256))
+				StateSav_ReadUBYTE(&MEMORY_mem[i << 8], 256);
+	}
+#else
 	StateSav_ReadUBYTE(&MEMORY_mem[0], 65536);
+#endif
 #ifndef PAGED_ATTRIB
 	StateSav_ReadUBYTE(&MEMORY_attrib[0], 65536);
 #else
@@ -496,6 +600,10 @@ void MEMORY_StateRead(UBYTE SaveVerbose, UBYTE StateVersion)
 		UBYTE attrib_page[256];
 		int i;
 		for (i = 0; i < 256; i++) {
+#ifdef DIRTY_PAGES
+			if (attrib_kind(i) == attrib_clean[i] && StateSav_KeepUBYTE(256))
+				continue;
+#endif
 			StateSav_ReadUBYTE(&attrib_page[0], 256);
 			/* note: 0x40 is intentional here:
 			   we want ROM on page 0xd1 if H: patches are enabled */
@@ -587,10 +695,15 @@ void MEMORY_StateRead(UBYTE SaveVerbose, UBYTE StateVersion)
 	if (Atari800_machine_type == Atari800_MACHINE_XLXE) {
 	///	if (SaveVerbose)
 	///		StateSav_ReadUBYTE(&MEMORY_basic[0], 8192);
-		StateSav_Read2PSRAM(under_cartA0BF_base, under_cartA0BF_size);
 	///	if (SaveVerbose)
 	///		StateSav_ReadUBYTE(&MEMORY_os[0], 16384);
-		StateSav_Read2PSRAM(under_atarixl_os_base, under_atarixl_os_size);
+#ifdef DIRTY_PAGES
+		if (under_rom_dirty || !StateSav_KeepUBYTE(under_cartA0BF_size + under_atarixl_os_size))
+#endif
+		{
+			StateSav_Read2PSRAM(under_cartA0BF_base, under_cartA0BF_size);
+			StateSav_Read2PSRAM(under_atarixl_os_base, under_atarixl_os_size);
+		}
 	///	if (StateVersion >= 7 && SaveVerbose)
 	///		StateSav_ReadUBYTE(MEMORY_xegame, 0x2000);
 	}
@@ -689,6 +802,9 @@ void MEMORY_StateRead(UBYTE SaveVerbose, UBYTE StateVersion)
 			StateSav_ReadUBYTE(mapram_memory, 0x800);
 		}
 	}
+#ifdef DIRTY_PAGES
+	MEMORY_SetAllDirty();
+#endif
 }
 
 #endif /* BASIC */
@@ -759,6 +875,7 @@ void MEMORY_HandlePORTB(UBYTE byte, UBYTE oldval)
 	if (mapram_selected && !new_mapram_selected) {
 		/* Restore RAM hidden by MapRAM. */
 		memcpy(mapram_memory, MEMORY_mem + 0x5000, 0x800);
+		MEMORY_SetDirty(0x5000, 0x800);
 		for (size_t i = 0; i < 0x800; ++i) {
 			MEMORY_mem[0x5000 + i] = read8psram(under_atarixl_os_base + 0x1000 + i);
 		}
@@ -803,6 +920,7 @@ void MEMORY_HandlePORTB(UBYTE byte, UBYTE oldval)
 		        || antic_bank != new_antic_bank
 		        || (MEMORY_ram_size == MEMORY_RAM_320_COMPY_SHOP && (byte & 0x20) == 0))) {
 			/* Disable Self Test ROM */
+			MEMORY_SetDirty(0x5000, 0x800);
 			for (size_t i = 0; i < 0x800; ++i) {
 				MEMORY_mem[0x5000 + i] = read8psram(under_atarixl_os_base + 0x1000 + i);
 			}
@@ -815,7 +933,7 @@ void MEMORY_HandlePORTB(UBYTE byte, UBYTE oldval)
 		}
 		if (cpu_bank != new_cpu_bank) {
 			memcpy(atarixe_memory + (cpu_bank << 14), MEMORY_mem + 0x4000, 0x4000);
-			memcpy(MEMORY_mem + 0x4000, atarixe_memory + (new_cpu_bank << 14), 0x4000);
+			MEMORY_dCopyToMem(atarixe_memory + (new_cpu_bank << 14), 0x4000, 0x4000);
 		}
 
 		if (MEMORY_ram_size == 128 || MEMORY_ram_size == MEMORY_RAM_320_COMPY_SHOP)
@@ -830,6 +948,7 @@ void MEMORY_HandlePORTB(UBYTE byte, UBYTE oldval)
 		if (byte & 0x01) {
 			/* Enable OS ROM */
 			if (MEMORY_ram_size > 48) {
+				SetUnderROMDirty();
 				for (size_t i = 0; i < 0x1000; ++i) {
 					write8psram(under_atarixl_os_base + i, MEMORY_mem[0xc000 + i]);
 				}
@@ -841,17 +960,19 @@ void MEMORY_HandlePORTB(UBYTE byte, UBYTE oldval)
 				MEMORY_SetROM(0xc000, 0xcfff);
 				MEMORY_SetROM(0xd800, 0xffff);
 			}
-			memcpy(MEMORY_mem + 0xc000, MEMORY_os, 0x1000);
-			memcpy(MEMORY_mem + 0xd800, MEMORY_os + 0x1800, 0x2800);
+			MEMORY_dCopyToMem(MEMORY_os, 0xc000, 0x1000);
+			MEMORY_dCopyToMem(MEMORY_os + 0x1800, 0xd800, 0x2800);
 			ESC_PatchOS();
 		}
 		else {
 			/* Disable OS ROM */
 			if (MEMORY_ram_size > 48) {
+				MEMORY_SetDirty(0xc000, 0x1000);
 				for (size_t i = 0; i < 0x1000; ++i) {
 					MEMORY_mem[0xc000 + i] = read8psram(under_atarixl_os_base + i);
 				}
 				///memcpy(MEMORY_mem + 0xc000, under_atarixl_os, 0x1000);
+				MEMORY_SetDirty(0xd800, 0x2800);
 				for (size_t i = 0; i < 0x2800; ++i) {
 					MEMORY_mem[0xd800 + i] = read8psram(under_atarixl_os_base + 0x1800 + i);
 				}
@@ -865,6 +986,7 @@ void MEMORY_HandlePORTB(UBYTE byte, UBYTE oldval)
 			/* When OS ROM is disabled we also have to disable Self Test - Jindroush */
 			if (MEMORY_selftest_enabled) {
 				if (MEMORY_ram_size > 20) {
+					MEMORY_SetDirty(0x5000, 0x800);
 					for (size_t i = 0; i < 0x800; ++i) {
 						MEMORY_mem[0x5000 + i] = read8psram(under_atarixl_os_base + 0x1000 + i);
 					}
@@ -887,6 +1009,7 @@ void MEMORY_HandlePORTB(UBYTE byte, UBYTE oldval)
 		UBYTE const *builtin_cart_old = builtin_cart(oldval);
 		if (builtin_cart_old != builtin_cart_new) {
 			if (builtin_cart_old == NULL && MEMORY_ram_size > 40) { /* switching RAM out */
+				SetUnderROMDirty();
 				for (size_t i = 0; i < 0x2000; ++i) {
 					write8psram(under_cartA0BF_base + i, MEMORY_mem[0xa000 + i]);
 				}
@@ -895,6 +1018,7 @@ void MEMORY_HandlePORTB(UBYTE byte, UBYTE oldval)
 			}
 			if (builtin_cart_new == NULL) { /* switching RAM in */
 				if (MEMORY_ram_size > 40) {
+					MEMORY_SetDirty(0xa000, 0x2000);
 					for (size_t i = 0; i < 0x2000; ++i) {
 						MEMORY_mem[0xa000 + i] = read8psram(under_cartA0BF_base + i);
 					}
@@ -905,7 +1029,7 @@ void MEMORY_HandlePORTB(UBYTE byte, UBYTE oldval)
 					MEMORY_dFillMem(0xa000, 0xff, 0x2000);
 			}
 			else
-				memcpy(MEMORY_mem + 0xa000, builtin_cart_new, 0x2000);
+				MEMORY_dCopyToMem(builtin_cart_new, 0xa000, 0x2000);
 		}
 	}
 
@@ -914,6 +1038,7 @@ void MEMORY_HandlePORTB(UBYTE byte, UBYTE oldval)
 		if (MEMORY_selftest_enabled) {
 			/* Disable Self Test ROM */
 			if (MEMORY_ram_size > 20) {
+				MEMORY_SetDirty(0x5000, 0x800);
 				for (size_t i = 0; i < 0x800; ++i) {
 					MEMORY_mem[0x5000 + i] = read8psram(under_atarixl_os_base + 0x1000 + i);
 				}
@@ -937,6 +1062,7 @@ void MEMORY_HandlePORTB(UBYTE byte, UBYTE oldval)
 		&& !((byte & 0x10) == 0 && MEMORY_ram_size == 1088)) {
 			/* Enable Self Test ROM */
 			if (MEMORY_ram_size > 20) {
+				SetUnderROMDirty();
 				for (size_t i = 0; i < 0x800; ++i) {
 					write8psram(under_atarixl_os_base + 0x1000 + i, MEMORY_mem[0x5000 + i]);
 				}
@@ -946,7 +1072,7 @@ void MEMORY_HandlePORTB(UBYTE byte, UBYTE oldval)
 					memcpy(antic_bank_under_selftest, atarixe_memory + (antic_bank << 14) + 0x1000, 0x800);
 				MEMORY_SetROM(0x5000, 0x57ff);
 			}
-			memcpy(MEMORY_mem + 0x5000, MEMORY_os + 0x1000, 0x800);
+			MEMORY_dCopyToMem(MEMORY_os + 0x1000, 0x5000, 0x800);
 			if (ANTIC_xe_ptr != NULL)
 				/* Also enable Self Test in the XE bank accessed by ANTIC. */
 				memcpy(atarixe_memory + (antic_bank << 14) + 0x1000, MEMORY_os + 0x1000, 0x800);
@@ -954,11 +1080,12 @@ void MEMORY_HandlePORTB(UBYTE byte, UBYTE oldval)
 		}
 		else if (!mapram_selected && new_mapram_selected) {
 			/* Enable MapRAM */
+			SetUnderROMDirty();
 			for (size_t i = 0; i < 0x800; ++i) {
 				write8psram(under_atarixl_os_base + 0x1000 + i, MEMORY_mem[0x5000 + i]);
 			}
 			///memcpy(under_atarixl_os + 0x1000, MEMORY_mem + 0x5000, 0x800);
-			memcpy(MEMORY_mem + 0x5000, mapram_memory, 0x800);
+			MEMORY_dCopyToMem(mapram_memory, 0x5000, 0x800);
 		}
 	}
 }
@@ -988,13 +1115,13 @@ static void MosaicPutByte(UWORD addr, UBYTE byte)
 	}
 	else if (newbank < mosaic_current_num_banks && mosaic_curbank >= mosaic_current_num_banks) {
 		/*rom->ram*/
-		memcpy(MEMORY_mem + 0xc000, mosaic_ram+newbank*0x1000,0x1000);
+		MEMORY_dCopyToMem(mosaic_ram+newbank*0x1000, 0xc000, 0x1000);
 		MEMORY_SetRAM(0xc000, 0xcfff);
 	}
 	else {
 		/*ram -> ram*/
 		memcpy(mosaic_ram + mosaic_curbank*0x1000, MEMORY_mem + 0xc000, 0x1000);
-		memcpy(MEMORY_mem + 0xc000, mosaic_ram + newbank*0x1000, 0x1000);
+		MEMORY_dCopyToMem(mosaic_ram + newbank*0x1000, 0xc000, 0x1000);
 		MEMORY_SetRAM(0xc000, 0xcfff);
 	}
 	mosaic_curbank = newbank;
@@ -1023,7 +1150,7 @@ static void AxlonPutByte(UWORD addr, UBYTE byte)
 {
 	int newbank;
 	/*Write-through to RAM if it is the page 0x0f shadow*/
-	if ((addr&0xff00) == 0x0f00) MEMORY_mem[addr] = byte;
+	if ((addr&0xff00) == 0x0f00) MEMORY_dPutByte(addr, byte);
 	if ((addr&0xff) < 0xc0) return; /*0xffc0-0xffff and 0x0fc0-0x0fff only*/
 #ifdef DEBUG
 	Log_print("AxlonPutByte:%4X:%2X", addr, byte);
@@ -1031,7 +1158,7 @@ static void AxlonPutByte(UWORD addr, UBYTE byte)
 	newbank = (byte&axlon_current_bankmask);
 	if (newbank == axlon_curbank) return;
 	memcpy(axlon_ram + axlon_curbank*0x4000, MEMORY_mem + 0x4000, 0x4000);
-	memcpy(MEMORY_mem + 0x4000, axlon_ram + newbank*0x4000, 0x4000);
+	MEMORY_dCopyToMem(axlon_ram + newbank*0x4000, 0x4000, 0x4000);
 	axlon_curbank = newbank;
 }
 
@@ -1047,6 +1174,7 @@ void MEMORY_Cart809fDisable(void)
 {
 	if (cart809F_enabled) {
 		if (MEMORY_ram_size > 32) {
+			MEMORY_SetDirty(0x8000, 0x2000);
 			for(size_t i = 0; i < 0x2000; ++i) {
 				MEMORY_mem[0x8000 + i] = read8psram(under_cart809F_base + i);
 			}
@@ -1081,6 +1209,7 @@ void MEMORY_CartA0bfDisable(void)
 		UBYTE const *builtin = builtin_cart(PIA_PORTB | PIA_PORTB_mask);
 		if (builtin == NULL) { /* switch RAM in */
 			if (MEMORY_ram_size > 40) {
+				MEMORY_SetDirty(0xa000, 0x2000);
 				for (size_t i = 0; i < 0x2000; ++i) {
 					MEMORY_mem[0xa000 + i] = read8psram(under_cartA0BF_base + i);
 				}
@@ -1091,7 +1220,7 @@ void MEMORY_CartA0bfDisable(void)
 				MEMORY_dFillMem(0xa000, 0xff, 0x2000);
 		}
 		else
-			memcpy(MEMORY_mem + 0xa000, builtin, 0x2000);
+			MEMORY_dCopyToMem(builtin, 0xa000, 0x2000);
 		MEMORY_cartA0BF_enabled = FALSE;
 		if (Atari800_machine_type == Atari800_MACHINE_XLXE) {
 			GTIA_TRIG[3] = 0;
@@ -1108,6 +1237,7 @@ void MEMORY_CartA0bfEnable(void)
 		/* or accessing extended 576K or 1088K memory */
 		if (MEMORY_ram_size > 40 && builtin_cart(PIA_PORTB | PIA_PORTB_mask) == NULL) {
 			/* Back-up 0xa000-0xbfff RAM */
+			SetUnderROMDirty();
 			for (size_t i = 0; i < 0x2000; ++i) {
 				write8psram(under_cartA0BF_base + i, MEMORY_mem[0xa000 + i]);
 			}
@@ -7,17 +7,21 @@
 #include "atari.h"
 
 #define MEMORY_dGetByte(x)				(MEMORY_mem[x])
+#ifndef DIRTY_PAGES
 #define MEMORY_dPutByte(x, y)			(MEMORY_mem[x] = y)
+#else
+#define MEMORY_dPutByte(x, y)			MEMORY_DirtyPutByte(x, y)
+#endif
 
 #ifndef WORDS_BIGENDIAN
-#ifdef WORDS_UNALIGNED_OK
+#if defined(WORDS_UNALIGNED_OK) && !defined(DIRTY_PAGES)
 #define MEMORY_dGetWord(x)				UNALIGNED_GET_WORD(MEMORY_mem+(x), memory_read_word_stat)
 #define MEMORY_dPutWord(x, y)			UNALIGNED_PUT_WORD(MEMORY_mem+(x), (y), memory_write_word_stat)
 #define MEMORY_dGetWordAligned(x)		UNALIGNED_GET_WORD(MEMORY_mem+(x), memory_read_aligned_word_stat)
 #define MEMORY_dPutWordAligned(x, y)	UNALIGNED_PUT_WORD(MEMORY_mem+(x), (y), memory_write_aligned_word_stat)
 #else	/* WORDS_UNALIGNED_OK */
 #define MEMORY_dGetWord(x)				(MEMORY_mem[x] + (MEMORY_mem[(x) + 1] << 8))
-#define MEMORY_dPutWord(x, y)			(MEMORY_mem[x] = (UBYTE) (y), MEMORY_mem[(x) + 1] = (UBYTE) ((y) >> 8))
+#define MEMORY_dPutWord(x, y)			(MEMORY_dPutByte(x, (UBYTE) (y)), MEMORY_dPutByte((x) + 1, (UBYTE) ((y) >> 8)))
 /* faster versions of MEMORY_jdGetWord and MEMORY_dPutWord for even addresses */
 /* TODO: guarantee that memory is UWORD-aligned and use UWORD access */
 #define MEMORY_dGetWordAligned(x)		MEMORY_dGetWord(x)
@@ -26,17 +30,46 @@
 #else	/* WORDS_BIGENDIAN */
 /* can't do any word optimizations for big endian machines */
 #define MEMORY_dGetWord(x)				(MEMORY_mem[x] + (MEMORY_mem[(x) + 1] << 8))
-#define MEMORY_dPutWord(x, y)			(MEMORY_mem[x] = (UBYTE) (y), MEMORY_mem[(x) + 1] = (UBYTE) ((y) >> 8))
+#define MEMORY_dPutWord(x, y)			(MEMORY_dPutByte(x, (UBYTE) (y)), MEMORY_dPutByte((x) + 1, (UBYTE) ((y) >> 8)))
 #define MEMORY_dGetWordAligned(x)		MEMORY_dGetWord(x)
 #define MEMORY_dPutWordAligned(x, y)	MEMORY_dPutWord(x, y)
 #endif	/* WORDS_BIGENDIAN */
 
 #define MEMORY_dCopyFromMem(from, to, size)	memcpy(to, MEMORY_mem + (from), size)
-#define MEMORY_dCopyToMem(from, to, size)		memcpy(MEMORY_mem + (to), from, size)
-#define MEMORY_dFillMem(addr1, value, length)	memset(MEMORY_mem + (addr1), value, length)
+#define MEMORY_dCopyToMem(from, to, size)		(MEMORY_SetDirty(to, size), memcpy(MEMORY_mem + (to), from, size))
+#define MEMORY_dFillMem(addr1, value, length)	(MEMORY_SetDirty(addr1, length), memset(MEMORY_mem + (addr1), value, length))
 
 extern UBYTE MEMORY_mem[65536 + 2];
 
+#ifdef DIRTY_PAGES
+/* One flag per 256-byte page of MEMORY_mem, set by every store made
+   through the macros in this file. Code that writes MEMORY_mem directly
+   calls MEMORY_SetDirty itself. The rewind ring saves only the pages
+   flagged since its previous snapshot, then calls MEMORY_ClearDirty. */
+extern UBYTE MEMORY_dirty[256];
+
+inline static UBYTE MEMORY_DirtyPutByte(int addr, UBYTE byte) {
+	MEMORY_dirty[(addr >> 8) & 0xff] = 1;
+	return MEMORY_mem[addr] = byte;
+}
+
+inline static void MEMORY_SetDirty(int addr, int size) {
+	int last = (addr + size - 1) >> 8;
+	if (size <= 0)
+		return;
+	if (last > 0xff)
+		last = 0xff;
+	memset(MEMORY_dirty + (addr >> 8), 1, last - (addr >> 8) + 1);
+}
+
+/* Marks all memory clean, remembering the current memory map. */
+void MEMORY_ClearDirty(void);
+/* Marks all memory dirty, e.g. after a state was loaded. */
+void MEMORY_SetAllDirty(void);
+#else
+#define MEMORY_SetDirty(addr, size)	((void) 0)
+#endif /* DIRTY_PAGES */
+
 /* RAM size in kilobytes.
    Valid values for Atari800_MACHINE_800 are: 16, 48, 52.
    Valid values for Atari800_MACHINE_XLXE are: 16, 64, 128, 192, RAM_320_RAMBO,
@@ -58,7 +91,7 @@ extern UBYTE MEMORY_attrib[65536];
 #define MEMORY_GetByte(addr)		(MEMORY_attrib[addr] == MEMORY_HARDWARE ? MEMORY_HwGetByte(addr, FALSE) : MEMORY_mem[addr])
 /* Reads a byte from ADDR, but without any side effects. */
 #define MEMORY_SafeGetByte(addr)		(MEMORY_attrib[addr] == MEMORY_HARDWARE ? MEMORY_HwGetByte(addr, TRUE) : MEMORY_mem[addr])
-#define MEMORY_PutByte(addr, byte)	 do { if (MEMORY_attrib[addr] == MEMORY_RAM) MEMORY_mem[addr] = byte; else if (MEMORY_attrib[addr] == MEMORY_HARDWARE) MEMORY_HwPutByte(addr, byte); } while (0)
+#define MEMORY_PutByte(addr, byte)	 do { if (MEMORY_attrib[addr] == MEMORY_RAM) MEMORY_dPutByte(addr, byte); else if (MEMORY_attrib[addr] == MEMORY_HARDWARE) MEMORY_HwPutByte(addr, byte); } while (0)
 #define MEMORY_SetRAM(addr1, addr2) memset(MEMORY_attrib + (addr1), MEMORY_RAM, (addr2) - (addr1) + 1)
 #define MEMORY_SetROM(addr1, addr2) memset(MEMORY_attrib + (addr1), MEMORY_ROM, (addr2) - (addr1) + 1)
 #define MEMORY_SetHARDWARE(addr1, addr2) memset(MEMORY_attrib + (addr1), MEMORY_HARDWARE, (addr2) - (addr1) + 1)
@@ -76,7 +109,7 @@ void MEMORY_ROM_PutByte(UWORD addr, UBYTE byte);
 #define MEMORY_GetByte(addr)		(MEMORY_readmap[(addr) >> 8] ? (*MEMORY_readmap[(addr) >> 8])(addr, FALSE) : MEMORY_mem[addr])
 /* Reads a byte from ADDR, but without any side effects. */
 #define MEMORY_SafeGetByte(addr)		(MEMORY_readmap[(addr) >> 8] ? (*MEMORY_readmap[(addr) >> 8])(addr, TRUE) : MEMORY_mem[addr])
-#define MEMORY_PutByte(addr,byte)	(MEMORY_writemap[(addr) >> 8] ? ((*MEMORY_writemap[(addr) >> 8])(addr, byte), 0) : (MEMORY_mem[addr] = byte))
+#define MEMORY_PutByte(addr,byte)	(MEMORY_writemap[(addr) >> 8] ? ((*MEMORY_writemap[(addr) >> 8])(addr, byte), 0) : MEMORY_dPutByte(addr, byte))
 #define MEMORY_SetRAM(addr1, addr2) do { \
 		int i; \
 		for (i = (addr1) >> 8; i <= (addr2) >> 8; i++) { \
@@ -122,7 +155,7 @@ void MEMORY_Cart809fDisable(void);
 void MEMORY_Cart809fEnable(void);
 void MEMORY_CartA0bfDisable(void);
 void MEMORY_CartA0bfEnable(void);
-#define MEMORY_CopyFromCart(addr1, addr2, src) memcpy(MEMORY_mem + (addr1), src, (addr2) - (addr1) + 1)
+#define MEMORY_CopyFromCart(addr1, addr2, src) (MEMORY_SetDirty(addr1, (addr2) - (addr1) + 1), memcpy(MEMORY_mem + (addr1), src, (addr2) - (addr1) + 1))
 #define MEMORY_CopyToCart(addr1, addr2, dst) memcpy(dst, MEMORY_mem + (addr1), (addr2) - (addr1) + 1)
 void MEMORY_GetCharset(UBYTE *cs);
 
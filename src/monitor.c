@@ -522,8 +522,8 @@ static void free_user_labels(void)
 {
 	if (symtable_user != NULL) {
 		while (symtable_user_size > 0)
-			free(symtable_user[--symtable_user_size].name);
-		free(symtable_user);
+			Util_free(symtable_user[--symtable_user_size].name);
+		Util_free(symtable_user);
 		symtable_user = NULL;
 	}
 }
@@ -955,7 +955,7 @@ static UWORD show_instruction(FIL *fp, UWORD pc)
 void MONITOR_Exit(void)
 {
 	if (trainer_memory != NULL) {
-		free(trainer_memory);
+		Util_free(trainer_memory);
 		trainer_memory=NULL;
 		trainer_flags=NULL;
 	}
@@ -2221,6 +2221,7 @@ static void monitor_read_from_file(UWORD *addr)
 					if ((int)toaddr-(int)fromaddr<0) { printf("Bad xex file\n"); break; }
 					nbytes=toaddr-fromaddr+1;
 					UINT rb;
+					MEMORY_SetDirty(*addr, nbytes);
 					/* if not full block, error */
 					if (f_read(&f, &MEMORY_mem[*addr], nbytes, &rb) != FR_OK) {
 						printf("Bad xex file\n");
@@ -2247,6 +2248,7 @@ static void monitor_read_from_file(UWORD *addr)
 					}
 					else {
 						UINT rb;
+						MEMORY_SetDirty(*addr, nbytes);
 						/* read as many bytes as given or available */
 						if (f_read(&f, &MEMORY_mem[*addr], nbytes, &rb) != FR_OK)
 							printf("Could not read bytes\n");
@@ -34,6 +34,10 @@
 #include "mzpokeysnd.h"
 #include "pokeysnd.h"
 #include "remez.h"
+#include "screen.h"
+#include "sramtab.h"
+#include "util.h"
+#include "log.h"
 #include "antic.h"
 #include "gtia.h"
 
@@ -75,8 +79,16 @@ static int num_cur_pokeys = 0;
 static int pokey_frq; /* Hz - for easier resampling */
 static int filter_size;
 
+/* Resampling filters precomputed for a playback rate and quality */
+typedef struct {
+    int playback_freq;
+    int quality;
+    int size;
+    const double *data;
+} filter_table_t;
+
 #include "filter_data.h"
-///static double * filter_data = (double*)polyDtbl;//[SND_FILTER_SIZE];
+static const double *filter_data;
 static int audible_frq;
 
 static const int pokey_frq_ideal =  1789790; /* Hz - True */
@@ -103,6 +115,9 @@ static int poly5tbl[31];
 #include <pico/platform.h>
 #include "poly9tbl.h"
 #include "poly17tbl.h"
+/* poly9tbl and poly17tbl, or their copies in SRAM */
+static const UBYTE *poly9_table = poly9tbl;
+static const UBYTE *poly17_table = poly17tbl;
 
 struct stPokeyState;
 
@@ -434,6 +449,7 @@ static double read_resam_all(PokeyState* ps)
 
     if(ps->qebeg == ps->qeend)
     {
+        SRAMTAB_COUNT(SRAMTAB_FILTER);
         return ps->ovola * filter_data[0]; /* if no events in the queue */
     }
 
@@ -447,6 +463,7 @@ static double read_resam_all(PokeyState* ps)
         {
             bvol = ps->qev[i];
             sum += (avol-bvol)*filter_data[ps->curtick - ps->qet[i]];
+            SRAMTAB_COUNT(SRAMTAB_FILTER);
             avol = bvol;
             ++i;
         }
@@ -458,11 +475,13 @@ static double read_resam_all(PokeyState* ps)
     {
         bvol = ps->qev[i];
         sum += (avol-bvol)*filter_data[ps->curtick - ps->qet[i]];
+        SRAMTAB_COUNT(SRAMTAB_FILTER);
         avol = bvol;
         ++i;
     }
 
     sum += avol*filter_data[0];
+    SRAMTAB_COUNT(SRAMTAB_FILTER);
     return sum;
 }
 
@@ -473,6 +492,7 @@ static double interp_filter_data(int pos, double frac)
 	if (pos+1 >= filter_size) {
 		return 0.0;
 	}
+	SRAMTAB_COUNT(SRAMTAB_FILTER);
 	return (frac)*filter_data[pos+1]+(1-frac)*(filter_data[pos]-filter_data[filter_size-1]);
 }
 
@@ -649,6 +669,7 @@ static void build_poly17(void)
 	f_write(&f, str, strlen(str), &bw);
 	f_close(&f);
 #endif
+	poly17_table = (const UBYTE *) SRAMTAB_Place(SRAMTAB_POLY17, poly17tbl, sizeof(poly17tbl));
 }
 
 static void build_poly9(void) {
@@ -686,6 +707,7 @@ static void build_poly9(void) {
 	f_write(&f, str, strlen(str), &bw);
 	f_close(&f);
 #endif
+	poly9_table = (const UBYTE *) SRAMTAB_Place(SRAMTAB_POLY9, poly9tbl, sizeof(poly9tbl));
 }
 
 static void advance_polies(PokeyState* ps, int tacts)
@@ -1082,9 +1104,15 @@ static void advance_ticks(PokeyState* ps, int ticks)
             p5v = poly5tbl[ps->poly5pos] & 1;
             p4v = poly4tbl[ps->poly4pos] & 1;
             if(ps->selpoly9)
-                p917v = poly9tbl[ps->poly9pos] & 1;
+            {
+                p917v = poly9_table[ps->poly9pos] & 1;
+                SRAMTAB_COUNT(SRAMTAB_POLY9);
+            }
             else
-                p917v = poly17tbl[ps->poly17pos] & 1;
+            {
+                p917v = poly17_table[ps->poly17pos] & 1;
+                SRAMTAB_COUNT(SRAMTAB_POLY17);
+            }
 
 #ifdef NONLINEAR_MIXING
             if(ta == tbe0)
@@ -1223,104 +1251,226 @@ static const struct {
 };
 static const double __in_flash() __aligned(8) passtab[] = { 0.5, 0.6, 0.7 };
 
-static int remez_filter_table(double resamp_rate, /* output_rate/input_rate */
-                              double *cutoff,
-                              int quality
-) {
-#ifndef filter_data.h_regenerate
-    return sizeof(filter_data) / sizeof(filter_data[0]);
-#else
-    printf("remez_filter_table");
-    filter_data = (double*)Screen_atari;
-    int i;
-    int ripple = 0, order = 0;
-    int size;
-    double weights[2], desired[2], bands[4];
-    static const int interlevel = 5;
-    double step = 1.0 / interlevel;
-    *cutoff = 0.95 * 0.5 * resamp_rate;
+/* Picks the filter order and stopband for RESAMP_RATE (output_rate/
+   input_rate) and QUALITY, and returns the filter size. */
+static int filter_params(double resamp_rate, int quality, int *ripple, int *order)
+{
+    double cutoff = 0.95 * 0.5 * resamp_rate;
     if (quality >= (int) (sizeof(passtab) / sizeof(passtab[0])))
         quality = (int) (sizeof(passtab) / sizeof(passtab[0])) - 1;
-    for (ripple = 0; paramtab[ripple].stop > 0; ripple++) {
-        for (order = 0; order < (int) (sizeof(orders)/sizeof(orders[0])); order++) {
-            if ((*cutoff - paramtab[ripple].twidth[order]) > passtab[quality] * 0.5 * resamp_rate) {
-	            printf("transition width OK");
-	            goto found;
-            }
+    for (*ripple = 0; paramtab[*ripple].stop > 0; (*ripple)++) {
+        for (*order = 0; *order < (int) (sizeof(orders)/sizeof(orders[0])); (*order)++) {
+            if ((cutoff - paramtab[*ripple].twidth[*order]) > passtab[quality] * 0.5 * resamp_rate)
+                return orders[*order] + 1;
         }
     }
-    printf("not found -- use shortest transition");
-    ripple--;
-    order--;
-found:
-#if 0
-  printf("order: %d, cutoff: %g\tstopband:%d\ttranswidth:%f\n",
-         orders[order],
-	 1789790 * *cutoff,
-	 paramtab[ripple].stop,
-	 1789790 * paramtab[ripple].twidth[order]);
-  exit(1);
-#endif
-    printf("order: %d; ripple: %d", order, ripple);
-    size = orders[order] + 1;
-    if (size > SND_FILTER_SIZE) {
-        printf("static table too short %d", size);
-        return 0;
-    }
-    printf("orders[%d] + 1 = %d", order, size);
+    /* not found -- use shortest transition */
+    (*ripple)--;
+    (*order)--;
+    return orders[*order] + 1;
+}
+
+/* Designs the filter for RESAMP_RATE and QUALITY into H, which has room
+   for its size, with TMP as work space for REMEZ_CreateFilter.  Returns
+   the size. */
+static int design_filter(double *h, double resamp_rate, int quality, double *tmp)
+{
+    int i;
+    int ripple, order;
+    int size = filter_params(resamp_rate, quality, &ripple, &order);
+    double weights[2], desired[2], bands[4];
+    static const int interlevel = 5;
+    double step = 1.0 / interlevel;
+    double cutoff = 0.95 * 0.5 * resamp_rate;
     desired[0] = 1;
     desired[1] = 0;
     weights[0] = 1;
     weights[1] = paramtab[ripple].weight;
     bands[0] = 0;
-    bands[2] = *cutoff;
+    bands[2] = cutoff;
     bands[1] = bands[2] - paramtab[ripple].twidth[order];
     bands[3] = 0.5;
     bands[1] *= (double)interlevel;
     bands[2] *= (double)interlevel;
-    REMEZ_CreateFilter(filter_data, (size / interlevel) + 1, 2, bands, desired, weights, REMEZ_BANDPASS,
-                       filter_data + (size * sizeof(filter_data[0]))
-    );
+    REMEZ_CreateFilter(h, (size / interlevel) + 1, 2, bands, desired, weights, REMEZ_BANDPASS, tmp);
     for (i = size - interlevel; i >= 0; i -= interlevel) {
         int s;
-        double h1 = filter_data[i/interlevel];
-        double h2 = filter_data[i/interlevel+1];
+        double h1 = h[i/interlevel];
+        double h2 = h[i/interlevel+1];
         for (s = 0; s < interlevel; s++) {
             double d = (double)s * step;
-            filter_data[i+s] = (h1*(1.0 - d) + h2 * d) * step;
+            h[i+s] = (h1*(1.0 - d) + h2 * d) * step;
         }
     }
     /* compute reversed cumulative sum table */
     for (i = size - 2; i >= 0; i--) {
-        filter_data[i] += filter_data[i + 1];
+        h[i] += h[i + 1];
     }
-	char tmp[1024];
-	FIL f; UINT bw;
-	FRESULT fr = f_open(&f, "\\filter_data.h", FA_WRITE | FA_CREATE_ALWAYS);
-	const char * str = "const double __in_flash() __aligned(8) filter_data[%d] = {\n";
-	sprintf(tmp, str, size);
-	f_write(&f, tmp, strlen(tmp), &bw);
-	for (int i = 0; i < size; ++i) {
-		if (i && !(i % 16)) {
-			sprintf(tmp, " // 0x%d\n", i - 16);
-			f_write(&f, tmp, strlen(tmp), &bw);
-		}
-		if (i == 0) {
-			str = "  ";
-		} else {
-			str = ", ";
-		}
-		f_write(&f, str, strlen(str), &bw);
-		sprintf(tmp, "%.15f", filter_data[i]);
-		f_write(&f, tmp, strlen(tmp), &bw);
-	}
-	sprintf(tmp, "};\n"); f_write(&f, tmp, strlen(tmp), &bw);
-	f_close(&f);
-    filter_data = (double*)polyDtbl;
     return size;
-#endif
 }
 
+/* Filters for the rates not in filter_tables, designed once and kept on
+   the card: FILTER_CACHE_DIR/<rate>_<quality>.flt holds a filter_cache_t
+   and the table. */
+#define FILTER_CACHE_DIR "/.a800flt"
+#define FILTER_CACHE_MAGIC 0x54463841 /* "A8FT" */
+#define FILTER_CACHE_VERSION 1
+
+typedef struct {
+    ULONG magic;
+    ULONG version;
+    ULONG playback_freq;
+    ULONG pokey_frq;
+    ULONG quality;
+    ULONG size;
+} filter_cache_t;
+
+static double *filter_custom = NULL;	/* filter_data of a rate not built in */
+
+static void filter_cache_name(char *path, int playback_freq, int quality)
+{
+    snprintf(path, FILENAME_MAX, FILTER_CACHE_DIR "/%d_%d.flt", playback_freq, quality);
+}
+
+static int filter_cache_read(const filter_cache_t *expected)
+{
+    char path[FILENAME_MAX];
+    filter_cache_t header;
+    FIL f;
+    UINT n;
+    UINT len = expected->size * sizeof(double);
+    int ok;
+    filter_cache_name(path, expected->playback_freq, expected->quality);
+    if (f_open(&f, path, FA_READ) != FR_OK)
+        return FALSE;
+    ok = f_read(&f, &header, sizeof(header), &n) == FR_OK && n == sizeof(header)
+      && memcmp(&header, expected, sizeof(header)) == 0
+      && f_read(&f, filter_custom, len, &n) == FR_OK && n == len;
+    f_close(&f);
+    return ok;
+}
+
+static void filter_cache_write(const filter_cache_t *header)
+{
+    char path[FILENAME_MAX];
+    FIL f;
+    UINT n;
+    UINT len = header->size * sizeof(double);
+    int ok;
+    filter_cache_name(path, header->playback_freq, header->quality);
+    f_mkdir(FILTER_CACHE_DIR);
+    if (f_open(&f, path, FA_WRITE | FA_CREATE_ALWAYS) != FR_OK)
+        return;
+    ok = f_write(&f, header, sizeof(*header), &n) == FR_OK && n == sizeof(*header)
+      && f_write(&f, filter_custom, len, &n) == FR_OK && n == len;
+    if (f_close(&f) != FR_OK || !ok)
+        f_unlink(path);
+}
+
+/* Sets filter_data for the playback rate and QUALITY and returns its
+   size: a table from filter_data.h, or one designed for another rate,
+   from the card when it has been designed before. */
+static int remez_filter_table(double resamp_rate, /* output_rate/input_rate */
+                              double *cutoff,
+                              int quality
+) {
+    filter_cache_t header;
+    int ripple, order;
+    int i;
+    *cutoff = 0.95 * 0.5 * resamp_rate;
+    if (quality >= (int) (sizeof(passtab) / sizeof(passtab[0])))
+        quality = (int) (sizeof(passtab) / sizeof(passtab[0])) - 1;
+    Util_free(filter_custom);
+    filter_custom = NULL;
+    for (i = 0; i < (int) (sizeof(filter_tables) / sizeof(filter_tables[0])); i++) {
+        if (filter_tables[i].playback_freq == POKEYSND_playback_freq
+            && filter_tables[i].quality == quality) {
+            filter_data = (const double *) SRAMTAB_Place(SRAMTAB_FILTER, filter_tables[i].data,
+                                                          filter_tables[i].size * sizeof(double));
+            return filter_tables[i].size;
+        }
+    }
+    header.magic = FILTER_CACHE_MAGIC;
+    header.version = FILTER_CACHE_VERSION;
+    header.playback_freq = POKEYSND_playback_freq;
+    header.pokey_frq = pokey_frq;
+    header.quality = quality;
+    header.size = filter_params(resamp_rate, quality, &ripple, &order);
+    filter_custom = (double *) Util_malloc(header.size * sizeof(double), "remez_filter_table");
+    filter_data = filter_custom;
+    if (filter_cache_read(&header))
+        return header.size;
+    Log_print("Designing the sound filter for %d Hz", POKEYSND_playback_freq);
+    /* the screen is the work space, it is redrawn anyway */
+    design_filter(filter_custom, resamp_rate, quality, (double *) Screen_atari);
+    filter_cache_write(&header);
+    return header.size;
+}
+
+#ifdef FILTER_DATA_REGENERATE
+/* Writes filter_data.h with the filters for the rates of the sound menu
+   and every quality, one table for the qualities that share a design. */
+static void write_filter_tables(void)
+{
+    static const int rates[] = { 8192, 11025, 22050, 44100, 48000 };
+    static const int n_quality = (int) (sizeof(passtab) / sizeof(passtab[0]));
+    static double h[1201];
+    char tmp[128];
+    char names[sizeof(rates) / sizeof(rates[0])][3][32];
+    int sizes[sizeof(rates) / sizeof(rates[0])][3];
+    FIL f;
+    UINT bw;
+    int r, q, i;
+    f_open(&f, "\\filter_data.h", FA_WRITE | FA_CREATE_ALWAYS);
+    sprintf(tmp, "/* Resampling filters of the MZ POKEY engine, written by write_filter_tables() */\n");
+    f_write(&f, tmp, strlen(tmp), &bw);
+    for (r = 0; r < (int) (sizeof(rates) / sizeof(rates[0])); r++) {
+        int frq = (int)(((double)pokey_frq_ideal/rates[r]) + 0.5) * rates[r];
+        double resamp_rate = (double)rates[r]/frq;
+        for (q = 0; q < n_quality; q++) {
+            int ripple, order, p;
+            sizes[r][q] = filter_params(resamp_rate, q, &ripple, &order);
+            /* a quality picking the same design as a lower one shares its table */
+            for (p = 0; p < q; p++) {
+                int ripple2, order2;
+                filter_params(resamp_rate, p, &ripple2, &order2);
+                if (ripple2 == ripple && order2 == order)
+                    break;
+            }
+            if (p < q) {
+                strcpy(names[r][q], names[r][p]);
+                continue;
+            }
+            sprintf(names[r][q], "filter_%d_%d", rates[r], q);
+            design_filter(h, resamp_rate, q, (double *) Screen_atari);
+            sprintf(tmp, "static const double __in_flash() __aligned(8) %s[%d] = {\n", names[r][q], sizes[r][q]);
+            f_write(&f, tmp, strlen(tmp), &bw);
+            for (i = 0; i < sizes[r][q]; ++i) {
+                if (i && !(i % 16)) {
+                    sprintf(tmp, " // 0x%d\n", i - 16);
+                    f_write(&f, tmp, strlen(tmp), &bw);
+                }
+                f_write(&f, i == 0 ? "  " : ", ", 2, &bw);
+                sprintf(tmp, "%.15f", h[i]);
+                f_write(&f, tmp, strlen(tmp), &bw);
+            }
+            sprintf(tmp, "\n};\n");
+            f_write(&f, tmp, strlen(tmp), &bw);
+        }
+    }
+    sprintf(tmp, "static const filter_table_t __in_flash() __aligned(4) filter_tables[] = {\n");
+    f_write(&f, tmp, strlen(tmp), &bw);
+    for (r = 0; r < (int) (sizeof(rates) / sizeof(rates[0])); r++)
+        for (q = 0; q < n_quality; q++) {
+            sprintf(tmp, "    { %d, %d, %d, %s },\n", rates[r], q, sizes[r][q], names[r][q]);
+            f_write(&f, tmp, strlen(tmp), &bw);
+        }
+    sprintf(tmp, "};\n");
+    f_write(&f, tmp, strlen(tmp), &bw);
+    f_close(&f);
+}
+#endif
+
 static void mzpokeysnd_process_8(void* sndbuffer, int sndn);
 static void mzpokeysnd_process_16(void* sndbuffer, int sndn);
 static void Update_pokey_sound_mz(UWORD addr, UBYTE val, UBYTE chip, UBYTE gain);
@@ -1465,6 +1615,9 @@ int MZPOKEYSND_Init(ULONG freq17, int playback_freq, UBYTE num_pokeys,
         break;
 #endif
     default:
+#ifdef FILTER_DATA_REGENERATE
+        write_filter_tables();
+#endif
         pokey_frq = (int)(((double)pokey_frq_ideal/POKEYSND_playback_freq) + 0.5) * POKEYSND_playback_freq;
 	    filter_size = remez_filter_table((double)POKEYSND_playback_freq/pokey_frq, &cutoff, quality);
 	    audible_frq = (int ) (cutoff * pokey_frq);
@@ -0,0 +1,191 @@
+/*
+ * pacing.c - Frame pacing governor
+ *
+ * Copyright (C) 2026 Atari800 development team (see DOC/CREDITS)
+ *
+ * This file is part of the Atari800 emulator project which emulates
+ * the Atari 400, 800, 800XL, 130XE, and 5200 8-bit computers.
+ *
+ * Atari800 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Atari800 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Atari800; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "config.h"
+#include <string.h>
+#include "atari.h"
+#include "pacing.h"
+
+/* All times are kept in 1/256 microseconds so that the fractional part of
+   the frame period (20044.8 us on PAL, 16688.2 us on NTSC) does not drift. */
+#define FRAC 8
+
+/* The display period is used instead of the emulated one when they differ
+   by less than 1/VSYNC_TOLERANCE (0.5%). */
+#define VSYNC_TOLERANCE 200
+
+/* Audio queued at a frame end is held near AUDIO_TARGET frames' worth.
+   A queue off target by one frame of audio changes the
+   period by 1/AUDIO_GAIN, and never by more than 1/AUDIO_LIMIT. */
+#define AUDIO_TARGET 2
+#define AUDIO_GAIN 16
+#define AUDIO_LIMIT 20
+
+/* Being more than SKIP_BEHIND frames late SKIP_RAISE times in a row
+   raises frame skip; being more than RESYNC_BEHIND frames late drops the
+   schedule altogether. */
+#define SKIP_BEHIND 1
+#define SKIP_RAISE 3
+#define RESYNC_BEHIND 4
+
+/* Frame skip is lowered again after this many frames with spare time. */
+#define SKIP_RECOVER 50
+
+/* The governor draws at least one frame in SKIP_MAX, or one in
+   Atari800_refresh_rate if that is set higher. */
+#define SKIP_MAX 4
+
+PACING_stats_t PACING_stats;
+int PACING_frameskip = TRUE;
+int PACING_extra_skip = 0;
+
+static unsigned long long nominal_period;	/* FRAC fixed point */
+static unsigned long long deadline;			/* FRAC fixed point */
+static int audio_target = 0;
+static int audio_per_frame = 0;
+
+static ULONG window_count;					/* vsync measurement window start */
+static ULONG window_time;
+static int window_valid = FALSE;
+static unsigned long long vsync_period;		/* FRAC fixed point, 0 if unknown */
+static int early_run = 0;
+static int late_run = 0;
+
+void PACING_Init(ULONG fps_mhz, int audio_bytes_per_frame)
+{
+	nominal_period = (1000000000ULL << FRAC) / fps_mhz;
+	audio_per_frame = audio_bytes_per_frame;
+	audio_target = audio_bytes_per_frame * AUDIO_TARGET;
+	vsync_period = 0;
+	window_valid = FALSE;
+	memset(&PACING_stats, 0, sizeof(PACING_stats));
+}
+
+void PACING_Reset(unsigned long long now_us)
+{
+	deadline = now_us << FRAC;
+	early_run = 0;
+	late_run = 0;
+	PACING_extra_skip = 0;
+	PACING_stats.frames = 0;
+	PACING_stats.drift_us = 0;
+}
+
+/* Measures the display period over windows of VSYNC_WINDOW ticks, using
+   the time stamp of the latest tick. */
+#define VSYNC_WINDOW 64
+static void measure_vsync(ULONG vsync_count, ULONG vsync_time)
+{
+	ULONG ticks = vsync_count - window_count;
+	if (!window_valid || ticks > VSYNC_WINDOW * 4) {
+		/* first call, or the display was stopped for a while */
+		window_count = vsync_count;
+		window_time = vsync_time;
+		window_valid = TRUE;
+		return;
+	}
+	if (ticks < VSYNC_WINDOW)
+		return;
+	vsync_period = ((unsigned long long) (vsync_time - window_time) << FRAC) / ticks;
+	window_count = vsync_count;
+	window_time = vsync_time;
+}
+
+unsigned long long PACING_EndFrame(unsigned long long now_us, ULONG vsync_count, ULONG vsync_time, int audio_fill)
+{
+	unsigned long long now = now_us << FRAC;
+	unsigned long long period = nominal_period;
+	long long drift;
+
+	PACING_stats.frames++;
+	if (!PACING_frameskip)
+		PACING_extra_skip = 0;
+	if (!Atari800_display_screen)
+		PACING_stats.skipped_frames++;
+
+	if (vsync_count != 0)
+		measure_vsync(vsync_count, vsync_time);
+	PACING_stats.vsync_period_us = (ULONG) (vsync_period >> FRAC);
+	if (vsync_period != 0) {
+		long long diff = (long long) vsync_period - (long long) period;
+		if (diff < 0)
+			diff = -diff;
+		if ((unsigned long long) diff * VSYNC_TOLERANCE < period) {
+			period = vsync_period;
+			PACING_stats.vsync_locked++;
+		}
+	}
+
+	/* Too much queued audio means the emulation runs ahead of the audio
+	   clock: lengthen the period, and shorten it when the queue drains. */
+	PACING_stats.audio_fill = audio_fill;
+	if (audio_fill >= 0 && audio_per_frame > 0) {
+		long long adj = (long long) period * (audio_fill - audio_target) / ((long long) audio_per_frame * AUDIO_GAIN);
+		long long limit = period / AUDIO_LIMIT;
+		if (adj > limit)
+			adj = limit;
+		else if (adj < -limit)
+			adj = -limit;
+		period += adj;
+	}
+	PACING_stats.period_us = (ULONG) (period >> FRAC);
+
+	deadline += period;
+	drift = (long long) (now - deadline);
+	PACING_stats.drift_us = (SLONG) (drift >> FRAC);
+	if (PACING_stats.drift_us > PACING_stats.max_drift_us)
+		PACING_stats.max_drift_us = PACING_stats.drift_us;
+
+	if (drift > 0) {
+		PACING_stats.late_frames++;
+		early_run = 0;
+		if (drift > (long long) (period * RESYNC_BEHIND)) {
+			/* hopelessly behind (e.g. a slow disk access): start over */
+			deadline = now;
+			PACING_stats.resyncs++;
+		}
+		if (drift > (long long) (period * SKIP_BEHIND)) {
+			if (++late_run >= SKIP_RAISE && PACING_frameskip
+			    && Atari800_refresh_rate + PACING_extra_skip < SKIP_MAX) {
+				PACING_extra_skip++;
+				late_run = 0;
+			}
+		}
+		else
+			late_run = 0;
+	}
+	else {
+		late_run = 0;
+		/* lower frame skip only after a run of frames with a quarter
+		   of a period to spare */
+		if (-drift > (long long) (period / 4)) {
+			if (++early_run >= SKIP_RECOVER && PACING_extra_skip > 0) {
+				PACING_extra_skip--;
+				early_run = 0;
+			}
+		}
+		else
+			early_run = 0;
+	}
+	return deadline >> FRAC;
+}
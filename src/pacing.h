@@ -0,0 +1,53 @@
+#ifndef PACING_H_
+#define PACING_H_
+
+#include "atari.h"
+
+/* Frame pacing governor.  The host calls PACING_EndFrame after every
+   emulated frame with the current time, the display's vsync counter and
+   the number of audio bytes still queued, and waits until the returned
+   time before running the next frame.  The governor keeps the emulated
+   frame rate at 50/60 Hz, follows the display when its refresh rate is
+   close enough, trims the rate to hold the audio queue near its target,
+   and skips more frames than Atari800_refresh_rate asks for when it falls
+   behind.  The configured Atari800_refresh_rate is never changed. */
+
+typedef struct {
+	ULONG frames;			/* frames paced since PACING_Reset */
+	ULONG late_frames;		/* frames that started after their deadline */
+	ULONG skipped_frames;	/* frames not drawn because of frame skip */
+	ULONG resyncs;			/* times the schedule was dropped as hopeless */
+	ULONG vsync_locked;		/* frames paced at the display's rate */
+	ULONG audio_underruns;	/* updated by the host's audio consumer */
+	ULONG audio_overruns;	/* updated by the host's audio producer */
+	SLONG drift_us;			/* now - deadline at the last frame end */
+	SLONG max_drift_us;		/* largest drift_us seen */
+	ULONG period_us;		/* period used for the last frame */
+	ULONG vsync_period_us;	/* measured display period, 0 if none */
+	int audio_fill;			/* audio bytes queued at the last frame end */
+} PACING_stats_t;
+
+extern PACING_stats_t PACING_stats;
+
+/* Allow the governor to skip frames (default TRUE). */
+extern int PACING_frameskip;
+
+/* Frames the governor skips on top of Atari800_refresh_rate, so that one
+   of Atari800_refresh_rate + PACING_extra_skip frames is drawn. */
+extern int PACING_extra_skip;
+
+/* Sets the emulated refresh rate in millihertz and the number of audio
+   bytes one frame produces (0 disables audio feedback). */
+void PACING_Init(ULONG fps_mhz, int audio_bytes_per_frame);
+
+/* Restarts the schedule at NOW_US, e.g. after turbo mode or the UI. */
+void PACING_Reset(unsigned long long now_us);
+
+/* Called at the end of each frame with the display's vsync counter and the
+   time stamp of its last tick in microseconds (both 0 when the display has
+   no vsync), and the audio bytes still queued (or -1 when no audio is being
+   produced).  Returns the time, in microseconds, at which the next frame
+   should start. */
+unsigned long long PACING_EndFrame(unsigned long long now_us, ULONG vsync_count, ULONG vsync_time, int audio_fill);
+
+#endif /* PACING_H_ */
@@ -31,6 +31,7 @@
 #include "pia.h"
 #include "pokey.h"
 #include "cpu.h"
+#include "blkcache.h"
 #include "pbi_scsi.h"
 #include "statesav.h"
 #include "util.h"
@@ -75,16 +76,16 @@ static void init_bb(void)
 		Log_print("Invalid black box rom size\n");
 		return;
 	}
-	free(bb_rom);
+	Util_free(bb_rom);
 	bb_rom = (UBYTE *)Util_malloc(bb_rom_size, "init_bb rom");
 	if (!Atari800_LoadImage(bb_rom_filename, bb_rom, bb_rom_size)) {
-		free(bb_rom);
+		Util_free(bb_rom);
 		bb_rom = NULL;
 		return;
 	}
 	D(printf("loaded black box rom image\n"));
 	PBI_BB_enabled = TRUE;
-	if (PBI_SCSI_disk != NULL) fclose(PBI_SCSI_disk);
+	PBI_SCSI_CloseDisk();
 	if (!Util_filenamenotset(bb_scsi_disk_filename)) {
 		PBI_SCSI_disk = fopen(&bb_scsi_disk, bb_scsi_disk_filename, FA_READ | FA_WRITE);
 		if (PBI_SCSI_disk == NULL) {
@@ -93,12 +94,13 @@ static void init_bb(void)
 		else {
 			D(printf("Opened BB SCSI disk image\n"));
 			bb_scsi_enabled = TRUE;
+			BLKCACHE_Map(PBI_SCSI_disk);
 		}
 	}
 	if (!bb_scsi_enabled) {
 		PBI_SCSI_BSY = TRUE; /* makes BB give up easier? */
 	}
-	free(bb_ram);
+	Util_free(bb_ram);
 	bb_ram = (UBYTE *)Util_malloc(BB_RAM_SIZE, "init_bb ram");
 	memset(bb_ram,0,BB_RAM_SIZE);
 }
@@ -124,12 +126,9 @@ int PBI_BB_Initialise(int *argc, char *argv[])
 
 void PBI_BB_Exit(void)
 {
-	if (PBI_SCSI_disk != NULL) {
-		fclose(PBI_SCSI_disk);
-		PBI_SCSI_disk = NULL;
-	}
-	free(bb_ram);
-	free(bb_rom);
+	PBI_SCSI_CloseDisk();
+	Util_free(bb_ram);
+	Util_free(bb_rom);
 	bb_rom = bb_ram = NULL;
 }
 
@@ -211,7 +210,7 @@ void PBI_BB_D1PutByte(UWORD addr, UBYTE byte)
 		/* Copy old page to buffer, Copy new page from buffer */
 		memcpy(bb_ram+bb_ram_bank_offset,MEMORY_mem + 0xd600,0x100);
 		bb_ram_bank_offset = (byte << 8);
-		memcpy(MEMORY_mem + 0xd600, bb_ram+bb_ram_bank_offset, 0x100);
+		MEMORY_dCopyToMem(bb_ram+bb_ram_bank_offset, 0xd600, 0x100);
 	} 
 	else if (addr  == 0xd1be) {
 		/* high rom bit */
@@ -219,7 +218,7 @@ void PBI_BB_D1PutByte(UWORD addr, UBYTE byte)
 			/* high bit has changed */
 			bb_rom_high_bit = ((byte & 0x04) << 2);
 			if (bb_rom_bank > 0 && bb_rom_bank < 8) {
-					memcpy(MEMORY_mem + 0xd800, bb_rom + (bb_rom_bank + bb_rom_high_bit)*0x800, 0x800);
+					MEMORY_dCopyToMem(bb_rom + (bb_rom_bank + bb_rom_high_bit)*0x800, 0xd800, 0x800);
 					D(printf("black box bank:%2x activated\n", bb_rom_bank+bb_rom_high_bit));
 			}
 		}
@@ -238,11 +237,11 @@ void PBI_BB_D1PutByte(UWORD addr, UBYTE byte)
 			}
 
 			if (offset != -1) {
-					memcpy(MEMORY_mem + 0xd800, bb_rom + offset, 0x800);
+					MEMORY_dCopyToMem(bb_rom + offset, 0xd800, 0x800);
 					D(printf("black box bank:%2x activated\n", byte + bb_rom_high_bit));
 			}
 			else {
-					memcpy(MEMORY_mem + 0xd800, MEMORY_os + 0x1800, 0x800);
+					MEMORY_dCopyToMem(MEMORY_os + 0x1800, 0xd800, 0x800);
 					if (byte != 0) D(printf("d1ff ERROR: byte=%2x\n", byte));
 					D(printf("Floating point rom activated\n"));
 			}
@@ -262,7 +261,7 @@ UBYTE PBI_BB_D6GetByte(UWORD addr, int no_side_effects)
 /* $D6xx */
 void PBI_BB_D6PutByte(UWORD addr, UBYTE byte)
 {
-	MEMORY_mem[addr]=byte;
+	MEMORY_dPutByte(addr, byte);
 }
 
 static int buttondown;
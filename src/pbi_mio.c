@@ -31,6 +31,7 @@
 #include "pbi.h"
 #include "cpu.h"
 #include "stdlib.h"
+#include "blkcache.h"
 #include "pbi_scsi.h"
 #include "statesav.h"
 
@@ -59,16 +60,16 @@ static FIL scsi_disk;
 
 static void init_mio(void)
 {
-	free(mio_rom);
+	Util_free(mio_rom);
 	mio_rom = (UBYTE *)Util_malloc(mio_rom_size, "init_mio rom");
 	if (!Atari800_LoadImage(mio_rom_filename, mio_rom, mio_rom_size)) {
-		free(mio_rom);
+		Util_free(mio_rom);
 		mio_rom = NULL;
 		return;
 	}
 	D(printf("Loaded mio rom image\n"));
 	PBI_MIO_enabled = TRUE;
-	if (PBI_SCSI_disk != NULL) fclose(PBI_SCSI_disk);
+	PBI_SCSI_CloseDisk();
 	if (!Util_filenamenotset(mio_scsi_disk_filename)) {
 		PBI_SCSI_disk = fopen(&scsi_disk, mio_scsi_disk_filename, FA_READ | FA_WRITE);
 		if (PBI_SCSI_disk == NULL) {
@@ -77,12 +78,13 @@ static void init_mio(void)
 		else {
 			D(printf("Opened SCSI disk image\n"));
 			mio_scsi_enabled = TRUE;
+			BLKCACHE_Map(PBI_SCSI_disk);
 		}
 	}
 	if (!mio_scsi_enabled) {
 		PBI_SCSI_BSY = TRUE; /* makes MIO give up easier */
 	}
-	free(mio_ram);
+	Util_free(mio_ram);
 	mio_ram = (UBYTE *)Util_malloc(mio_ram_size, "init_mio ram");
 	memset(mio_ram, 0, mio_ram_size);
 }
@@ -108,12 +110,9 @@ int PBI_MIO_Initialise(int *argc, char *argv[])
 
 void PBI_MIO_Exit(void)
 {
-	if (PBI_SCSI_disk != NULL) {
-		fclose(PBI_SCSI_disk);
-		PBI_SCSI_disk = NULL;
-	}
-	free(mio_ram);
-	free(mio_rom);
+	PBI_SCSI_CloseDisk();
+	Util_free(mio_ram);
+	Util_free(mio_rom);
 	mio_rom = mio_ram = NULL;
 }
 
@@ -192,10 +191,10 @@ void PBI_MIO_D1PutByte(UWORD addr, UBYTE byte)
 			else if (byte == 0x10) offset = 0x3000;
 			else if (byte == 0x20) offset = 0x3800;
 			if (offset != -1) {
-				memcpy(MEMORY_mem + 0xd800, mio_rom+offset, 0x800);
+				MEMORY_dCopyToMem(mio_rom+offset, 0xd800, 0x800);
 				D(printf("mio bank:%2x activated\n", byte));
 			}else{
-				memcpy(MEMORY_mem + 0xd800, MEMORY_os + 0x1800, 0x800);
+				MEMORY_dCopyToMem(MEMORY_os + 0x1800, 0xd800, 0x800);
 				D(printf("Floating point rom activated\n"));
 
 			}
@@ -207,15 +206,15 @@ void PBI_MIO_D1PutByte(UWORD addr, UBYTE byte)
 	ram_enabled_changed = (old_mio_ram_enabled != mio_ram_enabled);
 	if (mio_ram_enabled && ram_enabled_changed) {
 		/* Copy new page from buffer, overwrite ff page */
-		memcpy(MEMORY_mem + 0xd600, mio_ram + mio_ram_bank_offset, 0x100);
+		MEMORY_dCopyToMem(mio_ram + mio_ram_bank_offset, 0xd600, 0x100);
 	} else if (mio_ram_enabled && offset_changed) {
 		/* Copy old page to buffer, copy new page from buffer */
 		memcpy(mio_ram + old_mio_ram_bank_offset,MEMORY_mem + 0xd600, 0x100);
-		memcpy(MEMORY_mem + 0xd600, mio_ram + mio_ram_bank_offset, 0x100);
+		MEMORY_dCopyToMem(mio_ram + mio_ram_bank_offset, 0xd600, 0x100);
 	} else if (!mio_ram_enabled && ram_enabled_changed) {
 		/* Copy old page to buffer, set new page to ff */
 		memcpy(mio_ram + old_mio_ram_bank_offset, MEMORY_mem + 0xd600, 0x100);
-		memset(MEMORY_mem + 0xd600, 0xff, 0x100);
+		MEMORY_dFillMem(0xd600, 0xff, 0x100);
 	}
 	D(printf("MIO Write addr:%4x byte:%2x, cpu:%4x\n", addr, byte,CPU_remember_PC[(CPU_remember_PC_curpos-1)%CPU_REMEMBER_PC_STEPS]));
 }
@@ -233,7 +232,7 @@ UBYTE PBI_MIO_D6GetByte(UWORD addr, int no_side_effects)
 void PBI_MIO_D6PutByte(UWORD addr, UBYTE byte)
 {
 	if (!mio_ram_enabled) return;
-	MEMORY_mem[addr]=byte;
+	MEMORY_dPutByte(addr, byte);
 }
 
 #ifndef BASIC
@@ -65,7 +65,7 @@ int PBI_PROTO80_Initialise(int *argc, char *argv[])
 	if (PBI_PROTO80_enabled) {
 		proto80rom = (UBYTE *)Util_malloc(0x800, "PBI_PROTO80_Initialise");
 		if (!Atari800_LoadImage(proto80_rom_filename, proto80rom, 0x800)) {
-			free(proto80rom);
+			Util_free(proto80rom);
 			PBI_PROTO80_enabled = FALSE;
 			Log_print("Couldn't load proto80 rom image");
 			return FALSE;
@@ -82,7 +82,7 @@ int PBI_PROTO80_Initialise(int *argc, char *argv[])
 void PBI_PROTO80_Exit(void)
 {
 	if (PBI_PROTO80_enabled) {
-		free(proto80rom);
+		Util_free(proto80rom);
 		PBI_PROTO80_enabled = FALSE;
 	}
 }
@@ -117,7 +117,7 @@ int PBI_PROTO80_D1ffPutByte(UBYTE byte)
 {
 	int result = 0; /* handled */
 	if (PBI_PROTO80_enabled && byte == PROTO80_MASK) {
-		memcpy(MEMORY_mem + 0xd800, proto80rom, 0x800);
+		MEMORY_dCopyToMem(proto80rom, 0xd800, 0x800);
 		D(printf("PROTO80 rom activated\n"));
 	}
 	else result = PBI_NOT_HANDLED;
@@ -25,6 +25,7 @@
 #include "atari.h"
 #include "util.h"
 #include "log.h"
+#include "blkcache.h"
 #include "pbi_scsi.h"
 
 #ifdef PBI_DEBUG
@@ -57,6 +58,18 @@ static UBYTE scsi_buffer[256];
 static int scsi_count = 0;
 
 FIL *PBI_SCSI_disk = NULL;
+static BLKCACHE_dev_t scsi_blk = { "SCSI" };
+/* where the sector of the current command is */
+static FSIZE_t scsi_pos;
+
+void PBI_SCSI_CloseDisk(void)
+{
+	if (PBI_SCSI_disk != NULL) {
+		BLKCACHE_Release(PBI_SCSI_disk);
+		fclose(PBI_SCSI_disk);
+		PBI_SCSI_disk = NULL;
+	}
+}
 
 static void scsi_changephase(int phase)
 {
@@ -138,8 +151,13 @@ static void scsi_process_command(void)
 /*			lun = ((scsi_buffer[1]&0xe0)>>5);*/
 			lba = (((scsi_buffer[1]&0x1f)<<16)|(scsi_buffer[2]<<8)|(scsi_buffer[3]));
 			D(printf("SCSI: read lun:%d lba:%d\n",lun,lba));
-			fseek(PBI_SCSI_disk, lba*256, SEEK_SET);
-			scsi_count = fread(scsi_buffer, 1, 256, PBI_SCSI_disk);
+			scsi_pos = (FSIZE_t)lba*256;
+			{
+				UINT br;
+				if (!BLKCACHE_Read(&scsi_blk, PBI_SCSI_disk, scsi_pos, scsi_buffer, 256, &br))
+					br = 0;
+				scsi_count = br;
+			}
 			scsi_changephase(SCSI_PHASE_DATAIN);
 			/* scsi_count = 256; */
 			break;
@@ -148,7 +166,7 @@ static void scsi_process_command(void)
 /*			lun = ((scsi_buffer[1]&0xe0)>>5);*/
 			lba = (((scsi_buffer[1]&0x1f)<<16)|(scsi_buffer[2]<<8)|(scsi_buffer[3]));
 			D(printf("SCSI: write lun:%d lba:%d\n",lun,lba));
-			fseek(PBI_SCSI_disk, lba*256, SEEK_SET);
+			scsi_pos = (FSIZE_t)lba*256;
 			scsi_changephase(SCSI_PHASE_DATAOUT);
 			scsi_count = 256;
 			break;
@@ -188,7 +206,8 @@ static void scsi_nextbyte(void)
 		D(printf("SCSI data out:%2x\n", scsi_byte));
 		scsi_buffer[scsi_bufpos++] = scsi_byte;
 		if (scsi_bufpos >= scsi_count) {
-			fwrite(scsi_buffer, 1, 256, PBI_SCSI_disk);
+			UINT bw;
+			BLKCACHE_Write(&scsi_blk, PBI_SCSI_disk, scsi_pos, scsi_buffer, 256, &bw);
 			scsi_changephase(SCSI_PHASE_STATUS);
 			scsi_buffer[0] = 0;
 		}
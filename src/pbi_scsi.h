@@ -16,5 +16,7 @@ void PBI_SCSI_PutByte(UBYTE byte);
 UBYTE PBI_SCSI_GetByte(void);
 void PBI_SCSI_PutSEL(int newsel);
 void PBI_SCSI_PutACK(int newack);
+/* Writes back and closes PBI_SCSI_disk, if open. */
+void PBI_SCSI_CloseDisk(void);
 
 #endif /* PBI_MIO_H_ */
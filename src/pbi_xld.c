@@ -82,10 +82,10 @@ static UBYTE PIO_Command_Frame(void);
 
 static void init_xld_v(void)
 {
-	free(voicerom);
+	Util_free(voicerom);
 	voicerom = (UBYTE *)Util_malloc(0x1000, "init_xld_v");
 	if (!Atari800_LoadImage(xld_v_rom_filename, voicerom, 0x1000)) {
-		free(voicerom);
+		Util_free(voicerom);
 		PBI_XLD_v_enabled = FALSE;
 	}
 	else {
@@ -96,10 +96,10 @@ static void init_xld_v(void)
 
 static void init_xld_d(void)
 {
-	free(diskrom);
+	Util_free(diskrom);
 	diskrom = (UBYTE *)Util_malloc(0x800, "init_xld_d");
 	if (!Atari800_LoadImage(xld_d_rom_filename, diskrom, 0x800)) {
-		free(diskrom);
+		Util_free(diskrom);
 		xld_d_enabled = FALSE;
 	}
 	else {
@@ -150,11 +150,11 @@ int PBI_XLD_Initialise(int *argc, char *argv[])
 void PBI_XLD_Exit(void)
 {
 	if (xld_d_enabled) {
-		free(diskrom);
+		Util_free(diskrom);
 		xld_d_enabled = FALSE;
 	}
 	if (PBI_XLD_v_enabled) {
-		free(voicerom);
+		Util_free(voicerom);
 		PBI_XLD_v_enabled = FALSE;
 	}
 	PBI_XLD_enabled = FALSE;
@@ -260,15 +260,15 @@ int PBI_XLD_D1ffPutByte(UBYTE byte)
 {
 	int result = 0; /* handled */
 	if (xld_d_enabled && byte == DISK_MASK) {
-		memcpy(MEMORY_mem + 0xd800, diskrom, 0x800);
+		MEMORY_dCopyToMem(diskrom, 0xd800, 0x800);
 		D(printf("DISK rom activated\n"));
 	} 
 	else if (byte == MODEM_MASK) {
-		memcpy(MEMORY_mem + 0xd800, voicerom + 0x800, 0x800);
+		MEMORY_dCopyToMem(voicerom + 0x800, 0xd800, 0x800);
 		D(printf("MODEM rom activated\n"));
 	} 
 	else if (byte == VOICE_MASK) { 
-		memcpy(MEMORY_mem + 0xd800, voicerom, 0x800);
+		MEMORY_dCopyToMem(voicerom, 0xd800, 0x800);
 		D(printf("VOICE rom activated\n"));
 	}
 	else result = PBI_NOT_HANDLED;
@@ -37,6 +37,7 @@
 #include "pokey.h"
 #include "gtia.h"
 #include "sio.h"
+#include "sramtab.h"
 #ifndef BASIC
 #include "input.h"
 #include "statesav.h"
@@ -60,6 +61,7 @@
 #endif
 
 #include "POKEY_poly17_lookup.h"
+const UBYTE *POKEY_poly17_table = POKEY_poly17_lookup;
 
 #ifdef POKEY_UPDATE
 void pokey_update(void);
@@ -134,7 +136,8 @@ UBYTE POKEY_GetByte(UWORD addr, int no_side_effects)
 			else {
 				const UBYTE *ptr;
 				i %= POKEY_POLY17_SIZE;
-				ptr = POKEY_poly17_lookup + (i >> 3);
+				ptr = POKEY_poly17_table + (i >> 3);
+				SRAMTAB_COUNT(SRAMTAB_POLY17_LOOKUP);
 				i &= 7;
 				byte = (UBYTE) ((ptr[0] >> i) + (ptr[1] << (8 - i)));
 			}
@@ -409,6 +412,7 @@ int POKEY_Initialise(int *argc, char *argv[])
 		reg = ((((reg >> 5) ^ reg) & 1) << 8) + (reg >> 1);
 		POKEY_poly9_lookup[i] = (UBYTE) reg;
 	}
+	POKEY_poly17_table = (const UBYTE *) SRAMTAB_Place(SRAMTAB_POLY17_LOOKUP, POKEY_poly17_lookup, sizeof(POKEY_poly17_lookup));
 #ifdef POKEY_poly17_lookup.h_regenerate
 	/* initialise poly17_lookup */
 	reg = 0x1ffff;
@@ -515,7 +519,8 @@ void POKEY_Scanline(void)
 
 	random_scanline_counter += ANTIC_LINE_C;
 
-	if (POKEY_DELAYED_SERIN_IRQ > 0) {
+	/* a drive still reading its sector holds the next byte back */
+	if (POKEY_DELAYED_SERIN_IRQ > 0 && !(POKEY_DELAYED_SERIN_IRQ == 1 && SIO_SerinWait())) {
 		if (--POKEY_DELAYED_SERIN_IRQ == 0) {
 			/* Load a byte to SERIN - even when the IRQ is disabled. */
 			POKEY_SERIN = SIO_GetByte();
@@ -120,5 +120,7 @@ extern int POKEY_Base_mult[POKEY_MAXPOKEYS];	/* selects either 64Khz or 15Khz cl
 
 extern UBYTE POKEY_poly9_lookup[POKEY_POLY9_SIZE];
 extern const UBYTE __in_flash() __aligned(4096) POKEY_poly17_lookup[16385];
+/* POKEY_poly17_lookup, or its copy in SRAM */
+extern const UBYTE *POKEY_poly17_table;
 
 #endif /* POKEY_H_ */
@@ -44,6 +44,7 @@
 #endif
 #include "antic.h"
 #include "gtia.h"
+#include "sramtab.h"
 #include "util.h"
 
 #ifdef WORDS_UNALIGNED_OK
@@ -340,7 +341,7 @@ int POKEYSND_Init(ULONG freq17, int playback_freq, UBYTE num_pokeys,
 		unsigned int max_ticks_per_frame = ticks_per_frame + surplus_ticks;
 		double ticks_per_sample = (double)ticks_per_frame / samples_per_frame;
 		POKEYSND_process_buffer_length = POKEYSND_num_pokeys * (unsigned int)ceil((double)max_ticks_per_frame / ticks_per_sample) * ((POKEYSND_snd_flags & POKEYSND_BIT16) ? 2:1);
-		free(POKEYSND_process_buffer);
+		Util_free(POKEYSND_process_buffer);
 		POKEYSND_process_buffer = (UBYTE *)Util_malloc(POKEYSND_process_buffer_length);
 		POKEYSND_process_buffer_fill = 0;
 	    prev_update_tick = ANTIC_CPU_CLOCK;
@@ -961,7 +962,8 @@ static void pokeysnd_process_8(void *sndbuffer, int sndn)
 						}
 						else {
 							/* otherwise compare to the poly17 bit */
-							toggle = (((POKEY_poly17_lookup[P17 >> 3] >> (P17 & 7)) & 1) == !(*out_ptr));
+							toggle = (((POKEY_poly17_table[P17 >> 3] >> (P17 & 7)) & 1) == !(*out_ptr));
+							SRAMTAB_COUNT(SRAMTAB_POLY17_LOOKUP);
 						}
 					}
 				}
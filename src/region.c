@@ -0,0 +1,324 @@
+/*
+ * region.c - Memory regions for media, extended RAM and the UI
+ *
+ * Copyright (C) 2026 Atari800 development team (see DOC/CREDITS)
+ *
+ * This file is part of the Atari800 emulator project which emulates
+ * the Atari 400, 800, 800XL, 130XE, and 5200 8-bit computers.
+ *
+ * Atari800 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Atari800 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Atari800; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "config.h"
+#include <string.h>
+#include "atari.h"
+#include "binload.h"
+#include "blkcache.h"
+#include "cartcache.h"
+#include "img_tape.h"
+#include "log.h"
+#include "region.h"
+#include "util.h"
+
+REGION_stats_t REGION_stats;
+int REGION_arena_kb = 0;
+
+/* Each block starts with a header_t.  Blocks of the media regions lie one
+   after another from arena_start up to bottom, the others from top up to
+   arena_end, where a block of region FREE is a gap left by a released one. */
+typedef struct {
+	size_t size;		/* of the block, header included */
+	int region;
+	void **owner;
+} header_t;
+
+#define FREE (-1)
+#define ALIGN(n) (((n) + 7) & ~(size_t) 7)
+#define HEADER_SIZE ALIGN(sizeof(header_t))
+#define IS_MEDIA(region) ((region) >= REGION_CART)
+
+static UBYTE *arena_start = NULL;
+static UBYTE *arena_end;
+static UBYTE *bottom;
+static UBYTE *top;
+
+#define BLOCK(p) ((header_t *) (p))
+#define DATA(p) ((UBYTE *) (p) + HEADER_SIZE)
+
+/* A FatFS name buffer, with the exFAT directory entries of a long name
+   and the size ff_memalloc() keeps before it.  Both cores may have one. */
+#if FF_USE_LFN == 3
+#if FF_FS_EXFAT
+#define FATFS_NAME_BUFFER ((FF_MAX_LFN + 1) * 2 + (FF_MAX_LFN + 44) / 15 * 32 + 8)
+#else
+#define FATFS_NAME_BUFFER ((FF_MAX_LFN + 1) * 2 + 8)
+#endif
+#else
+#define FATFS_NAME_BUFFER 0
+#endif
+
+/* The small blocks, the UI's strings and malloc()'s own headers. */
+#define HEAP_SLACK (8 * 1024)
+
+/* The smallest arena reserved, enough for the UI's file lists and the
+   sector info of a disk image. */
+#define ARENA_MIN (64 * 1024)
+
+/* Returns the heap to leave to Util_malloc(): what the media code takes
+   with a disk, a tape, a XEX file and a bank-switched cartridge in use at
+   once, at the sizes set. */
+static size_t HeapReserve(void)
+{
+	return BLKCACHE_HeapSize()
+	       + CARTCACHE_SLOTS * CARTCACHE_BANK_SIZE
+	       + IMG_TAPE_HeapSize()
+	       + BINLOAD_HeapSize()
+	       + 2 * FATFS_NAME_BUFFER
+	       + HEAP_SLACK;
+}
+
+static void UpdateStats(void)
+{
+	REGION_stats.free = top - bottom;
+	if (REGION_stats.arena - REGION_stats.free > REGION_stats.peak)
+		REGION_stats.peak = REGION_stats.arena - REGION_stats.free;
+}
+
+/* Moves the media blocks down over the free ones between them, and points
+   each owner at its block's new place.  An owner may lie in a block that
+   moves too. */
+static void Compact(void)
+{
+	UBYTE *p;
+	UBYTE *dst;
+
+	/* find the owners' new addresses while the blocks are where they were */
+	for (p = arena_start; p < bottom; p += BLOCK(p)->size) {
+		UBYTE *owner = (UBYTE *) BLOCK(p)->owner;
+		UBYTE *q;
+		size_t shift = 0;
+		if (BLOCK(p)->region == FREE || owner < arena_start || owner >= bottom)
+			continue;
+		for (q = arena_start; q < bottom; q += BLOCK(q)->size) {
+			if (BLOCK(q)->region == FREE)
+				shift += BLOCK(q)->size;
+			else if (owner < q + BLOCK(q)->size) {
+				BLOCK(p)->owner = (void **) (owner - shift);
+				break;
+			}
+		}
+	}
+	/* move the blocks, lowest first */
+	for (p = dst = arena_start; p < bottom; ) {
+		size_t size = BLOCK(p)->size;
+		if (BLOCK(p)->region != FREE) {
+			if (dst != p) {
+				memmove(dst, p, size);
+				REGION_stats.moved += size;
+			}
+			dst += size;
+		}
+		p += size;
+	}
+	bottom = dst;
+	for (p = arena_start; p < bottom; p += BLOCK(p)->size)
+		*BLOCK(p)->owner = DATA(p);
+}
+
+/* Joins the free blocks above top, and raises top over those at it. */
+static void Coalesce(void)
+{
+	UBYTE *p;
+	for (p = top; p < arena_end; p += BLOCK(p)->size) {
+		UBYTE *next;
+		if (BLOCK(p)->region != FREE)
+			continue;
+		while ((next = p + BLOCK(p)->size) < arena_end && BLOCK(next)->region == FREE)
+			BLOCK(p)->size += BLOCK(next)->size;
+	}
+	if (top < arena_end && BLOCK(top)->region == FREE)
+		top += BLOCK(top)->size;
+}
+
+void *REGION_Alloc(int region, void *owner, size_t size, const char *from)
+{
+	UBYTE *p = NULL;
+	size = HEADER_SIZE + ALIGN(size);
+	if (arena_start == NULL)
+		return NULL;
+	if (IS_MEDIA(region)) {
+		if (size <= (size_t) (top - bottom)) {
+			p = bottom;
+			bottom += size;
+			BLOCK(p)->size = size;
+		}
+	}
+	else {
+		/* first fit in the gaps between the stacked blocks */
+		for (p = top; p < arena_end; p += BLOCK(p)->size) {
+			size_t gap = BLOCK(p)->size;
+			if (BLOCK(p)->region != FREE || gap < size)
+				continue;
+			if (gap - size >= HEADER_SIZE + 8) {
+				/* the rest stays free */
+				BLOCK(p + size)->size = gap - size;
+				BLOCK(p + size)->region = FREE;
+				BLOCK(p)->size = size;
+			}
+			break;
+		}
+		if (p == arena_end) {
+			if (size <= (size_t) (top - bottom)) {
+				top -= size;
+				p = top;
+				BLOCK(p)->size = size;
+			}
+			else
+				p = NULL;
+		}
+	}
+	if (p == NULL) {
+		Log_print("%s: no room for %lu bytes in the memory regions (%lu free)", from,
+		          (unsigned long) size, (unsigned long) (top - bottom));
+		REGION_stats.failures++;
+		return NULL;
+	}
+	BLOCK(p)->region = region;
+	BLOCK(p)->owner = (void **) owner;
+	REGION_stats.used[region] += BLOCK(p)->size;
+	UpdateStats();
+	return DATA(p);
+}
+
+void REGION_Release(void *ptr)
+{
+	header_t *block;
+	int media;
+	if (ptr == NULL)
+		return;
+	block = BLOCK((UBYTE *) ptr - HEADER_SIZE);
+	REGION_stats.used[block->region] -= block->size;
+	media = IS_MEDIA(block->region);
+	block->region = FREE;
+	if (media)
+		Compact();
+	else
+		Coalesce();
+	UpdateStats();
+}
+
+void REGION_Free(int region)
+{
+	UBYTE *p;
+	UBYTE *start = IS_MEDIA(region) ? arena_start : top;
+	UBYTE *end = IS_MEDIA(region) ? bottom : arena_end;
+	int found = FALSE;
+	if (arena_start == NULL)
+		return;
+	for (p = start; p < end; p += BLOCK(p)->size) {
+		if (BLOCK(p)->region == region) {
+			BLOCK(p)->region = FREE;
+			found = TRUE;
+		}
+	}
+	if (!found)
+		return;
+	REGION_stats.used[region] = 0;
+	if (IS_MEDIA(region))
+		Compact();
+	else
+		Coalesce();
+	UpdateStats();
+}
+
+int REGION_Initialise(int *argc, char *argv[])
+{
+	int i;
+	int j;
+	size_t size;
+	size_t heap;
+	size_t avail;
+	for (i = j = 1; i < *argc; i++) {
+		int i_a = (i + 1 < *argc);		/* is argument available? */
+		int a_m = FALSE;			/* error, argument missing! */
+		if (strcmp(argv[i], "-arena-kb") == 0) {
+			if (i_a)
+				REGION_arena_kb = Util_sscandec(argv[++i]);
+			else a_m = TRUE;
+		}
+		else {
+			if (strcmp(argv[i], "-help") == 0)
+				Log_print("\t-arena-kb <kb>       Memory for media and extended RAM (0: auto)");
+			argv[j++] = argv[i];
+		}
+		if (a_m) {
+			Log_print("Missing argument for '%s'", argv[i]);
+			return FALSE;
+		}
+	}
+	*argc = j;
+	if (REGION_arena_kb < 0)
+		REGION_arena_kb = 0;
+
+	if (arena_start != NULL)
+		return TRUE;
+	heap = Util_HeapFree(NULL);
+	REGION_stats.reserve = HeapReserve();
+	/* On a short heap the block cache gives up its SRAM first: what
+	   Util_malloc() cannot get later ends the emulator. */
+	while (heap < REGION_stats.reserve + ARENA_MIN && BLKCACHE_sram_kb > 0) {
+		BLKCACHE_sram_kb >>= 1;
+		REGION_stats.reserve = HeapReserve();
+		Log_print("Heap short: disk block cache cut to %d KB of SRAM", BLKCACHE_sram_kb);
+	}
+	if (heap >= REGION_stats.reserve + ARENA_MIN)
+		avail = heap - REGION_stats.reserve;
+	else {
+		Log_print("Heap short: %lu KB free, %lu KB needed besides the memory regions",
+		          (unsigned long) (heap >> 10), (unsigned long) (REGION_stats.reserve >> 10));
+		avail = heap / 2 < ARENA_MIN ? heap / 2 : ARENA_MIN;
+	}
+	size = avail;
+	if (REGION_arena_kb != 0) {
+		size = (size_t) REGION_arena_kb << 10;
+		if (size > avail) {
+			Log_print("Only %lu KB left for the memory regions", (unsigned long) (avail >> 10));
+			size = avail;
+		}
+	}
+	size &= ~(size_t) 7;
+	arena_start = (UBYTE *) Util_malloc(size, "REGION arena");
+	arena_end = arena_start + size;
+	bottom = arena_start;
+	top = arena_end;
+	REGION_stats.arena = size;
+	UpdateStats();
+	Log_print("Heap: %lu KB free at start-up, %lu KB for the memory regions, %lu KB kept",
+	          (unsigned long) (heap >> 10), (unsigned long) (size >> 10),
+	          (unsigned long) (REGION_stats.reserve >> 10));
+	return TRUE;
+}
+
+int REGION_ReadConfig(char *string, char *ptr)
+{
+	if (strcmp(string, "ARENA_KB") == 0)
+		return (REGION_arena_kb = Util_sscandec(ptr)) >= 0;
+	return FALSE;
+}
+
+void REGION_WriteConfig(FIL *fp)
+{
+	fprintf(fp, "ARENA_KB=%d\n", REGION_arena_kb);
+}
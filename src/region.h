@@ -0,0 +1,74 @@
+#ifndef REGION_H_
+#define REGION_H_
+
+#include "config.h"
+#include <stddef.h>
+#include "atari.h"
+#include "ff.h"
+#include "sio.h"
+
+/* Memory regions.  What is allocated and freed again while the emulator
+   runs - cartridge images, the sector info of VAPI and PRO disk images,
+   extended RAM, the sound buffer and the UI's file lists - comes from one
+   arena reserved at start-up instead of the heap, grouped by how long it
+   lives: as long as the machine configuration, the medium in one slot or
+   one file selector.  A region is freed in one go when its lifetime ends.
+
+   The media regions are kept packed at the bottom of the arena: freeing
+   one moves the blocks above it down and updates the pointer each block
+   was allocated for.  So there are no holes between them, and a medium
+   fits whenever the arena has room for it.  The other regions do not move
+   and are stacked from the top of the arena. */
+
+enum {
+	/* stacked from the top, not moved */
+	REGION_MACHINE,		/* extended RAM, until the machine is reconfigured */
+	REGION_SOUND,		/* sound output, until sound is set up again */
+	REGION_UI,			/* file lists, until the file selector closes */
+	/* packed at the bottom, moved */
+	REGION_CART,		/* main cartridge image */
+	REGION_PIGGYBACK,	/* piggyback cartridge image */
+	REGION_DISK1,		/* sector info of the image in SIO drive 1, and so on */
+	REGION_COUNT = REGION_DISK1 + SIO_MAX_DRIVES
+};
+
+/* Arena size in KB.  0 reserves the heap left at start-up but for what
+   stays with Util_malloc() for the disk block cache, the cartridge bank
+   cache, tape images, the XEX segment index and FatFS, which is worked
+   out from their sizes.  On a short heap the block cache's SRAM is cut
+   to leave the arena 64 KB. */
+extern int REGION_arena_kb;
+
+typedef struct {
+	ULONG arena;		/* bytes reserved */
+	ULONG reserve;		/* bytes of the heap left to Util_malloc() */
+	ULONG used[REGION_COUNT];	/* bytes allocated now in each region */
+	ULONG free;			/* bytes left between the packed and the stacked blocks */
+	ULONG peak;			/* most bytes taken at once */
+	ULONG moved;		/* bytes moved down to keep the media regions packed */
+	ULONG failures;		/* allocations that did not fit */
+} REGION_stats_t;
+
+extern REGION_stats_t REGION_stats;
+
+int REGION_Initialise(int *argc, char *argv[]);
+int REGION_ReadConfig(char *string, char *ptr);
+void REGION_WriteConfig(FIL *fp);
+
+/* Allocates SIZE bytes in REGION.  Returns NULL if they do not fit.
+   OWNER is the pointer the block is stored in.  For a media region it must
+   be given, and it is updated whenever the block moves; the block must not
+   be referred to by anything else.  FROM names the caller, as for
+   Util_malloc(). */
+void *REGION_Alloc(int region, void *owner, size_t size, const char *from);
+
+/* Frees one block before the rest of its region. */
+void REGION_Release(void *ptr);
+
+/* Frees all blocks of REGION. */
+void REGION_Free(int region);
+
+/* Returns the region of the medium in SIO drive DISKNO (1-based). */
+#define REGION_Disk(diskno) (REGION_DISK1 + (diskno) - 1)
+
+#endif /* REGION_H_ */
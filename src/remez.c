@@ -382,7 +382,7 @@ static void Search(int r, int Ext[], int gridsize, const double E[])
 		Ext[i] = foundExt[i];
 	}
 
-	free(foundExt);
+	Util_free(foundExt);
 }
 
 
@@ -629,15 +629,15 @@ void REMEZ_CreateFilter(double h[], int numtaps, int numband, double bands[], co
 
 	/* Delete allocated memory */
 	if (tmp == 0) {
-		free(Grid);
-		free(W);
-		free(D);
-		free(E);
-		free(Ext);
-		free(taps);
-		free(x);
-		free(y);
-		free(ad);
+		Util_free(Grid);
+		Util_free(W);
+		Util_free(D);
+		Util_free(E);
+		Util_free(Ext);
+		Util_free(taps);
+		Util_free(x);
+		Util_free(y);
+		Util_free(ad);
 	}
 	printf("REMEZ_CreateFilter DONE");
 }
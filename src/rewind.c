@@ -0,0 +1,345 @@
+/*
+ * rewind.c - Ring of machine snapshots in PSRAM
+ *
+ * Copyright (C) 2026 Atari800 development team (see DOC/CREDITS)
+ *
+ * This file is part of the Atari800 emulator project which emulates
+ * the Atari 400, 800, 800XL, 130XE, and 5200 8-bit computers.
+ *
+ * Atari800 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Atari800 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Atari800; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "config.h"
+#include <string.h>
+#include <pico/time.h>
+#include "atari.h"
+#include "blkcache.h"
+#include "cartcache.h"
+#include "memory.h"
+#include "pokey.h"
+#include "rewind.h"
+#include "statesav.h"
+#include "psram_spi.h"
+#include "libatari800/sound.h"
+
+REWIND_stats_t REWIND_stats;
+int REWIND_interval = 25;
+
+#define HEAD_ADDR REWIND_PSRAM_BASE
+#define LOG_ADDR (REWIND_PSRAM_BASE + REWIND_HEAD_SIZE)
+/* The log ends at the block cache on a chip too small for all of it. */
+#define LOG_SIZE (LOG_ADDR + REWIND_LOG_SIZE <= BLKCACHE_PSRAM_BASE ? REWIND_LOG_SIZE : BLKCACHE_PSRAM_BASE - LOG_ADDR)
+
+/* The undo log is a circular buffer of entries, each a header followed by
+   up to UNDO_CHUNK bytes of the head as they were before an update, padded
+   to 4 bytes.  An entry never wraps around the end of the log; a header
+   with len == UNDO_WRAP, or no room left for a header, sends the reader
+   back to the start. */
+#define UNDO_CHUNK 256
+#define UNDO_WRAP 0xffffffff
+typedef struct {
+	ULONG addr;
+	ULONG len;
+} undo_t;
+#define UNDO_SIZE(len) (sizeof(undo_t) + (((len) + 3) & ~3))
+
+/* Emulator state that StateSav_SaveAtariState leaves out: what
+   libatari800_get_current_state keeps beside it, and the position of
+   POKEY's RANDOM generator, without which a restored machine reads
+   different random numbers than it did the first time.  undo_start and
+   undo_end delimit the log entries that turn the next newer snapshot
+   back into this one. */
+typedef struct {
+	int nframes;
+	ULONG size;
+	ULONG base_ram;
+	double sample_residual;
+	int selftest_enabled;
+	ULONG random_counter;
+	ULONG undo_start;
+	ULONG undo_end;
+} slot_t;
+
+static slot_t slots[REWIND_SLOTS];
+static int newest = REWIND_SLOTS - 1;
+static int count = 0;
+static int frames = 0;
+static ULONG log_head = 0;
+/* set when the update being logged did not fit, so it cannot be undone */
+static int log_lost;
+static ULONG delta;
+/* 256-byte pages of the head that undo() rewrote during a restore; the
+   machine keeps what it has of the others (see REWIND_Restore) */
+static UBYTE undone[REWIND_HEAD_SIZE >> 8];
+
+static int oldest(void)
+{
+	return (newest + REWIND_SLOTS - count + 1) % REWIND_SLOTS;
+}
+
+static void drop_oldest(void)
+{
+	count--;
+}
+
+/* Appends an undo entry for the LEN bytes at ADDR, dropping the oldest
+   snapshots while there is not enough room. */
+static void log_undo(ULONG addr, const UBYTE *old, size_t len)
+{
+	ULONG need = UNDO_SIZE(len);
+	ULONG pad = log_head + need > LOG_SIZE ? LOG_SIZE - log_head : 0;
+	undo_t hdr;
+
+	for (;;) {
+		ULONG tail = slots[oldest()].undo_start;
+		ULONG used = (log_head + LOG_SIZE - tail) % LOG_SIZE;
+		if (used + pad + need < LOG_SIZE)
+			break;
+		if (count <= 1) {
+			log_lost = TRUE;
+			return;
+		}
+		drop_oldest();
+	}
+	if (pad > 0) {
+		if (pad >= sizeof(undo_t)) {
+			hdr.addr = 0;
+			hdr.len = UNDO_WRAP;
+			writepsram(LOG_ADDR + log_head, (const UBYTE *) &hdr, sizeof(hdr));
+		}
+		log_head = 0;
+	}
+	hdr.addr = addr;
+	hdr.len = len;
+	writepsram(LOG_ADDR + log_head, (const UBYTE *) &hdr, sizeof(hdr));
+	writepsram(LOG_ADDR + log_head + sizeof(hdr), old, len);
+	log_head = (log_head + need) % LOG_SIZE;
+	delta += len;
+}
+
+/* Writes the state bytes that changed into the head, logging what was
+   there before.  Called by the state saver in place of writepsram. */
+static void update(ULONG addr, const UBYTE *data, size_t len)
+{
+	UBYTE old[UNDO_CHUNK];
+	while (len > 0) {
+		size_t n = len < UNDO_CHUNK ? len : UNDO_CHUNK;
+		size_t first, last;
+		readpsram(addr, old, n);
+		for (first = 0; first < n && old[first] == data[first]; first++);
+		if (first < n) {
+			for (last = n; old[last - 1] == data[last - 1]; last--);
+			if (!log_lost)
+				log_undo(addr + first, old + first, last - first);
+			writepsram(addr + first, data + first, last - first);
+		}
+		addr += n;
+		data += n;
+		len -= n;
+	}
+}
+
+/* Puts back into the head what the log entries of SLOT hold, turning the
+   next newer snapshot into that one. */
+static void undo(int slot)
+{
+	UBYTE buf[sizeof(undo_t) + UNDO_CHUNK];
+	ULONG pos = slots[slot].undo_start;
+	while (pos != slots[slot].undo_end) {
+		undo_t hdr;
+		if (pos + sizeof(undo_t) > LOG_SIZE) {
+			pos = 0;
+			continue;
+		}
+		readpsram(LOG_ADDR + pos, buf, sizeof(buf) < LOG_SIZE - pos ? sizeof(buf) : LOG_SIZE - pos);
+		memcpy(&hdr, buf, sizeof(hdr));
+		if (hdr.len == UNDO_WRAP) {
+			pos = 0;
+			continue;
+		}
+		writepsram(hdr.addr, buf + sizeof(hdr), hdr.len);
+		if (hdr.len > 0) {
+			ULONG first = (hdr.addr - HEAD_ADDR) >> 8;
+			ULONG last = (hdr.addr - HEAD_ADDR + hdr.len - 1) >> 8;
+			memset(undone + first, 1, last - first + 1);
+		}
+		pos = (pos + UNDO_SIZE(hdr.len)) % LOG_SIZE;
+	}
+}
+
+/* Tells the state loader whether undo() rewrote any of the LEN head bytes
+   at ADDR; the others still hold the newest snapshot. */
+static int head_changed(ULONG addr, size_t len)
+{
+	ULONG page;
+	for (page = (addr - HEAD_ADDR) >> 8; page <= (addr - HEAD_ADDR + len - 1) >> 8; page++)
+		if (undone[page])
+			return TRUE;
+	return FALSE;
+}
+
+static int save_head(statesav_tags_t *tags)
+{
+	int slot = newest;
+
+	if (count == 0) {
+		/* first snapshot: write the head afresh */
+		log_head = 0;
+		return LIBATARI800_StateSavePSRAM(HEAD_ADDR, tags);
+	}
+	slots[slot].undo_start = log_head;
+	log_lost = FALSE;
+	if (!LIBATARI800_StateUpdatePSRAM(HEAD_ADDR, tags, update))
+		goto failed;
+	if (tags->base_ram != slots[slot].base_ram) {
+		/* Memory has moved within the state (e.g. a disk with a longer
+		   name was inserted), so the pages skipped as clean were left in
+		   the wrong place. Take the update back and redo it in full. */
+		if (!log_lost) {
+			slots[slot].undo_end = log_head;
+			undo(slot);
+			log_head = slots[slot].undo_start;
+		}
+#ifdef DIRTY_PAGES
+		MEMORY_SetAllDirty();
+#endif
+		if (!LIBATARI800_StateUpdatePSRAM(HEAD_ADDR, tags, update))
+			goto failed;
+	}
+	if (log_lost) {
+		/* the head is good but no older snapshot can be rebuilt */
+		count = 0;
+		log_head = 0;
+	}
+	else
+		slots[slot].undo_end = log_head;
+	return TRUE;
+
+failed:
+	if (log_lost) {
+		REWIND_Clear();
+		return FALSE;
+	}
+	slots[slot].undo_end = log_head;
+	undo(slot);
+	log_head = slots[slot].undo_start;
+	return FALSE;
+}
+
+static void take_snapshot(void)
+{
+	int slot = (newest + 1) % REWIND_SLOTS;
+	statesav_tags_t tags;
+	ULONG start = time_us_32();
+
+	if (count == REWIND_SLOTS)
+		drop_oldest();
+	delta = 0;
+	if (!save_head(&tags)) {
+		REWIND_stats.failures++;
+		return;
+	}
+#ifdef DIRTY_PAGES
+	MEMORY_ClearDirty();
+#endif
+	slots[slot].nframes = Atari800_nframes;
+	slots[slot].size = tags.size;
+	slots[slot].base_ram = tags.base_ram;
+	slots[slot].sample_residual = sample_residual;
+	slots[slot].selftest_enabled = MEMORY_selftest_enabled;
+	slots[slot].random_counter = POKEY_GetRandomCounter();
+	slots[slot].undo_start = slots[slot].undo_end = log_head;
+	newest = slot;
+	count++;
+
+	REWIND_stats.saves++;
+	REWIND_stats.last_size = tags.size;
+	if (tags.size > REWIND_stats.max_size)
+		REWIND_stats.max_size = tags.size;
+	REWIND_stats.last_delta = delta;
+	if (delta > REWIND_stats.max_delta)
+		REWIND_stats.max_delta = delta;
+	REWIND_stats.save_us = time_us_32() - start;
+}
+
+void REWIND_Frame(void)
+{
+	/* a large cartridge image may lie over the log */
+	if (REWIND_interval <= 0 || !PSRAM_AVAILABLE || CARTCACHE_HoldsRewindArea())
+		return;
+	if (++frames < REWIND_interval)
+		return;
+	frames = 0;
+	take_snapshot();
+}
+
+int REWIND_Count(void)
+{
+	return count;
+}
+
+int REWIND_Restore(int age)
+{
+	int slot;
+	int i;
+	int ok;
+	ULONG start;
+
+	if (age < 0 || age >= count)
+		return FALSE;
+	start = time_us_32();
+	memset(undone, 0, sizeof(undone));
+	slot = newest;
+	for (i = 0; i < age; i++) {
+		slot = (slot + REWIND_SLOTS - 1) % REWIND_SLOTS;
+		undo(slot);
+	}
+	/* The machine still holds the newest snapshot, but for the pages it
+	   dirtied since, so only those and what the undo log rewrote are read
+	   back; unless memory has moved within the state. */
+	if (slots[slot].base_ram == slots[newest].base_ram)
+		ok = LIBATARI800_StateRestorePSRAM(HEAD_ADDR, head_changed);
+	else
+		ok = LIBATARI800_StateLoadPSRAM(HEAD_ADDR);
+	log_head = slots[slot].undo_end = slots[slot].undo_start;
+	newest = slot;
+	count -= age;
+	frames = 0;
+	/* a failed read leaves the machine half restored; drop the ring so
+	   nothing newer is taken from it */
+	if (!ok) {
+		REWIND_stats.failures++;
+		REWIND_Clear();
+		return FALSE;
+	}
+#ifdef DIRTY_PAGES
+	MEMORY_ClearDirty();
+#endif
+	Atari800_nframes = slots[slot].nframes;
+	sample_residual = slots[slot].sample_residual;
+	MEMORY_selftest_enabled = slots[slot].selftest_enabled;
+	POKEY_SetRandomCounter(slots[slot].random_counter);
+
+	REWIND_stats.restores++;
+	REWIND_stats.restore_us = time_us_32() - start;
+	return TRUE;
+}
+
+void REWIND_Clear(void)
+{
+	count = 0;
+	frames = 0;
+	log_head = 0;
+}
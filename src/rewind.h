@@ -0,0 +1,57 @@
+#ifndef REWIND_H_
+#define REWIND_H_
+
+#include "config.h"
+#include "atari.h"
+#include "statesav.h"
+
+/* Rewind ring.  Every REWIND_interval frames a snapshot of the machine is
+   taken, so the emulator can be stepped back over the last REWIND_SLOTS
+   of them.  Only the newest snapshot is kept whole, in the head area of
+   PSRAM.  A new snapshot updates the head in place, and the bytes it
+   overwrites go to an undo log, from which older snapshots are rebuilt.
+   With DIRTY_PAGES the update skips memory pages that were not written
+   since the previous snapshot, so its cost follows what the program
+   changed rather than the size of the machine.  So does a restore's: it
+   reads back only the pages dirtied since the newest snapshot and those
+   the undo log rewrote. */
+
+#define REWIND_SLOTS 64
+/* PSRAM below this is used by memory.c for RAM under the ROMs. */
+#define REWIND_PSRAM_BASE 0x100000
+#define REWIND_HEAD_SIZE ((STATESAV_MAX_SIZE + 0xfff) & ~0xfff)
+/* Cut short on a small PSRAM chip, see blkcache.h. */
+#define REWIND_LOG_SIZE 0x300000
+
+typedef struct {
+	ULONG saves;
+	ULONG restores;
+	ULONG failures;		/* saves or restores that did not complete */
+	ULONG last_size;	/* bytes in the newest snapshot */
+	ULONG max_size;		/* largest snapshot so far */
+	ULONG last_delta;	/* bytes the newest snapshot changed */
+	ULONG max_delta;	/* most bytes changed by one snapshot */
+	ULONG save_us;		/* duration of the last save */
+	ULONG restore_us;	/* duration of the last restore */
+} REWIND_stats_t;
+
+extern REWIND_stats_t REWIND_stats;
+
+/* Frames between snapshots, 0 disables the ring (default 25). */
+extern int REWIND_interval;
+
+/* Called after every frame; takes a snapshot when one is due. */
+void REWIND_Frame(void);
+
+/* Number of snapshots held, the newest has age 0. */
+int REWIND_Count(void);
+
+/* Restores the snapshot of the given age and forgets the newer ones, so
+   the restored snapshot becomes the newest.  Returns FALSE if there is no
+   such snapshot or it could not be read. */
+int REWIND_Restore(int age);
+
+/* Forgets all snapshots, e.g. after a cold start or loading a program. */
+void REWIND_Clear(void);
+
+#endif /* REWIND_H_ */
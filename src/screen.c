@@ -36,6 +36,7 @@
 #include "pia.h"
 #include "screen.h"
 #include "sio.h"
+#include "telemetry.h"
 #include "util.h"
 #if defined(SCREENSHOTS) || defined(AUDIO_RECORDING) || defined(VIDEO_RECORDING)
 #include "file_export.h"
@@ -68,6 +69,9 @@ int Screen_show_atari_speed = FALSE;
 int Screen_show_disk_led = TRUE;
 int Screen_show_sector_counter = FALSE;
 int Screen_show_1200_leds = TRUE;
+#ifdef TELEMETRY
+int Screen_show_frame_times = FALSE;
+#endif
 
 #ifdef SCREENSHOTS
 #ifdef HAVE_LIBPNG
@@ -117,6 +121,11 @@ int Screen_Initialise(int *argc, char *argv[])
 		else if (strcmp(argv[i], "-showspeed") == 0) {
 			Screen_show_atari_speed = TRUE;
 		}
+#ifdef TELEMETRY
+		else if (strcmp(argv[i], "-showframetimes") == 0) {
+			Screen_show_frame_times = TRUE;
+		}
+#endif
 		else {
 			if (strcmp(argv[i], "-help") == 0) {
 				help_only = TRUE;
@@ -128,6 +137,9 @@ int Screen_Initialise(int *argc, char *argv[])
 				Log_print("\t-no-showstats    Don't show recording stats of video or audio");
 #endif
 				Log_print("\t-showspeed       Show percentage of actual speed");
+#ifdef TELEMETRY
+				Log_print("\t-showframetimes  Show where the time of each frame goes");
+#endif
 			}
 			argv[j++] = argv[i];
 		}
@@ -174,6 +186,10 @@ int Screen_ReadConfig(char *string, char *ptr)
 		return (Screen_show_sector_counter = Util_sscanbool(ptr)) != -1;
 	else if (strcmp(string, "SCREEN_SHOW_1200XL_LEDS") == 0)
 		return (Screen_show_1200_leds = Util_sscanbool(ptr)) != -1;
+#ifdef TELEMETRY
+	else if (strcmp(string, "SCREEN_SHOW_FRAME_TIMES") == 0)
+		return (Screen_show_frame_times = Util_sscanbool(ptr)) != -1;
+#endif
 #if defined(AUDIO_RECORDING) || defined(VIDEO_RECORDING)
 	else if (strcmp(string, "SCREEN_SHOW_MULTIMEDIA_STATS") == 0)
 		return (Screen_show_multimedia_stats = Util_sscanbool(ptr)) != -1;
@@ -188,6 +204,9 @@ void Screen_WriteConfig(FIL *fp)
 	fprintf(fp, "SCREEN_SHOW_IO_ACTIVITY=%d\n", Screen_show_disk_led);
 	fprintf(fp, "SCREEN_SHOW_IO_COUNTER=%d\n", Screen_show_sector_counter);
 	fprintf(fp, "SCREEN_SHOW_1200XL_LEDS=%d\n", Screen_show_1200_leds);
+#ifdef TELEMETRY
+	fprintf(fp, "SCREEN_SHOW_FRAME_TIMES=%d\n", Screen_show_frame_times);
+#endif
 #if defined(AUDIO_RECORDING) || defined(VIDEO_RECORDING)
 	fprintf(fp, "SCREEN_SHOW_MULTIMEDIA_STATS=%d\n", Screen_show_multimedia_stats);
 #endif
@@ -722,6 +741,45 @@ void Screen_Draw1200LED(void)
 	}
 }
 
+#ifdef TELEMETRY
+/* Draws one row per phase of the last frame: a letter, a bar scaled so that
+   FRAME_TIMES_BAR pixels are one frame period, and the time in microseconds. */
+#define FRAME_TIMES_BAR 100
+void Screen_DrawFrameTimes(void)
+{
+	static const UBYTE label[TELEMETRY_PHASES] = {
+		SMALLFONT_O, SMALLFONT_C, SMALLFONT_A, SMALLFONT_G,
+		SMALLFONT_S, SMALLFONT_D, SMALLFONT_P, SMALLFONT_W
+	};
+	static const UBYTE colour[TELEMETRY_PHASES] = {
+		0x08, 0x96, 0x36, 0xc6, 0xf6, 0x26, 0x56, 0x04
+	};
+	const TELEMETRY_frame_t *f;
+	int period;
+	int i;
+
+	if (!Screen_show_frame_times || (f = TELEMETRY_GetFrame(0)) == NULL)
+		return;
+	period = Atari800_tv_mode == Atari800_TV_PAL ? 20000 : 16667;
+	for (i = 0; i < TELEMETRY_PHASES; i++) {
+		UBYTE *screen = (UBYTE *) Screen_atari + Screen_visible_x1 + SMALLFONT_WIDTH
+		                + (Screen_visible_y1 + 8 + i * (SMALLFONT_HEIGHT + 1)) * Screen_WIDTH;
+		int len = (int) f->us[i] * FRAME_TIMES_BAR / period;
+		int x;
+		int y;
+		if (len > FRAME_TIMES_BAR)
+			len = FRAME_TIMES_BAR;
+		SmallFont_DrawChar(screen, label[i], 0x0f, 0x00);
+		screen += SMALLFONT_WIDTH + 2;
+		for (y = 1; y < SMALLFONT_HEIGHT - 1; y++)
+			for (x = 0; x < FRAME_TIMES_BAR; x++)
+				ANTIC_VideoPutByte(screen + y * Screen_WIDTH + x, (UBYTE) (x < len ? colour[i] : 0x00));
+		/* the number is drawn right-aligned after the bar */
+		SmallFont_DrawInt(screen + FRAME_TIMES_BAR + 6 * SMALLFONT_WIDTH, f->us[i], 0x0c, 0x00);
+	}
+}
+#endif /* TELEMETRY */
+
 #if defined(AUDIO_RECORDING) || defined(VIDEO_RECORDING)
 /* Returns screen address for placing the next character on the left of the
    drawn number. */
@@ -878,7 +936,7 @@ int Screen_SaveScreenshot(const char *filename, int interlaced)
 		Log_print("Failed saving to file: %s", filename);
 	}
 	if (interlaced) {
-		free(Screen_atari);
+		Util_free(Screen_atari);
 		Screen_atari = main_screen_atari;
 	}
 	return result;
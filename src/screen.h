@@ -46,6 +46,9 @@ extern int Screen_show_atari_speed;
 extern int Screen_show_disk_led;
 extern int Screen_show_sector_counter;
 extern int Screen_show_1200_leds;
+#ifdef TELEMETRY
+extern int Screen_show_frame_times;
+#endif
 extern int Screen_show_multimedia_stats;
 
 int Screen_Initialise(int *argc, char *argv[]);
@@ -54,6 +57,9 @@ void Screen_WriteConfig(FIL *fp);
 void Screen_DrawAtariSpeed(double);
 void Screen_DrawDiskLED(void);
 void Screen_Draw1200LED(void);
+#ifdef TELEMETRY
+void Screen_DrawFrameTimes(void);
+#endif
 void Screen_DrawMultimediaStats(void);
 void Screen_FindScreenshotFilename(char *buffer, unsigned bufsize);
 int Screen_SaveScreenshot(const char *filename, int interlaced);
@@ -35,6 +35,8 @@
 #include "antic.h"  /* ANTIC_ypos */
 #include "atari.h"
 #include "binload.h"
+#include "blkcache.h"
+#include "bootsnap.h"
 #include "cassette.h"
 #include "compfile.h"
 #include "cpu.h"
@@ -44,6 +46,7 @@
 #include "platform.h"
 #include "pokey.h"
 #include "pokeysnd.h"
+#include "region.h"
 #include "sio.h"
 #include "util.h"
 #ifndef BASIC
@@ -73,6 +76,9 @@ static int image_type[SIO_MAX_DRIVES];
 #define IMAGE_TYPE_PRO  2
 #define IMAGE_TYPE_VAPI 3
 static FIL disk[SIO_MAX_DRIVES];
+/* Sectors are read and written through the block cache, at disk_pos. */
+static FSIZE_t disk_pos[SIO_MAX_DRIVES];
+static BLKCACHE_dev_t sio_blk = { "SIO" };
 static int sectorcount[SIO_MAX_DRIVES];
 static int sectorsize[SIO_MAX_DRIVES];
 /* these two are used by the 1450XLD parallel disk device */
@@ -148,9 +154,16 @@ typedef struct tagvapi_sector_header_t {
 #define VAPI_32(x) (x[0] + (x[1] << 8) + (x[2] << 16) + (x[3] << 24))
 #define VAPI_16(x) (x[0] + (x[1] << 8))
 
-/* Additional Info for all copy protected disk types */
+/* Additional Info for all copy protected disk types, kept in the drive's
+   memory region */
 static void *additional_info[SIO_MAX_DRIVES];
 
+static void FreeAdditionalInfo(int diskno)
+{
+	REGION_Free(REGION_Disk(diskno));
+	additional_info[diskno - 1] = NULL;
+}
+
 SIO_UnitStatus SIO_drive_status[SIO_MAX_DRIVES];
 char SIO_filename[SIO_MAX_DRIVES][FILENAME_MAX];
 
@@ -170,12 +183,15 @@ char SIO_status[256];
 #define SIO_WriteFrame      (0x04)
 #define SIO_FinalStatus     (0x05)
 #define SIO_FormatFrame     (0x06)
+#define SIO_SectorWait      (0x07)	/* read acknowledged, sector still on the card */
 static UBYTE CommandFrame[6];
 static int CommandIndex = 0;
 static UBYTE DataBuffer[256 + 3];
 static int DataIndex = 0;
 static int TransferStatus = SIO_NoFrame;
 static int ExpectedBytes = 0;
+static int WaitUnit;
+static int WaitSector;
 
 int ignore_header_writeprotect = FALSE;
 
@@ -217,7 +233,8 @@ int SIO_Mount(int diskno, const char *filename, int b_open_readonly)
 
 	/* release previous disk */
 	SIO_Dismount(diskno);
-    FRESULT fr;
+	/* a read-only mount goes straight to FA_READ */
+	FRESULT fr = FR_DENIED;
 	/* open file */
 	if (!b_open_readonly) {
 		fr = f_open(&f, filename, FA_READ | FA_WRITE);
@@ -402,9 +419,16 @@ int SIO_Mount(int diskno, const char *filename, int b_open_readonly)
 			trackoffset += next;
 		}
 
-		info = (vapi_additional_info_t *)Util_malloc(sizeof(vapi_additional_info_t), "SIO_Mount info");
+		info = (vapi_additional_info_t *)REGION_Alloc(REGION_Disk(diskno), &additional_info[diskno-1], sizeof(vapi_additional_info_t), "SIO_Mount info");
 		additional_info[diskno-1] = info;
-		info->sectors = (vapi_sec_info_t *)Util_malloc(sectorcount[diskno - 1] * sizeof(vapi_sec_info_t), "SIO_Mount sectors");
+		if (info != NULL)
+			info->sectors = (vapi_sec_info_t *)REGION_Alloc(REGION_Disk(diskno), &info->sectors, sectorcount[diskno - 1] * sizeof(vapi_sec_info_t), "SIO_Mount sectors");
+		if (info == NULL || info->sectors == NULL) {
+			FreeAdditionalInfo(diskno);
+			Util_fclose(&f, sio_tmpbuf[diskno - 1]);
+			Log_print("VAPI: Not enough memory");
+			return(FALSE);
+			}
 		memset(info->sectors, 0, sectorcount[diskno - 1] * 
  					 sizeof(vapi_sec_info_t));
 
@@ -420,8 +444,7 @@ int SIO_Mount(int diskno, const char *filename, int b_open_readonly)
 
 			fseek(&f,trackoffset,SEEK_SET);
 			if (fread(&trackheader,1,sizeof(trackheader),&f) != sizeof(trackheader)) {
-				free(info->sectors);
-				free(info);
+				FreeAdditionalInfo(diskno);
 				Util_fclose(&f, sio_tmpbuf[diskno - 1]);
 				Log_print("VAPI: Bad Track Header while reading sectors");
 				return(FALSE);
@@ -436,16 +459,14 @@ int SIO_Mount(int diskno, const char *filename, int b_open_readonly)
 #endif
 			if (tracktype == 0) {
 				if (seclistdata > file_length) {
-					free(info->sectors);
-					free(info);
+					FreeAdditionalInfo(diskno);
 					Util_fclose(&f, sio_tmpbuf[diskno - 1]);
 					Log_print("VAPI: Bad Sector List Offset");
 					return(FALSE);
 					}
 				fseek(&f,seclistdata,SEEK_SET);
 				if (fread(&sectorlist,1,sizeof(sectorlist),&f) != sizeof(sectorlist)) {
-					free(info->sectors);
-					free(info);
+					FreeAdditionalInfo(diskno);
 					Util_fclose(&f, sio_tmpbuf[diskno - 1]);
 					Log_print("VAPI: Bad Sector List");
 					return(FALSE);
@@ -457,13 +478,13 @@ int SIO_Mount(int diskno, const char *filename, int b_open_readonly)
 					double percent_rot;
 
 					if (fread(&sectorheader,1,sizeof(sectorheader),&f) != sizeof(sectorheader)) {
-						free(info->sectors);
-						free(info);
+						FreeAdditionalInfo(diskno);
 						Util_fclose(&f, sio_tmpbuf[diskno - 1]);
 						Log_print("VAPI: Bad Sector Header");
 						return(FALSE);
 						}
 					if (sectorheader.sectornum > 18)  {
+						FreeAdditionalInfo(diskno);
 						Util_fclose(&f, sio_tmpbuf[diskno - 1]);
 						Log_print("VAPI: Bad Sector Index: Track %d Sec Num %d Index %d",
 								trackheader.tracknum,j,sectorheader.sectornum);
@@ -477,8 +498,7 @@ int SIO_Mount(int diskno, const char *filename, int b_open_readonly)
 					sector->sec_status[sector->sec_count] = ~sectorheader.sectorstatus;
 					sector->sec_count++;
 					if (sector->sec_count > MAX_VAPI_PHANTOM_SEC) {
-						free(info->sectors);
-						free(info);
+						FreeAdditionalInfo(diskno);
 						Util_fclose(&f, sio_tmpbuf[diskno - 1]);
 						Log_print("VAPI: Too many Phantom Sectors");
 						return(FALSE);
@@ -526,9 +546,16 @@ int SIO_Mount(int diskno, const char *filename, int b_open_readonly)
 				sectorcount[diskno - 1] = 720;
 			}
 
-			info = (pro_additional_info_t *)Util_malloc(sizeof(pro_additional_info_t), "SIO_Mount info");
+			info = (pro_additional_info_t *)REGION_Alloc(REGION_Disk(diskno), &additional_info[diskno-1], sizeof(pro_additional_info_t), "SIO_Mount info");
 			additional_info[diskno-1] = info;
-			info->count = (unsigned char *)Util_malloc(sectorcount[diskno - 1], "SIO_Mount count");
+			if (info != NULL)
+				info->count = (unsigned char *)REGION_Alloc(REGION_Disk(diskno), &info->count, sectorcount[diskno - 1], "SIO_Mount count");
+			if (info == NULL || info->count == NULL) {
+				FreeAdditionalInfo(diskno);
+				Util_fclose(&f, sio_tmpbuf[diskno - 1]);
+				Log_print("PRO: Not enough memory");
+				return FALSE;
+			}
 			memset(info->count, 0, sectorcount[diskno -1]);
 			info->max_sector = (file_length-16)/(128+12);
 		}
@@ -564,24 +591,19 @@ int SIO_Mount(int diskno, const char *filename, int b_open_readonly)
 	strcpy(SIO_filename[diskno - 1], filename);
 	SIO_drive_status[diskno - 1] = status;
 	disk[diskno - 1] = f;
+	BLKCACHE_Map(&disk[diskno - 1]);
 	return TRUE;
 }
 
 void SIO_Dismount(int diskno)
 {
 	if (disk[diskno - 1].obj.fs != 0) {
+		BLKCACHE_Release(&disk[diskno - 1]);
 		Util_fclose(&disk[diskno - 1], sio_tmpbuf[diskno - 1]);
 	///	disk[diskno - 1] = NULL;
 		SIO_drive_status[diskno - 1] = SIO_NO_DISK;
 		strcpy(SIO_filename[diskno - 1], "Empty");
-		if (image_type[diskno - 1] == IMAGE_TYPE_PRO) {
-			free(((pro_additional_info_t *)additional_info[diskno-1])->count);
-		}
-		else if (image_type[diskno - 1] == IMAGE_TYPE_VAPI) {
-			free(((vapi_additional_info_t *)additional_info[diskno-1])->sectors);
-		}
-		free(additional_info[diskno - 1]);
-		additional_info[diskno - 1] = 0;
+		FreeAdditionalInfo(diskno);
 	}
 }
 
@@ -645,6 +667,24 @@ void SIO_SizeOfSector(UBYTE unit, int sector, int *sz, ULONG *ofs)
 		*ofs = offset;
 }
 
+static int ReadDisk(int unit, UBYTE *buffer, int size)
+{
+	UINT br;
+	if (!BLKCACHE_Read(&sio_blk, &disk[unit], disk_pos[unit], buffer, size, &br))
+		return 0;
+	disk_pos[unit] += br;
+	return br;
+}
+
+static int WriteDisk(int unit, const UBYTE *buffer, int size)
+{
+	UINT bw;
+	if (!BLKCACHE_Write(&sio_blk, &disk[unit], disk_pos[unit], buffer, size, &bw))
+		return 0;
+	disk_pos[unit] += bw;
+	return bw;
+}
+
 static int SeekSector(int unit, int sector)
 {
 	ULONG offset;
@@ -653,7 +693,7 @@ static int SeekSector(int unit, int sector)
 	SIO_last_sector = sector;
 	snprintf(SIO_status, sizeof(SIO_status), "%d: %d", unit + 1, sector);
 	SIO_SizeOfSector((UBYTE) unit, sector, &size, &offset);
-	fseek(&disk[unit], offset, SEEK_SET);
+	disk_pos[unit] = offset;
 
 	return size;
 }
@@ -682,7 +722,7 @@ int SIO_ReadSector(int unit, int sector, UBYTE *buffer)
 		unsigned char *count;
 		info = (pro_additional_info_t *)additional_info[unit];
 		count = info->count;
-		if (fread(buffer, 1, 12, &disk[unit]) < 12) {
+		if (ReadDisk(unit, buffer, 12) < 12) {
 			Log_print("Error in header of .pro image: sector:%d", sector);
 			return 'E';
 		}
@@ -702,7 +742,7 @@ int SIO_ReadSector(int unit, int sector, UBYTE *buffer)
 				}
 				size = SeekSector(unit, sector);
 				/* read sector header */
-				if (fread(buffer, 1, 12, &disk[unit]) < 12) {
+				if (ReadDisk(unit, buffer, 12) < 12) {
 					Log_print("Error in header2 of .pro image: sector:%d dupnum:%d", sector, dupnum);
 					return 'E';
 				}
@@ -710,7 +750,7 @@ int SIO_ReadSector(int unit, int sector, UBYTE *buffer)
 		}
 		/* bad sector */
 		if (buffer[1] != 0xff) {
-			if (fread(buffer, 1, size, &disk[unit]) < size) {
+			if (ReadDisk(unit, buffer, size) < size) {
 				Log_print("Error in bad sector of .pro image: sector:%d", sector);
 			}
 			io_success[unit] = sector;
@@ -802,13 +842,13 @@ int SIO_ReadSector(int unit, int sector, UBYTE *buffer)
 		if (secinfo->sec_count > 1)
 			Log_print("duplicate sector:%d dupnum:%d delay:%d",sector, secindex,info->vapi_delay_time);
 #endif
-		fseek(&disk[unit],secinfo->sec_offset[secindex],SEEK_SET);
+		disk_pos[unit] = secinfo->sec_offset[secindex];
 		info->sec_stat_buff[0] = 0x8 | ((secinfo->sec_status[secindex] == 0xFF) ? 0 : 0x04);
 		info->sec_stat_buff[1] = secinfo->sec_status[secindex];
 		info->sec_stat_buff[2] = 0xe0;
 		info->sec_stat_buff[3] = 0;
 		if (secinfo->sec_status[secindex] != 0xFF) {
-			if (fread(buffer, 1, size, &disk[unit]) < size) {
+			if (ReadDisk(unit, buffer, size) < size) {
 				Log_print("error reading sector:%d", sector);
 			}
 			io_success[unit] = sector;
@@ -832,7 +872,7 @@ int SIO_ReadSector(int unit, int sector, UBYTE *buffer)
 		Log_flushlog();
 #endif		
 	}
-	if (fread(buffer, 1, size, &disk[unit]) < size) {
+	if (ReadDisk(unit, buffer, size) < size) {
 		Log_print("incomplete sector num:%d", sector);
 	}
 	io_success[unit] = 0;
@@ -871,8 +911,8 @@ int SIO_WriteSector(int unit, int sector, const UBYTE *buffer)
 		}
 		
 		size = SeekSector(unit, sector);
-		fseek(disk[unit],secinfo->sec_offset[0],SEEK_SET);
-		fwrite(buffer, 1, size, disk[unit]);
+		disk_pos[unit] = secinfo->sec_offset[0];
+		WriteDisk(unit, buffer, size);
 		io_success[unit] = 0;
 		return 'C';
 #if 0		
@@ -894,7 +934,7 @@ int SIO_WriteSector(int unit, int sector, const UBYTE *buffer)
 	} 
 #endif
 	size = SeekSector(unit, sector);
-	fwrite(buffer, 1, size, &disk[unit]);
+	WriteDisk(unit, buffer, size);
 	io_success[unit] = 0;
 	return 'C';
 }
@@ -1084,7 +1124,7 @@ int SIO_DriveStatus(int unit, UBYTE *buffer)
 	if (io_success[unit] != 0  && image_type[unit] == IMAGE_TYPE_PRO) {
 		int sector = io_success[unit];
 		SeekSector(unit, sector);
-		if (fread(buffer, 1, 4, &disk[unit]) < 4) {
+		if (ReadDisk(unit, buffer, 4) < 4) {
 			Log_print("SIO_DriveStatus: failed to read sector header");
 		}
 		return 'C';
@@ -1135,6 +1175,9 @@ void SIO_Handler(void)
 	int realsize = 0;
 	int cmd = MEMORY_dGetByte(0x302);
 
+	/* the OS booting after a cold start may be saved here */
+	BOOTSNAP_SIOCall();
+
 	if ((unsigned int)MEMORY_dGetByte(0x300) + (unsigned int)MEMORY_dGetByte(0x301) > 0xff) {
 		/* carry */
 		unit++;
@@ -1355,6 +1398,28 @@ UBYTE SIO_ChkSum(const UBYTE *buffer, int length)
 	return checksum;
 }
 
+static void ReadSectorFrame(int unit, int sector, int realsize)
+{
+	DataBuffer[0] = SIO_ReadSector(unit, sector, DataBuffer + 1);
+	DataBuffer[1 + realsize] = SIO_ChkSum(DataBuffer + 1, realsize);
+	DataIndex = 0;
+	ExpectedBytes = 2 + realsize;
+	TransferStatus = SIO_ReadFrame;
+}
+
+/* Returns TRUE while the sector of an acknowledged read is still being
+   read from the card; POKEY holds the next byte back meanwhile, as a
+   drive would while it reads. */
+int SIO_SerinWait(void)
+{
+	int size;
+	ULONG offset;
+	if (TransferStatus != SIO_SectorWait || disk[WaitUnit].obj.fs == 0)
+		return FALSE;
+	SIO_SizeOfSector((UBYTE) WaitUnit, WaitSector, &size, &offset);
+	return !BLKCACHE_Fetch(&sio_blk, &disk[WaitUnit], offset, size);
+}
+
 static UBYTE Command_Frame(void)
 {
 	int unit;
@@ -1406,6 +1471,13 @@ static UBYTE Command_Frame(void)
 			CommandFrame[3], CommandFrame[4]);
 #endif
 		SIO_SizeOfSector((UBYTE) unit, sector, &realsize, NULL);
+		if ((image_type[unit] == IMAGE_TYPE_ATR || image_type[unit] == IMAGE_TYPE_XFD)
+		    && disk[unit].obj.fs != 0 && sector > 0 && sector <= sectorcount[unit]) {
+			ULONG offset;
+			/* what the sector shares a cache block with comes in meanwhile */
+			SIO_SizeOfSector((UBYTE) unit, sector, NULL, &offset);
+			BLKCACHE_Fetch(&sio_blk, &disk[unit], offset, realsize);
+		}
 		ExpectedBytes = realsize + 1;
 		DataIndex = 0;
 		TransferStatus = SIO_WriteFrame;
@@ -1421,11 +1493,22 @@ static UBYTE Command_Frame(void)
 			CommandFrame[3], CommandFrame[4]);
 #endif
 		SIO_SizeOfSector((UBYTE) unit, sector, &realsize, NULL);
-		DataBuffer[0] = SIO_ReadSector(unit, sector, DataBuffer + 1);
-		DataBuffer[1 + realsize] = SIO_ChkSum(DataBuffer + 1, realsize);
-		DataIndex = 0;
-		ExpectedBytes = 2 + realsize;
-		TransferStatus = SIO_ReadFrame;
+		if ((image_type[unit] == IMAGE_TYPE_ATR || image_type[unit] == IMAGE_TYPE_XFD)
+		    && !BINLOAD_start_binloading && disk[unit].obj.fs != 0
+		    && sector > 0 && sector <= sectorcount[unit]) {
+			ULONG offset;
+			SIO_SizeOfSector((UBYTE) unit, sector, NULL, &offset);
+			if (!BLKCACHE_Fetch(&sio_blk, &disk[unit], offset, realsize)) {
+				/* read it when POKEY wants the first byte */
+				WaitUnit = unit;
+				WaitSector = sector;
+				TransferStatus = SIO_SectorWait;
+			}
+			else
+				ReadSectorFrame(unit, sector, realsize);
+		}
+		else
+			ReadSectorFrame(unit, sector, realsize);
 		/* wait longer before confirmation because bytes could be lost */
 		/* before the buffer was set (see $E9FB & $EA37 in XL-OS) */
 		POKEY_DELAYED_SERIN_IRQ = SIO_SERIN_INTERVAL << 2; 
@@ -1518,7 +1601,7 @@ void SIO_SwitchCommandFrame(int onoff)
 	}
 	else {
 		if (TransferStatus != SIO_StatusRead && TransferStatus != SIO_NoFrame &&
-			TransferStatus != SIO_ReadFrame) {
+			TransferStatus != SIO_ReadFrame && TransferStatus != SIO_SectorWait) {
 			if (!(TransferStatus == SIO_CommandFrame && CommandIndex == 0))
 				Log_print("Command frame %02x unfinished.", TransferStatus);
 			TransferStatus = SIO_NoFrame;
@@ -1619,6 +1702,13 @@ int SIO_GetByte(void)
 		TransferStatus = SIO_ReadFrame;
 		POKEY_DELAYED_SERIN_IRQ = SIO_SERIN_INTERVAL << 3;
 		/* FALL THROUGH */
+	case SIO_SectorWait:
+		if (TransferStatus == SIO_SectorWait) {
+			int realsize;
+			SIO_SizeOfSector((UBYTE) WaitUnit, WaitSector, &realsize, NULL);
+			ReadSectorFrame(WaitUnit, WaitSector, realsize);
+		}
+		/* FALL THROUGH */
 	case SIO_ReadFrame:
 		if (DataIndex < ExpectedBytes) {
 			byte = DataBuffer[DataIndex++];
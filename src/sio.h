@@ -34,6 +34,7 @@ UBYTE SIO_ChkSum(const UBYTE *buffer, int length);
 void SIO_SwitchCommandFrame(int onoff);
 void SIO_PutByte(int byte);
 int SIO_GetByte(void);
+int SIO_SerinWait(void);
 int SIO_Initialise(int *argc, char *argv[]);
 void SIO_Exit(void);
 
@@ -30,6 +30,7 @@
 #include "log.h"
 #include "platform.h"
 #include "pokeysnd.h"
+#include "region.h"
 #include "util.h"
 
 #define DEBUG 0
@@ -242,9 +243,13 @@ int Sound_Setup(void)
 
 	POKEYSND_stereo_enabled = Sound_out.channels == 2;
 #ifndef SOUND_CALLBACK
-	free(process_buffer);
+	REGION_Release(process_buffer);
 	process_buffer_size = Sound_out.buffer_frames * Sound_out.channels * Sound_out.sample_size;
-	process_buffer = Util_malloc(process_buffer_size, "Sound_Setup");
+	process_buffer = REGION_Alloc(REGION_SOUND, NULL, process_buffer_size, "Sound_Setup");
+	if (process_buffer == NULL) {
+		Sound_Exit();
+		return FALSE;
+	}
 #endif /* !SOUND_CALLBACK */
 
 	POKEYSND_Init(POKEYSND_FREQ_17_EXACT, Sound_out.freq, Sound_out.channels, Sound_out.sample_size == 2 ? POKEYSND_BIT16 : 0);
@@ -272,11 +277,11 @@ void Sound_Exit(void)
 		PLATFORM_SoundExit();
 		Sound_enabled = FALSE;
 #ifndef SOUND_CALLBACK
-		free(process_buffer);
+		REGION_Release(process_buffer);
 		process_buffer = NULL;
 #endif /* !SOUND_CALLBACK */
 #ifdef SYNCHRONIZED_SOUND
-		free(sync_buffer);
+		Util_free(sync_buffer);
 		sync_buffer = NULL;
 #endif /* SYNCHRONIZED_SOUND */
 	}
@@ -505,7 +510,7 @@ void Sound_SetLatency(unsigned int latency)
 		avg_fill = sync_min_fill;
 		sync_read_pos = 0;
 		sync_write_pos = sync_min_fill;
-		free(sync_buffer);
+		Util_free(sync_buffer);
 		sync_buffer = Util_malloc(sync_buffer_size);
 		memset(sync_buffer, 0, sync_buffer_size);
 		PLATFORM_SoundUnlock();
@@ -0,0 +1,145 @@
+/*
+ * sramtab.c - Hot lookup tables copied from flash to SRAM
+ *
+ * Copyright (C) 2026 Atari800 development team (see DOC/CREDITS)
+ *
+ * This file is part of the Atari800 emulator project which emulates
+ * the Atari 400, 800, 800XL, 130XE, and 5200 8-bit computers.
+ *
+ * Atari800 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Atari800 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Atari800; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "config.h"
+#include <string.h>
+#include "atari.h"
+#include "log.h"
+#include "sramtab.h"
+#include "util.h"
+
+int SRAMTAB_budget_kb = 16;
+
+#ifdef SRAMTAB_STATS
+ULONG SRAMTAB_hits[SRAMTAB_TABLES];
+#endif
+
+/* The placement manifest: the tables in the order they get SRAM, most
+   reads per byte first, with the most SRAM each may need.  The reads per
+   frame are from a SRAMTAB_STATS build running 6000 frames of a BASIC loop
+   that shows player 0 and alternates a tone with 17-bit and 9-bit noise
+   (MZ engine at 44100 Hz, quality 0). */
+static const struct {
+	int table;
+	const char *name;
+	size_t size;
+} manifest[] = {
+	/* 1001 reads per frame, at most 9.4 KB of a filter_data.h table */
+	{ SRAMTAB_FILTER, "filter_data", 1201 * sizeof(double) },
+	/* 151 reads per frame with a player on screen */
+	{ SRAMTAB_GRAFP, "grafp_lookup", 4 * 256 * sizeof(ULONG) },
+	/* 15 reads per frame */
+	{ SRAMTAB_POLY9, "poly9tbl", 511 },
+	/* only read by RANDOM and the old sound engine */
+	{ SRAMTAB_POLY17_LOOKUP, "POKEY_poly17_lookup", 16385 },
+	/* 8 reads per frame, and beyond any budget that leaves room to run */
+	{ SRAMTAB_POLY17, "poly17tbl", 131071 }
+};
+
+#define N_MANIFEST ((int) (sizeof(manifest) / sizeof(manifest[0])))
+
+static struct {
+	UBYTE *sram;		/* NULL if the table stays in flash */
+	size_t size;
+	const void *flash;	/* what sram holds a copy of */
+	const char *name;
+} tables[SRAMTAB_TABLES];
+
+const void *SRAMTAB_Place(int table, const void *flash, size_t size)
+{
+	if (tables[table].sram == NULL || size > tables[table].size)
+		return flash;
+	if (tables[table].flash != flash) {
+		memcpy(tables[table].sram, flash, size);
+		tables[table].flash = flash;
+	}
+	return tables[table].sram;
+}
+
+int SRAMTAB_Initialise(int *argc, char *argv[])
+{
+	int i;
+	int j;
+	size_t left;
+	for (i = j = 1; i < *argc; i++) {
+		int i_a = (i + 1 < *argc);		/* is argument available? */
+		int a_m = FALSE;			/* error, argument missing! */
+		if (strcmp(argv[i], "-sramtab-kb") == 0) {
+			if (i_a)
+				SRAMTAB_budget_kb = Util_sscandec(argv[++i]);
+			else a_m = TRUE;
+		}
+		else {
+			if (strcmp(argv[i], "-help") == 0)
+				Log_print("\t-sramtab-kb <kb>     SRAM for hot lookup tables (0: none)");
+			argv[j++] = argv[i];
+		}
+		if (a_m) {
+			Log_print("Missing argument for '%s'", argv[i]);
+			return FALSE;
+		}
+	}
+	*argc = j;
+	if (SRAMTAB_budget_kb < 0)
+		SRAMTAB_budget_kb = 0;
+
+	left = (size_t) SRAMTAB_budget_kb << 10;
+	for (i = 0; i < N_MANIFEST; i++) {
+		int table = manifest[i].table;
+		tables[table].name = manifest[i].name;
+		if (tables[table].sram != NULL || manifest[i].size > left)
+			continue;
+		tables[table].sram = (UBYTE *) Util_malloc(manifest[i].size, "SRAMTAB_Initialise");
+		tables[table].size = manifest[i].size;
+		left -= manifest[i].size;
+	}
+	return TRUE;
+}
+
+int SRAMTAB_ReadConfig(char *string, char *ptr)
+{
+	if (strcmp(string, "SRAMTAB_KB") == 0)
+		return (SRAMTAB_budget_kb = Util_sscandec(ptr)) >= 0;
+	return FALSE;
+}
+
+void SRAMTAB_WriteConfig(FIL *fp)
+{
+	fprintf(fp, "SRAMTAB_KB=%d\n", SRAMTAB_budget_kb);
+}
+
+#ifdef SRAMTAB_STATS
+
+void SRAMTAB_Report(void)
+{
+	int i;
+	Log_print("%-20s %6s %-5s %10s %8s", "Table", "Bytes", "In", "Reads", "/frame");
+	for (i = 0; i < N_MANIFEST; i++) {
+		int table = manifest[i].table;
+		Log_print("%-20s %6lu %-5s %10lu %8lu", tables[table].name, (unsigned long) manifest[i].size,
+		          tables[table].sram != NULL ? "SRAM" : "flash", (unsigned long) SRAMTAB_hits[table],
+		          Atari800_nframes > 0 ? (unsigned long) (SRAMTAB_hits[table] / Atari800_nframes) : 0UL);
+	}
+}
+
+#endif /* SRAMTAB_STATS */
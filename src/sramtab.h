@@ -0,0 +1,54 @@
+#ifndef SRAMTAB_H_
+#define SRAMTAB_H_
+
+#include "config.h"
+#include <stddef.h>
+#include "atari.h"
+#include "ff.h"
+
+/* Lookup tables copied to SRAM.  The big constant tables are kept in flash,
+   where a read that misses the XIP cache stalls the CPU, and the hot ones
+   are read every scanline or every sample.  At start-up the tables of the
+   manifest in sramtab.c are given SRAM in its order, as long as they fit
+   in SRAMTAB_budget_kb; the order comes from the access counts of a
+   SRAMTAB_STATS build.  A module reads its table through the pointer
+   SRAMTAB_Place() returns, which is the flash table if it got no SRAM. */
+
+enum {
+	SRAMTAB_GRAFP,			/* gtia.c grafp_lookup */
+	SRAMTAB_POLY17_LOOKUP,	/* pokey.c POKEY_poly17_lookup */
+	SRAMTAB_FILTER,			/* mzpokeysnd.c filter_data, the built-in one in use */
+	SRAMTAB_POLY9,			/* mzpokeysnd.c poly9tbl */
+	SRAMTAB_POLY17,			/* mzpokeysnd.c poly17tbl */
+	SRAMTAB_TABLES
+};
+
+/* SRAM for the tables in KB, taken from the heap. */
+extern int SRAMTAB_budget_kb;
+
+int SRAMTAB_Initialise(int *argc, char *argv[]);
+int SRAMTAB_ReadConfig(char *string, char *ptr);
+void SRAMTAB_WriteConfig(FIL *fp);
+
+/* Returns the SRAM copy of TABLE, whose contents are now at FLASH, or FLASH
+   itself if TABLE got no SRAM or less than SIZE bytes.  May be called again
+   when a module switches to another table of the same kind. */
+const void *SRAMTAB_Place(int table, const void *flash, size_t size);
+
+#ifdef SRAMTAB_STATS
+
+/* Reads of each table since start-up. */
+extern ULONG SRAMTAB_hits[SRAMTAB_TABLES];
+
+#define SRAMTAB_COUNT(table) (SRAMTAB_hits[table]++)
+
+/* Logs the size, placement and reads of each table. */
+void SRAMTAB_Report(void);
+
+#else /* SRAMTAB_STATS */
+
+#define SRAMTAB_COUNT(table)
+
+#endif /* SRAMTAB_STATS */
+
+#endif /* SRAMTAB_H_ */
@@ -54,6 +54,7 @@
 #include "pokey.h"
 #include "sio.h"
 #include "util.h"
+#include "psram_spi.h"
 #ifdef PBI_MIO
 #include "pbi_mio.h"
 #endif
@@ -79,14 +80,18 @@ static gzFile mem_open(const char *name, const char *mode);
 static int mem_close(gzFile stream);
 static size_t mem_read(void *buf, size_t len, gzFile stream);
 static size_t mem_write(const void *buf, size_t len, gzFile stream);
-static size_t psram_read(size_t offset, size_t len, gzFile stream);
-static size_t psram_write(size_t offset, size_t len, gzFile stream);
+static size_t mem_read2psram(size_t offset, size_t len, gzFile stream);
+static size_t mem_write_from_psram(size_t offset, size_t len, gzFile stream);
+#ifdef LIBATARI800
+static int mem_skip(size_t len, gzFile stream);
+static int mem_keep(size_t len, gzFile stream);
+#endif
 #define GZOPEN(X, Y)     mem_open(X, Y)
 #define GZCLOSE(X)       mem_close(X)
 #define GZREAD(X, Y, Z)  mem_read(Y, Z, X)
 #define GZWRITE(X, Y, Z) mem_write(Y, Z, X)
-#define GZREADPSRAM(X, Y, Z)  psram_read(Y, Z, X)
-#define GZWRITE2PSRAM(X, Y, Z) psram_write(Y, Z, X)
+#define GZREADPSRAM(X, Y, Z)  mem_read2psram(Y, Z, X)
+#define GZWRITE2PSRAM(X, Y, Z) mem_write_from_psram(Y, Z, X)
 #undef GZERROR
 #elif defined(HAVE_LIBZ) /* above MEMCOMPR, below HAVE_LIBZ */
 #define GZOPEN(X, Y)     gzopen(X, Y)
@@ -164,6 +169,37 @@ void StateSav_ReadUBYTE(UBYTE *data, int num)
 		GetGZErrorText();
 }
 
+/* When the state is only being updated (see LIBATARI800_StateUpdatePSRAM)
+   leaves the next num bytes as they are and returns TRUE; the caller
+   knows they have not changed since they were saved there. Otherwise
+   returns FALSE and the caller saves them as usual. */
+int StateSav_SkipUBYTE(int num)
+{
+	if (!StateFile || nFileError != Z_OK)
+		return FALSE;
+#ifdef LIBATARI800
+	return mem_skip(num, StateFile);
+#else
+	return FALSE;
+#endif
+}
+
+/* When the state is being brought back into the machine that last saved
+   it (see LIBATARI800_StateRestorePSRAM) moves past the next num bytes and
+   returns TRUE if they are still those it saved; the caller knows its own
+   copy has not changed since. Otherwise returns FALSE and the caller reads
+   them as usual. */
+int StateSav_KeepUBYTE(int num)
+{
+	if (!StateFile || nFileError != Z_OK)
+		return FALSE;
+#ifdef LIBATARI800
+	return mem_keep(num, StateFile);
+#else
+	return FALSE;
+#endif
+}
+
 /* Value is memory location of data, num is number of type to save */
 void StateSav_SaveUWORD(const UWORD *data, int num)
 {
@@ -560,6 +596,81 @@ int StateSav_ReadAtariState(const char *filename, const char *mode)
 	return TRUE;
 }
 
+#ifdef LIBATARI800
+/* The chips, the CPU and memory, without the machine configuration,
+   cartridges and drives around them.  Such a state can only be read back
+   into the configuration it was saved in. */
+int StateSav_SaveMachineState(void)
+{
+	UBYTE StateVersion = SAVE_VERSION_NUMBER;
+	UBYTE SaveVerbose = 0;
+
+	if (StateFile != NULL) {
+		GZCLOSE(StateFile);
+		StateFile = NULL;
+	}
+	nFileError = Z_OK;
+
+	StateFile = GZOPEN(NULL, "wb");
+	if (StateFile == NULL)
+		return FALSE;
+
+	STATESAV_TAG(size);
+	StateSav_SaveUBYTE(&StateVersion, 1);
+	StateSav_SaveUBYTE(&SaveVerbose, 1);
+	ANTIC_StateSave();
+	CPU_StateSave(SaveVerbose);
+	GTIA_StateSave();
+	PIA_StateSave();
+	POKEY_StateSave();
+	PBI_StateSave();
+
+	STATESAV_TAG(size);
+	if (GZCLOSE(StateFile) != 0) {
+		StateFile = NULL;
+		return FALSE;
+	}
+	StateFile = NULL;
+
+	return nFileError == Z_OK;
+}
+
+int StateSav_ReadMachineState(void)
+{
+	UBYTE StateVersion = 0;
+	UBYTE SaveVerbose = 0;
+
+	if (StateFile != NULL) {
+		GZCLOSE(StateFile);
+		StateFile = NULL;
+	}
+	nFileError = Z_OK;
+
+	StateFile = GZOPEN(NULL, "rb");
+	if (StateFile == NULL)
+		return FALSE;
+
+	if (GZREAD(StateFile, &StateVersion, 1) == 0
+	 || GZREAD(StateFile, &SaveVerbose, 1) == 0
+	 || StateVersion != SAVE_VERSION_NUMBER) {
+		GZCLOSE(StateFile);
+		StateFile = NULL;
+		return FALSE;
+	}
+	ANTIC_StateRead();
+	CPU_StateRead(SaveVerbose, StateVersion);
+	GTIA_StateRead(StateVersion);
+	PIA_StateRead(StateVersion);
+	POKEY_StateRead();
+	PBI_StateRead();
+
+	GZCLOSE(StateFile);
+	StateFile = NULL;
+
+	return nFileError == Z_OK;
+}
+#endif /* LIBATARI800 */
+
 
 /* Common definitions for in-memory state save used for DREAMCAST and libatari800
  */
@@ -613,12 +724,12 @@ static gzFile mem_open(const char *name, const char *mode)
 			printf("decompress: old len %lu, new len %lu\n",
 				   (unsigned long) len - 1024, (unsigned long) unclen);
 #endif
-			free(comprmembuf);
+			Util_free(comprmembuf);
 			plainmemoff = 0;
 			return (gzFile) plainmembuf;
 		}
-		free(comprmembuf);
-		free(plainmembuf);
+		Util_free(comprmembuf);
+		Util_free(plainmembuf);
 		return NULL;
 	}
 }
@@ -630,7 +741,7 @@ static int mem_close(gzFile stream)
 	unsigned int comprlen = STATESAV_MAX_SIZE - HDR_LEN;
 	if (openmode != OM_WRITE) {
 		/* was opened for read */
-		free(plainmembuf);
+		Util_free(plainmembuf);
 		return 0;
 	}
 	comprmembuf = Util_malloc(STATESAV_MAX_SIZE);
@@ -658,26 +769,88 @@ static int mem_close(gzFile stream)
 #endif
 		}
 	}
-	free(comprmembuf);
-	free(plainmembuf);
+	Util_free(comprmembuf);
+	Util_free(plainmembuf);
 	return status;
 }
 #endif /* #ifdef MEMCOMPR */
 
 #ifdef LIBATARI800
+/* When LIBATARI800_StateSav_buffer is NULL the state is kept in PSRAM at
+   LIBATARI800_StateSav_psram instead.  Small items are gathered in
+   psram_stage, which holds the state bytes from psram_stage_off on; blocks
+   at least as large as the stage (base RAM, attributes) bypass it.
+   While LIBATARI800_StateSav_update is set the state there is updated
+   rather than rewritten: StateSav_SkipUBYTE() leaves bytes alone and all
+   writes go through the update function. */
+#define PSRAM_STAGE_SIZE 512
+static UBYTE psram_stage[PSRAM_STAGE_SIZE];
+static unsigned int psram_stage_off;
+static unsigned int psram_stage_len;
+static int psram_stage_dirty;
+static int mem_overflow;
+
+static void psram_put(unsigned int off, const UBYTE *src, size_t len)
+{
+	if (LIBATARI800_StateSav_update != NULL)
+		LIBATARI800_StateSav_update(LIBATARI800_StateSav_psram + off, src, len);
+	else
+		writepsram(LIBATARI800_StateSav_psram + off, src, len);
+}
+
+static void psram_stage_flush(void)
+{
+	if (psram_stage_dirty)
+		psram_put(psram_stage_off, psram_stage, psram_stage_len);
+	psram_stage_dirty = FALSE;
+	psram_stage_off = plainmemoff;
+	psram_stage_len = 0;
+}
+
 /* replacement for GZOPEN */
 static gzFile mem_open(const char *name, const char *mode)
 {
 	plainmembuf = (char *)LIBATARI800_StateSav_buffer;
 	plainmemoff = 0; /*HDR_LEN;*/
 	unclen = STATESAV_MAX_SIZE;
+	mem_overflow = FALSE;
+	if (plainmembuf == NULL) {
+		if (LIBATARI800_StateSav_psram == LIBATARI800_STATESAV_NO_PSRAM)
+			return NULL;
+		psram_stage_dirty = FALSE;
+		psram_stage_flush();
+		return (gzFile) psram_stage;
+	}
 	return (gzFile) plainmembuf;
 }
 
 /* replacement for GZCLOSE */
 static int mem_close(gzFile stream)
 {
-	return 0;
+	if (plainmembuf == NULL)
+		psram_stage_flush();
+	return mem_overflow ? -1 : 0;
+}
+
+/* moves past LEN bytes without writing them, see StateSav_SkipUBYTE */
+static int mem_skip(size_t len, gzFile stream)
+{
+	if (plainmembuf != NULL || LIBATARI800_StateSav_update == NULL || plainmemoff + len > unclen)
+		return FALSE;
+	psram_stage_flush();
+	plainmemoff += len;
+	psram_stage_off = plainmemoff;
+	return TRUE;
+}
+
+/* moves past LEN bytes without reading them, see StateSav_KeepUBYTE */
+static int mem_keep(size_t len, gzFile stream)
+{
+	if (plainmembuf != NULL || LIBATARI800_StateSav_changed == NULL || plainmemoff + len > unclen
+	    || LIBATARI800_StateSav_changed(LIBATARI800_StateSav_psram + plainmemoff, len))
+		return FALSE;
+	plainmemoff += len;
+	return TRUE;
 }
 
 ULONG StateSav_Tell()
@@ -691,35 +864,101 @@ ULONG StateSav_Tell()
 static size_t mem_read(void *buf, size_t len, gzFile stream)
 {
 	if (plainmemoff + len > unclen) return 0;  /* shouldn't happen */
+#ifdef LIBATARI800
+	if (plainmembuf == NULL) {
+		UBYTE *dst = (UBYTE *) buf;
+		size_t left = len;
+		while (left > 0) {
+			size_t n;
+			if (plainmemoff >= psram_stage_off && plainmemoff < psram_stage_off + psram_stage_len) {
+				n = psram_stage_off + psram_stage_len - plainmemoff;
+				if (n > left)
+					n = left;
+				memcpy(dst, psram_stage + plainmemoff - psram_stage_off, n);
+			}
+			else if (left >= PSRAM_STAGE_SIZE) {
+				n = left;
+				readpsram(LIBATARI800_StateSav_psram + plainmemoff, dst, n);
+			}
+			else {
+				psram_stage_off = plainmemoff;
+				psram_stage_len = unclen - plainmemoff;
+				if (psram_stage_len > PSRAM_STAGE_SIZE)
+					psram_stage_len = PSRAM_STAGE_SIZE;
+				readpsram(LIBATARI800_StateSav_psram + psram_stage_off, psram_stage, psram_stage_len);
+				continue;
+			}
+			dst += n;
+			left -= n;
+			plainmemoff += n;
+		}
+		return len;
+	}
+#endif
 	memcpy(buf, plainmembuf + plainmemoff, len);
 	plainmemoff += len;
 	return len;
 }
 
-static size_t psram_read(size_t offset, size_t len, gzFile stream)
+/* replacement for GZWRITE */
+static size_t mem_write(const void *buf, size_t len, gzFile stream)
 {
-	if (plainmemoff + len > unclen) return 0;  /* shouldn't happen */
-	for (size_t i = 0; i < len; ++i)
-		write8psram(offset + i, plainmembuf[plainmemoff + plainmemoff + i]);
+	if (plainmemoff + len > unclen) {
+#ifdef LIBATARI800
+		mem_overflow = TRUE;
+#endif
+		return 0;
+	}
+#ifdef LIBATARI800
+	if (plainmembuf == NULL) {
+		if (psram_stage_len + len > PSRAM_STAGE_SIZE)
+			psram_stage_flush();
+		if (len >= PSRAM_STAGE_SIZE) {
+			psram_put(plainmemoff, (const UBYTE *) buf, len);
+			plainmemoff += len;
+			psram_stage_off = plainmemoff;
+		}
+		else {
+			memcpy(psram_stage + psram_stage_len, buf, len);
+			psram_stage_len += len;
+			psram_stage_dirty = TRUE;
+			plainmemoff += len;
+		}
+		return len;
+	}
+#endif
+	memcpy(plainmembuf + plainmemoff, buf, len);
 	plainmemoff += len;
 	return len;
 }
 
-static size_t psram_write(size_t offset, size_t len, gzFile stream)
+/* Moves emulated memory kept in PSRAM (e.g. RAM under the OS ROM) into or
+   out of the state, a block at a time. */
+#define PSRAM_BLOCK_SIZE 128
+
+static size_t mem_read2psram(size_t offset, size_t len, gzFile stream)
 {
-	if (plainmemoff + len > unclen) return 0;  /* shouldn't happen */
-	for (size_t i = 0; i < len; ++i)
-		plainmembuf[plainmemoff + plainmemoff + i] = read8psram(offset + i);
-	plainmemoff += len;
+	UBYTE block[PSRAM_BLOCK_SIZE];
+	size_t done;
+	for (done = 0; done < len; done += PSRAM_BLOCK_SIZE) {
+		size_t n = len - done < PSRAM_BLOCK_SIZE ? len - done : PSRAM_BLOCK_SIZE;
+		if (mem_read(block, n, stream) == 0)
+			return 0;
+		writepsram(offset + done, block, n);
+	}
 	return len;
 }
 
-/* replacement for GZWRITE */
-static size_t mem_write(const void *buf, size_t len, gzFile stream)
+static size_t mem_write_from_psram(size_t offset, size_t len, gzFile stream)
 {
-	if (plainmemoff + len > unclen) return 0;  /* shouldn't happen */
-	memcpy(plainmembuf + plainmemoff, buf, len);
-	plainmemoff += len;
+	UBYTE block[PSRAM_BLOCK_SIZE];
+	size_t done;
+	for (done = 0; done < len; done += PSRAM_BLOCK_SIZE) {
+		size_t n = len - done < PSRAM_BLOCK_SIZE ? len - done : PSRAM_BLOCK_SIZE;
+		readpsram(offset + done, block, n);
+		if (mem_write(block, n, stream) == 0)
+			return 0;
+	}
 	return len;
 }
 
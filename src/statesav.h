@@ -14,14 +14,21 @@ void StateSav_SaveUBYTE(const UBYTE *data, int num);
 void StateSav_SaveUWORD(const UWORD *data, int num);
 void StateSav_SaveINT(const int *data, int num);
 void StateSav_SaveFNAME(const char *filename);
+int StateSav_SkipUBYTE(int num);
 
 void StateSav_ReadUBYTE(UBYTE *data, int num);
 void StateSav_ReadUWORD(UWORD *data, int num);
 void StateSav_ReadINT(int *data, int num);
 void StateSav_ReadFNAME(char *filename);
+int StateSav_KeepUBYTE(int num);
 
 #ifdef LIBATARI800
 ULONG StateSav_Tell(void);
+/* Save or read just the chips, the CPU and memory, to be read back only
+   into the same machine configuration; cartridges and drives are left
+   out. */
+int StateSav_SaveMachineState(void);
+int StateSav_ReadMachineState(void);
 #include "libatari800/statesav.h"
 /* STATESAV_MAX_SIZE defined in libatari800 include file */
 #define STATESAV_TAG(a) (LIBATARI800_StateSav_tags->a = StateSav_Tell())
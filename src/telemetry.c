@@ -0,0 +1,85 @@
+/*
+ * telemetry.c - Per-frame time breakdown
+ *
+ * Copyright (C) 2026 Atari800 development team (see DOC/CREDITS)
+ *
+ * This file is part of the Atari800 emulator project which emulates
+ * the Atari 400, 800, 800XL, 130XE, and 5200 8-bit computers.
+ *
+ * Atari800 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Atari800 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Atari800; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "config.h"
+#include <string.h>
+#include "atari.h"
+#include "cpu.h"
+#include "telemetry.h"
+
+#ifdef TELEMETRY
+
+#include <pico/time.h>
+
+static int current_phase = TELEMETRY_OTHER;
+static ULONG phase_start = 0;
+static ULONG phase_us[TELEMETRY_PHASES];
+
+static TELEMETRY_frame_t ring[TELEMETRY_RING_SIZE];
+static int ring_next = 0;
+static int ring_count = 0;
+static ULONG skipped_before = 0;
+
+int TELEMETRY_Switch(int phase)
+{
+	int previous = current_phase;
+	ULONG now = time_us_32();
+	/* unsigned difference stays right across the 32-bit wrap */
+	phase_us[previous] += now - phase_start;
+	phase_start = now;
+	current_phase = phase;
+	return previous;
+}
+
+void TELEMETRY_EndFrame(void)
+{
+	TELEMETRY_frame_t *f = &ring[ring_next];
+	int i;
+
+	TELEMETRY_Switch(TELEMETRY_OTHER);
+	f->frame = Atari800_nframes;
+	for (i = 0; i < TELEMETRY_PHASES; i++) {
+		f->us[i] = (UWORD) (phase_us[i] > 0xffff ? 0xffff : phase_us[i]);
+		phase_us[i] = 0;
+	}
+	/* a frame is at most 312 * 114 cycles */
+	f->cpu_skipped = (UWORD) (CPU_vcount_skipped + CPU_idle_skipped - skipped_before);
+	skipped_before = CPU_vcount_skipped + CPU_idle_skipped;
+	ring_next = (ring_next + 1) % TELEMETRY_RING_SIZE;
+	if (ring_count < TELEMETRY_RING_SIZE)
+		ring_count++;
+}
+
+int TELEMETRY_NumFrames(void)
+{
+	return ring_count;
+}
+
+const TELEMETRY_frame_t *TELEMETRY_GetFrame(int age)
+{
+	if (age < 0 || age >= ring_count)
+		return NULL;
+	return &ring[(ring_next + TELEMETRY_RING_SIZE - 1 - age) % TELEMETRY_RING_SIZE];
+}
+
+#endif /* TELEMETRY */
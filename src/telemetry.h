@@ -0,0 +1,57 @@
+#ifndef TELEMETRY_H_
+#define TELEMETRY_H_
+
+#include "config.h"
+#include "atari.h"
+
+/* Phases a frame's wall time is split into. Time is charged to whichever
+   phase is current, so work done by the CPU (e.g. POKEY register writes)
+   counts as CPU unless it goes through a patch (TELEMETRY_SIO). */
+enum {
+	TELEMETRY_OTHER,	/* input, devices and host code between frames */
+	TELEMETRY_CPU,		/* CPU_GO */
+	TELEMETRY_ANTIC,	/* ANTIC_Frame outside the CPU: DMA and drawing */
+	TELEMETRY_GTIA,		/* GTIA_Frame and GTIA_NewPmScanline */
+	TELEMETRY_SOUND,	/* POKEY_Frame and Sound_Update */
+	TELEMETRY_SIO,		/* SIO and device patches run by ESC_Run */
+	TELEMETRY_PRESENT,	/* on-screen overlays and PLATFORM_DisplayScreen */
+	TELEMETRY_IDLE,		/* waiting for the frame rate throttle */
+	TELEMETRY_PHASES
+};
+
+typedef struct {
+	ULONG frame;					/* Atari800_nframes of the frame */
+	UWORD us[TELEMETRY_PHASES];		/* microseconds, saturated at 65535 */
+	UWORD cpu_skipped;				/* 6502 cycles of busy-waiting and idle
+									   loops CPU_GO skipped */
+} TELEMETRY_frame_t;
+
+/* Number of most recent frames kept. */
+#define TELEMETRY_RING_SIZE 64
+
+#ifdef TELEMETRY
+
+/* Makes PHASE current and returns the previous phase, so that a callee can
+   restore it with TELEMETRY_Switch(previous). */
+int TELEMETRY_Switch(int phase);
+
+/* Closes the current frame and stores it in the ring. */
+void TELEMETRY_EndFrame(void);
+
+/* Returns the number of frames held in the ring. */
+int TELEMETRY_NumFrames(void);
+
+/* Returns the frame completed AGE frames ago (0 is the last one), or NULL
+   if the ring holds no such frame. */
+const TELEMETRY_frame_t *TELEMETRY_GetFrame(int age);
+
+#else /* TELEMETRY */
+
+#define TELEMETRY_Switch(phase) 0
+#define TELEMETRY_EndFrame()
+#define TELEMETRY_NumFrames() 0
+#define TELEMETRY_GetFrame(age) NULL
+
+#endif /* TELEMETRY */
+
+#endif /* TELEMETRY_H_ */
@@ -58,6 +58,7 @@
 #include "pal_blending.h"
 #endif /* PAL_BLENDING */
 #include "platform.h"
+#include "region.h"
 #include "rtime.h"
 #include "screen.h"
 #include "sio.h"
@@ -1272,24 +1273,24 @@ static void CartManagement(void)
 				}
 
 				if (!cart.raw) {
-					free(cart.image);
+					Util_free(cart.image);
 					UI_driver->fMessage("Not an image file", 1);
 					break;
 				}
 
 				cart.type = UI_SelectCartType(kb);
 				if (cart.type == CARTRIDGE_NONE) {
-					free(cart.image);
+					Util_free(cart.image);
 					break;
 				}
 
 				if (!UI_driver->fGetSaveFilename(cart_filename, UI_atari_files_dir, UI_n_atari_files_dir)) {
-					free(cart.image);
+					Util_free(cart.image);
 					break;
 				}
 
 				error = CARTRIDGE_WriteImage(cart_filename, cart.type, cart.image, kb << 10, FALSE, -1);
-				free(cart.image);
+				Util_free(cart.image);
 				if (error)
 					CantSave(cart_filename);
 				else
@@ -1316,18 +1317,18 @@ static void CartManagement(void)
 				}
 
 				if (cart.raw) {
-					free(cart.image);
+					Util_free(cart.image);
 					UI_driver->fMessage("Not a CART file", 1);
 					break;
 				}
 
 				if (!UI_driver->fGetSaveFilename(cart_filename, UI_atari_files_dir, UI_n_atari_files_dir)) {
-					free(cart.image);
+					Util_free(cart.image);
 					break;
 				}
 
 				error = CARTRIDGE_WriteImage(cart_filename, CARTRIDGE_UNKNOWN, cart.image, cart.size << 10, TRUE, -1);
-				free(cart.image);
+				Util_free(cart.image);
 				if (error)
 					CantSave(cart_filename);
 				else
@@ -2241,6 +2242,46 @@ static void SystemROMSettings(void)
 	}
 }
 
+#ifdef HEAP_STATS
+static void MemoryUsage(void)
+{
+	/* totals, FatFS, the regions, a heading and the tags with the highest
+	   peaks */
+	enum { LINES = 20, TAGS = LINES - 6, WIDTH = 39 };
+	static char info[LINES * WIDTH + 1];
+	const Util_heap_tag_t *top[TAGS];
+	const Util_heap_tag_t *t;
+	Util_heap_t heap;
+	ULONG region_used;
+	char *p = info;
+	int n = 0;
+	int i;
+	Util_HeapStats(&heap);
+	for (i = 0; (t = Util_HeapTag(i)) != NULL; i++) {
+		/* insertion sort of the TAGS highest peaks */
+		int j;
+		if (n == TAGS && top[TAGS - 1]->peak >= t->peak)
+			continue;
+		j = n < TAGS ? n++ : TAGS - 1;
+		for (; j > 0 && top[j - 1]->peak < t->peak; j--)
+			top[j] = top[j - 1];
+		top[j] = t;
+	}
+	p += sprintf(p, "Used %lu KB, peak %lu KB, %lu blocks", (unsigned long) heap.live >> 10, (unsigned long) heap.peak >> 10, (unsigned long) heap.count) + 1;
+	p += sprintf(p, "Free %lu KB, %lu KB at the top", (unsigned long) heap.free >> 10, (unsigned long) heap.top_free >> 10) + 1;
+	p += sprintf(p, "FatFS names %lu bytes, peak %lu", (unsigned long) heap.fatfs_live, (unsigned long) heap.fatfs_peak) + 1;
+	for (i = 0, region_used = 0; i < REGION_COUNT; i++)
+		region_used += REGION_stats.used[i];
+	p += sprintf(p, "Regions %lu of %lu KB, peak %lu KB", (unsigned long) region_used >> 10, (unsigned long) REGION_stats.arena >> 10, (unsigned long) REGION_stats.peak >> 10) + 1;
+	*p++ = '\0';
+	p += sprintf(p, "%-22s %7s %7s", "Allocated by", "Now", "Peak") + 1;
+	for (i = 0; i < n; i++)
+		p += sprintf(p, "%-22.22s %7lu %7lu", top[i]->tag, (unsigned long) top[i]->live, (unsigned long) top[i]->peak) + 1;
+	*p = '\n';
+	UI_driver->fInfoScreen("Memory Usage", info);
+}
+#endif /* HEAP_STATS */
+
 static void AtariSettings(void)
 {
 #ifdef XEP80_EMULATION
@@ -2274,6 +2315,9 @@ static void AtariSettings(void)
 		UI_MENU_SUBMENU(11, "Host device settings"),
 		UI_MENU_SUBMENU(13, "System ROM settings"),
 		UI_MENU_SUBMENU(14, "Configure directories"),
+#ifdef HEAP_STATS
+		UI_MENU_ACTION(20, "Memory usage"),
+#endif
 #ifndef DREAMCAST
 		UI_MENU_ACTION(15, "Save configuration file"),
 		UI_MENU_CHECK(16, "Save configuration on exit:"),
@@ -2369,6 +2413,11 @@ static void AtariSettings(void)
 		case 19:
 			BINLOAD_slow_xex_loading = !BINLOAD_slow_xex_loading;
 			break;
+#ifdef HEAP_STATS
+		case 20:
+			MemoryUsage();
+			break;
+#endif
 		default:
 			ESC_UpdatePatches();
 			return;
@@ -2433,8 +2482,8 @@ static int ChooseVideoResolution(int current_res)
 	menu_array[i].suffix = NULL;
 
 	current_res = UI_driver->fSelect(NULL, UI_SELECT_POPUP, current_res, menu_array, NULL);
-	free(res_strings);
-	free(menu_array);
+	Util_free(res_strings);
+	Util_free(menu_array);
 	return current_res;
 }
 
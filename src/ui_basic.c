@@ -45,6 +45,7 @@
 #include "log.h"
 #include "memory.h"
 #include "platform.h"
+#include "region.h"
 #include "screen.h" /* Screen_atari */
 #include "ui.h"
 #include "util.h"
@@ -813,23 +814,167 @@ int Atari_ReadDir(char *fullpath, char *filename, int *isdir, int *ishidden,
 
 #define DO_DIR
 
+#else /* defined(PS2) */
+
+/* FatFS on the SD card.  f_readdir() does not return "." and "..", so ".."
+   is reported first in every directory but the root. */
+
+static DIR dir_handle;
+static int dir_state = 0; /* 0 = closed, 1 = ".." pending, 2 = reading */
+
+static int BasicUIOpenDir(const char *dirname)
+{
+	const char *p;
+	if (f_opendir(&dir_handle, dirname) != FR_OK)
+		return FALSE;
+	dir_state = 2;
+	for (p = dirname; *p != '\0'; p++) {
+		if (*p != '/' && *p != '\\') {
+			dir_state = 1;
+			break;
+		}
+	}
+	return TRUE;
+}
+
+static int BasicUIReadDir(char *filename, int *isdir, int *ishidden)
+{
+	FILINFO fno;
+	if (dir_state == 1) {
+		strcpy(filename, "..");
+		*isdir = TRUE;
+		*ishidden = FALSE;
+		dir_state = 2;
+		return TRUE;
+	}
+	if (f_readdir(&dir_handle, &fno) != FR_OK || fno.fname[0] == '\0') {
+		f_closedir(&dir_handle);
+		dir_state = 0;
+		return FALSE;
+	}
+	strcpy(filename, fno.fname);
+	*isdir = (fno.fattrib & AM_DIR) != 0;
+	*ishidden = (fno.fattrib & AM_HID) != 0 || fno.fname[0] == '.';
+	return TRUE;
+}
+
+#define DO_DIR
+
 #endif /* defined(PS2) */
 
 
 #ifdef DO_DIR
 
-static const char **filenames;
-#define FILENAMES_INITIAL_SIZE 256 /* preallocate 1 KB */
+/* Names are packed into blocks of FILENAMES_BLOCK_SIZE bytes, which are
+   freed together, instead of being strdup'ed one by one.  The filenames
+   array is allocated once the number of names is known. */
+#define FILENAMES_BLOCK_SIZE 4096
+
+typedef struct FilenamesBlock {
+	struct FilenamesBlock *next;
+	size_t used;
+	size_t size;
+	/* followed by size bytes of names */
+} FilenamesBlock;
+
+static FilenamesBlock *blocks_head = NULL;
+static FilenamesBlock *blocks_tail = NULL;
+
+/* the blocks and the filenames array are in REGION_UI */
+static const char **filenames = NULL;
 static int n_filenames;
+/* filenames[0] to filenames[n_sorted - 1] are in FilenamesCmp() order */
+static int n_sorted;
+
+/* Returns NULL if there is no room for LEN more bytes of names. */
+static char *FilenamesAlloc(size_t len)
+{
+	FilenamesBlock *block = blocks_tail;
+	char *p;
+	if (block == NULL || block->used + len > block->size) {
+		size_t size = len > FILENAMES_BLOCK_SIZE ? len : FILENAMES_BLOCK_SIZE;
+		block = (FilenamesBlock *) REGION_Alloc(REGION_UI, NULL, sizeof(FilenamesBlock) + size, "FilenamesAlloc");
+		if (block == NULL)
+			return NULL;
+		block->next = NULL;
+		block->used = 0;
+		block->size = size;
+		if (blocks_tail != NULL)
+			blocks_tail->next = block;
+		else
+			blocks_head = block;
+		blocks_tail = block;
+	}
+	p = (char *) (block + 1) + block->used;
+	block->used += len;
+	return p;
+}
+
+/* Directories are added as [dir].  Returns FALSE if there is no room
+   for the name. */
+static int FilenamesAdd(const char *filename, int isdir)
+{
+	size_t len = strlen(filename);
+	char *p = FilenamesAlloc(len + (isdir ? 3 : 1));
+	if (p == NULL)
+		return FALSE;
+	if (isdir) {
+		*p++ = '[';
+		memcpy(p, filename, len);
+		strcpy(p + len, "]");
+	}
+	else
+		memcpy(p, filename, len + 1);
+	n_filenames++;
+	return TRUE;
+}
 
-/* filename must be malloc'ed or strdup'ed */
-static void FilenamesAdd(const char *filename)
+/* Frees the last block of names.  Returns FALSE if there is none. */
+static int FilenamesDropBlock(void)
 {
-	if (n_filenames >= FILENAMES_INITIAL_SIZE && (n_filenames & (n_filenames - 1)) == 0) {
-		/* n_filenames is a power of two: allocate twice as much */
-		filenames = (const char **) Util_realloc((void *) filenames, 2 * n_filenames * sizeof(const char *));
+	FilenamesBlock *block = blocks_head;
+	const char *p;
+	const char *end;
+	if (block == NULL)
+		return FALSE;
+	if (block == blocks_tail)
+		blocks_head = NULL;
+	else {
+		while (block->next != blocks_tail)
+			block = block->next;
+		block->next = NULL;
+	}
+	for (p = (const char *) (blocks_tail + 1), end = p + blocks_tail->used; p < end; p += strlen(p) + 1)
+		n_filenames--;
+	REGION_Release(blocks_tail);
+	blocks_tail = blocks_head == NULL ? NULL : block;
+	if (n_sorted > n_filenames)
+		n_sorted = n_filenames;
+	return TRUE;
+}
+
+/* Fills the filenames array with the names added so far, in order.
+   Without room for the array, the last names are dropped until there is. */
+static void FilenamesIndex(void)
+{
+	static const char *no_filenames[1] = { NULL };
+	const FilenamesBlock *block;
+	int i = 0;
+	while ((filenames = (const char **) REGION_Alloc(REGION_UI, NULL, (n_filenames + 1) * sizeof(const char *), "FilenamesIndex")) == NULL) {
+		if (!FilenamesDropBlock()) {
+			filenames = no_filenames;
+			n_filenames = n_sorted = 0;
+			return;
+		}
+	}
+	for (block = blocks_head; block != NULL; block = block->next) {
+		const char *p = (const char *) (block + 1);
+		const char *end = p + block->used;
+		while (p < end) {
+			filenames[i++] = p;
+			p += strlen(p) + 1;
+		}
 	}
-	filenames[n_filenames++] = filename;
 }
 
 static int FilenamesCmp(const char *filename1, const char *filename2)
@@ -880,13 +1025,42 @@ static void FilenamesSort(const char **start, const char **end)
 
 static void FilenamesFree(void)
 {
-	while (n_filenames > 0)
-		free((void *) filenames[--n_filenames]);
-	free((void *) filenames);
+	REGION_Free(REGION_UI);
+	blocks_head = blocks_tail = NULL;
+	filenames = NULL;
+	n_filenames = 0;
+}
+
+/* Returns the index of filename, or 0 if it is not listed. */
+static int FilenamesFind(const char *filename)
+{
+	int lo = 0;
+	int hi = n_sorted;
+	int i;
+	while (lo < hi) {
+		int mid = (lo + hi) >> 1;
+		if (FilenamesCmp(filenames[mid], filename) < 0)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	/* FilenamesCmp() ignores case */
+	for (i = lo; i < n_sorted; i++) {
+		if (FilenamesCmp(filenames[i], filename) != 0)
+			break;
+		if (strcmp(filenames[i], filename) == 0)
+			return i;
+	}
+	for (i = n_sorted; i < n_filenames; i++)
+		if (strcmp(filenames[i], filename) == 0)
+			return i;
+	return 0;
 }
 
 static void GetDirectory(const char *directory)
 {
+	int full = FALSE;
+	int added;
 #ifdef __DJGPP__
 	unsigned short s_backup = _djstat_flags;
 	_djstat_flags = _STAT_INODE | _STAT_EXEC_EXT | _STAT_EXEC_MAGIC | _STAT_DIRSIZE |
@@ -894,43 +1068,29 @@ static void GetDirectory(const char *directory)
 	/* we do not need any of those 'hard-to-get' informations */
 #endif	/* DJGPP */
 
-	filenames = (const char **) Util_malloc(FILENAMES_INITIAL_SIZE * sizeof(const char *));
 	n_filenames = 0;
 
 	if (BasicUIOpenDir(directory)) {
 		char filename[FILENAME_MAX];
 		int isdir, ishidden;
 
+		/* once a name does not fit, the rest are read only to reach the
+		   end of the directory, which closes it */
 		while (BasicUIReadDir(filename, &isdir, &ishidden)) {
-			char *filename2;
-
-			if (filename[0] == '\0' ||
+			if (full || filename[0] == '\0' ||
 				(filename[0] == '.' && filename[1] == '\0') ||
 				(ishidden && !UI_show_hidden_files))
 				continue;
 
-			if (isdir) {
-				/* add directories as [dir] */
-				size_t len = strlen(filename);
-				filename2 = (char *) Util_malloc(len + 3);
-				memcpy(filename2 + 1, filename, len);
-				filename2[0] = '[';
-				filename2[len + 1] = ']';
-				filename2[len + 2] = '\0';
-			}
-			else
-				filename2 = Util_strdup(filename);
-
-			FilenamesAdd(filename2);
+			full = !FilenamesAdd(filename, isdir);
 		}
-
-		FilenamesSort(filenames, filenames + n_filenames);
 	}
 	else {
 		Log_print("Error opening '%s' directory", directory);
 	}
+	n_sorted = n_filenames;
 #ifdef PS2
-	FilenamesAdd(Util_strdup("[mc0:]"));
+	FilenamesAdd("mc0:", TRUE);
 #endif
 #ifdef DOS_DRIVES
 	/* in DOS/Windows, add all existing disk letters */
@@ -942,7 +1102,7 @@ static void GetDirectory(const char *directory)
 			if (drive_mask & 1) {
 				static char drive2[5] = "[C:]";
 				drive2[1] = letter;
-				FilenamesAdd(Util_strdup(drive2));
+				FilenamesAdd(drive2, FALSE);
 			}
 			drive_mask >>= 1;
 		}
@@ -958,12 +1118,17 @@ static void GetDirectory(const char *directory)
 			{
 				static char drive2[5] = "[C:]";
 				drive2[1] = letter;
-				FilenamesAdd(Util_strdup(drive2));
+				FilenamesAdd(drive2, FALSE);
 			}
 		}
 #endif /* HAVE_WINDOWS_H */
 	}
 #endif /* DOS_DRIVES */
+	added = n_filenames;
+	FilenamesIndex();
+	if (full || n_filenames < added)
+		Log_print("Only %d entries of '%s' fit in memory", n_filenames, directory);
+	FilenamesSort(filenames, filenames + n_sorted);
 #ifdef __DJGPP__
 	_djstat_flags = s_backup;	/* restore the original state */
 #endif
@@ -1045,14 +1210,8 @@ static int FileSelector(char *path, int select_dir, char pDirectories[][FILENAME
 			}
 		}
 
-		if (highlighted_file[0] != '\0') {
-			for (i = 0; i < n_filenames; i++) {
-				if (strcmp(filenames[i], highlighted_file) == 0) {
-					index = i;
-					break;
-				}
-			}
-		}
+		if (highlighted_file[0] != '\0')
+			index = FilenamesFind(highlighted_file);
 
 		for (;;) {
 			int seltype;
@@ -1313,7 +1472,7 @@ static int BasicUIEditString(const char *title, char *string, int size)
 
 static int BasicUIGetSaveFilename(char *filename, char directories[][FILENAME_MAX], int n_directories)
 {
-#ifdef DO_DIR
+#if defined(DO_DIR)
 	return EditFilename("Save as ([Tab] = directory locator)", filename, directories, n_directories);
 #else
 	return EditFilename("Save as", filename, directories, n_directories);
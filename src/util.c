@@ -35,6 +35,8 @@
 #include <stdlib.h>
 #include <string.h>
 #include <errno.h>
+#include <malloc.h> /* mallinfo() */
+#include <unistd.h> /* sbrk() */
 #ifdef HAVE_SYS_STAT_H
 #include <sys/stat.h>
 #endif
@@ -297,6 +299,110 @@ double Util_round(double x)
 }
 #endif
 
+#ifdef HEAP_STATS
+
+/* Tags seen so far. The last entry takes the blocks of the tags that do not
+   fit. */
+#define HEAP_TAGS 48
+/* Blocks accounted at once. */
+#define HEAP_BLOCKS 96
+
+static Util_heap_tag_t heap_tags[HEAP_TAGS];
+static int heap_n_tags = 0;
+static struct {
+	void *ptr;
+	size_t size;
+	int tag;
+} heap_blocks[HEAP_BLOCKS];
+static int heap_n_blocks = 0;
+static Util_heap_t heap;
+
+static int HeapFindTag(const char *from)
+{
+	int i;
+	for (i = 0; i < heap_n_tags; i++) {
+		if (heap_tags[i].tag == from || strcmp(heap_tags[i].tag, from) == 0)
+			return i;
+	}
+	if (i == HEAP_TAGS)
+		return HEAP_TAGS - 1;
+	heap_tags[i].tag = i == HEAP_TAGS - 1 ? "other" : from;
+	heap_n_tags++;
+	return i;
+}
+
+static void HeapAdd(void *ptr, size_t size, const char *from)
+{
+	Util_heap_tag_t *t;
+	if (heap_n_blocks == HEAP_BLOCKS) {
+		heap.untracked++;
+		return;
+	}
+	heap_blocks[heap_n_blocks].ptr = ptr;
+	heap_blocks[heap_n_blocks].size = size;
+	heap_blocks[heap_n_blocks].tag = HeapFindTag(from);
+	t = &heap_tags[heap_blocks[heap_n_blocks++].tag];
+	t->live += size;
+	t->count++;
+	if (t->live > t->peak)
+		t->peak = t->live;
+	heap.live += size;
+	heap.count++;
+	if (heap.live > heap.peak)
+		heap.peak = heap.live;
+}
+
+static void HeapRemove(void *ptr)
+{
+	int i;
+	/* blocks tend to be freed in the reverse order */
+	for (i = heap_n_blocks; --i >= 0; ) {
+		if (heap_blocks[i].ptr == ptr) {
+			Util_heap_tag_t *t = &heap_tags[heap_blocks[i].tag];
+			t->live -= heap_blocks[i].size;
+			t->count--;
+			heap.live -= heap_blocks[i].size;
+			heap.count--;
+			heap_blocks[i] = heap_blocks[--heap_n_blocks];
+			return;
+		}
+	}
+}
+
+const Util_heap_tag_t *Util_HeapTag(int i)
+{
+	return i >= 0 && i < heap_n_tags ? &heap_tags[i] : NULL;
+}
+
+void Util_HeapStats(Util_heap_t *h)
+{
+	*h = heap;
+	h->free = Util_HeapFree(&h->top_free);
+#if FF_USE_LFN == 3
+	h->fatfs_live = ff_mem_live;
+	h->fatfs_peak = ff_mem_peak;
+#else
+	h->fatfs_live = h->fatfs_peak = 0;
+#endif
+}
+
+#endif /* HEAP_STATS */
+
+/* the heap grows from the end of .bss up to __StackLimit */
+extern char __StackLimit;
+
+size_t Util_HeapFree(size_t *top_free)
+{
+	struct mallinfo mi = mallinfo();
+	char *brk = (char *) sbrk(0);
+	size_t top = brk < &__StackLimit ? &__StackLimit - brk : 0;
+	/* keepcost is the free chunk at the top of the arena, which the
+	   unclaimed space above it extends */
+	if (top_free != NULL)
+		*top_free = mi.keepcost + top;
+	return mi.fordblks + top;
+}
+
 void *Util_malloc(size_t size, const char* from)
 {
 	printf("Util_malloc(%d, '%s')", size, from);
@@ -306,18 +412,27 @@ void *Util_malloc(size_t size, const char* from)
 		Atari800_ErrExit(); // TODO: ??
 		exit(1);
 	}
+#ifdef HEAP_STATS
+	HeapAdd(ptr, size, from);
+#endif
 	return ptr;
 }
 
 void *Util_realloc(void *ptr, size_t size, const char* from)
 {
 	printf("Util_realloc(%d, '%s')", size, from);
+#ifdef HEAP_STATS
+	HeapRemove(ptr);
+#endif
 	ptr = realloc(ptr, size);
 	if (ptr == NULL) {
 		printf("Fatal error: out of memory\n");
 		Atari800_ErrExit();
 		exit(1);
 	}
+#ifdef HEAP_STATS
+	HeapAdd(ptr, size, from);
+#endif
 	return ptr;
 }
 
@@ -330,6 +445,16 @@ char *Util_strdup(const char *s, const char* from)
 	return ptr;
 }
 
+void Util_free(void *ptr)
+{
+	if (ptr == NULL)
+		return;
+#ifdef HEAP_STATS
+	HeapRemove(ptr);
+#endif
+	free(ptr);
+}
+
 void Util_splitpath(const char *path, char *dir_part, char *file_part)
 {
 	const char *p;
@@ -523,7 +648,7 @@ FIL *Util_uniqopen(char *filename, const char *mode)
 	for (no = 0; no < 1000000; no++) {
 		snprintf(filename, FILENAME_MAX, "a8%06d", no);
 		if (!Util_fileexists(filename)) {
-			FIL * fp = Util_malloc(sizeof(FIL), filename);
+			FIL * fp = Util_malloc(sizeof(FIL), "Util_uniqopen");
 			return fopen(fp, filename, FA_READ);
 		}
 	}
@@ -31,7 +31,7 @@ inline static int stricmp(const char* s1, const char* s2) {
       char c1 = tolower(s1[i]);
       char c2 = tolower(s2[i]);
       if (c1 > c2) return 1;
-      if (c2 < c2) return -1;
+      if (c1 < c2) return -1;
    }
    return 0;
 }
@@ -127,6 +127,43 @@ void *Util_realloc(void *ptr, size_t size, const char* from);
 /* strdup() with out-of-memory checking. Never returns NULL. */
 char *Util_strdup(const char *s, const char* from);
 
+/* free() for memory from the functions above. */
+void Util_free(void *ptr);
+
+/* Returns the bytes malloc() can still hand out, in all free blocks, and
+   if TOP_FREE is not NULL stores those at the top of the heap there. */
+size_t Util_HeapFree(size_t *top_free);
+
+#ifdef HEAP_STATS
+/* Blocks allocated by the functions above under one FROM tag, which is
+   why FROM must be a string constant. Memory released with plain free()
+   stays counted. */
+typedef struct {
+	const char *tag;
+	size_t live;	/* bytes allocated now */
+	size_t peak;	/* most bytes allocated at once */
+	size_t count;	/* blocks allocated now */
+} Util_heap_tag_t;
+
+typedef struct {
+	size_t live;	/* bytes allocated now, all tags */
+	size_t peak;	/* most bytes allocated at once, all tags */
+	size_t count;	/* blocks allocated now */
+	size_t untracked;	/* blocks allocated while too many were live to count them */
+	size_t free;	/* bytes left to malloc(), in all free blocks */
+	size_t top_free;	/* of those, the ones at the top of the heap, which
+	                   	   one malloc() can get at least */
+	size_t fatfs_live;	/* bytes of the FatFS name buffers, which do not */
+	size_t fatfs_peak;	/* go through Util_malloc() */
+} Util_heap_t;
+
+/* Returns the accounting of the I-th tag seen, or NULL past the last one. */
+const Util_heap_tag_t *Util_HeapTag(int i);
+
+/* Fills HEAP with the totals and the state of the heap. */
+void Util_HeapStats(Util_heap_t *heap);
+#endif /* HEAP_STATS */
+
 
 /* Filenames ------------------------------------------------------------- */
 
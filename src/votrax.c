@@ -439,7 +439,7 @@ int Votrax_Start(void *sound_interface)
 void Votrax_Stop(void)
 {
 	if ( votraxsc01_locals.lpBuffer ) {
-		free(votraxsc01_locals.lpBuffer);
+		Util_free(votraxsc01_locals.lpBuffer);
 		votraxsc01_locals.lpBuffer = NULL;
 	}
 }
@@ -48,8 +48,9 @@ enum {
 
 int XEP80_FONTS_inited = FALSE;
 
-/* Internal character set of the NS405 chip */
-UBYTE internal_font[XEP80_FONTS_CHAR_COUNT / 2][XEP80_MAX_CHAR_HEIGHT][XEP80_CHAR_WIDTH] = {
+/* Internal character set of the NS405 chip, only read when the fonts are
+   built, so it stays in flash */
+static const UBYTE internal_font[XEP80_FONTS_CHAR_COUNT / 2][XEP80_MAX_CHAR_HEIGHT][XEP80_CHAR_WIDTH] = {
 	{{0,0,0,0,0,0,0}, /* 00 */
 	 {0,0,1,0,0,1,0},
 	 {0,0,1,0,0,1,0},
@@ -0,0 +1,98 @@
+#!/bin/sh
+# Regenerates the table of known cartridge images in src/cartdb.c.
+#
+# The table always holds the BASIC images that come with the emulator;
+# the images in the CART files given as arguments are added to them:
+#
+#	util/cartdb.sh [cartfile...]
+#
+# Run it from the top directory of the sources.  The name of each CART
+# file, without its directory and extension, is the comment of its entry.
+
+set -e
+
+DB=src/cartdb.c
+TMP=`mktemp -d`
+trap 'rm -rf "$TMP"' EXIT
+
+if [ ! -f $DB ]; then
+	echo "run $0 from the top directory of the sources" >&2
+	exit 1
+fi
+
+# CRC-32 of a file, as CRC32_Update() computes it: gzip stores it,
+# least significant byte first, in the 4 bytes before the size.
+crc32() {
+	gzip -c < "$1" | tail -c 8 | od -An -tx1 -N4 |
+		awk '{ printf "0x%s%s%s%s\n", $4, $3, $2, $1 }'
+}
+
+# "kb name" of cartridge type $1, from src/cartridge_info.*
+cart_type() {
+	name=`awk -v t=$1 '$2 == "=" && $3 + 0 == t && $1 ~ /^CARTRIDGE_/ { print $1; exit }' src/cartridge_info.h`
+	kb=`awk -v t=$1 '/^[ \t]*{ "/ && n++ == t { sub(/.*",[ \t]*/, ""); print $1 + 0; exit }' src/cartridge_info.c`
+	if [ -z "$name" ] || [ -z "$kb" ] || [ "$kb" = 0 ]; then
+		return 1
+	fi
+	echo "$kb $name"
+}
+
+# Adds the entry of image $1 of type $2 called $3.
+entry() {
+	set -- "$1" `cart_type $2` "$3"
+	size=`wc -c < "$1"`
+	if [ $size -ne `expr $2 \* 1024` ]; then
+		echo "$4: $size bytes, expected $2 KB, skipped" >&2
+		return
+	fi
+	printf '%s %4d %s %s\n' `crc32 "$1"` $2 $3 "$4" >> "$TMP/entries"
+}
+
+: > "$TMP/entries"
+
+# The built-in Altirra BASIC, taken out of its C array.
+sed -n '/^{/,/^};/p' src/roms/altirra_basic.c | tr -cs '0-9a-fx' '\n' |
+	sed -n 's/^0x//p' | tr -d '\n' | xxd -r -p > "$TMP/altirra.rom"
+entry "$TMP/altirra.rom" 1 "Altirra BASIC 1.58"
+entry data/ATARIBAS.ROM 1 "Atari BASIC revision C"
+
+for car in "$@"; do
+	if [ "`head -c 4 "$car"`" != CART ]; then
+		echo "$car: not a CART file, skipped" >&2
+		continue
+	fi
+	type=`od -An -tu1 -j4 -N4 "$car" | awk '{ print (($1 * 256 + $2) * 256 + $3) * 256 + $4 }'`
+	if ! cart_type $type > /dev/null; then
+		echo "$car: unknown type $type, skipped" >&2
+		continue
+	fi
+	tail -c +17 "$car" > "$TMP/image"
+	name=`basename "$car"`
+	entry "$TMP/image" $type "${name%.*}"
+done
+
+# Sorted by CRC, then size, as CARTDB_Lookup() searches it; the last
+# entry without a comma.
+sort -k1,1 -k2,2n "$TMP/entries" | awk '
+	{ line[NR] = $0 }
+	END {
+		for (i = 1; i <= NR; i++) {
+			split(line[i], f, " ")
+			name = line[i]
+			sub(/^[^ ]+ +[^ ]+ +[^ ]+ /, "", name)
+			printf "\t{ %s, %4d, %s }%s\t/* %s */\n", f[1], f[2], f[3], i < NR ? "," : "", name
+		}
+	}' > "$TMP/table"
+
+# Replace the lines between "} known[] = {" and "};".
+awk -v table="$TMP/table" '
+	skip && /^};/ { skip = 0 }
+	!skip { print }
+	/^} known\[\] = {/ {
+		while ((getline line < table) > 0)
+			print line
+		skip = 1
+	}
+' $DB > "$TMP/cartdb.c"
+cp "$TMP/cartdb.c" $DB
+echo "`wc -l < "$TMP/table"` entries written to $DB"
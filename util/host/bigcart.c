@@ -0,0 +1,254 @@
+/*
+ * bigcart.c - checks cartridges too big for their PSRAM area, and decoding
+ *
+ * Copyright (C) 2026 Atari800 development team (see DOC/CREDITS)
+ *
+ * This file is part of the Atari800 emulator project which emulates
+ * the Atari 400, 800, 800XL, 130XE, and 5200 8-bit computers.
+ *
+ * Atari800 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Atari800 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Atari800; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/* Inserts a 4 MB MegaCart with rewind on, and checks that:
+   - the image is kept in PSRAM, over the rewind ring, and its banks read
+     back right without reading the card;
+   - no rewind snapshots are taken while it is inserted, and they are
+     again once it is removed;
+   - inserting it again copies it from the card once more, since the
+     rewind ring wrote over it.
+   Then inserts a 128 KB ATRAX cartridge, decodes it again with random
+   address and data line maps, checks the result against a decoding done
+   here, and prints the PSRAM traffic of a decode with the time the SPI
+   bus takes for it (see rewind.c):
+
+	util/host/build.sh util/host/bigcart.c && $WORK/test
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "libatari800/libatari800.h"
+#include "cartcache.h"
+#include "cartridge.h"
+#include "ff.h"
+#include "rewind.h"
+#undef printf
+
+int printf(const char *format, ...);
+
+extern bool PSRAM_AVAILABLE;
+extern unsigned long host_psram_wr, host_psram_rd, host_psram_wtx, host_psram_rtx;
+extern unsigned long host_disk_read_calls;
+
+#define CART_HEADER 16
+#define MEGA_SIZE (4 << 20)
+#define ATRAX_SIZE 0x20000
+
+static FATFS fs;
+static input_template_t input;
+static UBYTE buf[CART_HEADER + MEGA_SIZE];
+static int failed = FALSE;
+
+static UBYTE MegaByte(ULONG i)
+{
+	return (UBYTE) (i * 13 ^ i >> 8 ^ i >> 16);
+}
+
+/* Writes a CART file of TYPE with the SIZE bytes at buf + CART_HEADER. */
+static int PutCart(char const *name, int type, ULONG size)
+{
+	FIL f;
+	UINT written = 0;
+	ULONG sum = 0;
+	ULONG i;
+	for (i = 0; i < size; i++)
+		sum += buf[CART_HEADER + i];
+	memset(buf, 0, CART_HEADER);
+	memcpy(buf, "CART", 4);
+	buf[7] = type;
+	buf[8] = (UBYTE) (sum >> 24);
+	buf[9] = (UBYTE) (sum >> 16);
+	buf[10] = (UBYTE) (sum >> 8);
+	buf[11] = (UBYTE) sum;
+	if (f_open(&f, name, FA_WRITE | FA_CREATE_ALWAYS) != FR_OK)
+		return FALSE;
+	f_write(&f, buf, CART_HEADER + size, &written);
+	f_close(&f);
+	return written == CART_HEADER + size;
+}
+
+static void Fail(char const *what)
+{
+	printf("FAIL: %s\n", what);
+	failed = TRUE;
+}
+
+/* Runs FRAMES frames taking a snapshot each. */
+static void Run(int frames)
+{
+	int i;
+	REWIND_interval = 1;
+	for (i = 0; i < frames; i++) {
+		libatari800_next_frame(&input);
+		REWIND_Frame();
+	}
+	REWIND_interval = 0;
+}
+
+/* Checks some banks of the MegaCart, which must be read from PSRAM. */
+static void CheckMega(char const *when)
+{
+	static int const banks[] = { 0, 1, 255, 256, 300, 511 };
+	static UBYTE bank[CARTCACHE_BANK_SIZE];
+	unsigned long calls = host_disk_read_calls;
+	unsigned int i;
+	for (i = 0; i < sizeof(banks) / sizeof(banks[0]); i++) {
+		ULONG offset = (ULONG) banks[i] * CARTCACHE_BANK_SIZE;
+		ULONG j;
+		CARTCACHE_Read(&CARTRIDGE_main, offset, bank, CARTCACHE_BANK_SIZE);
+		for (j = 0; j < CARTCACHE_BANK_SIZE; j++)
+			if (bank[j] != MegaByte(offset + j))
+				break;
+		if (j < CARTCACHE_BANK_SIZE) {
+			printf("FAIL: %s: bank %d differs at %lu\n", when, banks[i], (unsigned long) j);
+			failed = TRUE;
+			return;
+		}
+	}
+	if (host_disk_read_calls != calls) {
+		printf("FAIL: %s: the banks were read from the card\n", when);
+		failed = TRUE;
+	}
+	else
+		printf("%s: banks read right from PSRAM\n", when);
+}
+
+/* Decodes the ATRAX image in buf as the cartridge code does, with random
+   maps, and compares the cartridge's. */
+static void CheckDecode(void)
+{
+	static UBYTE want[ATRAX_SIZE];
+	static UBYTE got[ATRAX_SIZE];
+	unsigned int addr[17];
+	unsigned char data[8];
+	int n;
+	ULONG i;
+	for (n = 0; n < 17; n++)
+		addr[n] = 1 << n;
+	for (n = 16; n > 0; n--) {
+		int k = rand() % (n + 1);
+		unsigned int t = addr[n];
+		addr[n] = addr[k];
+		addr[k] = t;
+	}
+	for (n = 0; n < 8; n++)
+		data[n] = 1 << n;
+	for (n = 7; n > 0; n--) {
+		int k = rand() % (n + 1);
+		unsigned char t = data[n];
+		data[n] = data[k];
+		data[k] = t;
+	}
+	for (i = 0; i < ATRAX_SIZE; i++) {
+		ULONG rom_addr = 0;
+		UBYTE byte;
+		UBYTE value = 0;
+		for (n = 0; n < 17; n++)
+			if (i & (1 << n))
+				rom_addr |= addr[n];
+		byte = buf[CART_HEADER + rom_addr];
+		for (n = 0; n < 8; n++)
+			if (byte & (1 << n))
+				value |= data[n];
+		want[i] = value;
+	}
+	host_psram_wr = host_psram_rd = host_psram_wtx = host_psram_rtx = 0;
+	if (!CARTCACHE_Decode(&CARTRIDGE_main, addr, data)) {
+		Fail("ATRAX image not decoded");
+		return;
+	}
+	printf("decode of %d KB: PSRAM written %lu bytes in %lu transfers, read %lu bytes in %lu, %.2f ms on the bus\n",
+	       ATRAX_SIZE >> 10, host_psram_wr, host_psram_wtx, host_psram_rd, host_psram_rtx,
+	       (((host_psram_wr + host_psram_rd) * 8 + (host_psram_wtx + host_psram_rtx) * 41) / 94.5
+	        + host_psram_wtx + host_psram_rtx) / 1e3);
+	CARTCACHE_Read(&CARTRIDGE_main, 0, got, ATRAX_SIZE);
+	if (memcmp(got, want, ATRAX_SIZE) != 0)
+		Fail("decoded ATRAX image differs");
+}
+
+int main(int argc, char **argv)
+{
+	static BYTE work[4096];
+	MKFS_PARM opt = { FM_FAT32, 0, 0, 0, 0 };
+	char *args[] = { "-xl", NULL };
+	unsigned long calls;
+	ULONG i;
+	int n;
+
+	f_mkfs("", &opt, work, sizeof(work));
+	f_mount(&fs, "", 1);
+	libatari800_init(-1, args);
+	libatari800_clear_input_array(&input);
+	PSRAM_AVAILABLE = TRUE;
+	Run(10);
+	if (REWIND_Count() == 0)
+		Fail("no rewind snapshots before the cartridge");
+
+	for (i = 0; i < MEGA_SIZE; i++)
+		buf[CART_HEADER + i] = MegaByte(i);
+	if (!PutCart("/mega4.car", CARTRIDGE_MEGA_4096, MEGA_SIZE)) {
+		printf("FAIL: cannot write the cartridge\n");
+		return 1;
+	}
+	if (CARTRIDGE_InsertAutoReboot("/mega4.car") != 0 || CARTRIDGE_main.type != CARTRIDGE_MEGA_4096) {
+		printf("FAIL: 4 MB MegaCart not inserted\n");
+		return 1;
+	}
+	if (!CARTCACHE_HoldsRewindArea())
+		Fail("4 MB MegaCart not kept over the rewind ring");
+	Run(50);
+	if (REWIND_Count() != 0)
+		Fail("rewind snapshots taken with the cartridge in");
+	CheckMega("4 MB MegaCart");
+
+	CARTRIDGE_RemoveAutoReboot();
+	if (CARTCACHE_HoldsRewindArea())
+		Fail("rewind ring still held after the cartridge is removed");
+	Run(REWIND_SLOTS + 10);
+	n = REWIND_Count();
+	printf("%d rewind snapshots after removing the cartridge\n", n);
+	if (n == 0)
+		Fail("no rewind snapshots after the cartridge");
+
+	calls = host_disk_read_calls;
+	CARTRIDGE_InsertAutoReboot("/mega4.car");
+	if (host_disk_read_calls == calls)
+		Fail("inserted again without reading the card");
+	CheckMega("inserted again");
+	CARTRIDGE_RemoveAutoReboot();
+
+	srand(1);
+	for (i = 0; i < ATRAX_SIZE; i++)
+		buf[CART_HEADER + i] = (UBYTE) rand();
+	if (!PutCart("/atrax.car", CARTRIDGE_ATRAX_128, ATRAX_SIZE)
+	    || CARTRIDGE_InsertAutoReboot("/atrax.car") != 0 || CARTRIDGE_main.type != CARTRIDGE_ATRAX_128) {
+		printf("FAIL: ATRAX cartridge not inserted\n");
+		return 1;
+	}
+	for (n = 0; n < 3; n++)
+		CheckDecode();
+	CARTRIDGE_RemoveAutoReboot();
+	return failed;
+}
@@ -0,0 +1,88 @@
+#!/bin/sh
+# Builds the emulator core for the PC, on a RAM disk and with the Pico SDK
+# replaced by the stand-ins in util/host, and links it with a test:
+#
+#	util/host/build.sh [option...] test.c [source...]
+#
+# Run it from the top directory of the sources.  The program is written to
+# $WORK/test; WORK defaults to ${TMPDIR:-/tmp}/atari800-host.  Options:
+#
+#	-x file.c		leave src/file.c out
+#	-e file.c:script	edit the copy of src/file.c with sed script
+#	-D..., -O..., -f...	passed to the compiler
+#
+# The copy of src/ gets these edits for the PC: debug.c logs to stdout,
+# debug.h declares snprintf() as the C library does, and the checks of
+# atari.c and sysrom.c for ROM images in flash always answer flash.
+
+set -e
+
+WORK=${WORK:-${TMPDIR:-/tmp}/atari800-host}
+HOST=util/host
+EXCLUDE=
+EDITS=
+FLAGS=
+
+if [ ! -f $HOST/stub.c ]; then
+	echo "run $0 from the top directory of the sources" >&2
+	exit 1
+fi
+
+while [ $# -gt 0 ]; do
+	case "$1" in
+	-x)	EXCLUDE="$EXCLUDE $2"; shift 2 ;;
+	-e)	EDITS="$EDITS
+$2"; shift 2 ;;
+	-*)	FLAGS="$FLAGS $1"; shift ;;
+	*)	break ;;
+	esac
+done
+if [ $# -eq 0 ]; then
+	echo "usage: $0 [-x file.c] [-e file.c:script] [-Dflag] test.c [source...]" >&2
+	exit 1
+fi
+
+rm -rf "$WORK"
+mkdir -p "$WORK/obj" "$WORK/include"
+cp -r src "$WORK/src"
+cp -r drivers/fatfs "$WORK/fatfs"
+cp -r $HOST/include/* "$WORK/include"
+
+sed -i 's/^\(void logMsg(char\* msg) {\)/int puts(const char *); \1 puts(msg); return;/' "$WORK/src/debug.c"
+sed -i 's/unsigned int size/size_t size/' "$WORK/src/debug.h"
+sed -i 's/buffer < 0x20000000/1/' "$WORK/src/atari.c" "$WORK/src/sysrom.c"
+sed -i 's/MEMORY_os >= 0x20000000/0/' "$WORK/src/atari.c"
+echo "$EDITS" | while IFS= read -r edit; do
+	if [ -n "$edit" ]; then
+		sed -i "${edit#*:}" "$WORK/src/${edit%%:*}"
+	fi
+done
+
+# The tests format card images, which the device does not.
+sed -i 's/^#define FF_USE_MKFS[ \t]*0/#define FF_USE_MKFS\t\t1/' "$WORK/fatfs/ffconf.h"
+
+# The PSRAM driver's API, without its SPI and PIO declarations.
+{
+	echo '#include <stdint.h>'
+	echo '#include <stddef.h>'
+	echo '#include <stdbool.h>'
+	awk '/^extern bool PSRAM_AVAILABLE;/ { p = 1 } /^#ifdef __cplusplus/ { if (p) exit } p' drivers/psram/psram_spi.h
+} > "$WORK/include/psram_spi.h"
+
+CFLAGS="-O2 -g -w -Werror=implicit-function-declaration -DPACKAGE_VERSION=\"host\" -DPSRAM \
+	-I$WORK/include -include pico/platform.h -include stddef.h \
+	-I$WORK/src -I$WORK/fatfs $FLAGS"
+
+objs=
+for f in "$WORK"/src/*.c "$WORK"/src/libatari800/*.c "$WORK"/src/roms/*.c \
+		"$WORK"/fatfs/ff.c "$WORK"/fatfs/ffsystem.c "$WORK"/fatfs/ffunicode.c \
+		$HOST/stub.c "$@"; do
+	case " $EXCLUDE " in
+	*" `basename $f` "*) continue ;;
+	esac
+	o="$WORK/obj/`basename \`dirname $f\``_`basename $f .c`.o"
+	gcc $CFLAGS -c "$f" -o "$o"
+	objs="$objs $o"
+done
+gcc -o "$WORK/test" $objs -lm -lpthread
+echo "$WORK/test"
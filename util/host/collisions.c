@@ -0,0 +1,120 @@
+/*
+ * collisions.c - checks the lazy player/missile collisions of GTIA
+ *
+ * Copyright (C) 2026 Atari800 development team (see DOC/CREDITS)
+ *
+ * This file is part of the Atari800 emulator project which emulates
+ * the Atari 400, 800, 800XL, 130XE, and 5200 8-bit computers.
+ *
+ * Atari800 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Atari800 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Atari800; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/* Writes random player and missile registers, draws scanlines, clears
+   the collisions now and then and reads M0PL..P3PL.  The values read
+   must be those of eager collision detection, which this test does
+   itself from the objects drawn in GTIA_pm_scanline after each line.
+   Prints how many lines were recorded, resolved and never resolved:
+
+	util/host/build.sh util/host/collisions.c && $WORK/test [steps [seed]]
+*/
+
+#include <stdlib.h>
+
+#include "libatari800/libatari800.h"
+#include "gtia.h"
+#include "screen.h"
+#undef printf
+
+int printf(const char *format, ...);
+
+/* Eager collisions: players that overlapped each player, and players
+   that overlapped each missile. */
+static UBYTE player_player[4];
+static UBYTE missile_player[4];
+
+static void EagerScanline(void)
+{
+	int i, n;
+	for (i = 0; i < Screen_WIDTH / 2; i++) {
+		UBYTE p = GTIA_pm_scanline[i];
+		for (n = 0; n < 4; n++) {
+			if (p & (1 << n))
+				player_player[n] |= p & 0x0f & ~(1 << n);
+			if (p & (0x10 << n))
+				missile_player[n] |= p & 0x0f;
+		}
+	}
+}
+
+int main(int argc, char **argv)
+{
+	char *args[] = { "-atari", NULL };
+	long const steps = argc > 1 ? atol(argv[1]) : 5000000;
+	unsigned int rng = argc > 2 ? atoi(argv[2]) : 12345;
+	long lines = 0, reads = 0, errors = 0;
+	long step;
+	int n;
+
+	libatari800_init(-1, args);
+
+	for (step = 0; step < steps; step++) {
+		unsigned int r;
+		int op;
+		rng = rng * 1103515245 + 12345;
+		r = rng >> 8;
+		op = r % 100;
+		if (op < 45) {
+			GTIA_NewPmScanline();
+			EagerScanline();
+			lines++;
+		}
+		else if (op < 90) {
+			/* HPOSP0..GRAFM, with graphics cleared a third of the time */
+			int reg = (r >> 7) % (GTIA_OFFSET_GRAFM + 1);
+			UBYTE value = r >> 12;
+			if (reg >= GTIA_OFFSET_GRAFP0 && (r >> 20) % 3 == 0)
+				value = 0;
+			GTIA_PutByte(reg, value);
+		}
+		else if (op < 99) {
+			for (n = 0; n < 4; n++) {
+				UBYTE m = GTIA_GetByte(GTIA_OFFSET_M0PL + n, FALSE);
+				UBYTE p = GTIA_GetByte(GTIA_OFFSET_P0PL + n, FALSE);
+				UBYTE m_eager = missile_player[n] & GTIA_collisions_mask_missile_player;
+				UBYTE p_eager = player_player[n] & GTIA_collisions_mask_player_player;
+				if (m != m_eager || p != p_eager) {
+					if (errors++ < 10)
+						printf("step %ld: M%dPL %02X P%dPL %02X, eager %02X %02X\n",
+						       step, n, m, n, p, m_eager, p_eager);
+				}
+			}
+			reads++;
+		}
+		else {
+			GTIA_PutByte(GTIA_OFFSET_HITCLR, 0);
+			for (n = 0; n < 4; n++)
+				player_player[n] = missile_player[n] = 0;
+		}
+	}
+
+	printf("%ld lines, %ld reads: %lu lines recorded, %lu resolved, %lu avoided\n",
+	       lines, reads, (unsigned long) GTIA_pmpl_lines_recorded,
+	       (unsigned long) GTIA_pmpl_lines_resolved, (unsigned long) GTIA_pmpl_lines_avoided);
+	if (errors > 0) {
+		printf("FAIL: %ld reads differ\n", errors);
+		return 1;
+	}
+	return 0;
+}
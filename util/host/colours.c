@@ -0,0 +1,299 @@
+/*
+ * colours.c - checks the fixed-point palette generators against double
+ *             precision
+ *
+ * Copyright (C) 2026 Atari800 development team (see DOC/CREDITS)
+ *
+ * This file is part of the Atari800 emulator project which emulates
+ * the Atari 400, 800, 800XL, 130XE, and 5200 8-bit computers.
+ *
+ * Atari800 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Atari800 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Atari800; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/* Builds NTSC and PAL palettes with random colour controls, half of them
+   from random external palettes, and compares every channel with the
+   double-precision generators that colours_ntsc.c and colours_pal.c had
+   before they went to fixed point.  Then times a rebuild of each.
+
+	util/host/build.sh util/host/colours.c && $WORK/test [settings [seed]]
+
+   Fails if a channel is off by more than MAX_ERROR. */
+
+#include <math.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "colours.h"
+#include "colours_ntsc.h"
+#include "colours_pal.h"
+#undef printf
+
+/* not stdio.h, whose FILE functions ff.h redefines */
+int printf(const char *format, ...);
+
+/* One LSB: the fixed-point maths rounds where the doubles truncated. */
+#define MAX_ERROR 1
+
+extern uint32_t host_palette[256];
+
+static int ref_palette[256][3];
+
+static void RefSetRGB(int n, double r, double g, double b)
+{
+	double c[3];
+	int i;
+	c[0] = r;
+	c[1] = g;
+	c[2] = b;
+	for (i = 0; i < 3; i++) {
+		int x = (int) (c[i] * 255);
+		ref_palette[n][i] = x < 0 ? 0 : x > 255 ? 255 : x;
+	}
+}
+
+static double const luma_mult[16] = {
+	0.6941, 0.7091, 0.7241, 0.7401,
+	0.7560, 0.7741, 0.7931, 0.8121,
+	0.8260, 0.8470, 0.8700, 0.8930,
+	0.9160, 0.9420, 0.9690, 1.0000
+};
+
+static double RefLuma(Colours_setup_t const *setup, int lm)
+{
+	double y = (luma_mult[lm] - luma_mult[0]) / (luma_mult[15] - luma_mult[0]);
+	double const black = (double) setup->black_level / 255.0;
+	double const white = (double) setup->white_level / 255.0;
+	y *= setup->contrast * 0.5 + 1;
+	y += setup->brightness * 0.5;
+	return y * (white - black) + black;
+}
+
+static void RefGamma(Colours_setup_t const *setup, COLOURS_EXTERNAL_t const *ext, double *r, double *g, double *b)
+{
+	if (!ext->loaded || ext->adjust) {
+		*r = Colours_Linear2sRGB(Colours_Gamma2Linear(*r, setup->gamma));
+		*g = Colours_Linear2sRGB(Colours_Gamma2Linear(*g, setup->gamma));
+		*b = Colours_Linear2sRGB(Colours_Gamma2Linear(*b, setup->gamma));
+	}
+}
+
+static void RefNTSC(void)
+{
+	Colours_setup_t const *setup = &COLOURS_NTSC_setup;
+	COLOURS_EXTERNAL_t const *ext = &COLOURS_NTSC_external;
+	double const colorburst_angle = (303.0f) * M_PI / 180.0f;
+	double const start_angle = colorburst_angle + setup->hue * M_PI;
+	double yiq[256][3];
+	int n;
+
+	if (ext->loaded) {
+		double const s = sin(start_angle - colorburst_angle);
+		double const c = cos(start_angle - colorburst_angle);
+		for (n = 0; n < 256; n++) {
+			double r = ext->palette[n * 3] / 255.0;
+			double g = ext->palette[n * 3 + 1] / 255.0;
+			double b = ext->palette[n * 3 + 2] / 255.0;
+			double y = 0.299 * r + 0.587 * g + 0.114 * b;
+			double i = 0.595716 * r - 0.274453 * g - 0.321263 * b;
+			double q = 0.211456 * r - 0.522591 * g + 0.311135 * b;
+			double tmp_i = i;
+			i = tmp_i * c - q * s;
+			q = tmp_i * s + q * c;
+			if (ext->adjust) {
+				y *= setup->contrast * 0.5 + 1;
+				y += setup->brightness * 0.5;
+				y = y > 1.0 ? 1.0 : y < 0.0 ? 0.0 : y;
+				i *= setup->saturation + 1;
+				q *= setup->saturation + 1;
+			}
+			yiq[n][0] = y;
+			yiq[n][1] = i;
+			yiq[n][2] = q;
+		}
+	}
+	else {
+		double const color_diff = setup->color_delay * M_PI / 180.0;
+		for (n = 0; n < 256; n++) {
+			int cr = n >> 4;
+			double angle = start_angle + (cr - 1) * color_diff;
+			double saturation = cr ? (setup->saturation + 1) * 0.175f : 0.0;
+			yiq[n][0] = RefLuma(setup, n & 15);
+			yiq[n][1] = cos(angle) * saturation;
+			yiq[n][2] = sin(angle) * saturation;
+		}
+	}
+
+	for (n = 0; n < 256; n++) {
+		double y = yiq[n][0], i = yiq[n][1], q = yiq[n][2];
+		double r = y + 0.9563 * i + 0.6210 * q;
+		double g = y - 0.2721 * i - 0.6474 * q;
+		double b = y - 1.1070 * i + 1.7046 * q;
+		RefGamma(setup, ext, &r, &g, &b);
+		RefSetRGB(n, r, g, b);
+	}
+}
+
+static void RefPAL(void)
+{
+	/* ADD and MULT of the delay of hues $1..$F, see colours_pal.c */
+	static int const even_add[15] = { 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1 };
+	static int const even_mult[15] = { 5, 6, 7, 0, 1, 2, 4, 5, 6, 7, 1, 2, 3, 4, 5 };
+	static int const odd_add[15] = { 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1 };
+	static int const odd_mult[15] = { 1, 0, 7, 6, 5, 4, 2, 1, 0, 7, 5, 4, 3, 2, 1 };
+	static double const color_disable_threshold = 0.05;
+	static double const base_del = 0.421894970414201;
+	static double const add_del = 0.446563064859117;
+	Colours_setup_t const *setup = &COLOURS_PAL_setup;
+	COLOURS_EXTERNAL_t const *ext = &COLOURS_PAL_external;
+	double yuv[256][3];
+	int n;
+
+	if (ext->loaded) {
+		double const s = sin(setup->hue * M_PI);
+		double const c = cos(setup->hue * M_PI);
+		for (n = 0; n < 256; n++) {
+			double y, u, v, tmp_u;
+			Colours_RGB2YUV(ext->palette[n * 3] / 255.0, ext->palette[n * 3 + 1] / 255.0,
+			                ext->palette[n * 3 + 2] / 255.0, &y, &u, &v);
+			tmp_u = u;
+			u = tmp_u * c - v * s;
+			v = tmp_u * s + v * c;
+			if (ext->adjust) {
+				y *= setup->contrast * 0.5 + 1;
+				y += setup->brightness * 0.5;
+				y = y > 1.0 ? 1.0 : y < 0.0 ? 0.0 : y;
+				u *= setup->saturation + 1.0;
+				v *= setup->saturation + 1.0;
+			}
+			yuv[n][0] = y;
+			yuv[n][1] = u;
+			yuv[n][2] = v;
+		}
+	}
+	else {
+		double const del_adj = setup->color_delay / 360.0;
+		double const even_burst_del = base_del + add_del * even_add[0] + del_adj * even_mult[0];
+		double const odd_burst_del = base_del + add_del * odd_add[0] + del_adj * odd_mult[0];
+		double const subcarrier_del = (even_burst_del + odd_burst_del + setup->hue) / 2.0;
+		double burst_diff = even_burst_del - odd_burst_del;
+		double saturation_mult;
+		burst_diff -= floor(burst_diff);
+		if (burst_diff > 0.5 - color_disable_threshold && burst_diff < 0.5 + color_disable_threshold)
+			saturation_mult = 0.0;
+		else
+			saturation_mult = sqrt(2.0) / sqrt(2.0 * cos(burst_diff * 2.0 * M_PI) + 2.0);
+		for (n = 0; n < 256; n++) {
+			int cr = n >> 4;
+			double u = 0.0, v = 0.0;
+			if (cr) {
+				double even_del = base_del + add_del * even_add[cr - 1] + del_adj * even_mult[cr - 1];
+				double odd_del = base_del + add_del * odd_add[cr - 1] + del_adj * odd_mult[cr - 1];
+				double even_angle = (0.5 - (even_del - subcarrier_del)) * 2.0 * M_PI;
+				double odd_angle = (0.5 + (odd_del - subcarrier_del)) * 2.0 * M_PI;
+				double saturation = (setup->saturation + 1) * 0.175 * saturation_mult;
+				u = (cos(even_angle) + cos(odd_angle)) * saturation / 2.0;
+				v = (sin(even_angle) + sin(odd_angle)) * saturation / 2.0;
+			}
+			yuv[n][0] = RefLuma(setup, n & 15);
+			yuv[n][1] = u;
+			yuv[n][2] = v;
+		}
+	}
+
+	for (n = 0; n < 256; n++) {
+		double r, g, b;
+		Colours_YUV2RGB(yuv[n][0], yuv[n][1], yuv[n][2], &r, &g, &b);
+		RefGamma(setup, ext, &r, &g, &b);
+		RefSetRGB(n, r, g, b);
+	}
+}
+
+static double Random(double min, double max)
+{
+	return min + (max - min) * rand() / RAND_MAX;
+}
+
+static double Rebuild_us(void (*update)(void))
+{
+	int const count = 2000;
+	clock_t start = clock();
+	int i;
+	for (i = 0; i < count; i++)
+		update();
+	return (double) (clock() - start) / CLOCKS_PER_SEC * 1e6 / count;
+}
+
+int main(int argc, char **argv)
+{
+	int const settings = argc > 1 ? atoi(argv[1]) : 400;
+	unsigned long hist[256] = { 0 };
+	unsigned long total = 0;
+	int max = 0;
+	int t, n, i;
+
+	srand(argc > 2 ? atoi(argv[2]) : 1);
+	Colours_PreInitialise();
+
+	for (t = 0; t < settings; t++) {
+		int const pal = t & 1;
+		Colours_setup_t *setup = pal ? &COLOURS_PAL_setup : &COLOURS_NTSC_setup;
+		COLOURS_EXTERNAL_t *ext = pal ? &COLOURS_PAL_external : &COLOURS_NTSC_external;
+
+		/* the first two are the default NTSC and PAL palettes */
+		if (t >= 2) {
+			setup->hue = Random(COLOURS_HUE_MIN, COLOURS_HUE_MAX);
+			setup->saturation = Random(COLOURS_SATURATION_MIN, COLOURS_SATURATION_MAX);
+			setup->contrast = Random(COLOURS_CONTRAST_MIN, COLOURS_CONTRAST_MAX);
+			setup->brightness = Random(COLOURS_BRIGHTNESS_MIN, COLOURS_BRIGHTNESS_MAX);
+			setup->gamma = Random(COLOURS_GAMMA_MIN, COLOURS_GAMMA_MAX);
+			setup->color_delay = Random(COLOURS_DELAY_MIN, COLOURS_DELAY_MAX);
+		}
+		ext->loaded = t >= 2 && (t & 2);
+		ext->adjust = t & 4;
+		for (i = 0; i < 768; i++)
+			ext->palette[i] = rand();
+
+		if (pal) {
+			COLOURS_PAL_Update();
+			RefPAL();
+		}
+		else {
+			COLOURS_NTSC_Update();
+			RefNTSC();
+		}
+
+		for (n = 0; n < 256; n++) {
+			for (i = 0; i < 3; i++) {
+				int d = abs((int) ((host_palette[n] >> (16 - 8 * i)) & 0xff) - ref_palette[n][i]);
+				if (d > max)
+					max = d;
+				hist[d]++;
+				total++;
+			}
+		}
+	}
+
+	printf("%d palettes, %lu channels: %.2f%% exact, %.2f%% off by 1, largest error %d\n",
+	       settings, total, 100.0 * hist[0] / total, 100.0 * hist[1] / total, max);
+
+	COLOURS_NTSC_external.loaded = COLOURS_PAL_external.loaded = FALSE;
+	printf("rebuild: NTSC %.1f us, PAL %.1f us\n", Rebuild_us(COLOURS_NTSC_Update), Rebuild_us(COLOURS_PAL_Update));
+
+	if (max > MAX_ERROR) {
+		printf("FAIL: error above %d\n", MAX_ERROR);
+		return 1;
+	}
+	return 0;
+}
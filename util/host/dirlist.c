@@ -0,0 +1,134 @@
+/*
+ * dirlist.c - times the file selector's first screen of a large directory
+ *
+ * Copyright (C) 2026 Atari800 development team (see DOC/CREDITS)
+ *
+ * This file is part of the Atari800 emulator project which emulates
+ * the Atari 400, 800, 800XL, 130XE, and 5200 8-bit computers.
+ *
+ * Atari800 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Atari800 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Atari800; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/* Fills a directory on a RAM disk with 32K clusters, as SD cards have,
+   with 5,000 files in random order, opens the file selector on it and
+   times the first screen: the host time, the card calls and sectors read,
+   and the time those take on an SD card taking 0.6 ms a call and
+   1.5 MB/s.  Then checks that the listing has every file, in order, and
+   that with an arena too small for it the selector lists the first files
+   that fit.  The functions are static, so ui_basic.c is built into this
+   file; the argument sets the arena in KB:
+
+	util/host/build.sh -x ui_basic.c util/host/dirlist.c && $WORK/test [KB]
+*/
+
+#include "ui_basic.c"
+
+#include <stdlib.h>
+#include <time.h>
+#undef printf
+
+int printf(const char *format, ...);
+
+extern unsigned long host_disk_reads, host_disk_read_calls;
+
+#define FILES 5000
+#define DIRECTORY "/atari800/big"
+
+static FATFS fs;
+
+static double Now_ms(void)
+{
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec * 1e3 + t.tv_nsec * 1e-6;
+}
+
+static void FirstScreen(void)
+{
+	char path[FILENAME_MAX] = DIRECTORY "/file00000_some_long_name.xex";
+	unsigned long calls = host_disk_read_calls;
+	unsigned long sectors = host_disk_reads;
+	double t0 = Now_ms();
+	double host_ms;
+	/* Esc as soon as the first screen is drawn */
+	UI_alt_function = 0;
+	FileSelector(path, FALSE, NULL, 0);
+	UI_alt_function = -1;
+	host_ms = Now_ms() - t0;
+	calls = host_disk_read_calls - calls;
+	sectors = host_disk_reads - sectors;
+	printf("first screen: %.1f ms on the host, %lu calls, %lu sectors, %.0f ms on the card\n",
+	       host_ms, calls, sectors, calls * 0.6 + sectors * 512 / 1.5e3);
+}
+
+/* Returns the number of names listed, or -1 if they are wrong. */
+static int Check(void)
+{
+	int listed;
+	int i;
+	GetDirectory(DIRECTORY);
+	listed = n_filenames;
+	if (listed < 2 || strcmp(filenames[0], "[..]") != 0)
+		listed = -1;
+	for (i = 1; listed > 0 && i < n_filenames; i++) {
+		if (strncmp(filenames[i], "file", 4) != 0 || (i > 1 && FilenamesCmp(filenames[i - 1], filenames[i]) >= 0))
+			listed = -1;
+	}
+	FilenamesFree();
+	return listed;
+}
+
+int main(int argc, char **argv)
+{
+	static BYTE work[4096];
+	MKFS_PARM opt = { FM_ANY, 0, 0, 0, 32768 };
+	char kb[16] = "0";
+	char *args[] = { "dirlist", "-arena-kb", kb, NULL };
+	int n = 3;
+	char name[64];
+	FIL f;
+	int listed;
+	int i;
+
+	if (argc > 1)
+		strncpy(kb, argv[1], sizeof(kb) - 1);
+	REGION_Initialise(&n, args);
+	f_mkfs("", &opt, work, sizeof(work));
+	f_mount(&fs, "", 1);
+	f_mkdir("/atari800");
+	f_mkdir(DIRECTORY);
+	for (i = 0; i < FILES; i++) {
+		sprintf(name, DIRECTORY "/file%05d_some_long_name.xex", (i + 1) * 7919 % FILES);
+		if (f_open(&f, name, FA_WRITE | FA_CREATE_ALWAYS) != FR_OK) {
+			printf("FAIL: cannot create %s\n", name);
+			return 1;
+		}
+		f_close(&f);
+	}
+	printf("%d files, %lu KB arena\n", FILES, (unsigned long) (REGION_stats.arena >> 10));
+	FirstScreen();
+
+	listed = Check();
+	printf("%d of %d files listed\n", listed - 1, FILES);
+	if (listed < 0 || (listed != FILES + 1 && REGION_stats.arena >= 256 << 10)) {
+		printf("FAIL: the listing is wrong\n");
+		return 1;
+	}
+	if (REGION_stats.used[REGION_UI] != 0) {
+		printf("FAIL: %lu bytes of the listing left\n", (unsigned long) REGION_stats.used[REGION_UI]);
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,161 @@
+/*
+ * filters.c - times the MZ POKEY engine's choice of resampling filter
+ *
+ * Copyright (C) 2026 Atari800 development team (see DOC/CREDITS)
+ *
+ * This file is part of the Atari800 emulator project which emulates
+ * the Atari 400, 800, 800XL, 130XE, and 5200 8-bit computers.
+ *
+ * Atari800 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Atari800 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Atari800; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/* Times remez_filter_table(), which MZPOKEYSND_Init calls, at every
+   quality for the rates of the sound menu, whose filters are built in,
+   and for rates that are not, on a RAM disk: the first init designs the
+   filter and writes it to the card, later ones read it back.  Prints the
+   host time and the card sectors of each, best of 5 for the built-in
+   ones.  Checks that each built-in table is what the design code gives
+   for it, and that a filter read back is the one designed.  The
+   functions are static, so mzpokeysnd.c is built into this file; the
+   arguments add rates to design:
+
+	util/host/build.sh -x mzpokeysnd.c util/host/filters.c && $WORK/test [Hz...]
+*/
+
+#include "mzpokeysnd.c"
+
+#include <math.h>
+#include <stdlib.h>
+#include <time.h>
+#undef printf
+
+int printf(const char *format, ...);
+
+extern unsigned long host_disk_reads, host_disk_writes;
+
+#define QUALITIES ((int) (sizeof(passtab) / sizeof(passtab[0])))
+
+static FATFS fs;
+static int failed = FALSE;
+
+static double Now_us(void)
+{
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec * 1e6 + t.tv_nsec * 1e-3;
+}
+
+/* Sets the rate as MZPOKEYSND_Init does for one not in its list, and
+   returns remez_filter_table's size, its time in *US and the card sectors
+   read and written in *SECTORS. */
+static int Table(int rate, int quality, double *us, unsigned long *sectors)
+{
+	unsigned long reads = host_disk_reads + host_disk_writes;
+	double cutoff;
+	double t0;
+	int size;
+	POKEYSND_playback_freq = rate;
+	pokey_frq = (int) (((double) pokey_frq_ideal / rate) + 0.5) * rate;
+	t0 = Now_us();
+	size = remez_filter_table((double) rate / pokey_frq, &cutoff, quality);
+	*us = Now_us() - t0;
+	*sectors = host_disk_reads + host_disk_writes - reads;
+	if (cutoff != 0.95 * 0.5 * ((double) rate / pokey_frq)) {
+		printf("FAIL: %d Hz quality %d: cutoff %g\n", rate, quality, cutoff);
+		failed = TRUE;
+	}
+	return size;
+}
+
+/* Returns the largest difference between SIZE taps of filter_data and
+   the design for RATE and QUALITY. */
+static double Difference(int rate, int quality, int size)
+{
+	static double h[1201];
+	double max = 0;
+	int i;
+	design_filter(h, (double) rate / pokey_frq, quality, (double *) Screen_atari);
+	for (i = 0; i < size; i++)
+		if (fabs(h[i] - filter_data[i]) > max)
+			max = fabs(h[i] - filter_data[i]);
+	return max;
+}
+
+static void BuiltIn(void)
+{
+	int t;
+	for (t = 0; t < (int) (sizeof(filter_tables) / sizeof(filter_tables[0])); t++) {
+		int rate = filter_tables[t].playback_freq;
+		int quality = filter_tables[t].quality;
+		double best = 1e9;
+		unsigned long sectors;
+		double diff;
+		int size = 0;
+		int n;
+		for (n = 0; n < 5; n++) {
+			double us;
+			size = Table(rate, quality, &us, &sectors);
+			if (us < best)
+				best = us;
+		}
+		diff = Difference(rate, quality, size);
+		printf("%5d Hz quality %d: built in, %4d taps, %.2f us, %lu sectors, design differs by %.1e\n",
+		       rate, quality, size, best, sectors, diff);
+		if (filter_custom != NULL || sectors != 0 || diff > 1e-9) {
+			printf("FAIL: %d Hz quality %d: not the built-in table\n", rate, quality);
+			failed = TRUE;
+		}
+	}
+}
+
+static void Designed(int rate)
+{
+	static double first[1201];
+	int quality;
+	for (quality = 0; quality < QUALITIES; quality++) {
+		double design_us, cached_us;
+		unsigned long design_sectors, cached_sectors;
+		int size = Table(rate, quality, &design_us, &design_sectors);
+		memcpy(first, filter_data, size * sizeof(double));
+		if (Table(rate, quality, &cached_us, &cached_sectors) != size
+		    || memcmp(first, filter_data, size * sizeof(double)) != 0) {
+			printf("FAIL: %d Hz quality %d: the cached filter differs\n", rate, quality);
+			failed = TRUE;
+		}
+		printf("%5d Hz quality %d: %4d taps, designed in %.0f us with %lu sectors,"
+		       " read back in %.0f us with %lu\n",
+		       rate, quality, size, design_us, design_sectors, cached_us, cached_sectors);
+	}
+}
+
+int main(int argc, char **argv)
+{
+	static BYTE work[4096];
+	MKFS_PARM opt = { FM_FAT32, 0, 0, 0, 0 };
+	int i;
+
+	f_mkfs("", &opt, work, sizeof(work));
+	f_mount(&fs, "", 1);
+	BuiltIn();
+	if (argc > 1) {
+		for (i = 1; i < argc; i++)
+			Designed(atoi(argv[i]));
+	}
+	else {
+		Designed(16000);
+		Designed(31400);
+	}
+	return failed;
+}
@@ -0,0 +1,317 @@
+/*
+ * hdev.c - checks and times the block transfers of the H: device
+ *
+ * Copyright (C) 2026 Atari800 development team (see DOC/CREDITS)
+ *
+ * This file is part of the Atari800 emulator project which emulates
+ * the Atari 400, 800, 800XL, 130XE, and 5200 8-bit computers.
+ *
+ * Atari800 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Atari800 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Atari800; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/* Plays CIO's loops for GET and PUT commands against the H: handler on
+   the RAM disk, once with the IOCB showing the command so the handler
+   moves whole buffers, and once without so it moves a byte per call.
+   The bytes and statuses read and the files written must be the same
+   either way.  Binary and text files are read in characters and records,
+   including records longer than the buffer, and written likewise.
+   Prints handler calls, disk calls and KB/s.  The handler functions are
+   static, so devices.c is built into this file:
+
+	util/host/build.sh -x devices.c util/host/hdev.c && $WORK/test
+*/
+
+#include "devices.c"
+
+#include <stdlib.h>
+#include <time.h>
+#undef printf
+
+int printf(const char *format, ...);
+
+extern unsigned long host_disk_read_calls, host_disk_write_calls;
+
+#define IOCB 0x10
+#define BUFFER 0x2000
+#define BINARY_SIZE 200000
+#define TEXT_SIZE 90000
+
+static FATFS fs;
+static int block;
+static unsigned long calls;
+static UBYTE data[BINARY_SIZE];
+static char text[TEXT_SIZE + 200];
+static int text_size;
+static UBYTE result[2][2 * BINARY_SIZE + 0x10000];
+static int result_size[2];
+static int failed = FALSE;
+
+static double Now(void)
+{
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static void PutWord(int addr, int value)
+{
+	MEMORY_mem[addr] = (UBYTE) value;
+	MEMORY_mem[addr + 1] = (UBYTE) (value >> 8);
+}
+
+/* Sets up the IOCB and its zero page copy as CIO does for a command.
+   Without block, the IOCB shows no command, as if the handler was not
+   called from CIO. */
+static void SetIOCB(int com, UWORD buf, int len)
+{
+	int iocb = Devices_IOCB0 + IOCB;
+	MEMORY_mem[iocb + Devices_ICCOM] = block ? com : 0xff;
+	PutWord(iocb + Devices_ICBAL, buf);
+	PutWord(iocb + Devices_ICBLL, len);
+	MEMORY_mem[Devices_ICCOMZ] = com;
+	PutWord(Devices_ICBALZ, buf);
+	PutWord(Devices_ICBLLZ, len);
+	CPU_regX = IOCB;
+}
+
+static int Open(char const *name, int aux1)
+{
+	strcpy((char *) MEMORY_mem + 0x600, name);
+	MEMORY_mem[0x600 + strlen(name)] = 0x9b;
+	SetIOCB(3, 0x600, 64);
+	MEMORY_mem[Devices_ICDNOZ] = name[1] - '0';
+	MEMORY_mem[Devices_ICAX1Z] = aux1;
+	Devices_H_Open();
+	return CPU_regY;
+}
+
+static void Close(void)
+{
+	CPU_regX = IOCB;
+	Devices_H_Close();
+}
+
+/* CIO's loop for GET RECORD (5) and GET CHARACTERS (7).  Returns the
+   status and sets *count to the bytes stored. */
+static int Get(int com, UWORD buf, int len, int *count)
+{
+	int status = 1;
+	SetIOCB(com, buf, len);
+	for (;;) {
+		UWORD addr;
+		calls++;
+		CPU_regX = IOCB;
+		Devices_H_Read();
+		if (CPU_regY >= 128) {
+			status = CPU_regY;
+			break;
+		}
+		if (MEMORY_dGetWord(Devices_ICBLLZ) == 0) {
+			/* record longer than the buffer: skip to its EOL */
+			if (CPU_regA == 0x9b) {
+				status = 137;
+				break;
+			}
+			continue;
+		}
+		addr = MEMORY_dGetWord(Devices_ICBALZ);
+		MEMORY_mem[addr] = CPU_regA;
+		PutWord(Devices_ICBALZ, addr + 1);
+		PutWord(Devices_ICBLLZ, MEMORY_dGetWord(Devices_ICBLLZ) - 1);
+		status = CPU_regY;
+		if (com == 5 && CPU_regA == 0x9b)
+			break;
+		if (com == 7 && MEMORY_dGetWord(Devices_ICBLLZ) == 0)
+			break;
+	}
+	*count = len - MEMORY_dGetWord(Devices_ICBLLZ);
+	return status;
+}
+
+/* CIO's loop for PUT RECORD (9) and PUT CHARACTERS (11). */
+static void Put(int com, UWORD buf, int len)
+{
+	SetIOCB(com, buf, len);
+	for (;;) {
+		UBYTE byte = MEMORY_mem[MEMORY_dGetWord(Devices_ICBALZ)];
+		CPU_regA = byte;
+		calls++;
+		CPU_regX = IOCB;
+		Devices_H_Write();
+		PutWord(Devices_ICBALZ, MEMORY_dGetWord(Devices_ICBALZ) + 1);
+		PutWord(Devices_ICBLLZ, MEMORY_dGetWord(Devices_ICBLLZ) - 1);
+		if (com == 9 && byte == 0x9b)
+			break;
+		if (MEMORY_dGetWord(Devices_ICBLLZ) == 0) {
+			/* a record without EOL in the buffer gets one */
+			if (com == 9) {
+				CPU_regA = 0x9b;
+				calls++;
+				CPU_regX = IOCB;
+				Devices_H_Write();
+			}
+			break;
+		}
+	}
+}
+
+/* Reads a whole file, keeping the bytes and the status of each command
+   in result[block]. */
+static void ReadFile(char const *label, char const *name, int com, int len, int size)
+{
+	UBYTE *out = result[block];
+	unsigned long calls0 = calls;
+	unsigned long disk0 = host_disk_read_calls;
+	double start = Now();
+	int n = 0;
+	int status;
+	Open(name, 4);
+	do {
+		int count;
+		status = Get(com, BUFFER, len, &count);
+		memcpy(out + n, MEMORY_mem + BUFFER, count);
+		n += count;
+		out[n++] = status;
+	} while (status != 136 && n < (int) sizeof(result[0]) - 0x10000);
+	Close();
+	result_size[block] = n;
+	printf("%-30s %-5s %7lu %6lu %8.0f\n", label, block ? "block" : "byte", calls - calls0,
+	       host_disk_read_calls - disk0, size / 1024.0 / (Now() - start));
+}
+
+static void CompareFiles(char const *what, char const *name0, char const *name1)
+{
+	static UBYTE a[300000], b[300000];
+	FIL f;
+	UINT na = 0, nb = 0;
+	if (f_open(&f, name0, FA_READ) == FR_OK) {
+		f_read(&f, a, sizeof(a), &na);
+		f_close(&f);
+	}
+	if (f_open(&f, name1, FA_READ) == FR_OK) {
+		f_read(&f, b, sizeof(b), &nb);
+		f_close(&f);
+	}
+	if (na == 0 || na != nb || memcmp(a, b, na) != 0) {
+		printf("FAIL: %s written differ\n", what);
+		failed = TRUE;
+	}
+	else
+		printf("%s written identical, %u bytes\n", what, na);
+}
+
+static void MakeFiles(void)
+{
+	FIL f;
+	UINT written;
+	int i;
+	srand(1);
+	for (i = 0; i < BINARY_SIZE; i++)
+		data[i] = rand();
+	f_open(&f, "/h/B.BIN", FA_WRITE | FA_CREATE_ALWAYS);
+	f_write(&f, data, BINARY_SIZE, &written);
+	f_close(&f);
+	/* lines of up to 150 characters ending in CR, LF, CR LF or CR LF LF */
+	while (text_size < TEXT_SIZE) {
+		int len = rand() % 150;
+		int eol = rand() % 4;
+		for (i = 0; i < len; i++)
+			text[text_size++] = 'a' + rand() % 26;
+		if (eol != 1)
+			text[text_size++] = '\r';
+		if (eol != 0)
+			text[text_size++] = '\n';
+		if (eol == 3)
+			text[text_size++] = '\n';
+	}
+	f_open(&f, "/h/T.TXT", FA_WRITE | FA_CREATE_ALWAYS);
+	f_write(&f, text, text_size, &written);
+	f_close(&f);
+}
+
+int main(void)
+{
+	static struct {
+		char const *label;
+		char const *name;
+		int com;
+		int len;
+		int size;
+	} const reads[] = {
+		{ "GET CHARACTERS 4K, binary", "H1:B.BIN", 7, 4096, BINARY_SIZE },
+		{ "GET CHARACTERS 1000, binary", "H1:B.BIN", 7, 1000, BINARY_SIZE },
+		{ "GET CHARACTERS 1, binary", "H1:B.BIN", 7, 1, BINARY_SIZE },
+		{ "GET RECORD 100, binary", "H1:B.BIN", 5, 100, BINARY_SIZE },
+		{ "GET CHARACTERS 4K, text", "H6:T.TXT", 7, 4096, 0 },
+		{ "GET RECORD 128, text", "H6:T.TXT", 5, 128, 0 },
+		{ "GET RECORD 40, text", "H6:T.TXT", 5, 40, 0 }
+	};
+	static BYTE work[4096];
+	MKFS_PARM opt = { FM_FAT32, 0, 0, 0, 0 };
+	int i, r;
+
+	f_mkfs("", &opt, work, sizeof(work));
+	f_mount(&fs, "", 1);
+	f_mkdir("/h");
+	strcpy(Devices_atari_h_dir[0], "/h");
+	Devices_h_read_only = FALSE;
+	MakeFiles();
+
+	printf("command                        mode    calls  disk     KB/s\n");
+	for (r = 0; r < (int) (sizeof(reads) / sizeof(reads[0])); r++) {
+		int size = reads[r].size != 0 ? reads[r].size : text_size;
+		for (block = 0; block < 2; block++)
+			ReadFile(reads[r].label, reads[r].name, reads[r].com, reads[r].len, size);
+		if (result_size[0] != result_size[1] || memcmp(result[0], result[1], result_size[0]) != 0) {
+			printf("FAIL: %s reads differ\n", reads[r].label);
+			failed = TRUE;
+		}
+	}
+
+	for (block = 0; block < 2; block++) {
+		unsigned long calls0 = calls;
+		unsigned long disk0 = host_disk_write_calls;
+		double start = Now();
+		Open(block ? "H1:W1.BIN" : "H1:W0.BIN", 8);
+		memcpy(MEMORY_mem + BUFFER, data, 0x8000);
+		for (i = 0; i < 6; i++)
+			Put(11, BUFFER, 0x8000);
+		Close();
+		printf("%-30s %-5s %7lu %6lu %8.0f\n", "PUT CHARACTERS 32K, binary", block ? "block" : "byte",
+		       calls - calls0, host_disk_write_calls - disk0, 6 * 32 / (Now() - start));
+
+		calls0 = calls;
+		disk0 = host_disk_write_calls;
+		start = Now();
+		Open(block ? "H6:W1.TXT" : "H6:W0.TXT", 8);
+		for (i = 0; i < 2000; i++) {
+			int len = 5 + i % 60;
+			int j;
+			for (j = 0; j < len; j++)
+				MEMORY_mem[BUFFER + j] = 'A' + (i + j) % 26;
+			MEMORY_mem[BUFFER + len] = 0x9b;
+			MEMORY_mem[BUFFER + len + 1] = 'Z';
+			/* every 7th record has no EOL in its buffer */
+			Put(9, BUFFER, i % 7 == 0 ? len - 2 : 120);
+		}
+		Close();
+		printf("%-30s %-5s %7lu %6lu\n", "PUT RECORD, text", block ? "block" : "byte",
+		       calls - calls0, host_disk_write_calls - disk0);
+	}
+	CompareFiles("binary files", "/h/W0.BIN", "/h/W1.BIN");
+	CompareFiles("text files", "/h/W0.TXT", "/h/W1.TXT");
+
+	return failed;
+}
@@ -0,0 +1,151 @@
+/*
+ * heap.c - runs the heap budget check of libatari800_test on a RAM disk
+ *
+ * Copyright (C) 2026 Atari800 development team (see DOC/CREDITS)
+ *
+ * This file is part of the Atari800 emulator project which emulates
+ * the Atari 400, 800, 800XL, 130XE, and 5200 8-bit computers.
+ *
+ * Atari800 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Atari800 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Atari800; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/* Copies disks and programs from data/ to the RAM disk, adds a tape, an
+   8K cartridge made of data/ATARIBAS.ROM and a 1 MB MegaCart, and boots
+   them in turn with "libatari800_test -heap", which fails if the heap
+   peak goes over the budget the memory regions leave.  Run from the top
+   directory of the sources; other files of data/ can be given instead:
+
+	util/host/build.sh util/host/heap.c && $WORK/test [file...]
+*/
+
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "atari.h"
+#include "ff.h"
+#undef printf
+
+int printf(const char *format, ...);
+int main_TODO3(int argc, char **argv);
+
+extern bool PSRAM_AVAILABLE;
+
+#define CART_HEADER 16
+#define MEGACART_SIZE (1 << 20)
+
+static FATFS fs;
+static UBYTE buf[CART_HEADER + MEGACART_SIZE];
+
+static int Put(char const *name, UBYTE const *data, UINT size)
+{
+	FIL f;
+	UINT written = 0;
+	if (f_open(&f, name, FA_WRITE | FA_CREATE_ALWAYS) != FR_OK)
+		return FALSE;
+	f_write(&f, data, size, &written);
+	f_close(&f);
+	return written == size;
+}
+
+/* Copies data/NAME to /NAME on the RAM disk. */
+static int Copy(char const *name)
+{
+	char path[256] = "data/";
+	char card[256] = "/";
+	int fd;
+	long size;
+	strncat(path, name, sizeof(path) - 6);
+	strncat(card, name, sizeof(card) - 2);
+	fd = open(path, O_RDONLY);
+	if (fd < 0) {
+		printf("%s: cannot be read\n", path);
+		return FALSE;
+	}
+	size = read(fd, buf, sizeof(buf));
+	close(fd);
+	return size > 0 && Put(card, buf, size);
+}
+
+/* Writes a CART file of TYPE with the SIZE bytes at buf + CART_HEADER. */
+static int PutCart(char const *name, int type, ULONG size)
+{
+	ULONG sum = 0;
+	ULONG i;
+	for (i = 0; i < size; i++)
+		sum += buf[CART_HEADER + i];
+	memset(buf, 0, CART_HEADER);
+	memcpy(buf, "CART", 4);
+	buf[7] = type;
+	buf[8] = (UBYTE) (sum >> 24);
+	buf[9] = (UBYTE) (sum >> 16);
+	buf[10] = (UBYTE) (sum >> 8);
+	buf[11] = (UBYTE) sum;
+	return Put(name, buf, CART_HEADER + size);
+}
+
+int main(int argc, char **argv)
+{
+	/* a tape of one 128 byte record at 600 baud */
+	static UBYTE const tape[] = {
+		'F', 'U', 'J', 'I', 0, 0, 0, 0,
+		'b', 'a', 'u', 'd', 0, 0, 0x58, 0x02,
+		'd', 'a', 't', 'a', 132, 0, 0x20, 0x4e, 0x55, 0x55, 0xfc
+	};
+	static char const *const files[] = { "dos20.atr", "maze.xex", "wasteland.atr", NULL };
+	static char names[16][64];
+	static BYTE work[4096];
+	MKFS_PARM opt = { FM_FAT32, 0, 0, 0, 0 };
+	char const *const *list;
+	char *args[24] = { "libatari800_test", "-heap" };
+	int n = 2;
+	int fd;
+	int i;
+
+	f_mkfs("", &opt, work, sizeof(work));
+	f_mount(&fs, "", 1);
+	PSRAM_AVAILABLE = TRUE;
+
+	list = argc > 1 ? (char const *const *) argv + 1 : files;
+	for (i = 0; list[i] != NULL && i < 16; i++) {
+		if (!Copy(list[i]))
+			return 1;
+		strcpy(names[i], "/");
+		strncat(names[i], list[i], sizeof(names[0]) - 2);
+		args[n++] = names[i];
+	}
+	if (argc == 1) {
+		memset(buf, 0, sizeof(buf));
+		memcpy(buf, tape, sizeof(tape));
+		Put("/tape.cas", buf, 8 + 8 + 8 + 132);
+		args[n++] = "/tape.cas";
+
+		fd = open("data/ATARIBAS.ROM", O_RDONLY);
+		if (fd < 0 || read(fd, buf + CART_HEADER, 0x2000) != 0x2000) {
+			printf("data/ATARIBAS.ROM: cannot be read\n");
+			return 1;
+		}
+		close(fd);
+		PutCart("/basic.car", 1, 0x2000);
+		args[n++] = "/basic.car";
+
+		for (i = 0; i < MEGACART_SIZE; i++)
+			buf[CART_HEADER + i] = (UBYTE) (i * 13 ^ i >> 8);
+		PutCart("/mega.car", 32, MEGACART_SIZE);
+		args[n++] = "/mega.car";
+	}
+	args[n] = NULL;
+	return main_TODO3(n, args);
+}
@@ -0,0 +1,227 @@
+/*
+ * idecache.c - checks and times IDE commands on a cached image
+ *
+ * Copyright (C) 2026 Atari800 development team (see DOC/CREDITS)
+ *
+ * This file is part of the Atari800 emulator project which emulates
+ * the Atari 400, 800, 800XL, 130XE, and 5200 8-bit computers.
+ *
+ * Atari800 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Atari800 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Atari800; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/* Drives the IDE registers as a PIO driver does, against a 4 MB image
+   file on the RAM disk: sequential, random and FAT-like reads, writes
+   that are flushed with FLUSH CACHE or left for the idle write-back,
+   and a final read of the whole image.  Every sector read must hold what
+   was last written, and so must the image file after IDE_Exit.  Prints
+   the card calls and blocks of each pattern and the commands per second
+   of an SD card taking 0.6 ms a call and 1.5 MB/s.  The optional
+   argument sets the SRAM cache in KB, 0 for no cache:
+
+	util/host/build.sh util/host/idecache.c && $WORK/test [KB]
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "blkcache.h"
+#include "ide.h"
+#include "ff.h"
+#undef printf
+
+int printf(const char *format, ...);
+
+extern unsigned long host_disk_reads, host_disk_writes;
+extern unsigned long host_disk_read_calls, host_disk_write_calls;
+
+#define SECTORS 8192
+
+#define REG_DATA 0xd500
+#define REG_COUNT 0xd502
+#define REG_LBA0 0xd503
+#define REG_LBA1 0xd504
+#define REG_LBA2 0xd505
+#define REG_DEVICE 0xd506
+#define REG_COMMAND 0xd507
+#define REG_DATA_HIGH 0xd508
+
+#define READ_SECTORS 0x20
+#define WRITE_SECTORS 0x30
+#define READ_MULTIPLE 0xc4
+#define SET_MULTIPLE 0xc6
+#define FLUSH_CACHE 0xe7
+
+static FATFS fs;
+static UBYTE image[SECTORS][512];
+static unsigned long commands, errors;
+static unsigned long reads0, writes0, read_calls0, write_calls0, commands0;
+
+static void SetRegisters(int lba, int count)
+{
+	IDE_PutByte(REG_COUNT, count);
+	IDE_PutByte(REG_LBA0, lba);
+	IDE_PutByte(REG_LBA1, lba >> 8);
+	IDE_PutByte(REG_LBA2, lba >> 16);
+	IDE_PutByte(REG_DEVICE, 0xe0 | ((lba >> 24) & 0x0f));
+}
+
+static void Read(int lba, int count, int command)
+{
+	static UBYTE buf[16 * 512];
+	int i;
+	SetRegisters(lba, count);
+	IDE_PutByte(REG_COMMAND, command);
+	commands++;
+	for (i = 0; i < count * 256; i++) {
+		if (!(IDE_GetByte(REG_COMMAND, FALSE) & 0x08))
+			break;
+		buf[2 * i] = IDE_GetByte(REG_DATA, FALSE);
+		buf[2 * i + 1] = IDE_GetByte(REG_DATA_HIGH, FALSE);
+	}
+	if (i < count * 256 || IDE_GetByte(REG_COMMAND, FALSE) & 0x01
+	 || memcmp(buf, image[lba], count * 512) != 0) {
+		if (errors++ < 10)
+			printf("read of %d sectors at %d failed\n", count, lba);
+	}
+}
+
+/* Writes new random data to sector LBA. */
+static void Write(int lba)
+{
+	int i;
+	for (i = 0; i < 512; i++)
+		image[lba][i] = rand();
+	SetRegisters(lba, 1);
+	IDE_PutByte(REG_COMMAND, WRITE_SECTORS);
+	commands++;
+	for (i = 0; i < 256; i++) {
+		if (!(IDE_GetByte(REG_COMMAND, FALSE) & 0x08))
+			break;
+		IDE_PutByte(REG_DATA_HIGH, image[lba][2 * i + 1]);
+		IDE_PutByte(REG_DATA, image[lba][2 * i]);
+	}
+	if (i < 256 || IDE_GetByte(REG_COMMAND, FALSE) & 0x01) {
+		if (errors++ < 10)
+			printf("write at %d failed\n", lba);
+	}
+}
+
+static void Start(void)
+{
+	reads0 = host_disk_reads;
+	writes0 = host_disk_writes;
+	read_calls0 = host_disk_read_calls;
+	write_calls0 = host_disk_write_calls;
+	commands0 = commands;
+}
+
+static void Report(char const *what, unsigned long sectors)
+{
+	unsigned long calls = host_disk_read_calls - read_calls0 + host_disk_write_calls - write_calls0;
+	unsigned long blocks = host_disk_reads - reads0 + host_disk_writes - writes0;
+	double seconds = calls * 0.6e-3 + blocks * 512 / 1.5e6;
+	printf("%-34s %5lu %7lu %6lu %7lu %7.0f\n", what, commands - commands0, sectors,
+	       calls, blocks, (commands - commands0) / seconds);
+}
+
+int main(int argc, char **argv)
+{
+	static BYTE work[4096];
+	MKFS_PARM opt = { FM_FAT, 0, 0, 0, 16384 };
+	char *args[] = { "atari800", "-ide", "/hd.img", NULL };
+	int nargs = 3;
+	FIL f;
+	UINT n;
+	int i, j;
+
+	f_mkfs("", &opt, work, sizeof(work));
+	f_mount(&fs, "", 1);
+	for (i = 0; i < SECTORS; i++)
+		for (j = 0; j < 512; j++)
+			image[i][j] = (i * 7 + j * 13 + (i >> 8)) & 0xff;
+	f_open(&f, "/hd.img", FA_WRITE | FA_CREATE_ALWAYS);
+	f_write(&f, image, sizeof(image), &n);
+	f_close(&f);
+	if (argc > 1)
+		BLKCACHE_sram_kb = atoi(argv[1]);
+	if (!IDE_Initialise(&nargs, args)) {
+		printf("FAIL: IDE_Initialise\n");
+		return 1;
+	}
+	srand(1);
+
+	printf("pattern                             cmds sectors  calls  blocks cmds/s\n");
+	Start();
+	for (i = 0; i < 2048; i++)
+		Read(i, 1, READ_SECTORS);
+	Report("sequential READ SECTORS x1", 2048);
+
+	IDE_PutByte(REG_COUNT, 16);
+	IDE_PutByte(REG_COMMAND, SET_MULTIPLE);
+	Start();
+	for (i = 2048; i < 4096; i += 16)
+		Read(i, 16, READ_MULTIPLE);
+	Report("sequential READ MULTIPLE x16", 2048);
+
+	Start();
+	for (i = 0; i < 2000; i++)
+		Read(rand() % SECTORS, 1, READ_SECTORS);
+	Report("random READ SECTORS x1", 2000);
+
+	/* a file read, going back to the FAT and directory now and then */
+	Start();
+	for (i = 0; i < 2000; i++)
+		Read(i % 3 == 0 ? rand() % 16 : 4096 + i, 1, READ_SECTORS);
+	Report("file read with FAT lookups", 2000);
+
+	Start();
+	for (i = 0; i < 1024; i++) {
+		Write(5000 + i);
+		if (i % 64 == 63)
+			Write(rand() % 16);
+	}
+	IDE_PutByte(REG_COMMAND, FLUSH_CACHE);
+	Report("file write with FAT, FLUSH CACHE", 1024 + 16);
+
+	Start();
+	for (i = 0; i < 500; i++)
+		Write(6500 + rand() % 200);
+	for (i = 0; i < BLKCACHE_WRITEBACK_FRAMES + 10; i++)
+		BLKCACHE_Frame();
+	Report("random WRITE SECTORS x1, idle", 500);
+
+	for (i = 0; i < SECTORS; i += 16)
+		Read(i, 16, READ_MULTIPLE);
+	IDE_Exit();
+
+	{
+		static UBYTE file[SECTORS][512];
+		n = 0;
+		if (f_open(&f, "/hd.img", FA_READ) == FR_OK) {
+			f_read(&f, file, sizeof(file), &n);
+			f_close(&f);
+		}
+		if (n != sizeof(file) || memcmp(file, image, sizeof(file)) != 0) {
+			printf("FAIL: the image file differs\n");
+			return 1;
+		}
+	}
+	if (errors > 0) {
+		printf("FAIL: %lu commands\n", errors);
+		return 1;
+	}
+	printf("all sectors and the image file match\n");
+	return 0;
+}
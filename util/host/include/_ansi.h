@@ -0,0 +1,2 @@
+/* Stand-in for newlib's _ansi.h, used by src/debug.h. */
+#define _ATTRIBUTE(attrs)
@@ -0,0 +1,7 @@
+/* Stand-in for drivers/graphics/graphics.h; the palette set by the emulator
+   is kept in host_palette[] by util/host/stub.c. */
+#include <stdint.h>
+
+#define RGB888(r, g, b) ((r << 16) | (g << 8) | b)
+
+void graphics_set_palette(uint8_t i, uint32_t color);
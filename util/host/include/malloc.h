@@ -0,0 +1,15 @@
+/* Stand-in for newlib's malloc.h, which, unlike glibc's, does not pull in
+   stdio.h.  mallinfo() is answered by util/host/stub.c, which reports the
+   heap the emulator would have on the device. */
+#ifndef HOST_MALLOC_H_
+#define HOST_MALLOC_H_
+
+#include <stddef.h>
+
+struct mallinfo {
+	int arena, ordblks, smblks, hblks, hblkhd, usmblks, fsmblks, uordblks, fordblks, keepcost;
+};
+struct mallinfo host_mallinfo(void);
+#define mallinfo() host_mallinfo()
+
+#endif /* HOST_MALLOC_H_ */
@@ -0,0 +1,2 @@
+/* Stand-in for the Pico SDK header of the same name. */
+#include "pico/platform.h"
@@ -0,0 +1,41 @@
+/* Stand-in for the Pico SDK, enough of it for the emulator core to build
+   on the PC.  It is included ahead of every source by util/host/build.sh.
+   Timers read 0 and the hardware calls do nothing; the SDK mutexes, which
+   FatFs locks its volumes with, are in util/host/stub.c. */
+#ifndef HOST_PICO_PLATFORM_H_
+#define HOST_PICO_PLATFORM_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define __in_flash(...)
+#define __not_in_flash(...)
+#define __not_in_flash_func(f) f
+#define __time_critical_func(f) f
+#define __scratch_x(...)
+#define __scratch_y(...)
+#define __aligned(x) __attribute__((aligned(x)))
+#define __force_inline inline
+
+#define PICO_DEFAULT_LED_PIN 25
+
+typedef unsigned int uint;
+typedef uint64_t absolute_time_t;
+
+static inline absolute_time_t get_absolute_time(void) { return 0; }
+static inline uint32_t to_ms_since_boot(absolute_time_t t) { return 0; }
+static inline uint64_t time_us_64(void) { return 0; }
+static inline uint32_t time_us_32(void) { return 0; }
+static inline void sleep_ms(uint32_t ms) {}
+static inline void sleep_us(uint64_t us) {}
+static inline void tight_loop_contents(void) {}
+static inline uint get_core_num(void) { return 0; }
+static inline void gpio_put(uint gpio, bool value) {}
+
+typedef struct { int unused; } mutex_t;
+
+void mutex_init(mutex_t *mtx);
+bool mutex_enter_timeout_ms(mutex_t *mtx, uint32_t timeout_ms);
+void mutex_exit(mutex_t *mtx);
+
+#endif /* HOST_PICO_PLATFORM_H_ */
@@ -0,0 +1,304 @@
+/*
+ * iodelay.c - counts late frames and audio underruns on a slow card
+ *
+ * Copyright (C) 2026 Atari800 development team (see DOC/CREDITS)
+ *
+ * This file is part of the Atari800 emulator project which emulates
+ * the Atari 400, 800, 800XL, 130XE, and 5200 8-bit computers.
+ *
+ * Atari800 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Atari800 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Atari800; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/* Runs scanlines paced to 12 ms of emulation per frame, as on the
+   device, while DOS loads and saves files on an ATR through the SIO
+   bytes, and then while a program streams from a hard disk image and
+   writes records to it.  The card takes 1.5 ms a call, 4 ms a write and
+   0.35 ms a sector.  Each frame beyond 20 ms drains an audio buffer of
+   two frames.  Sectors read must be those written, and so must the ATR
+   after dismounting.  Prints frames late, the worst frame and audio
+   underruns.  Options: -worker accesses the card from a worker thread,
+   as core1 does, instead of inline, and -nopsram leaves out the PSRAM
+   cache level:
+
+	util/host/build.sh util/host/iodelay.c && $WORK/test [options]
+*/
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "atari.h"
+#include "blkcache.h"
+#include "esc.h"
+#include "ioqueue.h"
+#include "pokey.h"
+#include "sio.h"
+#undef printf
+
+int printf(const char *format, ...);
+int usleep(unsigned usec);
+
+extern bool PSRAM_AVAILABLE;
+extern UBYTE POKEY_SERIN;
+extern unsigned long host_disk_read_calls, host_disk_write_calls;
+extern unsigned host_disk_call_us, host_disk_write_us, host_disk_sector_us;
+
+#define FRAME_MS 20.0
+#define EMULATION_MS 12.0
+#define AUDIO_MS (2 * FRAME_MS)
+
+static FATFS fs;
+static UBYTE atr[721][128];
+static long frames, late_frames, underruns, errors;
+static double frame_start, worst, audio = AUDIO_MS;
+static int line;
+
+static double Now_ms(void)
+{
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec * 1e3 + t.tv_nsec * 1e-6;
+}
+
+static void Scanline(void)
+{
+	POKEY_Scanline();
+	while (Now_ms() < frame_start + line * (EMULATION_MS / Atari800_TV_PAL));
+	if (++line == Atari800_TV_PAL) {
+		double cost;
+		BLKCACHE_Frame();
+		cost = Now_ms() - frame_start;
+		if (cost > worst)
+			worst = cost;
+		if (cost > FRAME_MS)
+			late_frames++;
+		audio -= cost;
+		if (audio < 0) {
+			underruns++;
+			audio = 0;
+		}
+		audio += FRAME_MS;
+		if (audio > AUDIO_MS)
+			audio = AUDIO_MS;
+		frames++;
+		line = 0;
+		frame_start = Now_ms();
+	}
+}
+
+/* Waits for the serial input interrupt and returns the byte. */
+static int SerIn(void)
+{
+	for (;;) {
+		Scanline();
+		if (!(POKEY_IRQST & 0x20)) {
+			POKEY_IRQST |= 0x20;
+			return POKEY_SERIN;
+		}
+	}
+}
+
+static void Command(int command, int sector)
+{
+	UBYTE frame[5] = { 0x31, command, sector & 0xff, sector >> 8, 0 };
+	int i;
+	frame[4] = SIO_ChkSum(frame, 4);
+	SIO_SwitchCommandFrame(1);
+	for (i = 0; i < 5; i++)
+		SIO_PutByte(frame[i]);
+	SIO_SwitchCommandFrame(0);
+}
+
+static void ReadSector(int sector)
+{
+	UBYTE buf[130];
+	int i;
+	Command(0x52, sector);
+	if (SerIn() != 'A') {
+		errors++;
+		return;
+	}
+	for (i = 0; i < 130; i++)
+		buf[i] = SerIn();
+	if (buf[0] != 'C' || memcmp(buf + 1, atr[sector], 128) != 0 || buf[129] != SIO_ChkSum(buf + 1, 128))
+		errors++;
+}
+
+static void WriteSector(int sector)
+{
+	int i;
+	for (i = 0; i < 128; i++)
+		atr[sector][i] = rand();
+	Command(0x57, sector);
+	if (SerIn() != 'A') {
+		errors++;
+		return;
+	}
+	for (i = 0; i < 128; i++)
+		SIO_PutByte(atr[sector][i]);
+	SIO_PutByte(SIO_ChkSum(atr[sector], 128));
+	if (SerIn() != 'A' || SerIn() != 'C')
+		errors++;
+}
+
+static void Report(char const *what)
+{
+	printf("%-4s %6ld %5ld %6.1f %9ld %6lu %6lu\n", what, frames, late_frames, worst, underruns,
+	       host_disk_read_calls, host_disk_write_calls);
+	frames = late_frames = underruns = 0;
+	worst = 0;
+	host_disk_read_calls = host_disk_write_calls = 0;
+}
+
+static void *Worker(void *arg)
+{
+	for (;;) {
+		IOQUEUE_Work();
+		usleep(20);
+	}
+	return arg;
+}
+
+int main(int argc, char **argv)
+{
+	/* the ATR header: 720 * 128 / 16 = 0x1680 paragraphs */
+	static UBYTE const atr_header[16] = { 0x96, 0x02, 0x80, 0x16, 0x80, 0x00 };
+	static BYTE work[4096];
+	MKFS_PARM opt = { FM_FAT, 0, 0, 0, 4096 };
+	int worker = FALSE;
+	FIL f;
+	UINT n;
+	int i, j;
+
+	PSRAM_AVAILABLE = TRUE;
+	for (i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "-worker") == 0)
+			worker = TRUE;
+		else if (strcmp(argv[i], "-nopsram") == 0)
+			PSRAM_AVAILABLE = FALSE;
+	}
+	f_mkfs("", &opt, work, sizeof(work));
+	f_mount(&fs, "", 1);
+	srand(1);
+	for (i = 1; i <= 720; i++)
+		for (j = 0; j < 128; j++)
+			atr[i][j] = rand();
+	f_open(&f, "/d1.atr", FA_WRITE | FA_CREATE_ALWAYS);
+	f_write(&f, atr_header, sizeof(atr_header), &n);
+	f_write(&f, atr[1], 720 * 128, &n);
+	f_close(&f);
+
+	host_disk_call_us = 1500;
+	host_disk_write_us = 4000;
+	host_disk_sector_us = 350;
+	if (worker) {
+		pthread_t thread;
+		IOQUEUE_UseWorker();
+		pthread_create(&thread, NULL, Worker, NULL);
+	}
+	ESC_enable_sio_patch = TRUE;
+	POKEY_SKCTL = 3;
+	POKEY_IRQEN = 0x20;
+	POKEY_IRQST = 0xff;
+	POKEY_AUDF[POKEY_CHAN3] = 0x28;
+	SIO_Initialise(NULL, NULL);
+	if (!SIO_Mount(1, "/d1.atr", FALSE)) {
+		printf("FAIL: SIO_Mount\n");
+		return 1;
+	}
+	host_disk_read_calls = host_disk_write_calls = 0;
+	printf("%s, %s\n", worker ? "worker" : "inline", PSRAM_AVAILABLE ? "SRAM and PSRAM" : "SRAM only");
+	printf("     frames  late  worst underruns  reads writes\n");
+
+	/* DOS loading files of 10 to 60 sectors from all over the disk,
+	   updating the VTOC and directory after every few files and saving a
+	   file now and then, then idle until written back */
+	frame_start = Now_ms();
+	srand(2);
+	for (i = 0; i < 60; i++) {
+		int sector = 4 + rand() % 650;
+		int count = 10 + rand() % 50;
+		for (j = 0; j < count && sector + j <= 720; j++)
+			ReadSector(sector + j);
+		if (i % 5 == 4) {
+			WriteSector(360);
+			WriteSector(361);
+			WriteSector(4 + rand() % 700);
+		}
+		if (i % 10 == 9) {
+			sector = 4 + rand() % 650;
+			for (j = 0; j < 40; j++)
+				WriteSector(sector + j);
+		}
+	}
+	for (i = 0; i < Atari800_TV_PAL * 120; i++)
+		Scanline();
+	Report("SIO");
+
+	/* a program streaming from a hard disk image and writing scattered
+	   records, pausing now and then */
+	{
+		static BLKCACHE_dev_t hd = { "HD" };
+		static UBYTE buf[0x10000];
+		FSIZE_t pos = 0;
+		f_open(&f, "/hd.img", FA_WRITE | FA_READ | FA_CREATE_ALWAYS);
+		for (i = 0; i < 64; i++) {
+			for (j = 0; j < (int) sizeof(buf); j++)
+				buf[j] = rand();
+			f_write(&f, buf, sizeof(buf), &n);
+		}
+		BLKCACHE_Map(&f);
+		frame_start = Now_ms();
+		for (i = 0; i < 20; i++) {
+			int k;
+			for (k = 0; k < 300; k++) {
+				BLKCACHE_Read(&hd, &f, pos, buf, 256, &n);
+				pos = (pos + 256) % (4 << 20);
+				if (k % 3 == 0)
+					BLKCACHE_Write(&hd, &f, (FSIZE_t) (rand() % 8192) * 512, buf, 512, &n);
+				for (j = 0; j < Atari800_TV_PAL / 4; j++)
+					Scanline();
+			}
+			for (k = 0; k < Atari800_TV_PAL * 60; k++)
+				Scanline();
+		}
+		BLKCACHE_Release(&f);
+		f_close(&f);
+	}
+	Report("HD");
+	printf("queue: %lu submitted, %lu deep at most, %lu waits\n", (unsigned long) IOQUEUE_stats.submitted,
+	       (unsigned long) IOQUEUE_stats.max_depth, (unsigned long) IOQUEUE_stats.waits);
+
+	SIO_Dismount(1);
+	BLKCACHE_Exit();
+	{
+		static UBYTE file[sizeof(atr_header) + 720 * 128];
+		n = 0;
+		if (f_open(&f, "/d1.atr", FA_READ) == FR_OK) {
+			f_read(&f, file, sizeof(file), &n);
+			f_close(&f);
+		}
+		if (n != sizeof(file) || memcmp(file + sizeof(atr_header), atr[1], 720 * 128) != 0) {
+			printf("FAIL: the ATR differs\n");
+			return 1;
+		}
+	}
+	if (errors > 0) {
+		printf("FAIL: %ld sectors\n", errors);
+		return 1;
+	}
+	return 0;
+}
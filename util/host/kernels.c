@@ -0,0 +1,91 @@
+/*
+ * kernels.c - times the ANTIC 2, 4, E and F mode line kernels
+ *
+ * Copyright (C) 2026 Atari800 development team (see DOC/CREDITS)
+ *
+ * This file is part of the Atari800 emulator project which emulates
+ * the Atari 400, 800, 800XL, 130XE, and 5200 8-bit computers.
+ *
+ * Atari800 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Atari800 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Atari800; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/* Draws a normal width line of each mode over random screen data with
+   the kernel that merges PMG, which all lines used before, and with the
+   PMG-free kernel that ANTIC_Frame now picks for lines without players
+   or missiles, and prints the time per line.  The kernels are static, so
+   antic.c is built into this file:
+
+	util/host/build.sh -x antic.c util/host/kernels.c && $WORK/test [lines]
+*/
+
+#include "antic.c"
+
+#include <stdlib.h>
+#include <time.h>
+
+#include "libatari800/libatari800.h"
+#undef printf
+
+int printf(const char *format, ...);
+
+static double Time_ns(draw_antic_function draw, long lines)
+{
+	UWORD *screen = (UWORD *) Screen_atari + 64 * Screen_WIDTH / 2;
+	struct timespec start, end;
+	long i;
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &start);
+	for (i = 0; i < lines; i++)
+		draw(chars_displayed[NORMAL0],
+		     antic_memory + ANTIC_margin + ch_offset[NORMAL0],
+		     screen + x_min[NORMAL0],
+		     (ULONG *) &GTIA_pm_scanline[x_min[NORMAL0]]);
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &end);
+	return ((end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec)) / lines;
+}
+
+int main(int argc, char **argv)
+{
+	static int const modes[] = { 2, 4, 0xe, 0xf };
+	char *args[] = { "-atari", NULL };
+	long const lines = argc > 1 ? atol(argv[1]) : 1000000;
+	input_template_t input;
+	int m, i;
+
+	libatari800_init(-1, args);
+	libatari800_clear_input_array(&input);
+	for (i = 0; i < 100; i++)
+		libatari800_next_frame(&input);
+
+	srand(1);
+	for (i = 0; i < (int) sizeof(antic_memory); i++)
+		antic_memory[i] = rand();
+	memset(GTIA_pm_scanline, 0, sizeof(GTIA_pm_scanline));
+
+	printf("ns per line, %ld lines\n", lines);
+	printf("mode  PMG merge  PMG-free  player\n");
+	for (m = 0; m < 4; m++) {
+		draw_antic_function merge = draw_antic_table[0][modes[m]];
+		draw_antic_function nopm = draw_antic_nopm_table[modes[m]];
+		double merge_ns = Time_ns(merge, lines);
+		double nopm_ns = Time_ns(nopm, lines);
+		double player_ns;
+		/* a player 8 pixel pairs wide in the middle of the line */
+		memset(GTIA_pm_scanline + Screen_WIDTH / 4, 1, 8);
+		player_ns = Time_ns(merge, lines);
+		memset(GTIA_pm_scanline, 0, sizeof(GTIA_pm_scanline));
+		printf("%4X %10.1f %9.1f %7.1f\n", modes[m], merge_ns, nopm_ns, player_ns);
+	}
+	return 0;
+}
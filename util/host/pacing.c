@@ -0,0 +1,166 @@
+/*
+ * pacing.c - simulates the frame pacing governor against a display and
+ *            an audio consumer
+ *
+ * Copyright (C) 2026 Atari800 development team (see DOC/CREDITS)
+ *
+ * This file is part of the Atari800 emulator project which emulates
+ * the Atari 400, 800, 800XL, 130XE, and 5200 8-bit computers.
+ *
+ * Atari800 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Atari800 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Atari800; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/* Runs 10 minutes of simulated PAL frames through PACING_EndFrame for
+   several displays and audio clocks.  Frames cost 9-15 ms, some
+   scenarios have heavy scenes of 26 ms (17 ms when not drawn), and every
+   minute the card stalls a frame for 200 ms.  The audio consumer drains
+   the queue at its own clock.
+
+	util/host/build.sh util/host/pacing.c && $WORK/test
+
+   Fails if a scenario is off the PAL rate by more than 0.5%, lets the
+   audio queue grow past 4 frames, or underruns other than at stalls and
+   in the first frames of heavy scenes, before frame skip catches up. */
+
+#include <stdlib.h>
+
+#include "atari.h"
+#include "pacing.h"
+#undef printf
+
+int printf(const char *format, ...);
+
+#define FPS 49.8607597
+#define AUDIO_RATE 44100
+#define SECONDS 600
+#define STALL_EVERY 3000	/* frames */
+#define STALL_US 200000
+#define HEAVY_EVERY 500		/* frames, the last 99 of them heavy */
+#define HEAVY_UNDERRUNS 5	/* allowed at the start of a heavy scene */
+#define MAX_FILL 4			/* frames of audio */
+
+typedef struct {
+	double vsync_hz;	/* 0 for a display without vsync */
+	double consumer_hz;
+	int heavy;
+	int refresh_rate;
+} scenario_t;
+
+static int Run(scenario_t const *s)
+{
+	int const bytes_per_frame = (int) (AUDIO_RATE / FPS + 1) * 2;
+	double t = 0;		/* us */
+	double fill = 0;	/* audio bytes queued */
+	double min_fill = 1e9, max_fill = 0;
+	long frames = 0, stalls = 0, heavy_scenes = 0, underruns = 0;
+	long allowed;
+	int counter = 0;
+	double fps;
+	int ok;
+
+	srand(1);
+	Atari800_refresh_rate = s->refresh_rate;
+	PACING_Init((ULONG) (FPS * 1000), bytes_per_frame);
+	PACING_Reset(0);
+
+	while (t < SECONDS * 1e6) {
+		double cost = 9000 + rand() % 6000;
+		ULONG vsync_count;
+		unsigned long long next;
+
+		/* as Atari800_Frame: one frame drawn in refresh_rate + extra_skip */
+		Atari800_display_screen = ++counter >= Atari800_refresh_rate + PACING_extra_skip;
+		if (Atari800_display_screen)
+			counter = 0;
+		if (s->heavy && frames % HEAVY_EVERY > HEAVY_EVERY - 100) {
+			cost = Atari800_display_screen ? 26000 : 17000;
+			if (frames % HEAVY_EVERY == HEAVY_EVERY - 99)
+				heavy_scenes++;
+		}
+		if (frames % STALL_EVERY == STALL_EVERY / 2) {
+			cost = STALL_US;
+			stalls++;
+		}
+
+		t += cost;
+		fill -= cost * s->consumer_hz * 2 / 1e6;
+		if (fill < 0) {
+			fill = 0;
+			underruns++;
+		}
+		fill += AUDIO_RATE / FPS * 2;
+		frames++;
+		if (t > 10e6) {
+			if (fill < min_fill)
+				min_fill = fill;
+			if (fill > max_fill)
+				max_fill = fill;
+		}
+
+		vsync_count = (ULONG) (t * s->vsync_hz / 1e6);
+		next = PACING_EndFrame((unsigned long long) t, vsync_count,
+		                       s->vsync_hz > 0 ? (ULONG) (vsync_count * 1e6 / s->vsync_hz) : 0,
+		                       (int) fill);
+		if (next > t) {
+			fill -= (next - t) * s->consumer_hz * 2 / 1e6;
+			if (fill < 0) {
+				fill = 0;
+				underruns++;
+			}
+			t = next;
+		}
+	}
+
+	fps = frames / (t / 1e6);
+	/* one more underrun as the queue first fills up */
+	allowed = 1 + stalls + heavy_scenes * HEAVY_UNDERRUNS;
+	ok = fps > FPS * 0.995 && fps < FPS * 1.005 && max_fill <= MAX_FILL * bytes_per_frame
+	     && underruns <= allowed;
+	printf("%6.2f %6.0f %5d %7d  %8.4f %4ld/%-4ld %5.2f..%4.2f %6lu %5lu %5lu %6lu %6ld%s\n",
+	       s->vsync_hz, s->consumer_hz, s->heavy, s->refresh_rate, fps, underruns, allowed,
+	       min_fill / bytes_per_frame, max_fill / bytes_per_frame,
+	       (unsigned long) PACING_stats.vsync_locked, (unsigned long) PACING_stats.late_frames,
+	       (unsigned long) PACING_stats.resyncs, (unsigned long) PACING_stats.skipped_frames,
+	       (long) PACING_stats.max_drift_us, ok ? "" : "  FAIL");
+	return ok;
+}
+
+int main(void)
+{
+	static scenario_t const scenarios[] = {
+		{ 50.0, 44100, FALSE, 1 },
+		{ 49.9, 44100, FALSE, 1 },
+		{ 50.2, 44100, FALSE, 1 },
+		{ 59.94, 44100, FALSE, 1 },
+		{ 0, 44100, FALSE, 1 },
+		{ 50.0, 44000, FALSE, 1 },
+		{ 50.0, 44200, FALSE, 1 },
+		{ 50.0, 44100, TRUE, 1 },
+		{ 0, 44100, TRUE, 1 },
+		{ 50.0, 44100, TRUE, 2 }
+	};
+	int failed = 0;
+	int i;
+
+	printf(" vsync  audio heavy refresh     fps  underruns  fill(frames) locked  late resync skipped drift(us)\n");
+	for (i = 0; i < (int) (sizeof(scenarios) / sizeof(scenarios[0])); i++)
+		if (!Run(&scenarios[i]))
+			failed++;
+	if (failed) {
+		printf("FAIL: %d scenarios\n", failed);
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,224 @@
+/*
+ * psramsize.c - checks the users of PSRAM on chips of other sizes
+ *
+ * Copyright (C) 2026 Atari800 development team (see DOC/CREDITS)
+ *
+ * This file is part of the Atari800 emulator project which emulates
+ * the Atari 400, 800, 800XL, 130XE, and 5200 8-bit computers.
+ *
+ * Atari800 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Atari800 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Atari800; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/* Runs the emulator with a PSRAM chip of the size given in MB (2 by
+   default; 2, 4, 8 or 16) and uses every tier of it at once: rewind
+   snapshots of a machine whose memory changes a lot, a boot snapshot of a
+   blank disk, a 1 MB cartridge and a 2 MB file read twice through the block cache.
+   Checks that nothing is accessed past the end of the chip, that each
+   tier still reads back what it wrote after the others ran, and that the
+   boot snapshot is only taken on a chip with room for it:
+
+	util/host/build.sh util/host/psramsize.c && $WORK/test [MB]
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "libatari800/libatari800.h"
+#include "blkcache.h"
+#include "bootsnap.h"
+#include "cartcache.h"
+#include "cartridge.h"
+#include "ff.h"
+#include "memory.h"
+#include "rewind.h"
+#include "sio.h"
+#undef printf
+
+int printf(const char *format, ...);
+
+extern bool PSRAM_AVAILABLE;
+extern uint32_t PSRAM_SIZE;
+extern unsigned long host_psram_wr, host_psram_outside;
+extern unsigned long host_disk_read_calls;
+
+#define CART_HEADER 16
+#define CART_SIZE (1 << 20)
+#define FILE_SIZE (2 << 20)
+#define ATR_SIZE (16 + 720 * 128)
+
+static FATFS fs;
+static input_template_t input;
+static UBYTE buf[CART_HEADER + FILE_SIZE];
+static int failed = FALSE;
+
+static UBYTE Byte(ULONG i, int seed)
+{
+	return (UBYTE) (i * seed ^ i >> 8 ^ i >> 16);
+}
+
+static int Put(char const *name, UINT size)
+{
+	FIL f;
+	UINT written = 0;
+	if (f_open(&f, name, FA_WRITE | FA_CREATE_ALWAYS) != FR_OK)
+		return FALSE;
+	f_write(&f, buf, size, &written);
+	f_close(&f);
+	return written == size;
+}
+
+static void Check(int ok, char const *what)
+{
+	if (!ok) {
+		printf("FAIL: %s\n", what);
+		failed = TRUE;
+	}
+	if (host_psram_outside != 0) {
+		printf("FAIL: %lu accesses past the end of the chip by %s\n", host_psram_outside, what);
+		host_psram_outside = 0;
+		failed = TRUE;
+	}
+}
+
+/* Runs FRAMES frames, changing 4 KB of RAM and taking a snapshot each. */
+static void Run(int frames)
+{
+	static UBYTE data[0x1000];
+	int i;
+	REWIND_interval = 1;
+	for (i = 0; i < frames; i++) {
+		unsigned int j;
+		for (j = 0; j < sizeof(data); j++)
+			data[j] = (UBYTE) rand();
+		MEMORY_dCopyToMem(data, 0x4000 + (rand() & 0x3000), sizeof(data));
+		libatari800_next_frame(&input);
+		REWIND_Frame();
+	}
+	REWIND_interval = 0;
+}
+
+/* Reads the 2 MB file through the block cache, returns FALSE if it
+   differs. */
+static int ReadFile(void)
+{
+	static BLKCACHE_dev_t dev = { "test" };
+	static UBYTE block[0x1000];
+	FIL f;
+	FSIZE_t pos;
+	int ok = f_open(&f, "/big.bin", FA_READ) == FR_OK;
+	for (pos = 0; ok && pos < FILE_SIZE; pos += sizeof(block)) {
+		UINT n;
+		unsigned int j;
+		if (!BLKCACHE_Read(&dev, &f, pos, block, sizeof(block), &n) || n != sizeof(block))
+			ok = FALSE;
+		for (j = 0; ok && j < sizeof(block); j++)
+			ok = block[j] == Byte(pos + j, 7);
+	}
+	BLKCACHE_Release(&f);
+	f_close(&f);
+	return ok;
+}
+
+/* Returns FALSE if a bank of the cartridge differs. */
+static int ReadCart(void)
+{
+	static UBYTE bank[CARTCACHE_BANK_SIZE];
+	ULONG offset;
+	for (offset = 0; offset < CART_SIZE; offset += CARTCACHE_BANK_SIZE) {
+		ULONG j;
+		CARTCACHE_Read(&CARTRIDGE_main, offset, bank, CARTCACHE_BANK_SIZE);
+		for (j = 0; j < CARTCACHE_BANK_SIZE; j++)
+			if (bank[j] != Byte(offset + j, 13))
+				return FALSE;
+	}
+	return TRUE;
+}
+
+int main(int argc, char **argv)
+{
+	static BYTE work[4096];
+	MKFS_PARM opt = { FM_FAT32, 0, 0, 0, 0 };
+	char *args[] = { "-atari", NULL };
+	unsigned long psram_wr;
+	unsigned long calls;
+	ULONG sum = 0;
+	ULONG i;
+	int mb = argc > 1 ? atoi(argv[1]) : 2;
+
+	if (mb < 2 || mb > 16 || (mb & (mb - 1)) != 0) {
+		printf("FAIL: no %d MB chip\n", mb);
+		return 1;
+	}
+	PSRAM_SIZE = (uint32_t) mb << 20;
+	f_mkfs("", &opt, work, sizeof(work));
+	f_mount(&fs, "", 1);
+	libatari800_init(-1, args);
+	libatari800_clear_input_array(&input);
+	PSRAM_AVAILABLE = TRUE;
+	printf("%d MB chip\n", mb);
+
+	/* the boot snapshot is taken at the first SIO call after a cold start,
+	   here reading a blank disk */
+	memset(buf, 0, ATR_SIZE);
+	buf[0] = 0x96;
+	buf[1] = 0x02;
+	buf[2] = (UBYTE) ((ATR_SIZE - 16) >> 4);
+	buf[3] = (UBYTE) ((ATR_SIZE - 16) >> 12);
+	buf[4] = 128;
+	Check(Put("/blank.atr", ATR_SIZE) && SIO_Mount(1, "/blank.atr", TRUE), "mounting the disk");
+	Atari800_Coldstart();
+	for (i = 0; i < 200; i++)
+		libatari800_next_frame(&input);
+	Check(BOOTSNAP_stats.captures == (BOOTSNAP_PSRAM_BASE + BOOTSNAP_PSRAM_SIZE <= BLKCACHE_PSRAM_BASE),
+	      "boot snapshot");
+	printf("boot snapshot %s\n", BOOTSNAP_stats.captures ? "taken" : "not taken");
+
+	srand(1);
+	Run(REWIND_SLOTS + 100);
+	printf("%d rewind snapshots, the newest of %lu bytes\n", REWIND_Count(), (unsigned long) REWIND_stats.last_size);
+	Check(REWIND_Count() > 0 && REWIND_Restore(REWIND_Count() - 1), "rewind");
+
+	for (i = 0; i < FILE_SIZE; i++)
+		buf[i] = Byte(i, 7);
+	Check(Put("/big.bin", FILE_SIZE), "writing the file");
+	psram_wr = host_psram_wr;
+	Check(ReadFile(), "block cache, first read");
+	Check(host_psram_wr != psram_wr, "block cache PSRAM level");
+
+	for (i = 0; i < CART_SIZE; i++)
+		sum += buf[CART_HEADER + i] = Byte(i, 13);
+	memset(buf, 0, CART_HEADER);
+	memcpy(buf, "CART", 4);
+	buf[7] = CARTRIDGE_MEGA_1024;
+	buf[8] = (UBYTE) (sum >> 24);
+	buf[9] = (UBYTE) (sum >> 16);
+	buf[10] = (UBYTE) (sum >> 8);
+	buf[11] = (UBYTE) sum;
+	Check(Put("/mega.car", CART_HEADER + CART_SIZE), "writing the cartridge");
+	Check(CARTRIDGE_Insert("/mega.car") == 0 && CARTRIDGE_main.type == CARTRIDGE_MEGA_1024,
+	      "inserting the cartridge");
+	calls = host_disk_read_calls;
+	Check(ReadCart(), "cartridge");
+	printf("1 MB cartridge %s\n", host_disk_read_calls != calls ? "read from the card"
+	       : CARTCACHE_HoldsRewindArea() ? "in PSRAM over the rewind ring" : "in PSRAM");
+	Run(50);
+
+	Check(ReadFile(), "block cache, second read");
+	Check(ReadCart(), "cartridge after the block cache");
+	CARTRIDGE_Remove();
+	Run(50);
+	Check(REWIND_Count() > 0 && REWIND_Restore(REWIND_Count() - 1), "rewind after the cartridge");
+	return failed;
+}
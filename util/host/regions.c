@@ -0,0 +1,464 @@
+/*
+ * regions.c - mounts and removes media at random over the memory regions
+ *
+ * Copyright (C) 2026 Atari800 development team (see DOC/CREDITS)
+ *
+ * This file is part of the Atari800 emulator project which emulates
+ * the Atari 400, 800, 800XL, 130XE, and 5200 8-bit computers.
+ *
+ * Atari800 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Atari800 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Atari800; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/* Inserts and removes main and piggyback cartridges, mounts ATR, PRO and
+   ATX images in random drives and dismounts them, reconfigures the
+   machine, sets up sound and opens and closes UI sessions, in random
+   order.  After every step the arena must be laid out as region.c means
+   it to be, with the right owners and counts, every cartridge, disk and
+   UI list must still hold its data, and a medium may only have failed
+   to fit if the arena had no room for it.  First the arena is sized for
+   heaps too short for the default one, which must leave Util_malloc()
+   what it needs, cutting the block cache if need be.  The arguments are the arena
+   in KB (0 for the size worked out at start-up), the steps and the seed.
+   The arena is static in region.c, so region.c is built into this file:
+
+	util/host/build.sh -x region.c util/host/regions.c && $WORK/test [KB [steps [seed]]]
+*/
+
+#include "region.c"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "libatari800/libatari800.h"
+#include "cartridge.h"
+#include "memory.h"
+#include "sound.h"
+#undef printf
+
+int printf(const char *format, ...);
+int sprintf(char *str, const char *format, ...);
+
+extern bool PSRAM_AVAILABLE;
+extern size_t host_heap_free;
+
+#define PRO_SECTORS 721		/* sector 1 twice */
+#define ATX_SECTORS 18
+#define UI_LISTS 64
+
+static FATFS fs;
+static input_template_t input;
+static unsigned int rng = 1;
+static int step;
+static int errors = 0;
+
+#define CHECK(cond, what) \
+	do { \
+		if (!(cond)) { \
+			printf("FAIL at step %d: %s\n", step, what); \
+			if (++errors >= 10) \
+				exit(1); \
+		} \
+	} while (0)
+
+static unsigned int Random(unsigned int n)
+{
+	rng = rng * 1103515245 + 12345;
+	return (rng >> 8) % n;
+}
+
+/* Byte I of the data made from SEED. */
+static UBYTE Pattern(unsigned int seed, ULONG i)
+{
+	return (UBYTE) ((i * 7 + seed * 31) ^ (i >> 9) ^ seed);
+}
+
+static void Put(char const *name, UBYTE const *data, ULONG size)
+{
+	FIL f;
+	UINT written;
+	f_open(&f, name, FA_WRITE | FA_CREATE_ALWAYS);
+	f_write(&f, data, size, &written);
+	f_close(&f);
+}
+
+/* Checks the arena: media blocks packed from arena_start to bottom, the
+   others and the gaps from top to arena_end, each block pointed to by
+   its owner, and the counts of REGION_stats. */
+static void CheckArena(void)
+{
+	ULONG used[REGION_COUNT] = { 0 };
+	UBYTE *p;
+	int i;
+	for (p = arena_start; p < bottom; p += BLOCK(p)->size) {
+		header_t *h = BLOCK(p);
+		CHECK(h->size >= HEADER_SIZE && h->size % 8 == 0 && p + h->size <= bottom, "media block size");
+		CHECK(IS_MEDIA(h->region) && h->region < REGION_COUNT, "media block region");
+		CHECK(*h->owner == DATA(p), "media block owner");
+		used[h->region] += h->size;
+	}
+	CHECK(p == bottom, "end of the media blocks");
+	for (p = top; p < arena_end; p += BLOCK(p)->size) {
+		header_t *h = BLOCK(p);
+		CHECK(h->size >= HEADER_SIZE && h->size % 8 == 0, "stacked block size");
+		CHECK(h->region == FREE || !IS_MEDIA(h->region), "stacked block region");
+		if (h->region != FREE)
+			used[h->region] += h->size;
+		else
+			CHECK(p != top, "gap at the top");
+	}
+	CHECK(p == arena_end, "end of the stacked blocks");
+	for (i = 0; i < REGION_COUNT; i++)
+		CHECK(used[i] == REGION_stats.used[i], "bytes used by a region");
+	CHECK(REGION_stats.free == (ULONG) (top - bottom), "bytes free");
+}
+
+/* Cartridges: main and piggyback */
+
+static struct {
+	int inserted;
+	ULONG size;
+	unsigned int seed;
+} carts[2];
+
+static void MakeCart(char const *name, int type, ULONG size, unsigned int seed)
+{
+	static UBYTE buf[16 + 0x8000];
+	ULONG sum = 0;
+	ULONG i;
+	memset(buf, 0, 16);
+	memcpy(buf, "CART", 4);
+	buf[7] = type;
+	for (i = 0; i < size; i++) {
+		buf[16 + i] = Pattern(seed, i);
+		sum += buf[16 + i];
+	}
+	buf[8] = (UBYTE) (sum >> 24);
+	buf[9] = (UBYTE) (sum >> 16);
+	buf[10] = (UBYTE) (sum >> 8);
+	buf[11] = (UBYTE) sum;
+	Put(name, buf, 16 + size);
+}
+
+static void CheckCarts(void)
+{
+	int c;
+	for (c = 0; c < 2; c++) {
+		CARTRIDGE_image_t const *image = c ? &CARTRIDGE_piggyback : &CARTRIDGE_main;
+		ULONG i;
+		if (!carts[c].inserted) {
+			CHECK(image->image == NULL, "image of a removed cartridge");
+			continue;
+		}
+		CHECK(image->image != NULL, "image of an inserted cartridge");
+		if (image->image == NULL)
+			continue;
+		for (i = 0; i < carts[c].size; i++)
+			if (image->image[i] != Pattern(carts[c].seed, i)) {
+				CHECK(FALSE, "cartridge data");
+				break;
+			}
+	}
+}
+
+/* Disks: none, ATR, PRO or ATX in each drive */
+
+enum { NO_DISK, ATR, PRO, ATX };
+
+static struct {
+	int kind;
+	unsigned int seed;
+	int reads;
+} drives[SIO_MAX_DRIVES];
+
+static void MakePRO(char const *name, unsigned int seed)
+{
+	static UBYTE buf[16 + PRO_SECTORS * 140];
+	int s, i;
+	memset(buf, 0, sizeof(buf));
+	buf[0] = PRO_SECTORS >> 8;
+	buf[1] = PRO_SECTORS & 0xff;
+	buf[2] = 'P';
+	for (s = 1; s <= PRO_SECTORS; s++) {
+		UBYTE *sector = buf + 16 + (s - 1) * 140;
+		sector[1] = 0xff;
+		/* sector 1 has its duplicate in the last one */
+		if (s == 1) {
+			sector[5] = 1;
+			sector[7] = 1;
+		}
+		for (i = 0; i < 128; i++)
+			sector[12 + i] = Pattern(seed + s, i);
+	}
+	Put(name, buf, sizeof(buf));
+}
+
+static void MakeATX(char const *name, unsigned int seed)
+{
+	static UBYTE buf[48 + 40 + 8 * ATX_SECTORS + 128 * ATX_SECTORS];
+	UBYTE *track = buf + 48;
+	int size = sizeof(buf) - 48;
+	int s, i;
+	memset(buf, 0, sizeof(buf));
+	memcpy(buf, "AT8X", 4);
+	buf[28] = 48;
+	track[0] = size;
+	track[1] = size >> 8;
+	track[10] = ATX_SECTORS;
+	track[20] = 32;
+	for (s = 0; s < ATX_SECTORS; s++) {
+		UBYTE *header = track + 40 + 8 * s;
+		int offset = 40 + 8 * ATX_SECTORS + 128 * s;
+		header[0] = s + 1;
+		header[4] = offset;
+		header[5] = offset >> 8;
+		for (i = 0; i < 128; i++)
+			track[offset + i] = Pattern(seed + s + 1, i);
+	}
+	Put(name, buf, sizeof(buf));
+}
+
+/* Reads sector 1 of PRO images, which alternates between its two
+   copies, and sector 2 of ATX images. */
+static void CheckDisks(void)
+{
+	UBYTE buf[256];
+	int d;
+	for (d = 0; d < SIO_MAX_DRIVES; d++) {
+		int sector, seed, i;
+		if (drives[d].kind != PRO && drives[d].kind != ATX)
+			continue;
+		sector = drives[d].kind == PRO ? 1 : 2;
+		seed = drives[d].seed + sector;
+		if (drives[d].kind == PRO && drives[d].reads++ & 1)
+			seed = drives[d].seed + PRO_SECTORS;
+		CHECK(SIO_ReadSector(d, sector, buf) == 'C', "disk read");
+		for (i = 0; i < 128; i++)
+			if (buf[i] != Pattern(seed, i)) {
+				CHECK(FALSE, "disk data");
+				break;
+			}
+	}
+}
+
+/* UI lists, freed in one go when the session ends */
+
+static struct {
+	UBYTE *data;
+	int size;
+	unsigned int seed;
+} lists[UI_LISTS];
+static int n_lists;
+
+static void CheckLists(void)
+{
+	int i, j;
+	for (i = 0; i < n_lists; i++)
+		for (j = 0; j < lists[i].size; j++)
+			if (lists[i].data[j] != Pattern(lists[i].seed, j)) {
+				CHECK(FALSE, "UI list data");
+				break;
+			}
+}
+
+static void InsertCart(int piggyback)
+{
+	static int const types[] = { CARTRIDGE_STD_4, CARTRIDGE_STD_8, CARTRIDGE_STD_16, CARTRIDGE_XEGS_32 };
+	static ULONG const sizes[] = { 0x1000, 0x2000, 0x4000, 0x8000 };
+	int t = Random(piggyback ? 2 : 4);
+	unsigned int seed = Random(1000);
+	ULONG room;
+	int result;
+	MakeCart("/c.car", types[t], sizes[t], seed);
+	/* inserting the main cartridge removes both */
+	room = REGION_stats.free + REGION_stats.used[REGION_PIGGYBACK];
+	carts[1].inserted = FALSE;
+	if (!piggyback) {
+		room += REGION_stats.used[REGION_CART];
+		carts[0].inserted = FALSE;
+	}
+	result = piggyback ? CARTRIDGE_Insert_Second("/c.car") : CARTRIDGE_Insert("/c.car");
+	if (result == 0) {
+		carts[piggyback].inserted = TRUE;
+		carts[piggyback].size = sizes[t];
+		carts[piggyback].seed = seed;
+	}
+	else
+		CHECK(HEADER_SIZE + sizes[t] > room, "cartridge did not fit in room enough");
+}
+
+static void MountDisk(void)
+{
+	int d = Random(SIO_MAX_DRIVES);
+	int kind = 1 + Random(3);
+	unsigned int seed = Random(1000);
+	ULONG need = kind == PRO ? 2 * HEADER_SIZE + 16 + 720
+	           : kind == ATX ? 2 * HEADER_SIZE + 32 + 720 * 364 : 0;
+	ULONG room = REGION_stats.free + REGION_stats.used[REGION_Disk(d + 1)];
+	char name[32];
+	int result;
+	if (kind == PRO) {
+		sprintf(name, "/d%d.pro", d + 1);
+		MakePRO(name, seed);
+	}
+	else if (kind == ATX) {
+		sprintf(name, "/d%d.atx", d + 1);
+		MakeATX(name, seed);
+	}
+	else
+		strcpy(name, "/d.atr");
+	result = SIO_Mount(d + 1, name, TRUE);
+	drives[d].kind = result ? kind : NO_DISK;
+	drives[d].seed = seed;
+	drives[d].reads = 0;
+	if (!result) {
+		CHECK(need > room, "disk did not fit in room enough");
+		CHECK(REGION_stats.used[REGION_Disk(d + 1)] == 0, "memory left by a failed mount");
+	}
+}
+
+static void UISession(void)
+{
+	int k;
+	if (n_lists > 0 && Random(3) == 0) {
+		REGION_Free(REGION_UI);
+		n_lists = 0;
+		return;
+	}
+	for (k = 1 + Random(4); k > 0 && n_lists < UI_LISTS; k--) {
+		int size = 1 + Random(3000);
+		UBYTE *p = REGION_Alloc(REGION_UI, NULL, size, "test");
+		int i;
+		if (p == NULL) {
+			CHECK(REGION_stats.free < HEADER_SIZE + size + 8, "UI list did not fit in room enough");
+			break;
+		}
+		lists[n_lists].data = p;
+		lists[n_lists].size = size;
+		lists[n_lists].seed = Random(1000);
+		for (i = 0; i < size; i++)
+			p[i] = Pattern(lists[n_lists].seed, i);
+		n_lists++;
+	}
+}
+
+static void ShortHeap(void)
+{
+	static size_t const heaps_kb[] = { 1024, 256, 192, 160, 128 };
+	int const sram_kb = BLKCACHE_sram_kb;
+	unsigned int i;
+	for (i = 0; i < sizeof(heaps_kb) / sizeof(heaps_kb[0]); i++) {
+		char *args[] = { "regions", NULL };
+		int n = 1;
+		size_t left;
+		host_heap_free = heaps_kb[i] << 10;
+		BLKCACHE_sram_kb = 64;
+		REGION_Initialise(&n, args);
+		left = host_heap_free - REGION_stats.arena;
+		printf("heap %4lu KB: arena %4lu KB, %3lu KB left, %3lu KB needed, block cache %2d KB\n",
+		       (unsigned long) heaps_kb[i], (unsigned long) (REGION_stats.arena >> 10),
+		       (unsigned long) (left >> 10), (unsigned long) (HeapReserve() >> 10), BLKCACHE_sram_kb);
+		CHECK(REGION_stats.reserve == HeapReserve(), "the reserve is not that of the cache left");
+		if (host_heap_free >= HeapReserve() + ARENA_MIN)
+			CHECK(left >= HeapReserve() && REGION_stats.arena >= ARENA_MIN, "the heap left is short");
+		else
+			CHECK(REGION_stats.arena <= host_heap_free / 2 && BLKCACHE_sram_kb == 0, "the arena takes too much");
+		Util_free(arena_start);
+		arena_start = NULL;
+	}
+	host_heap_free = 64 << 20;
+	BLKCACHE_sram_kb = sram_kb;
+}
+
+int main(int argc, char **argv)
+{
+	static UBYTE atr[16 + 720 * 128] = { 0x96, 0x02, 0x80, 0x16, 0x80 };
+	static BYTE work[4096];
+	MKFS_PARM opt = { FM_FAT32, 0, 0, 0, 0 };
+	char *args[] = { "-xl", "-arena-kb", argc > 1 ? argv[1] : "200", NULL };
+	int const steps = argc > 2 ? atoi(argv[2]) : 5000;
+	int d;
+
+	rng = argc > 3 ? atoi(argv[3]) : 1;
+	ShortHeap();
+	f_mkfs("", &opt, work, sizeof(work));
+	f_mount(&fs, "", 1);
+	Put("/d.atr", atr, sizeof(atr));
+	PSRAM_AVAILABLE = FALSE;
+	libatari800_init(-1, args);
+	libatari800_clear_input_array(&input);
+
+	for (step = 0; step < steps; step++) {
+		switch (Random(10)) {
+		case 0:
+			InsertCart(FALSE);
+			break;
+		case 1:
+			InsertCart(carts[0].inserted);
+			break;
+		case 2:
+			if (Random(2)) {
+				CARTRIDGE_Remove();
+				carts[0].inserted = carts[1].inserted = FALSE;
+			}
+			else {
+				CARTRIDGE_Remove_Second();
+				carts[1].inserted = FALSE;
+			}
+			break;
+		case 3:
+		case 4:
+			MountDisk();
+			break;
+		case 5:
+			d = Random(SIO_MAX_DRIVES);
+			SIO_Dismount(d + 1);
+			drives[d].kind = NO_DISK;
+			break;
+		case 6:
+			/* 128K of extended RAM, when there is room for it */
+			if (REGION_stats.free >= 0x18000 + 8 * HEADER_SIZE) {
+				MEMORY_ram_size = Random(2) ? 128 : 64;
+				Atari800_InitialiseMachine();
+			}
+			break;
+		case 7:
+			UISession();
+			break;
+		case 8:
+			Sound_desired.freq = Random(2) ? 44100 : 22050;
+			Sound_Setup();
+			break;
+		case 9:
+			libatari800_next_frame(&input);
+			break;
+		}
+		CheckArena();
+		CheckCarts();
+		CheckDisks();
+		CheckLists();
+	}
+	printf("arena %lu bytes, peak %lu, %lu bytes moved, %lu allocations did not fit\n",
+	       (unsigned long) REGION_stats.arena, (unsigned long) REGION_stats.peak,
+	       (unsigned long) REGION_stats.moved, (unsigned long) REGION_stats.failures);
+
+	/* with all media removed only the stacked regions stay */
+	CARTRIDGE_Remove();
+	for (d = 1; d <= SIO_MAX_DRIVES; d++)
+		SIO_Dismount(d);
+	REGION_Free(REGION_UI);
+	CheckArena();
+	CHECK(bottom == arena_start, "media blocks left after removing all");
+	return errors != 0;
+}
@@ -0,0 +1,286 @@
+/*
+ * rewind.c - checks the rewind ring on a running BASIC program
+ *
+ * Copyright (C) 2026 Atari800 development team (see DOC/CREDITS)
+ *
+ * This file is part of the Atari800 emulator project which emulates
+ * the Atari 400, 800, 800XL, 130XE, and 5200 8-bit computers.
+ *
+ * Atari800 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Atari800 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Atari800; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/* Types in a BASIC program that draws random lines and plays random
+   sounds, then checks that:
+   - the frames after a restored snapshot are those after the save, by a
+     hash of memory, screen and sound;
+   - taking snapshots while running changes nothing;
+   - an older snapshot of the ring restores to the right frame;
+   - stepping back over a full ring of incremental snapshots gives the
+     memory of each one, and the machine saves the state the head holds;
+   - the head of the ring is what a fresh state save writes.
+   Prints snapshot sizes and the PSRAM traffic of a full and an
+   incremental save, and of a step back against a full state load, with
+   the time the SPI bus takes for it at 94.5 MHz (sysclk 378 MHz,
+   clkdiv 2), counting 41 bits of command and 1 us of setup a transfer.
+   The argument picks the machine, an 800 by default:
+
+	util/host/build.sh util/host/rewind.c && $WORK/test [-xl]
+*/
+
+#include <string.h>
+
+#include "libatari800/libatari800.h"
+#include "libatari800/sound.h"
+#include "memory.h"
+#include "rewind.h"
+#include "screen.h"
+#undef printf
+
+int printf(const char *format, ...);
+
+extern bool PSRAM_AVAILABLE;
+extern unsigned char host_psram[];
+extern unsigned long host_psram_wr, host_psram_rd, host_psram_wtx, host_psram_rtx;
+
+#define FRAMES 300
+
+static input_template_t input;
+static unsigned int ref[FRAMES], got[FRAMES];
+static int failed = FALSE;
+
+static unsigned int Hash(UBYTE const *p, int n, unsigned int h)
+{
+	while (n-- > 0)
+		h = (h ^ *p++) * 16777619u;
+	return h;
+}
+
+static unsigned int HashRAM(void)
+{
+	return Hash(MEMORY_mem, 65536, 2166136261u);
+}
+
+static unsigned int HashFrame(void)
+{
+	unsigned int h = HashRAM();
+	h = Hash(Screen_atari, Screen_WIDTH * Screen_HEIGHT, h);
+	return Hash(LIBATARI800_Sound_array, sound_array_fill, h);
+}
+
+static void Type(char const *s)
+{
+	for (; *s != '\0'; s++) {
+		int f;
+		input.keychar = *s;
+		for (f = 0; f < 3; f++)
+			libatari800_next_frame(&input);
+		input.keychar = 0;
+		for (f = 0; f < (*s == '\n' ? 20 : 3); f++)
+			libatari800_next_frame(&input);
+	}
+}
+
+static void Run(unsigned int *hashes, int frames)
+{
+	int i;
+	for (i = 0; i < frames; i++) {
+		libatari800_next_frame(&input);
+		REWIND_Frame();
+		hashes[i] = HashFrame();
+	}
+}
+
+static void Compare(char const *what, unsigned int const *a, unsigned int const *b, int frames)
+{
+	int i;
+	for (i = 0; i < frames; i++)
+		if (a[i] != b[i]) {
+			printf("FAIL %s: frame %d differs\n", what, i);
+			failed = TRUE;
+			return;
+		}
+	printf("%s: %d frames identical\n", what, frames);
+}
+
+static void ResetTraffic(void)
+{
+	host_psram_wr = host_psram_rd = host_psram_wtx = host_psram_rtx = 0;
+}
+
+static void PrintTraffic(char const *what)
+{
+	printf("%s: PSRAM written %lu bytes in %lu transfers, read %lu bytes in %lu\n",
+	       what, host_psram_wr, host_psram_wtx, host_psram_rd, host_psram_rtx);
+}
+
+static double BusMs(void)
+{
+	unsigned long bytes = host_psram_wr + host_psram_rd;
+	unsigned long transfers = host_psram_wtx + host_psram_rtx;
+	return ((bytes * 8 + transfers * 41) / 94.5 + transfers) / 1e3;
+}
+
+/* Takes a snapshot now. */
+static void Save(void)
+{
+	int interval = REWIND_interval;
+	REWIND_interval = 1;
+	REWIND_Frame();
+	REWIND_interval = interval;
+}
+
+int main(int argc, char **argv)
+{
+	char *args[] = { "-atari", "-basic", NULL };
+	int i;
+
+	if (argc > 1)
+		args[0] = argv[1];
+
+	libatari800_init(-1, args);
+	libatari800_clear_input_array(&input);
+	PSRAM_AVAILABLE = TRUE;
+	REWIND_interval = 0;
+	for (i = 0; i < 150; i++)
+		libatari800_next_frame(&input);
+	Type("10 GRAPHICS 23:SETCOLOR 2,INT(RND(0)*16),4\n"
+	     "20 COLOR INT(RND(0)*4):PLOT RND(0)*159,RND(0)*95:DRAWTO RND(0)*159,RND(0)*95\n"
+	     "30 SOUND 0,RND(0)*255,10,8:SOUND 1,PEEK(53770),12,6:GOTO 20\n"
+	     "RUN\n");
+	for (i = 0; i < 100; i++)
+		libatari800_next_frame(&input);
+
+	/* snapshot, run, restore, run again */
+	ResetTraffic();
+	Save();
+	PrintTraffic("full save");
+	printf("snapshot of %lu bytes\n", (unsigned long) REWIND_stats.last_size);
+	Run(ref, FRAMES);
+	if (!REWIND_Restore(0)) {
+		printf("FAIL: restore\n");
+		return 1;
+	}
+	Run(got, FRAMES);
+	Compare("restore and run", ref, got, FRAMES);
+
+	/* snapshots every 7 frames must not disturb the emulation */
+	REWIND_Restore(0);
+	REWIND_interval = 7;
+	Run(got, FRAMES);
+	Compare("run taking snapshots", ref, got, FRAMES);
+
+	/* the snapshot of age 5 was taken 5 snapshots before the last one */
+	{
+		int const age = 5;
+		int const at = (FRAMES / 7 - age) * 7;
+		REWIND_interval = 0;
+		if (!REWIND_Restore(age)) {
+			printf("FAIL: restore of age %d\n", age);
+			return 1;
+		}
+		Run(got, FRAMES - at);
+		Compare("restore from the ring and run", ref + at, got, FRAMES - at);
+	}
+
+	/* step back over a ring of incremental snapshots */
+	{
+		static unsigned int ram[REWIND_SLOTS];
+		static UBYTE buffer[STATESAV_MAX_SIZE];
+		statesav_tags_t tags;
+		double step_ms = 0;
+		double max_ms = 0;
+		int n = 0;
+		REWIND_Clear();
+		REWIND_interval = 3;
+		for (i = 0; i < 3 * (REWIND_SLOTS + 36); i++) {
+			ULONG saves = REWIND_stats.saves;
+			libatari800_next_frame(&input);
+			REWIND_Frame();
+			if (REWIND_stats.saves != saves) {
+				if (n == REWIND_SLOTS)
+					memmove(ram, ram + 1, sizeof(ram) - sizeof(ram[0]));
+				else
+					n++;
+				ram[n - 1] = HashRAM();
+			}
+		}
+		REWIND_interval = 0;
+		if (REWIND_Count() != n) {
+			printf("FAIL: %d snapshots held, %d expected\n", REWIND_Count(), n);
+			failed = TRUE;
+		}
+		for (i = n - 1; i >= 0; i--) {
+			ResetTraffic();
+			if (!REWIND_Restore(i == n - 1 ? 0 : 1)) {
+				printf("FAIL: step back to snapshot %d\n", i);
+				failed = TRUE;
+				break;
+			}
+			if (i < n - 1) {
+				step_ms += BusMs();
+				if (BusMs() > max_ms)
+					max_ms = BusMs();
+			}
+			if (HashRAM() != ram[i]) {
+				printf("FAIL: memory of snapshot %d differs\n", i);
+				failed = TRUE;
+				break;
+			}
+			LIBATARI800_StateSave(buffer, &tags);
+			if (memcmp(buffer, host_psram + REWIND_PSRAM_BASE, tags.size) != 0) {
+				printf("FAIL: state of snapshot %d differs from the head\n", i);
+				failed = TRUE;
+				break;
+			}
+		}
+		if (i < 0) {
+			printf("step back over %d snapshots: memory and state identical\n", n);
+			printf("step back: %.2f ms on the bus on average, %.2f ms at most\n",
+			       step_ms / (n - 1), max_ms);
+		}
+
+		libatari800_next_frame(&input);
+		ResetTraffic();
+		Save();
+		PrintTraffic("incremental save");
+		printf("snapshot changed %lu bytes, at most %lu\n",
+		       (unsigned long) REWIND_stats.last_delta, (unsigned long) REWIND_stats.max_delta);
+
+		ResetTraffic();
+		LIBATARI800_StateLoadPSRAM(REWIND_PSRAM_BASE);
+		PrintTraffic("full state load");
+		printf("full state load: %.2f ms on the bus\n", BusMs());
+	}
+
+	/* the head of the ring is a plain state save */
+	{
+		static UBYTE buffer[STATESAV_MAX_SIZE];
+		statesav_tags_t tags;
+		for (i = 0; i < 37; i++)
+			libatari800_next_frame(&input);
+		Save();
+		LIBATARI800_StateSave(buffer, &tags);
+		if (memcmp(buffer, host_psram + REWIND_PSRAM_BASE, tags.size) != 0) {
+			printf("FAIL: the head differs from a state save\n");
+			failed = TRUE;
+		}
+		else
+			printf("head equals a state save of %lu bytes\n", (unsigned long) tags.size);
+	}
+
+	printf("%lu saves, %lu restores, %lu failures\n", (unsigned long) REWIND_stats.saves,
+	       (unsigned long) REWIND_stats.restores, (unsigned long) REWIND_stats.failures);
+	return failed;
+}
@@ -0,0 +1,178 @@
+/*
+ * seek.c - times random and sequential reads of mapped and unmapped images
+ *
+ * Copyright (C) 2026 Atari800 development team (see DOC/CREDITS)
+ *
+ * This file is part of the Atari800 emulator project which emulates
+ * the Atari 400, 800, 800XL, 130XE, and 5200 8-bit computers.
+ *
+ * Atari800 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Atari800 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Atari800; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/* Makes two 16 MB images on a RAM disk, one contiguous and one
+   fragmented by growing it next to another file, and reads each at
+   random 512 byte and sequential 4K positions through the block cache,
+   writing a random sector every 10 reads, with and without BLKCACHE_Map.
+   Reads must return what was written, and so must the files at the end.
+   Prints the card calls and blocks per read and the time per read of an
+   SD card taking 0.6 ms a call and 1.5 MB/s.  Does it all on a FAT32
+   disk with 512 byte clusters, the worst case, and again with the 32 KB
+   clusters of most cards; the 256 MB disk is too small for FAT32 with
+   those, so it is FAT16 then, whose FAT sectors hold twice the clusters.
+   The arguments set the SRAM cache in KB and, if given, use PSRAM too:
+
+	util/host/build.sh -DHOST_DISK_MB=256 util/host/seek.c && $WORK/test [KB [psram]]
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "atari.h"
+#include "blkcache.h"
+#undef printf
+
+int printf(const char *format, ...);
+
+extern bool PSRAM_AVAILABLE;
+extern unsigned long host_disk_reads, host_disk_read_calls, host_disk_write_calls;
+
+#define IMAGE_SIZE (16 << 20)
+#define READS 3000
+
+static FATFS fs;
+static BLKCACHE_dev_t dev = { "test" };
+static int failed = FALSE;
+
+static void Run(char const *what, FIL *f, UBYTE *data, int map, int len, int sequential)
+{
+	static UBYTE buf[4096];
+	unsigned long read_calls = host_disk_read_calls;
+	unsigned long write_calls = host_disk_write_calls;
+	unsigned long blocks = host_disk_reads;
+	unsigned long calls;
+	int contiguous = map && BLKCACHE_Map(f);
+	int errors = 0;
+	int i;
+	srand(5);
+	for (i = 0; i < READS; i++) {
+		FSIZE_t pos = sequential ? (FSIZE_t) i * len % IMAGE_SIZE
+		                         : (FSIZE_t) (rand() % (IMAGE_SIZE / len)) * len;
+		UINT n;
+		if (!BLKCACHE_Read(&dev, f, pos, buf, len, &n) || n != (UINT) len
+		 || memcmp(buf, data + pos, len) != 0)
+			errors++;
+		if (i % 10 == 0) {
+			int j;
+			pos = (FSIZE_t) (rand() % (IMAGE_SIZE / 512)) * 512;
+			for (j = 0; j < 512; j++)
+				data[pos + j] = rand();
+			BLKCACHE_Write(&dev, f, pos, data + pos, 512, &n);
+		}
+	}
+	BLKCACHE_Flush(f);
+	BLKCACHE_Release(f);
+	calls = host_disk_read_calls - read_calls + host_disk_write_calls - write_calls;
+	blocks = host_disk_reads - blocks;
+	printf("%-26s %-11s %6.2f %7.2f %6.2f\n", what,
+	       map ? (contiguous ? "contiguous" : "mapped") : "unmapped",
+	       (double) calls / READS, (double) blocks / READS,
+	       (calls * 0.6e-3 + blocks * 512 / 1.5e6) / READS * 1e3);
+	if (errors > 0) {
+		printf("FAIL: %d reads differ\n", errors);
+		failed = TRUE;
+	}
+}
+
+static void Check(char const *name, UBYTE const *data)
+{
+	static UBYTE buf[IMAGE_SIZE];
+	FIL f;
+	UINT n = 0;
+	if (f_open(&f, name, FA_READ) == FR_OK) {
+		f_read(&f, buf, IMAGE_SIZE, &n);
+		f_close(&f);
+	}
+	if (n != IMAGE_SIZE || memcmp(buf, data, IMAGE_SIZE) != 0) {
+		printf("FAIL: %s differs\n", name);
+		failed = TRUE;
+	}
+}
+
+/* Formats the disk with clusters of AU bytes, writes the images from
+   CONTIGUOUS and FRAGMENTED and reads them. */
+static void Card(UBYTE *contiguous, UBYTE *fragmented, int au)
+{
+	static BYTE work[4096];
+	MKFS_PARM opt = { FM_FAT32, 0, 0, 0, 0 };
+	FIL f, g;
+	UINT n;
+	int i;
+
+	opt.fmt = au > 512 ? FM_FAT : FM_FAT32;
+	opt.au_size = au;
+	if (f_mkfs("", &opt, work, sizeof(work)) != FR_OK || f_mount(&fs, "", 1) != FR_OK) {
+		printf("FAIL: f_mkfs with %d byte clusters\n", au);
+		failed = TRUE;
+		return;
+	}
+	f_open(&f, "/c.img", FA_WRITE | FA_CREATE_ALWAYS);
+	f_write(&f, contiguous, IMAGE_SIZE, &n);
+	f_close(&f);
+	/* a cluster of the other file every 256K */
+	f_open(&f, "/f.img", FA_WRITE | FA_CREATE_ALWAYS);
+	f_open(&g, "/g.img", FA_WRITE | FA_CREATE_ALWAYS);
+	for (i = 0; i < IMAGE_SIZE; i += 0x40000) {
+		f_write(&f, fragmented + i, 0x40000, &n);
+		f_write(&g, fragmented + i, 512, &n);
+	}
+	f_close(&f);
+	f_close(&g);
+
+	printf("%s, %d byte clusters\n", fs.fs_type == FS_FAT32 ? "FAT32" : "FAT16", au);
+	printf("image, reads               map         calls  blocks     ms\n");
+	f_open(&f, "/c.img", FA_READ | FA_WRITE);
+	Run("contiguous, random 512", &f, contiguous, FALSE, 512, FALSE);
+	Run("contiguous, random 512", &f, contiguous, TRUE, 512, FALSE);
+	Run("contiguous, sequential 4K", &f, contiguous, FALSE, 4096, TRUE);
+	Run("contiguous, sequential 4K", &f, contiguous, TRUE, 4096, TRUE);
+	f_close(&f);
+	f_open(&f, "/f.img", FA_READ | FA_WRITE);
+	Run("fragmented, random 512", &f, fragmented, FALSE, 512, FALSE);
+	Run("fragmented, random 512", &f, fragmented, TRUE, 512, FALSE);
+	Run("fragmented, sequential 4K", &f, fragmented, FALSE, 4096, TRUE);
+	Run("fragmented, sequential 4K", &f, fragmented, TRUE, 4096, TRUE);
+	f_close(&f);
+	Check("/c.img", contiguous);
+	Check("/f.img", fragmented);
+	f_unmount("");
+}
+
+int main(int argc, char **argv)
+{
+	static UBYTE contiguous[IMAGE_SIZE], fragmented[IMAGE_SIZE];
+	int i;
+
+	BLKCACHE_sram_kb = argc > 1 ? atoi(argv[1]) : 16;
+	PSRAM_AVAILABLE = argc > 2;
+	for (i = 0; i < IMAGE_SIZE; i++) {
+		contiguous[i] = rand();
+		fragmented[i] = rand();
+	}
+	printf("%d KB SRAM cache%s\n", BLKCACHE_sram_kb, PSRAM_AVAILABLE ? " and PSRAM" : "");
+	Card(contiguous, fragmented, 512);
+	printf("\n");
+	Card(contiguous, fragmented, 32768);
+	return failed;
+}
@@ -0,0 +1,427 @@
+/*
+ * storage.c - stresses the block cache with SIO, IDE, PBI SCSI and H:
+ *
+ * Copyright (C) 2026 Atari800 development team (see DOC/CREDITS)
+ *
+ * This file is part of the Atari800 emulator project which emulates
+ * the Atari 400, 800, 800XL, 130XE, and 5200 8-bit computers.
+ *
+ * Atari800 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Atari800 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Atari800; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/* Interleaves the four devices on one card: DOS 2 loading from an ATR
+   on D1: and updating its VTOC, a file system on an IDE image, reads and
+   scattered writes on a PBI SCSI image, and a program reading a file and
+   writing a log through H:.  Every read must return what was last
+   written, and after the devices close every file must hold it.  Prints
+   the card calls made.  Options: -nopsram leaves out the PSRAM level,
+   -nocache sets no SRAM cache either, and -worker runs a storage worker
+   thread on a card taking 20 us a call.  The H: handler functions are
+   static, so devices.c is built into this file:
+
+	util/host/build.sh -x devices.c util/host/storage.c && $WORK/test [options]
+*/
+
+#include "devices.c"
+
+#include <pthread.h>
+#include <stdlib.h>
+
+#include "blkcache.h"
+#include "ide.h"
+#include "ioqueue.h"
+#include "pbi_scsi.h"
+#undef printf
+
+int printf(const char *format, ...);
+int usleep(unsigned usec);
+
+extern bool PSRAM_AVAILABLE;
+extern unsigned long host_disk_reads, host_disk_writes;
+extern unsigned long host_disk_read_calls, host_disk_write_calls;
+extern unsigned host_disk_call_us;
+
+#define SIO_SECTORS 720
+#define IDE_SECTORS 8192
+#define SCSI_SECTORS 4096
+#define H_SIZE 200000
+#define LOG_SIZE 100000
+
+static FATFS fs;
+static unsigned long errors;
+
+static void Error(char const *what, int where)
+{
+	if (errors++ < 10)
+		printf("%s %d differs\n", what, where);
+}
+
+/* H: through CIO's loops for GET and PUT CHARACTERS, on IOCB 1 for the
+   file read and IOCB 2 for the log */
+
+static UBYTE h_data[H_SIZE], h_log[LOG_SIZE];
+static int h_pos, h_log_size;
+
+static void PutWord(int addr, int value)
+{
+	MEMORY_mem[addr] = (UBYTE) value;
+	MEMORY_mem[addr + 1] = (UBYTE) (value >> 8);
+}
+
+static void SetIOCB(int iocb, int com, UWORD buf, int len)
+{
+	int addr = Devices_IOCB0 + iocb * 16;
+	MEMORY_mem[addr + Devices_ICCOM] = com;
+	PutWord(addr + Devices_ICBAL, buf);
+	PutWord(addr + Devices_ICBLL, len);
+	MEMORY_mem[Devices_ICCOMZ] = com;
+	PutWord(Devices_ICBALZ, buf);
+	PutWord(Devices_ICBLLZ, len);
+	CPU_regX = iocb * 16;
+}
+
+static void HOpen(int iocb, char const *name, int aux1)
+{
+	strcpy((char *) MEMORY_mem + 0x600, name);
+	MEMORY_mem[0x600 + strlen(name)] = 0x9b;
+	SetIOCB(iocb, 3, 0x600, 64);
+	MEMORY_mem[Devices_ICDNOZ] = name[1] - '0';
+	MEMORY_mem[Devices_ICAX1Z] = aux1;
+	Devices_H_Open();
+}
+
+static void HClose(int iocb)
+{
+	CPU_regX = iocb * 16;
+	Devices_H_Close();
+}
+
+static void HRead(int len)
+{
+	int status = 1;
+	int count;
+	SetIOCB(1, 7, 0x2000, len);
+	do {
+		UWORD addr;
+		CPU_regX = 16;
+		Devices_H_Read();
+		status = CPU_regY;
+		if (status >= 128)
+			break;
+		addr = MEMORY_dGetWord(Devices_ICBALZ);
+		MEMORY_mem[addr] = CPU_regA;
+		PutWord(Devices_ICBALZ, addr + 1);
+		PutWord(Devices_ICBLLZ, MEMORY_dGetWord(Devices_ICBLLZ) - 1);
+	} while (MEMORY_dGetWord(Devices_ICBLLZ) != 0);
+	count = len - MEMORY_dGetWord(Devices_ICBLLZ);
+	if (memcmp(MEMORY_mem + 0x2000, h_data + h_pos, count) != 0)
+		Error("H: read at", h_pos);
+	h_pos += count;
+	if (status == 136 || h_pos >= H_SIZE) {
+		HClose(1);
+		HOpen(1, "H1:B.BIN", 4);
+		h_pos = 0;
+	}
+}
+
+static void HWrite(int len)
+{
+	int i;
+	for (i = 0; i < len; i++)
+		h_log[h_log_size + i] = MEMORY_mem[0x3000 + i] = rand();
+	h_log_size += len;
+	SetIOCB(2, 11, 0x3000, len);
+	do {
+		CPU_regA = MEMORY_mem[MEMORY_dGetWord(Devices_ICBALZ)];
+		CPU_regX = 32;
+		Devices_H_Write();
+		PutWord(Devices_ICBALZ, MEMORY_dGetWord(Devices_ICBALZ) + 1);
+		PutWord(Devices_ICBLLZ, MEMORY_dGetWord(Devices_ICBLLZ) - 1);
+	} while (MEMORY_dGetWord(Devices_ICBLLZ) != 0);
+}
+
+/* IDE, through its registers */
+
+static UBYTE ide_data[IDE_SECTORS][512];
+
+static void IDESetRegisters(int lba, int command)
+{
+	IDE_PutByte(0xd502, 1);
+	IDE_PutByte(0xd503, lba);
+	IDE_PutByte(0xd504, lba >> 8);
+	IDE_PutByte(0xd505, lba >> 16);
+	IDE_PutByte(0xd506, 0xe0 | ((lba >> 24) & 0x0f));
+	IDE_PutByte(0xd507, command);
+}
+
+static void IDERead(int lba)
+{
+	UBYTE buf[512];
+	int i;
+	IDESetRegisters(lba, 0x20);
+	for (i = 0; i < 256; i++) {
+		if (!(IDE_GetByte(0xd507, FALSE) & 0x08))
+			break;
+		buf[2 * i] = IDE_GetByte(0xd500, FALSE);
+		buf[2 * i + 1] = IDE_GetByte(0xd508, FALSE);
+	}
+	if (i < 256 || memcmp(buf, ide_data[lba], 512) != 0)
+		Error("IDE sector", lba);
+}
+
+static void IDEWrite(int lba)
+{
+	int i;
+	for (i = 0; i < 512; i++)
+		ide_data[lba][i] = rand();
+	IDESetRegisters(lba, 0x30);
+	for (i = 0; i < 256; i++) {
+		if (!(IDE_GetByte(0xd507, FALSE) & 0x08))
+			break;
+		IDE_PutByte(0xd508, ide_data[lba][2 * i + 1]);
+		IDE_PutByte(0xd500, ide_data[lba][2 * i]);
+	}
+	if (i < 256)
+		Error("IDE write of sector", lba);
+}
+
+/* PBI SCSI, through the bus signals */
+
+static UBYTE scsi_data[SCSI_SECTORS][256];
+static FIL scsi_file;
+
+static void SCSIAck(void)
+{
+	PBI_SCSI_PutACK(1);
+	PBI_SCSI_PutACK(0);
+}
+
+static void SCSICommand(int op, int lba)
+{
+	UBYTE const cdb[6] = { op, lba >> 16, lba >> 8, lba, 1, 0 };
+	int i;
+	PBI_SCSI_PutByte(1);
+	PBI_SCSI_PutSEL(1);
+	PBI_SCSI_PutSEL(0);
+	for (i = 0; i < 6; i++) {
+		PBI_SCSI_PutByte(cdb[i]);
+		SCSIAck();
+	}
+}
+
+static void SCSIRead(int lba)
+{
+	int i;
+	int same = TRUE;
+	SCSICommand(0x08, lba);
+	for (i = 0; i < 256; i++) {
+		if (PBI_SCSI_GetByte() != scsi_data[lba][i])
+			same = FALSE;
+		SCSIAck();
+	}
+	/* status and message */
+	SCSIAck();
+	SCSIAck();
+	if (!same)
+		Error("SCSI sector", lba);
+}
+
+static void SCSIWrite(int lba)
+{
+	int i;
+	for (i = 0; i < 256; i++)
+		scsi_data[lba][i] = rand();
+	SCSICommand(0x0a, lba);
+	for (i = 0; i < 256; i++) {
+		PBI_SCSI_PutByte(scsi_data[lba][i]);
+		SCSIAck();
+	}
+	SCSIAck();
+	SCSIAck();
+}
+
+/* SIO, an ATR of 720 sectors of 128 bytes */
+
+static UBYTE sio_data[SIO_SECTORS + 1][128];
+
+static void SIORead(int sector)
+{
+	UBYTE buf[128];
+	if (SIO_ReadSector(0, sector, buf) != 'C' || memcmp(buf, sio_data[sector], 128) != 0)
+		Error("SIO sector", sector);
+}
+
+static void SIOWrite(int sector)
+{
+	int i;
+	for (i = 0; i < 128; i++)
+		sio_data[sector][i] = rand();
+	if (SIO_WriteSector(0, sector, sio_data[sector]) != 'C')
+		Error("SIO write of sector", sector);
+}
+
+static void WriteFile(char const *name, void const *header, UINT header_size, void const *data, UINT size)
+{
+	FIL f;
+	UINT written;
+	f_open(&f, name, FA_WRITE | FA_CREATE_ALWAYS);
+	if (header_size > 0)
+		f_write(&f, header, header_size, &written);
+	f_write(&f, data, size, &written);
+	f_close(&f);
+}
+
+static int CheckFile(char const *name, UINT offset, void const *data, UINT size)
+{
+	static UBYTE buf[IDE_SECTORS * 512];
+	FIL f;
+	UINT n = 0;
+	if (f_open(&f, name, FA_READ) == FR_OK) {
+		f_read(&f, buf, sizeof(buf), &n);
+		f_close(&f);
+	}
+	if (n != offset + size || memcmp(buf + offset, data, size) != 0) {
+		printf("FAIL: %s differs\n", name);
+		return FALSE;
+	}
+	return TRUE;
+}
+
+static unsigned long reads0, writes0, read_calls0, write_calls0;
+
+static void Report(char const *what)
+{
+	printf("%-24s %6lu read calls %6lu write calls %7lu blocks\n", what,
+	       host_disk_read_calls - read_calls0, host_disk_write_calls - write_calls0,
+	       host_disk_reads - reads0 + host_disk_writes - writes0);
+}
+
+static void *Worker(void *arg)
+{
+	for (;;) {
+		IOQUEUE_Work();
+		usleep(5);
+	}
+	return arg;
+}
+
+int main(int argc, char **argv)
+{
+	/* the ATR header: 720 * 128 / 16 = 0x1680 paragraphs */
+	static UBYTE const atr_header[16] = { 0x96, 0x02, 0x80, 0x16, 0x80, 0x00 };
+	static BYTE work[4096];
+	MKFS_PARM opt = { FM_FAT, 0, 0, 0, 16384 };
+	char *ide_args[] = { "atari800", "-ide", "/hd.img", NULL };
+	int ide_argc = 3;
+	int ok;
+	int i;
+
+	PSRAM_AVAILABLE = TRUE;
+	for (i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "-nopsram") == 0)
+			PSRAM_AVAILABLE = FALSE;
+		else if (strcmp(argv[i], "-nocache") == 0)
+			BLKCACHE_sram_kb = 0;
+		else if (strcmp(argv[i], "-worker") == 0) {
+			pthread_t thread;
+			host_disk_call_us = 20;
+			IOQUEUE_UseWorker();
+			pthread_create(&thread, NULL, Worker, NULL);
+		}
+	}
+
+	f_mkfs("", &opt, work, sizeof(work));
+	f_mount(&fs, "", 1);
+	srand(1);
+	for (i = 0; i < (int) sizeof(ide_data); i++)
+		ide_data[0][i] = rand();
+	WriteFile("/hd.img", NULL, 0, ide_data, sizeof(ide_data));
+	for (i = 0; i < (int) sizeof(scsi_data); i++)
+		scsi_data[0][i] = rand();
+	WriteFile("/scsi.img", NULL, 0, scsi_data, sizeof(scsi_data));
+	for (i = 0; i < SIO_SECTORS * 128; i++)
+		sio_data[1][i] = rand();
+	WriteFile("/d1.atr", atr_header, sizeof(atr_header), sio_data[1], SIO_SECTORS * 128);
+	f_mkdir("/h");
+	for (i = 0; i < H_SIZE; i++)
+		h_data[i] = rand();
+	WriteFile("/h/B.BIN", NULL, 0, h_data, H_SIZE);
+
+	if (!IDE_Initialise(&ide_argc, ide_args) || !SIO_Mount(1, "/d1.atr", FALSE)
+	 || f_open(&scsi_file, "/scsi.img", FA_READ | FA_WRITE) != FR_OK) {
+		printf("FAIL: opening the images\n");
+		return 1;
+	}
+	PBI_SCSI_disk = &scsi_file;
+	strcpy(Devices_atari_h_dir[0], "/h");
+	Devices_h_read_only = FALSE;
+	HOpen(1, "H1:B.BIN", 4);
+	HOpen(2, "H1:W.BIN", 8);
+
+	reads0 = host_disk_reads;
+	writes0 = host_disk_writes;
+	read_calls0 = host_disk_read_calls;
+	write_calls0 = host_disk_write_calls;
+	srand(2);
+	for (i = 0; i < 6000; i++) {
+		SIORead(4 + i % 700);
+		if (i % 50 == 0) {
+			SIOWrite(360);
+			SIOWrite(361);
+			SIOWrite(4 + rand() % 700);
+		}
+		/* data read in order, FAT lookups and writes */
+		IDERead(i % 3 == 0 ? rand() % 16 : 1024 + i);
+		if (i % 8 == 0)
+			IDEWrite(i % 64 == 0 ? rand() % 16 : 7000 + (i / 8) % 1000);
+		SCSIRead(i % SCSI_SECTORS);
+		if (i % 10 == 0)
+			SCSIWrite(rand() % SCSI_SECTORS);
+		if (i % 4 == 0)
+			HRead(300);
+		if (i % 5 == 0 && h_log_size + 37 <= LOG_SIZE)
+			HWrite(37);
+		if (i % 20 == 19)
+			BLKCACHE_Frame();
+	}
+	for (i = 1; i <= SIO_SECTORS; i++)
+		SIORead(i);
+	for (i = 0; i < IDE_SECTORS; i++)
+		IDERead(i);
+	for (i = 0; i < SCSI_SECTORS; i++)
+		SCSIRead(i);
+	Report("interleaved, read back");
+
+	HClose(1);
+	HClose(2);
+	SIO_Dismount(1);
+	IDE_Exit();
+	PBI_SCSI_CloseDisk();
+	BLKCACHE_Exit();
+	Report("closed");
+
+	ok = CheckFile("/hd.img", 0, ide_data, sizeof(ide_data));
+	ok &= CheckFile("/scsi.img", 0, scsi_data, sizeof(scsi_data));
+	ok &= CheckFile("/d1.atr", sizeof(atr_header), sio_data[1], SIO_SECTORS * 128);
+	ok &= CheckFile("/h/W.BIN", 0, h_log, h_log_size);
+	if (errors > 0) {
+		printf("FAIL: %lu reads differ\n", errors);
+		return 1;
+	}
+	if (!ok)
+		return 1;
+	printf("all reads and files match\n");
+	return 0;
+}
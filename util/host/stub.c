@@ -0,0 +1,239 @@
+/*
+ * stub.c - the device under the emulator core, for the PC builds of
+ *          util/host/build.sh
+ *
+ * Copyright (C) 2026 Atari800 development team (see DOC/CREDITS)
+ *
+ * This file is part of the Atari800 emulator project which emulates
+ * the Atari 400, 800, 800XL, 130XE, and 5200 8-bit computers.
+ *
+ * Atari800 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Atari800 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Atari800; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/* The SD card is a RAM disk, PSRAM is an array, and the display keeps
+   only the palette.  The host_* variables let the tests count accesses,
+   slow the card down or make it fail. */
+
+#include <malloc.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "ff.h"
+#include "diskio.h"
+
+/* PSRAM: 8 MB unless a test sets PSRAM_SIZE to another chip (up to
+   16 MB) before it starts the emulator, counting calls, bytes and SPI
+   transfers, and accesses past the end of the chip, which on the device
+   would wrap around to its start.  A transfer carries at most 64 bytes
+   and does not cross a multiple of 64, as drivers/psram/psram_spi.c
+   does. */
+#define HOST_PSRAM_MAX (16 << 20)
+#define PSRAM_CHUNK 64
+
+bool PSRAM_AVAILABLE;
+uint32_t PSRAM_SIZE = 8 << 20;
+uint8_t host_psram[HOST_PSRAM_MAX];
+unsigned long host_psram_ops;
+unsigned long host_psram_wr, host_psram_rd;
+unsigned long host_psram_wtx, host_psram_rtx;
+unsigned long host_psram_outside;
+
+static void Check(uint32_t addr, size_t len)
+{
+	host_psram_ops++;
+	if (addr + len > PSRAM_SIZE)
+		host_psram_outside++;
+}
+
+static unsigned long Transfers(uint32_t addr, size_t len)
+{
+	unsigned long n = 0;
+	while (len > 0) {
+		size_t chunk = PSRAM_CHUNK - (addr & (PSRAM_CHUNK - 1));
+		if (chunk > len)
+			chunk = len;
+		addr += chunk;
+		len -= chunk;
+		n++;
+	}
+	return n;
+}
+
+void init_psram(void) {}
+void psram_cleanup(void) {}
+
+void write8psram(uint32_t addr32, uint8_t v)
+{
+	Check(addr32, 1);
+	host_psram[addr32 % HOST_PSRAM_MAX] = v;
+}
+
+void write16psram(uint32_t addr32, uint16_t v)
+{
+	Check(addr32, 2);
+	memcpy(host_psram + addr32, &v, 2);
+}
+
+uint8_t read8psram(uint32_t addr32)
+{
+	Check(addr32, 1);
+	return host_psram[addr32 % HOST_PSRAM_MAX];
+}
+
+uint16_t read16psram(uint32_t addr32)
+{
+	uint16_t v;
+	Check(addr32, 2);
+	memcpy(&v, host_psram + addr32, 2);
+	return v;
+}
+
+void writepsram(uint32_t addr32, const uint8_t *src, size_t len)
+{
+	Check(addr32, len);
+	host_psram_wr += len;
+	host_psram_wtx += Transfers(addr32, len);
+	memcpy(host_psram + addr32, src, len);
+}
+
+void readpsram(uint32_t addr32, uint8_t *dst, size_t len)
+{
+	Check(addr32, len);
+	host_psram_rd += len;
+	host_psram_rtx += Transfers(addr32, len);
+	memcpy(dst, host_psram + addr32, len);
+}
+
+/* Display: the palette only. */
+uint32_t host_palette[256];
+
+void graphics_set_palette(uint8_t i, uint32_t color)
+{
+	host_palette[i] = color;
+}
+
+int Colours_GetR(int i) { return (host_palette[i] >> 16) & 0xff; }
+int Colours_GetG(int i) { return (host_palette[i] >> 8) & 0xff; }
+int Colours_GetB(int i) { return host_palette[i] & 0xff; }
+
+/* Sound: dropped. */
+unsigned char *LIBATARI800_Sound_array = NULL;
+
+void PLATFORM_SoundWrite(unsigned char const *buffer, unsigned int size) {}
+
+/* SD card: a RAM disk of HOST_DISK_MB, 64 MB unless the test is built
+   with another.  Every call waits host_disk_call_us (or
+   host_disk_write_us for writes) plus host_disk_sector_us per sector;
+   reads fail while host_disk_fail is set. */
+#ifndef HOST_DISK_MB
+#define HOST_DISK_MB 64
+#endif
+#define DISK_SECTORS (HOST_DISK_MB * 2048)
+
+uint8_t host_disk[DISK_SECTORS * 512];
+unsigned long host_disk_reads, host_disk_writes;
+unsigned long host_disk_read_calls, host_disk_write_calls;
+unsigned host_disk_call_us, host_disk_write_us, host_disk_sector_us;
+int host_disk_fail;
+
+DSTATUS disk_initialize(BYTE pdrv)
+{
+	return 0;
+}
+
+DSTATUS disk_status(BYTE pdrv)
+{
+	return 0;
+}
+
+DRESULT disk_read(BYTE pdrv, BYTE *buff, LBA_t sector, UINT count)
+{
+	if (host_disk_fail)
+		return RES_ERROR;
+	if (host_disk_call_us + count * host_disk_sector_us > 0)
+		usleep(host_disk_call_us + count * host_disk_sector_us);
+	host_disk_read_calls++;
+	host_disk_reads += count;
+	memcpy(buff, host_disk + sector * 512, count * 512);
+	return RES_OK;
+}
+
+DRESULT disk_write(BYTE pdrv, const BYTE *buff, LBA_t sector, UINT count)
+{
+	if (host_disk_write_us + count * host_disk_sector_us > 0)
+		usleep(host_disk_write_us + count * host_disk_sector_us);
+	host_disk_write_calls++;
+	host_disk_writes += count;
+	memcpy(host_disk + sector * 512, buff, count * 512);
+	return RES_OK;
+}
+
+DRESULT disk_ioctl(BYTE pdrv, BYTE cmd, void *buff)
+{
+	switch (cmd) {
+	case GET_SECTOR_COUNT:
+		*(LBA_t *) buff = DISK_SECTORS;
+		break;
+	case GET_SECTOR_SIZE:
+		*(WORD *) buff = 512;
+		break;
+	case GET_BLOCK_SIZE:
+		*(DWORD *) buff = 1;
+		break;
+	}
+	return RES_OK;
+}
+
+/* Mutexes: FatFs has one volume, whose lock is taken by the emulator and
+   by the worker threads of the tests. */
+static pthread_mutex_t host_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+void mutex_init(mutex_t *mtx) {}
+
+bool mutex_enter_timeout_ms(mutex_t *mtx, uint32_t timeout_ms)
+{
+	return pthread_mutex_lock(&host_mutex) == 0;
+}
+
+void mutex_exit(mutex_t *mtx)
+{
+	pthread_mutex_unlock(&host_mutex);
+}
+
+/* The file behind __stderr of ff.h, never opened. */
+FIL __nofil;
+
+DWORD get_fattime(void)
+{
+	return 0;
+}
+
+/* Heap: Util_HeapFree() measures the space between the top of the heap
+   and __StackLimit, which means nothing on the PC, so the stack limit is
+   put below the heap and mallinfo() reports host_heap_free bytes free,
+   by default more than the emulator needs. */
+char __StackLimit;
+size_t host_heap_free = 64 << 20;
+
+struct mallinfo host_mallinfo(void)
+{
+	struct mallinfo mi;
+	memset(&mi, 0, sizeof(mi));
+	mi.fordblks = mi.keepcost = host_heap_free;
+	return mi;
+}
@@ -0,0 +1,195 @@
+/*
+ * waits.c - checks the shortcuts of CPU_GO for VCOUNT and WSYNC waits
+ *
+ * Copyright (C) 2026 Atari800 development team (see DOC/CREDITS)
+ *
+ * This file is part of the Atari800 emulator project which emulates
+ * the Atari 400, 800, 800XL, 130XE, and 5200 8-bit computers.
+ *
+ * Atari800 is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Atari800 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Atari800; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/* Runs a program that polls VCOUNT with BNE, BCC, BCS, BPL, BMI and BEQ,
+   the last across a page boundary, and stores to WSYNC with STA, STX, STY
+   and a mirror, under the OS's VBI and a DLI that stores to WSYNC too.
+   After each wait it samples RANDOM, whose value depends on the exact
+   cycle, and VCOUNT.  Prints a hash of the registers and of memory after
+   every frame.  Built without FAST_WAITS, which turns off the shortcuts
+   of cpu.c, it gives the hash of the plain CPU; given that hash, the
+   normal build checks that it ends each frame the same, cycle for cycle,
+   and that it skipped VCOUNT waits:
+
+	util/host/build.sh -e 'cpu.c:/^#define FAST_WAITS$/d' util/host/waits.c && $WORK/test
+	util/host/build.sh util/host/waits.c && $WORK/test [hash [frames]]
+*/
+
+#include <stdlib.h>
+#include <time.h>
+
+#include "libatari800/libatari800.h"
+#include "antic.h"
+#include "cpu.h"
+#include "memory.h"
+#undef printf
+
+int printf(const char *format, ...);
+
+#define PROGRAM 0x3000
+#define DLI 0x3200
+#define SAMPLES 0x4000
+
+static UWORD pc;
+
+static void Byte(int b)
+{
+	MEMORY_dPutByte(pc, (UBYTE) b);
+	pc++;
+}
+
+static void Absolute(int op, UWORD addr)
+{
+	Byte(op);
+	Byte(addr & 0xff);
+	Byte(addr >> 8);
+}
+
+/* LDA VCOUNT, CMP #VALUE unless VALUE < 0, and BRANCH back to the LDA. */
+static void Wait(int value, int branch)
+{
+	UWORD top = pc;
+	Absolute(0xad, 0xd40b);
+	if (value >= 0) {
+		Byte(0xc9);
+		Byte(value);
+	}
+	Byte(branch);
+	Byte(top - (pc + 1));
+}
+
+/* LDA RANDOM, STA SAMPLES + N * 0x200,Y; LDA VCOUNT, STA SAMPLES + N * 0x200 + 0x100,Y */
+static void Sample(int n)
+{
+	Absolute(0xad, 0xd20a);
+	Absolute(0x99, SAMPLES + n * 0x200);
+	Absolute(0xad, 0xd40b);
+	Absolute(0x99, SAMPLES + n * 0x200 + 0x100);
+}
+
+static void Program(void)
+{
+	UWORD top;
+	UWORD dl = MEMORY_dGetWord(0x230);
+
+	pc = PROGRAM;
+	Byte(0xa0);				/* LDY #0 */
+	Byte(0);
+	top = pc;
+	Wait(0x40, 0xd0);			/* BNE: wait for VCOUNT $40 */
+	Sample(0);
+	Absolute(0x8d, 0xd40a);			/* STA WSYNC */
+	Absolute(0x8e, 0xd40a);			/* STX WSYNC */
+	Absolute(0x8c, 0xd41a);			/* STY WSYNC mirror */
+	Sample(1);
+	Wait(0x60, 0x90);			/* BCC: wait for VCOUNT >= $60 */
+	Sample(2);
+	Wait(0x10, 0xb0);			/* BCS: wait for VCOUNT < $10 */
+	Sample(3);
+	Wait(0x70, 0x10);			/* BPL: wait while VCOUNT >= $70 */
+	Sample(4);
+	Wait(-1, 0xd0);				/* BNE: wait for VCOUNT 0 */
+	Sample(5);
+	Absolute(0x4c, 0x30fc);			/* JMP */
+	pc = 0x30fc;
+	Wait(0x20, 0xf0);			/* BEQ across a page: wait while VCOUNT $20 */
+	Sample(6);
+	Wait(-1, 0x30);				/* BMI: never waits, VCOUNT < $80 */
+	Byte(0xc8);				/* INY */
+	Absolute(0x4c, top);			/* JMP */
+
+	/* the DLI samples and waits for the end of its line */
+	pc = DLI;
+	Byte(0x48);				/* PHA */
+	Absolute(0xad, 0xd20a);			/* LDA RANDOM */
+	Absolute(0x8d, SAMPLES + 0xe00);
+	Absolute(0x8d, 0xd40a);			/* STA WSYNC */
+	Absolute(0xad, 0xd40b);
+	Absolute(0x8d, SAMPLES + 0xe01);
+	Byte(0x68);				/* PLA */
+	Byte(0x40);				/* RTI */
+	MEMORY_dPutWord(0x200, DLI);
+	MEMORY_dPutByte(dl + 10, MEMORY_dGetByte(dl + 10) | 0x80);
+	MEMORY_dPutByte(dl + 20, MEMORY_dGetByte(dl + 20) | 0x80);
+	MEMORY_PutByte(0xd40e, 0xc0);		/* NMIEN */
+
+	CPU_regPC = PROGRAM;
+}
+
+static ULONG Hash(ULONG h)
+{
+	int i;
+	h = h * 31 + CPU_regA;
+	h = h * 31 + CPU_regX;
+	h = h * 31 + CPU_regY;
+	h = h * 31 + CPU_regS;
+	h = h * 31 + CPU_regPC;
+	for (i = 0; i < 0x10000; i++)
+		h = h * 31 + MEMORY_mem[i];
+	return h;
+}
+
+int main(int argc, char **argv)
+{
+	char *args[] = { "-atari", NULL };
+	input_template_t input;
+	struct timespec start, end;
+	double ms = 0;
+	ULONG hash = 0;
+	UBYTE last;
+	int frames = argc > 2 ? atoi(argv[2]) : 300;
+	int i;
+
+	libatari800_init(-1, args);
+	libatari800_clear_input_array(&input);
+	for (i = 0; i < 100; i++)
+		libatari800_next_frame(&input);
+	Program();
+
+	for (i = 0; i < frames; i++) {
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		libatari800_next_frame(&input);
+		clock_gettime(CLOCK_MONOTONIC, &end);
+		ms += (end.tv_sec - start.tv_sec) * 1e3 + (end.tv_nsec - start.tv_nsec) * 1e-6;
+		hash = Hash(hash);
+	}
+
+	last = (UBYTE) (CPU_regY - 1);
+	printf("%d frames, the last samples RANDOM %02x VCOUNT %02x after a wait, %02x %02x in the DLI\n", frames,
+	       MEMORY_dGetByte(SAMPLES + 6 * 0x200 + last), MEMORY_dGetByte(SAMPLES + 6 * 0x200 + 0x100 + last),
+	       MEMORY_dGetByte(SAMPLES + 0xe00), MEMORY_dGetByte(SAMPLES + 0xe01));
+	printf("%lu cycles of VCOUNT waits and %lu of idle loops skipped per frame, %.3f ms host per frame\n",
+	       (unsigned long) (CPU_vcount_skipped / frames), (unsigned long) (CPU_idle_skipped / frames), ms / frames);
+	printf("hash %08lx\n", (unsigned long) hash);
+	if (argc > 1) {
+		if (strtoul(argv[1], NULL, 16) != hash) {
+			printf("FAIL: the hash of the plain CPU is %s\n", argv[1]);
+			return 1;
+		}
+		if (CPU_vcount_skipped == 0) {
+			printf("FAIL: no VCOUNT wait skipped\n");
+			return 1;
+		}
+	}
+	return 0;
+}